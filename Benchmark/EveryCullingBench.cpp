@@ -0,0 +1,1456 @@
+// Headless benchmark of EveryCulling.
+//
+// Generates a synthetic scene ( N entities, M occluder meshes, K cameras ),
+// drives PreCullJob / ThreadCullJob / WaitToFinishCullJobOfAllCameras on a pool of worker threads
+// and reports per-stage timings and culled entity counts.
+//
+// Usage : everyculling_bench [--entities N] [--occluders M] [--cameras K] [--threads T]
+//                            [--frames F] [--warmup W] [--seed S] [--world SIZE]
+//                            [--width W] [--height H]
+//                            [--no-distance] [--no-frustum] [--no-occlusion] [--fused] [--multi-view] [--hierarchy]
+//                            [--shadow-cascades N] [--portal-cells N] [--pvs-cells N] [--pvs-samples S]
+//                            [--min-screen-size P] [--shadow-min-screen-size P] [--lods N] [--lod-hysteresis PERCENT]
+//                            [--occluder-subdivisions N] [--occluder-lods] [--adaptive-occlusion] [--occluded-entity-cost NS]
+//                            [--simd sse4.1|avx2|avx512] [--moving PERCENT]
+
+#include "EveryCulling.h"
+#include "DataType/EntityBlockViewer.h"
+#include "DataType/Math/Common.h"
+#include "CullingModule/PreCulling/PreCulling.h"
+#include "CullingModule/DistanceCulling/DistanceCulling.h"
+#include "CullingModule/ViewFrustumCulling/ViewFrustumCulling.h"
+#include "CullingModule/FusedCulling/FusedCulling.h"
+#include "CullingModule/MultiViewCulling/MultiViewCulling.h"
+#include "CullingModule/ShadowCasterCulling/ShadowCasterCulling.h"
+#include "CullingModule/PortalCulling/PortalCulling.h"
+#include "CullingModule/PVSCulling/PVSCulling.h"
+#include "CullingModule/PVSCulling/PVSBaker.h"
+#include "CullingModule/ScreenSpaceSizeCulling/ScreenSpaceSizeCulling.h"
+#include "CullingModule/HierarchyCulling/HierarchyCulling.h"
+#include "CullingModule/MaskedSWOcclusionCulling/MaskedSWOcclusionCulling.h"
+#include "CullingModule/VisibleEntityCompaction/VisibleEntityCompaction.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cctype>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	struct BenchOptions
+	{
+		std::uint32_t mEntityCount = 100000;
+		std::uint32_t mOccluderCount = 64;
+		std::uint32_t mCameraCount = 1;
+		std::uint32_t mThreadCount = EVERYCULLING_MAX(1u, std::thread::hardware_concurrency());
+		std::uint32_t mFrameCount = 100;
+		std::uint32_t mWarmupFrameCount = 10;
+		std::uint32_t mSeed = 1;
+		float mWorldSize = 4000.0f;
+		std::uint32_t mWidth = 640;
+		std::uint32_t mHeight = 360;
+
+		bool mEnableDistanceCulling = true;
+		bool mEnableViewFrustumCulling = true;
+		bool mEnableMaskedSWOcclusionCulling = true;
+		bool mEnableFusedCulling = false;
+		// test each entity block for every camera at once with ThreadMultiViewCullJob
+		bool mEnableMultiViewCulling = false;
+		bool mEnableHierarchyCulling = false;
+		// cascades of directional light shadow of camera 0, culled as extra cameras after player cameras
+		std::uint32_t mShadowCascadeCount = 0;
+		// split world to N x N cells connected by doorway portals. 0 : no cell
+		std::uint32_t mPortalCellCount = 0;
+		// bake PVS of static entities over N x N cells at startup and cull with it. 0 : no PVS
+		std::uint32_t mPVSCellCount = 0;
+		// PVS of each cell is baked at S ^ 3 sample points
+		std::uint32_t mPVSSamplePointCountPerAxis = 1;
+		// cull entities smaller than this in pixels of depth buffer. 0 : no screen space size culling
+		std::uint32_t mMinScreenSpaceSize = 0;
+		// min screen space size of shadow cascades. 0 : same with player cameras
+		std::uint32_t mShadowMinScreenSpaceSize = 0;
+		// LOD count of every entity. 1 : LOD isn't selected
+		std::uint32_t mLODCount = 1;
+		std::uint32_t mLODHysteresisPercentage = 0;
+		// each face of occluder cube mesh is split to N x N quads
+		std::uint32_t mOccluderSubdivisionCount = 1;
+		// plain cube is coarse LOD of subdivided occluder mesh
+		bool mEnableOccluderMeshLOD = false;
+		// skip or bound occlusion culling of each camera with measured cost
+		bool mEnableAdaptiveOcclusionCulling = false;
+		// render time saved by an occluded entity in nanoseconds. 0 : default of OcclusionCostModel
+		std::uint32_t mOccludedEntitySavedTime = 0;
+		bool mEnableTemporalCoherence = false;
+		// cameras don't rotate
+		bool mIsCameraStatic = false;
+		// percentage of entities moving every frame
+		std::uint32_t mMovingEntityPercentage = 0;
+		// repack entity blocks in morton order every this count of frames. 0 : never
+		std::uint32_t mRepackInterval = 0;
+		// update entity datas with EveryCulling::UpdateEntityDatas on worker threads
+		bool mIsBatchUpdate = false;
+		// percentage of entities removed and allocated again every frame
+		std::uint32_t mChurnEntityPercentage = 0;
+		// remove and allocate churned entities on worker threads
+		bool mIsParallelChurn = false;
+		// write indices of visible entities to compact list at end of cull job
+		bool mEnableVisibleEntityCompaction = false;
+		// defragment entity blocks every this count of frames. 0 : never
+		std::uint32_t mDefragmentInterval = 0;
+		// after measured frames, check fused culling and multi view culling return same visibility with separated culling modules
+		bool mCheckCullingPaths = false;
+		culling::EntityBlockArenaNumaPolicy mNumaPolicy = culling::EntityBlockArenaNumaPolicy::FirstTouch;
+		std::uint32_t mNumaNode = 0;
+
+		// empty : widest supported instruction set
+		std::string mSIMDInstructionSetName;
+	};
+
+	void PrintUsage()
+	{
+		std::printf
+		(
+			"usage : everyculling_bench [options]\n"
+			"  --entities N     entity count ( default 100000 )\n"
+			"  --occluders M    occluder mesh count, included in entity count ( default 64 )\n"
+			"  --cameras K      camera count ( default 1, max %d )\n"
+			"  --threads T      worker thread count ( default hardware concurrency )\n"
+			"  --frames F       measured frame count ( default 100 )\n"
+			"  --warmup W       warmup frame count ( default 10 )\n"
+			"  --seed S         scene random seed ( default 1 )\n"
+			"  --world SIZE     world extent on x, z axis ( default 4000 )\n"
+			"  --width W        depth buffer width, multiple of %d ( default 640 )\n"
+			"  --height H       depth buffer height, multiple of %d ( default 360 )\n"
+			"  --no-distance    disable distance culling\n"
+			"  --no-frustum     disable view frustum culling\n"
+			"  --no-occlusion   disable masked sw occlusion culling\n"
+			"  --fused          use fused pre / distance / view frustum culling module\n"
+			"  --multi-view     cull each entity block for every camera in one pass ( multi view cull job )\n"
+			"  --hierarchy      reject subtrees of bounding volume hierarchy over entity blocks first\n"
+			"  --shadow-cascades N  cull shadow casters of N directional light cascades of camera 0 as extra cameras ( default 0 )\n"
+			"  --portal-cells N cull entities in cells unreachable through doorway portals of N x N cell grid ( default 0 )\n"
+			"  --pvs-cells N    bake PVS of static entities over N x N cell grid at startup and cull with it ( default 0 )\n"
+			"  --pvs-samples S  bake PVS of each cell at S x S x S sample points ( default 1 )\n"
+			"  --min-screen-size P  cull entities whose screen space aabb is smaller than P pixels ( default 0 : off )\n"
+			"  --shadow-min-screen-size P  min screen space size of shadow cascades ( default 0 : same with cameras )\n"
+			"  --lods N         select LOD of N levels for every entity during PreCulling ( default 1 : off, max %d )\n"
+			"  --lod-hysteresis PERCENT  hysteresis of LOD screen space area thresholds ( default 0 )\n"
+			"  --occluder-subdivisions N  split each face of occluder cube mesh to N x N quads ( default 1 )\n"
+			"  --occluder-lods  rasterize plain cube as coarse LOD of small or far occluders\n"
+			"  --adaptive-occlusion  skip or bound occlusion culling of each camera with measured cost\n"
+			"  --occluded-entity-cost NS  render time saved by an occluded entity for adaptive occlusion ( default %.0f )\n"
+			"  --moving P       percentage of entities moving every frame ( default 0 )\n"
+			"  --temporal       reuse distance / view frustum culling result of last frame for unchanged entities\n"
+			"  --static-cameras cameras don't rotate\n"
+			"  --repack N       repack entity blocks in morton order after scene creation and every N frames ( default 0 : never )\n"
+			"  --batch-update   update entity datas with batch update api split across worker threads\n"
+			"  --churn P        percentage of entities removed and allocated again every frame ( default 0 )\n"
+			"  --parallel-churn remove and allocate churned entities on worker threads\n"
+			"  --defrag N       merge sparse entity blocks every N frames ( default 0 : never )\n"
+			"  --compact-visible  write indices of visible entities to compact list per camera and check it\n"
+			"  --check-culling-paths  check fused and multi view culling match separated modules for every distance / frustum enabled state\n"
+			"  --numa-interleave  spread memory of entity blocks over all NUMA nodes\n"
+			"  --numa-node N    place memory of entity blocks at NUMA node N\n"
+			"  --simd NAME      pin instruction set of entity culling and depth buffer kernels ( sse4.1, avx2, avx512 )\n",
+			EVERYCULLING_MAX_CAMERA_COUNT, EVERYCULLING_TILE_WIDTH, EVERYCULLING_TILE_HEIGHT, EVERYCULLING_MAX_LOD_COUNT, EVERYCULLING_DEFAULT_OCCLUDED_ENTITY_SAVED_TIME
+		);
+	}
+
+	bool ParseOptions(const int argc, char** const argv, BenchOptions& options)
+	{
+		for (int argIndex = 1; argIndex < argc; argIndex++)
+		{
+			const std::string arg{ argv[argIndex] };
+
+			const std::function<bool(std::uint32_t&)> readUInt = [&](std::uint32_t& outValue)
+			{
+				if (argIndex + 1 >= argc)
+				{
+					std::fprintf(stderr, "missing value for %s\n", arg.c_str());
+					return false;
+				}
+				outValue = static_cast<std::uint32_t>(std::strtoul(argv[++argIndex], nullptr, 10));
+				return true;
+			};
+
+			bool isSuccess = true;
+			if (arg == "--entities") isSuccess = readUInt(options.mEntityCount);
+			else if (arg == "--occluders") isSuccess = readUInt(options.mOccluderCount);
+			else if (arg == "--cameras") isSuccess = readUInt(options.mCameraCount);
+			else if (arg == "--threads") isSuccess = readUInt(options.mThreadCount);
+			else if (arg == "--frames") isSuccess = readUInt(options.mFrameCount);
+			else if (arg == "--warmup") isSuccess = readUInt(options.mWarmupFrameCount);
+			else if (arg == "--seed") isSuccess = readUInt(options.mSeed);
+			else if (arg == "--moving") isSuccess = readUInt(options.mMovingEntityPercentage);
+			else if (arg == "--repack") isSuccess = readUInt(options.mRepackInterval);
+			else if (arg == "--churn") isSuccess = readUInt(options.mChurnEntityPercentage);
+			else if (arg == "--defrag") isSuccess = readUInt(options.mDefragmentInterval);
+			else if (arg == "--shadow-cascades") isSuccess = readUInt(options.mShadowCascadeCount);
+			else if (arg == "--portal-cells") isSuccess = readUInt(options.mPortalCellCount);
+			else if (arg == "--pvs-cells") isSuccess = readUInt(options.mPVSCellCount);
+			else if (arg == "--pvs-samples") isSuccess = readUInt(options.mPVSSamplePointCountPerAxis);
+			else if (arg == "--min-screen-size") isSuccess = readUInt(options.mMinScreenSpaceSize);
+			else if (arg == "--shadow-min-screen-size") isSuccess = readUInt(options.mShadowMinScreenSpaceSize);
+			else if (arg == "--lods") isSuccess = readUInt(options.mLODCount);
+			else if (arg == "--lod-hysteresis") isSuccess = readUInt(options.mLODHysteresisPercentage);
+			else if (arg == "--occluder-subdivisions") isSuccess = readUInt(options.mOccluderSubdivisionCount);
+			else if (arg == "--occluded-entity-cost") isSuccess = readUInt(options.mOccludedEntitySavedTime);
+			else if (arg == "--width") isSuccess = readUInt(options.mWidth);
+			else if (arg == "--height") isSuccess = readUInt(options.mHeight);
+			else if (arg == "--world")
+			{
+				std::uint32_t worldSize;
+				isSuccess = readUInt(worldSize);
+				options.mWorldSize = static_cast<float>(worldSize);
+			}
+			else if (arg == "--no-distance") options.mEnableDistanceCulling = false;
+			else if (arg == "--no-frustum") options.mEnableViewFrustumCulling = false;
+			else if (arg == "--no-occlusion") options.mEnableMaskedSWOcclusionCulling = false;
+			else if (arg == "--fused") options.mEnableFusedCulling = true;
+			else if (arg == "--multi-view") options.mEnableMultiViewCulling = true;
+			else if (arg == "--hierarchy") options.mEnableHierarchyCulling = true;
+			else if (arg == "--temporal") options.mEnableTemporalCoherence = true;
+			else if (arg == "--static-cameras") options.mIsCameraStatic = true;
+			else if (arg == "--batch-update") options.mIsBatchUpdate = true;
+			else if (arg == "--parallel-churn") options.mIsParallelChurn = true;
+			else if (arg == "--compact-visible") options.mEnableVisibleEntityCompaction = true;
+			else if (arg == "--check-culling-paths") options.mCheckCullingPaths = true;
+			else if (arg == "--occluder-lods") options.mEnableOccluderMeshLOD = true;
+			else if (arg == "--adaptive-occlusion") options.mEnableAdaptiveOcclusionCulling = true;
+			else if (arg == "--numa-interleave") options.mNumaPolicy = culling::EntityBlockArenaNumaPolicy::Interleave;
+			else if (arg == "--numa-node")
+			{
+				isSuccess = readUInt(options.mNumaNode);
+				options.mNumaPolicy = culling::EntityBlockArenaNumaPolicy::Bind;
+			}
+			else if (arg == "--simd")
+			{
+				if (argIndex + 1 >= argc)
+				{
+					std::fprintf(stderr, "missing value for %s\n", arg.c_str());
+					return false;
+				}
+				options.mSIMDInstructionSetName = argv[++argIndex];
+				for (char& c : options.mSIMDInstructionSetName)
+				{
+					c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+				}
+			}
+			else
+			{
+				if (arg != "--help" && arg != "-h")
+				{
+					std::fprintf(stderr, "unknown option : %s\n", arg.c_str());
+				}
+				return false;
+			}
+
+			if (isSuccess == false)
+			{
+				return false;
+			}
+		}
+
+		if (options.mCameraCount == 0 || options.mCameraCount + options.mShadowCascadeCount > EVERYCULLING_MAX_CAMERA_COUNT)
+		{
+			std::fprintf(stderr, "camera count ( with shadow cascades ) should be in [1, %d]\n", EVERYCULLING_MAX_CAMERA_COUNT);
+			return false;
+		}
+		if (options.mWidth == 0 || options.mWidth % EVERYCULLING_TILE_WIDTH != 0 || options.mHeight == 0 || options.mHeight % EVERYCULLING_TILE_HEIGHT != 0)
+		{
+			std::fprintf(stderr, "resolution should be multiple of %d x %d\n", EVERYCULLING_TILE_WIDTH, EVERYCULLING_TILE_HEIGHT);
+			return false;
+		}
+		options.mThreadCount = EVERYCULLING_MAX(1u, options.mThreadCount);
+		options.mOccluderCount = EVERYCULLING_MIN(options.mOccluderCount, options.mEntityCount);
+
+		return true;
+	}
+
+	// Math helpers ( column major, OpenGL clip space ) -------------------------------------------
+
+	culling::Vec3 Normalize(const culling::Vec3& vec)
+	{
+		const float magnitude = vec.magnitude();
+		return culling::Vec3{ vec.x / magnitude, vec.y / magnitude, vec.z / magnitude };
+	}
+
+	culling::Mat4x4 MakeIdentityMatrix()
+	{
+		culling::Mat4x4 matrix;
+		std::memset(&matrix, 0, sizeof(culling::Mat4x4));
+		matrix[0][0] = matrix[1][1] = matrix[2][2] = matrix[3][3] = 1.0f;
+		return matrix;
+	}
+
+	culling::Mat4x4 MakePerspectiveMatrix(const float fovInDegree, const float aspect, const float nearPlane, const float farPlane)
+	{
+		const float focalLength = 1.0f / std::tan(fovInDegree * culling::DEGREE_TO_RADIAN * 0.5f);
+
+		culling::Mat4x4 matrix;
+		std::memset(&matrix, 0, sizeof(culling::Mat4x4));
+		matrix[0][0] = focalLength / aspect;
+		matrix[1][1] = focalLength;
+		matrix[2][2] = (farPlane + nearPlane) / (nearPlane - farPlane);
+		matrix[2][3] = -1.0f;
+		matrix[3][2] = (2.0f * farPlane * nearPlane) / (nearPlane - farPlane);
+		return matrix;
+	}
+
+	culling::Mat4x4 MakeOrthographicMatrix(const float halfExtent, const float nearPlane, const float farPlane)
+	{
+		culling::Mat4x4 matrix = MakeIdentityMatrix();
+		matrix[0][0] = 1.0f / halfExtent;
+		matrix[1][1] = 1.0f / halfExtent;
+		matrix[2][2] = -2.0f / (farPlane - nearPlane);
+		matrix[3][2] = -(farPlane + nearPlane) / (farPlane - nearPlane);
+		return matrix;
+	}
+
+	culling::Mat4x4 MakeLookAtMatrix(const culling::Vec3& eye, const culling::Vec3& forward, const culling::Vec3& up)
+	{
+		const culling::Vec3 f = Normalize(forward);
+		const culling::Vec3 s = Normalize(culling::Cross(f, up));
+		const culling::Vec3 u = culling::Cross(s, f);
+
+		culling::Mat4x4 matrix = MakeIdentityMatrix();
+		matrix[0][0] = s.x;
+		matrix[1][0] = s.y;
+		matrix[2][0] = s.z;
+		matrix[0][1] = u.x;
+		matrix[1][1] = u.y;
+		matrix[2][1] = u.z;
+		matrix[0][2] = -f.x;
+		matrix[1][2] = -f.y;
+		matrix[2][2] = -f.z;
+		matrix[3][0] = -culling::Dot(s, eye);
+		matrix[3][1] = -culling::Dot(u, eye);
+		matrix[3][2] = culling::Dot(f, eye);
+		return matrix;
+	}
+
+	// Unit cube mesh used for occluders ----------------------------------------------------------
+
+	const culling::Vec3 CUBE_VERTICES[8] =
+	{
+		{ -1.0f, -1.0f, -1.0f }, { 1.0f, -1.0f, -1.0f }, { 1.0f, 1.0f, -1.0f }, { -1.0f, 1.0f, -1.0f },
+		{ -1.0f, -1.0f,  1.0f }, { 1.0f, -1.0f,  1.0f }, { 1.0f, 1.0f,  1.0f }, { -1.0f, 1.0f,  1.0f }
+	};
+
+	// counter clock wise when seen from outside
+	const std::uint32_t CUBE_INDICES[36] =
+	{
+		0, 2, 1, 0, 3, 2, // -z
+		4, 5, 6, 4, 6, 7, // +z
+		0, 1, 5, 0, 5, 4, // -y
+		3, 7, 6, 3, 6, 2, // +y
+		0, 4, 7, 0, 7, 3, // -x
+		1, 2, 6, 1, 6, 5  // +x
+	};
+
+	// Coarse LOD of occluder mesh is selected when its screen space aabb is smaller than this or it's farther than this
+	const float OCCLUDER_LOD_MAX_SCREEN_SPACE_AREA = 20000.0f;
+	const float OCCLUDER_LOD_MIN_DISTANCE_TO_CAMERA = 250.0f;
+
+	struct BenchOccluderMesh
+	{
+		std::vector<culling::Vec3> mVertices;
+		std::vector<std::uint32_t> mIndices;
+		std::vector<culling::OccluderMeshLOD> mCoarseMeshLODs;
+	};
+
+	/// <summary>
+	/// Unit cube whose faces are split to subdivisionCount x subdivisionCount quads. Plain cube is coarse LOD if enabled
+	/// </summary>
+	void CreateOccluderMesh(const BenchOptions& options, BenchOccluderMesh& outOccluderMesh)
+	{
+		const std::uint32_t subdivisionCount = EVERYCULLING_MAX(options.mOccluderSubdivisionCount, 1u);
+		if (subdivisionCount == 1)
+		{
+			outOccluderMesh.mVertices.assign(std::begin(CUBE_VERTICES), std::end(CUBE_VERTICES));
+			outOccluderMesh.mIndices.assign(std::begin(CUBE_INDICES), std::end(CUBE_INDICES));
+		}
+		else
+		{
+			for (std::uint32_t axisIndex = 0; axisIndex < 3; axisIndex++)
+			{
+				for (const float normalSign : { -1.0f, 1.0f })
+				{
+					// cross( u, v ) is outward normal, so triangles are counter clock wise when seen from outside
+					const std::uint32_t uAxisIndex = (normalSign > 0.0f) ? (axisIndex + 1) % 3 : (axisIndex + 2) % 3;
+					const std::uint32_t vAxisIndex = (normalSign > 0.0f) ? (axisIndex + 2) % 3 : (axisIndex + 1) % 3;
+					const std::uint32_t firstVertexIndex = static_cast<std::uint32_t>(outOccluderMesh.mVertices.size());
+
+					for (std::uint32_t vIndex = 0; vIndex <= subdivisionCount; vIndex++)
+					{
+						for (std::uint32_t uIndex = 0; uIndex <= subdivisionCount; uIndex++)
+						{
+							float vertex[3];
+							vertex[axisIndex] = normalSign;
+							vertex[uAxisIndex] = -1.0f + 2.0f * uIndex / subdivisionCount;
+							vertex[vAxisIndex] = -1.0f + 2.0f * vIndex / subdivisionCount;
+							outOccluderMesh.mVertices.push_back(culling::Vec3{ vertex[0], vertex[1], vertex[2] });
+						}
+					}
+
+					for (std::uint32_t vIndex = 0; vIndex < subdivisionCount; vIndex++)
+					{
+						for (std::uint32_t uIndex = 0; uIndex < subdivisionCount; uIndex++)
+						{
+							const std::uint32_t vertexIndex = firstVertexIndex + vIndex * (subdivisionCount + 1) + uIndex;
+							const std::uint32_t quadIndices[6] = { vertexIndex, vertexIndex + 1, vertexIndex + subdivisionCount + 2, vertexIndex, vertexIndex + subdivisionCount + 2, vertexIndex + subdivisionCount + 1 };
+							outOccluderMesh.mIndices.insert(outOccluderMesh.mIndices.end(), std::begin(quadIndices), std::end(quadIndices));
+						}
+					}
+				}
+			}
+		}
+
+		if (options.mEnableOccluderMeshLOD == true)
+		{
+			outOccluderMesh.mCoarseMeshLODs.push_back(culling::OccluderMeshLOD{ CUBE_VERTICES, CUBE_INDICES, 8, 36, OCCLUDER_LOD_MAX_SCREEN_SPACE_AREA, OCCLUDER_LOD_MIN_DISTANCE_TO_CAMERA });
+		}
+	}
+
+	// Scene --------------------------------------------------------------------------------------
+
+	struct BenchEntity
+	{
+		culling::EntityBlockViewer mEntityBlockViewer;
+		culling::Vec4 mWorldPosition;
+		culling::Vec4 mAABBMinWorldPoint;
+		culling::Vec4 mAABBMaxWorldPoint;
+		bool mIsMoving;
+		bool mIsOccluder;
+		float mDesiredMaxDrawDistance;
+		std::uint32_t mCellIndex;
+		std::uint32_t mPVSIndex;
+		std::uint32_t mLODCount;
+		culling::Mat4x4 mModelMatrix;
+	};
+
+	struct BenchCamera
+	{
+		culling::Vec3 mWorldPosition;
+		float mYaw;
+		float mYawSpeed;
+	};
+
+	struct BenchScene
+	{
+		std::vector<BenchEntity> mEntities;
+		std::vector<BenchCamera> mCameras;
+		BenchOccluderMesh mOccluderMesh;
+	};
+
+	// Min screen space aabb area of LOD 0, 1, ... ( pixels of depth buffer )
+	const float LOD_SCREEN_SPACE_AREAS[] = { 4096.0f, 1024.0f, 256.0f, 64.0f, 16.0f, 4.0f, 1.0f };
+	const std::uint32_t MAX_BENCH_LOD_COUNT = EVERYCULLING_MIN(static_cast<std::uint32_t>(sizeof(LOD_SCREEN_SPACE_AREAS) / sizeof(float)) + 1, static_cast<std::uint32_t>(EVERYCULLING_MAX_LOD_COUNT));
+
+	/// <summary>
+	/// entityChangeLock should be kept until viewer of the entity is stored and its data is set
+	/// </summary>
+	void AllocateEntity(culling::EveryCulling& everyCulling, const culling::EveryCulling::EntityChangeLock& entityChangeLock, const BenchScene& scene, BenchEntity& entity, const std::uint32_t entityIndex)
+	{
+		entity.mEntityBlockViewer = everyCulling.AllocateNewEntity(entityChangeLock);
+		entity.mEntityBlockViewer.SetUserData(entityIndex);
+
+		if (entity.mIsOccluder == true)
+		{
+			const BenchOccluderMesh& occluderMesh = scene.mOccluderMesh;
+			entity.mEntityBlockViewer.SetMeshVertexData(occluderMesh.mVertices.data(), occluderMesh.mVertices.size(), occluderMesh.mIndices.data(), occluderMesh.mIndices.size(), sizeof(culling::Vec3));
+			entity.mEntityBlockViewer.SetOccluderMeshLODs(occluderMesh.mCoarseMeshLODs.data(), static_cast<std::uint32_t>(occluderMesh.mCoarseMeshLODs.size()));
+		}
+		entity.mEntityBlockViewer.SetDesiredMaxDrawDistance(entity.mDesiredMaxDrawDistance);
+		entity.mEntityBlockViewer.SetCellIndex(entity.mCellIndex);
+		entity.mEntityBlockViewer.SetPVSIndex(entity.mPVSIndex);
+		if (entity.mLODCount > 1)
+		{
+			entity.mEntityBlockViewer.SetLODScreenSpaceAreas(LOD_SCREEN_SPACE_AREAS, entity.mLODCount);
+		}
+
+		entity.mEntityBlockViewer.UpdateEntityData(entity.mWorldPosition.data(), entity.mAABBMinWorldPoint.data(), entity.mAABBMaxWorldPoint.data(), entity.mModelMatrix.data());
+	}
+
+	// Portal cells -------------------------------------------------------------------------------
+
+	// Doorway in each wall between neighbor cells
+	const float PORTAL_DOORWAY_WIDTH_RATIO = 0.2f;
+	const float PORTAL_DOORWAY_HEIGHT = 40.0f;
+	const float PORTAL_CELL_HEIGHT = 10000.0f;
+
+	std::uint32_t GetPortalCellIndex(const BenchOptions& options, const float x, const float z)
+	{
+		if (options.mPortalCellCount == 0)
+		{
+			return EVERYCULLING_INVALID_CELL_INDEX;
+		}
+
+		const float cellSize = options.mWorldSize / options.mPortalCellCount;
+		const float halfWorldSize = options.mWorldSize * 0.5f;
+		const std::int32_t maxCellCoordinate = static_cast<std::int32_t>(options.mPortalCellCount) - 1;
+		const std::int32_t cellX = EVERYCULLING_MIN(EVERYCULLING_MAX(static_cast<std::int32_t>(std::floor((x + halfWorldSize) / cellSize)), 0), maxCellCoordinate);
+		const std::int32_t cellZ = EVERYCULLING_MIN(EVERYCULLING_MAX(static_cast<std::int32_t>(std::floor((z + halfWorldSize) / cellSize)), 0), maxCellCoordinate);
+		return static_cast<std::uint32_t>(cellZ) * options.mPortalCellCount + static_cast<std::uint32_t>(cellX);
+	}
+
+	void CreatePortalCells(culling::EveryCulling& everyCulling, const BenchOptions& options)
+	{
+		const std::uint32_t gridSize = options.mPortalCellCount;
+		const float cellSize = options.mWorldSize / gridSize;
+		const float halfWorldSize = options.mWorldSize * 0.5f;
+		const float halfDoorwayWidth = cellSize * PORTAL_DOORWAY_WIDTH_RATIO * 0.5f;
+
+		std::vector<culling::PortalCell> cells(gridSize * gridSize);
+		std::vector<culling::Portal> portals;
+		for (std::uint32_t cellZ = 0; cellZ < gridSize; cellZ++)
+		{
+			for (std::uint32_t cellX = 0; cellX < gridSize; cellX++)
+			{
+				const std::uint32_t cellIndex = cellZ * gridSize + cellX;
+				const float minX = -halfWorldSize + cellX * cellSize;
+				const float minZ = -halfWorldSize + cellZ * cellSize;
+				cells[cellIndex].mAABBMinWorldPoint = culling::Vec3{ minX, -PORTAL_CELL_HEIGHT, minZ };
+				cells[cellIndex].mAABBMaxWorldPoint = culling::Vec3{ minX + cellSize, PORTAL_CELL_HEIGHT, minZ + cellSize };
+
+				// Doorway to +x neighbor
+				if (cellX + 1 < gridSize)
+				{
+					const float wallX = minX + cellSize;
+					const float centerZ = minZ + cellSize * 0.5f;
+					culling::Portal portal;
+					portal.mCellIndices[0] = cellIndex;
+					portal.mCellIndices[1] = cellIndex + 1;
+					portal.mVertices = { { wallX, 0.0f, centerZ - halfDoorwayWidth }, { wallX, 0.0f, centerZ + halfDoorwayWidth }, { wallX, PORTAL_DOORWAY_HEIGHT, centerZ + halfDoorwayWidth }, { wallX, PORTAL_DOORWAY_HEIGHT, centerZ - halfDoorwayWidth } };
+					portals.push_back(std::move(portal));
+				}
+				// Doorway to +z neighbor
+				if (cellZ + 1 < gridSize)
+				{
+					const float wallZ = minZ + cellSize;
+					const float centerX = minX + cellSize * 0.5f;
+					culling::Portal portal;
+					portal.mCellIndices[0] = cellIndex;
+					portal.mCellIndices[1] = cellIndex + gridSize;
+					portal.mVertices = { { centerX - halfDoorwayWidth, 0.0f, wallZ }, { centerX + halfDoorwayWidth, 0.0f, wallZ }, { centerX + halfDoorwayWidth, PORTAL_DOORWAY_HEIGHT, wallZ }, { centerX - halfDoorwayWidth, PORTAL_DOORWAY_HEIGHT, wallZ } };
+					portals.push_back(std::move(portal));
+				}
+			}
+		}
+
+		everyCulling.mPortalCulling->SetCellGraph(std::move(cells), std::move(portals));
+		everyCulling.SetEnabledCullingModule(culling::EveryCulling::CullingModuleType::PortalCulling, true);
+	}
+
+	// PVS ---------------------------------------------------------------------------------------
+
+	const char* const PVS_BAKE_FILE_PATH = "everyculling_bench.pvs";
+	// Cells cover height of cameras
+	const float PVS_CELL_HEIGHT = 20.0f;
+
+	// Bake PVS of static entities, write it to file and map it
+	bool BakePVS(culling::EveryCulling& everyCulling, const BenchOptions& options, double& outBakeElapsedTime, size_t& outCompressedBitsetSize)
+	{
+		const float cellSize = options.mWorldSize / options.mPVSCellCount;
+		const float halfWorldSize = options.mWorldSize * 0.5f;
+
+		culling::PVSBakeSettings bakeSettings;
+		bakeSettings.mGrid.mMinWorldPoint = culling::Vec3{ -halfWorldSize, 0.0f, -halfWorldSize };
+		bakeSettings.mGrid.mCellSize = culling::Vec3{ cellSize, PVS_CELL_HEIGHT, cellSize };
+		bakeSettings.mGrid.mCellCounts[0] = options.mPVSCellCount;
+		bakeSettings.mGrid.mCellCounts[1] = 1;
+		bakeSettings.mGrid.mCellCounts[2] = options.mPVSCellCount;
+		bakeSettings.mEntityCount = options.mEntityCount;
+		bakeSettings.mSamplePointCountPerAxis = options.mPVSSamplePointCountPerAxis;
+		bakeSettings.mNearClipPlaneDistance = 0.1f;
+		bakeSettings.mFarClipPlaneDistance = 3000.0f;
+		bakeSettings.mThreadCount = options.mThreadCount;
+
+		const std::chrono::steady_clock::time_point bakeStartTime = std::chrono::steady_clock::now();
+		culling::PVSBaker pvsBaker{ everyCulling };
+		pvsBaker.Bake(bakeSettings);
+		outBakeElapsedTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - bakeStartTime).count();
+		outCompressedBitsetSize = pvsBaker.GetCompressedBitsetSize();
+
+		if (pvsBaker.WriteBakeFile(PVS_BAKE_FILE_PATH) == false || everyCulling.mPVSCulling->LoadBakeFile(PVS_BAKE_FILE_PATH) == false)
+		{
+			return false;
+		}
+		everyCulling.SetEnabledCullingModule(culling::EveryCulling::CullingModuleType::PVSCulling, true);
+		return true;
+	}
+
+	void CreateScene(culling::EveryCulling& everyCulling, const BenchOptions& options, BenchScene& scene)
+	{
+		std::mt19937 randomEngine{ options.mSeed };
+		const float halfWorldSize = options.mWorldSize * 0.5f;
+		std::uniform_real_distribution<float> worldPositionDistribution{ -halfWorldSize, halfWorldSize };
+		std::uniform_real_distribution<float> propExtentDistribution{ 0.5f, 4.0f };
+		std::uniform_real_distribution<float> occluderExtentDistribution{ 20.0f, 60.0f };
+		std::uniform_real_distribution<float> unitDistribution{ 0.0f, 1.0f };
+
+		CreateOccluderMesh(options, scene.mOccluderMesh);
+
+		scene.mEntities.resize(options.mEntityCount);
+		culling::EveryCulling::EntityChangeLock entityChangeLock = everyCulling.LockEntityChanges();
+		for (std::uint32_t entityIndex = 0; entityIndex < options.mEntityCount; entityIndex++)
+		{
+			BenchEntity& entity = scene.mEntities[entityIndex];
+			const bool isOccluder = entityIndex < options.mOccluderCount;
+
+			culling::Vec3 extent;
+			if (isOccluder == true)
+			{
+				extent = culling::Vec3{ occluderExtentDistribution(randomEngine), occluderExtentDistribution(randomEngine), occluderExtentDistribution(randomEngine) };
+			}
+			else
+			{
+				const float propExtent = propExtentDistribution(randomEngine);
+				extent = culling::Vec3{ propExtent, propExtent, propExtent };
+			}
+
+			const culling::Vec3 position{ worldPositionDistribution(randomEngine), extent.y, worldPositionDistribution(randomEngine) };
+
+			entity.mWorldPosition = culling::Vec4{ position.x, position.y, position.z, 1.0f };
+			entity.mAABBMinWorldPoint = culling::Vec4{ position.x - extent.x, position.y - extent.y, position.z - extent.z, 1.0f };
+			entity.mAABBMaxWorldPoint = culling::Vec4{ position.x + extent.x, position.y + extent.y, position.z + extent.z, 1.0f };
+
+			entity.mModelMatrix = MakeIdentityMatrix();
+			entity.mModelMatrix[0][0] = extent.x;
+			entity.mModelMatrix[1][1] = extent.y;
+			entity.mModelMatrix[2][2] = extent.z;
+			entity.mModelMatrix[3][0] = position.x;
+			entity.mModelMatrix[3][1] = position.y;
+			entity.mModelMatrix[3][2] = position.z;
+
+			entity.mIsMoving = (isOccluder == false) && (entityIndex % 100 < options.mMovingEntityPercentage);
+			entity.mIsOccluder = isOccluder;
+			// small props fade out earlier
+			entity.mDesiredMaxDrawDistance = (isOccluder == true) ? EVERYCULLING_DEFAULT_DESIRED_MAX_DRAW_DISTANCE : 200.0f + 150.0f * extent.x * unitDistribution(randomEngine);
+			entity.mCellIndex = GetPortalCellIndex(options, position.x, position.z);
+			// moving entities aren't baked to PVS
+			entity.mPVSIndex = (entity.mIsMoving == false) ? entityIndex : EVERYCULLING_INVALID_PVS_INDEX;
+			entity.mLODCount = EVERYCULLING_MIN(EVERYCULLING_MAX(options.mLODCount, 1u), MAX_BENCH_LOD_COUNT);
+
+			AllocateEntity(everyCulling, entityChangeLock, scene, entity, entityIndex);
+		}
+		entityChangeLock.unlock();
+		// Add entity blocks of allocated entities to active entity block list now
+		everyCulling.ApplyDeferredEntityChanges();
+
+		if (options.mRepackInterval != 0)
+		{
+			everyCulling.RepackEntityBlocks();
+			everyCulling.SetEntityBlockRepackInterval(options.mRepackInterval);
+		}
+		everyCulling.SetEntityBlockDefragmentInterval(options.mDefragmentInterval);
+
+		scene.mCameras.resize(options.mCameraCount);
+		for (BenchCamera& camera : scene.mCameras)
+		{
+			camera.mWorldPosition = culling::Vec3{ worldPositionDistribution(randomEngine) * 0.5f, 10.0f, worldPositionDistribution(randomEngine) * 0.5f };
+			camera.mYaw = unitDistribution(randomEngine) * 360.0f;
+			camera.mYawSpeed = 0.5f + unitDistribution(randomEngine);
+		}
+	}
+
+	const culling::Vec3 SHADOW_LIGHT_DIRECTION{ 0.36f, -0.9f, 0.24f };
+	const float SHADOW_LIGHT_DISTANCE = 4000.0f;
+	const float SHADOW_CASCADE_RADIUS = 50.0f;
+
+	void UpdateCameras(culling::EveryCulling& everyCulling, const BenchOptions& options, BenchScene& scene)
+	{
+		const float aspect = static_cast<float>(options.mWidth) / static_cast<float>(options.mHeight);
+		const culling::Mat4x4 projectionMatrix = MakePerspectiveMatrix(60.0f, aspect, 0.1f, 3000.0f);
+
+		for (size_t cameraIndex = 0; cameraIndex < scene.mCameras.size(); cameraIndex++)
+		{
+			BenchCamera& camera = scene.mCameras[cameraIndex];
+			if (options.mIsCameraStatic == false)
+			{
+				camera.mYaw += camera.mYawSpeed;
+			}
+
+			const float yawInRadian = camera.mYaw * culling::DEGREE_TO_RADIAN;
+			const culling::Vec3 forward{ std::cos(yawInRadian), -0.05f, std::sin(yawInRadian) };
+			const culling::Mat4x4 viewMatrix = MakeLookAtMatrix(camera.mWorldPosition, forward, culling::Vec3{ 0.0f, 1.0f, 0.0f });
+
+			culling::EveryCulling::GlobalDataForCullJob globalData;
+			globalData.mViewProjectionMatrix = projectionMatrix * viewMatrix;
+			globalData.mFieldOfViewInDegree = 60.0f;
+			globalData.mCameraNearPlaneDistance = 0.1f;
+			globalData.mCameraFarPlaneDistance = 3000.0f;
+			globalData.mCameraWorldPosition = camera.mWorldPosition;
+			globalData.mCameraRotation = culling::Vec4{ 0.0f, std::sin(yawInRadian * 0.5f), 0.0f, std::cos(yawInRadian * 0.5f) };
+
+			everyCulling.UpdateGlobalDataForCullJob(cameraIndex, globalData);
+		}
+
+		// Cascade i covers sphere of radius SHADOW_CASCADE_RADIUS * 4^i in front of camera 0
+		const BenchCamera& receiverCamera = scene.mCameras[0];
+		const float receiverYawInRadian = receiverCamera.mYaw * culling::DEGREE_TO_RADIAN;
+		const culling::Vec3 receiverForward{ std::cos(receiverYawInRadian), 0.0f, std::sin(receiverYawInRadian) };
+		float cascadeRadius = SHADOW_CASCADE_RADIUS;
+		for (std::uint32_t cascadeIndex = 0; cascadeIndex < options.mShadowCascadeCount; cascadeIndex++)
+		{
+			const culling::Vec3 cascadeCenter{ receiverCamera.mWorldPosition.x + receiverForward.x * cascadeRadius, 0.0f, receiverCamera.mWorldPosition.z + receiverForward.z * cascadeRadius };
+			const culling::Vec3 lightEye{ cascadeCenter.x - SHADOW_LIGHT_DIRECTION.x * SHADOW_LIGHT_DISTANCE, cascadeCenter.y - SHADOW_LIGHT_DIRECTION.y * SHADOW_LIGHT_DISTANCE, cascadeCenter.z - SHADOW_LIGHT_DIRECTION.z * SHADOW_LIGHT_DISTANCE };
+			const culling::Mat4x4 lightViewMatrix = MakeLookAtMatrix(lightEye, SHADOW_LIGHT_DIRECTION, culling::Vec3{ 0.0f, 0.0f, 1.0f });
+
+			culling::EveryCulling::GlobalDataForCullJob globalData;
+			globalData.mViewProjectionMatrix = MakeOrthographicMatrix(cascadeRadius, 0.1f, 2.0f * SHADOW_LIGHT_DISTANCE) * lightViewMatrix;
+			globalData.mFieldOfViewInDegree = 60.0f;
+			globalData.mCameraNearPlaneDistance = 0.1f;
+			globalData.mCameraFarPlaneDistance = 2.0f * SHADOW_LIGHT_DISTANCE;
+			// distance culling of casters is relative to the player
+			globalData.mCameraWorldPosition = receiverCamera.mWorldPosition;
+			globalData.mCameraRotation = culling::Vec4{ 0.0f, 0.0f, 0.0f, 1.0f };
+
+			everyCulling.UpdateGlobalDataForCullJob(options.mCameraCount + cascadeIndex, globalData);
+			cascadeRadius *= 4.0f;
+		}
+	}
+
+	void UpdateEntities(BenchScene& scene, const std::uint32_t frameIndex, const bool isBatchUpdate)
+	{
+		// moving entities go back and forth along x axis
+		const float movedDistance = (frameIndex % 2 == 0) ? 1.0f : -1.0f;
+
+		for (BenchEntity& entity : scene.mEntities)
+		{
+			if (entity.mIsMoving == true)
+			{
+				entity.mWorldPosition[0] += movedDistance;
+				entity.mAABBMinWorldPoint[0] += movedDistance;
+				entity.mAABBMaxWorldPoint[0] += movedDistance;
+				entity.mModelMatrix[3][0] += movedDistance;
+			}
+
+			if (isBatchUpdate == true)
+			{
+				// updated at UpdateEntitiesWithBatch
+				continue;
+			}
+
+			entity.mEntityBlockViewer.UpdateEntityData
+			(
+				entity.mWorldPosition.data(),
+				entity.mAABBMinWorldPoint.data(),
+				entity.mAABBMaxWorldPoint.data(),
+				entity.mModelMatrix.data()
+			);
+		}
+	}
+
+	// Worker threads -----------------------------------------------------------------------------
+
+	/// <summary>
+	/// Persistent worker threads.
+	/// Every worker runs cull job of every camera once per frame like a job system would do.
+	/// </summary>
+	class BenchWorkerPool
+	{
+	private:
+
+		std::vector<std::thread> mThreads;
+		std::mutex mMutex;
+		std::condition_variable mConditionVariable;
+		std::uint64_t mDispatchedFrame = 0;
+		std::atomic<std::uint32_t> mFinishedWorkerCount{ 0 };
+		bool mIsTerminated = false;
+		std::function<void()> mJob;
+
+		void WorkerLoop()
+		{
+			std::uint64_t executedFrame = 0;
+			while (true)
+			{
+				std::function<void()> job;
+				{
+					std::unique_lock<std::mutex> lock{ mMutex };
+					mConditionVariable.wait(lock, [&]() { return mIsTerminated == true || mDispatchedFrame != executedFrame; });
+					if (mIsTerminated == true)
+					{
+						return;
+					}
+					executedFrame = mDispatchedFrame;
+					job = mJob;
+				}
+
+				job();
+				mFinishedWorkerCount.fetch_add(1, std::memory_order_release);
+			}
+		}
+
+	public:
+
+		explicit BenchWorkerPool(const std::uint32_t threadCount)
+		{
+			for (std::uint32_t threadIndex = 0; threadIndex < threadCount; threadIndex++)
+			{
+				mThreads.emplace_back(&BenchWorkerPool::WorkerLoop, this);
+			}
+		}
+
+		~BenchWorkerPool()
+		{
+			{
+				std::lock_guard<std::mutex> lock{ mMutex };
+				mIsTerminated = true;
+			}
+			mConditionVariable.notify_all();
+			for (std::thread& thread : mThreads)
+			{
+				thread.join();
+			}
+		}
+
+		void Dispatch(std::function<void()> job)
+		{
+			{
+				std::lock_guard<std::mutex> lock{ mMutex };
+				mJob = std::move(job);
+				mFinishedWorkerCount.store(0, std::memory_order_relaxed);
+				mDispatchedFrame++;
+			}
+			mConditionVariable.notify_all();
+		}
+
+		void WaitIdle() const
+		{
+			while (mFinishedWorkerCount.load(std::memory_order_acquire) < mThreads.size())
+			{
+				std::this_thread::yield();
+			}
+		}
+	};
+
+	/// <summary>
+	/// Update entity datas with EveryCulling::UpdateEntityDatas.
+	/// BenchEntity array is passed as strided arrays and workers pop ranges of it
+	/// </summary>
+	void UpdateEntitiesWithBatch(culling::EveryCulling& everyCulling, BenchScene& scene, BenchWorkerPool& workerPool)
+	{
+		if (scene.mEntities.empty() == true)
+		{
+			return;
+		}
+
+		const BenchEntity& firstEntity = scene.mEntities.front();
+		culling::EntityDataUpdateBatch batch;
+		batch.mEntityBlockViewers = { &(firstEntity.mEntityBlockViewer), sizeof(BenchEntity) };
+		batch.mWorldPositions = { firstEntity.mWorldPosition.data(), sizeof(BenchEntity) };
+		batch.mAABBMinWorldPoints = { firstEntity.mAABBMinWorldPoint.data(), sizeof(BenchEntity) };
+		batch.mAABBMaxWorldPoints = { firstEntity.mAABBMaxWorldPoint.data(), sizeof(BenchEntity) };
+		batch.mModelMatrixes = { firstEntity.mModelMatrix.data(), sizeof(BenchEntity) };
+		batch.mEntityCount = scene.mEntities.size();
+
+		// multiple of entity count in a entity block, so ranges of workers rarely share a entity block
+		constexpr size_t ENTITY_COUNT_PER_RANGE = 64 * EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK;
+		std::atomic<size_t> nextEntityIndex{ 0 };
+
+		workerPool.Dispatch
+		(
+			[&everyCulling, &batch, &nextEntityIndex]()
+			{
+				while (true)
+				{
+					const size_t beginEntityIndex = nextEntityIndex.fetch_add(ENTITY_COUNT_PER_RANGE, std::memory_order_relaxed);
+					if (beginEntityIndex >= batch.mEntityCount)
+					{
+						break;
+					}
+					everyCulling.UpdateEntityDatas(batch, beginEntityIndex, EVERYCULLING_MIN(beginEntityIndex + ENTITY_COUNT_PER_RANGE, batch.mEntityCount));
+				}
+			}
+		);
+		workerPool.WaitIdle();
+	}
+
+	/// <summary>
+	/// Remove some entities and allocate them again with same data.
+	/// Removed entities leave holes filled by other entities and re-allocated entities are appended to last entity block,
+	/// so visibility should be same with the scene without churn.
+	/// If isParallel is true, workers pop ranges of entities and remove, allocate them at same time like streaming threads would do
+	/// </summary>
+	void ChurnEntities(culling::EveryCulling& everyCulling, BenchScene& scene, BenchWorkerPool& workerPool, const std::uint32_t frameIndex, const std::uint32_t churnEntityPercentage, const bool isParallel)
+	{
+		if (churnEntityPercentage == 0)
+		{
+			return;
+		}
+
+		const size_t entityCount = scene.mEntities.size();
+		const std::function<bool(size_t)> isChurned = [&](const size_t entityIndex)
+		{
+			return (entityIndex * 7 + frameIndex * 13) % 100 < churnEntityPercentage;
+		};
+
+		if (isParallel == true)
+		{
+			constexpr size_t ENTITY_COUNT_PER_RANGE = 1024;
+			std::atomic<size_t> nextEntityIndex{ 0 };
+
+			workerPool.Dispatch
+			(
+				[&everyCulling, &scene, &isChurned, &nextEntityIndex, entityCount]()
+				{
+					while (true)
+					{
+						const size_t beginEntityIndex = nextEntityIndex.fetch_add(ENTITY_COUNT_PER_RANGE, std::memory_order_relaxed);
+						if (beginEntityIndex >= entityCount)
+						{
+							break;
+						}
+
+						const size_t endEntityIndex = EVERYCULLING_MIN(beginEntityIndex + ENTITY_COUNT_PER_RANGE, entityCount);
+						const culling::EveryCulling::EntityChangeLock entityChangeLock = everyCulling.LockEntityChanges();
+						for (size_t entityIndex = beginEntityIndex; entityIndex < endEntityIndex; entityIndex++)
+						{
+							if (isChurned(entityIndex) == true)
+							{
+								everyCulling.RemoveEntityFromBlock(scene.mEntities[entityIndex].mEntityBlockViewer, entityChangeLock);
+								AllocateEntity(everyCulling, entityChangeLock, scene, scene.mEntities[entityIndex], entityIndex);
+							}
+						}
+					}
+				}
+			);
+			workerPool.WaitIdle();
+			return;
+		}
+
+		const culling::EveryCulling::EntityChangeLock entityChangeLock = everyCulling.LockEntityChanges();
+		for (size_t entityIndex = 0; entityIndex < entityCount; entityIndex++)
+		{
+			if (isChurned(entityIndex) == true)
+			{
+				everyCulling.RemoveEntityFromBlock(scene.mEntities[entityIndex].mEntityBlockViewer, entityChangeLock);
+			}
+		}
+
+		for (size_t entityIndex = 0; entityIndex < entityCount; entityIndex++)
+		{
+			if (isChurned(entityIndex) == true)
+			{
+				AllocateEntity(everyCulling, entityChangeLock, scene, scene.mEntities[entityIndex], entityIndex);
+			}
+		}
+	}
+
+	// Cull job ---------------------------------------------------------------------------------------
+
+	/// <summary>
+	/// Run cull job of every camera on worker threads and wait for it
+	/// </summary>
+	void CullFrame(culling::EveryCulling& everyCulling, BenchWorkerPool& workerPool, const std::uint32_t cameraCount, const bool isMultiViewCull)
+	{
+		culling::EveryCulling* const everyCullingPtr = &everyCulling;
+		const unsigned long long tickCount = everyCulling.GetTickCount();
+		if (isMultiViewCull == true)
+		{
+			workerPool.Dispatch
+			(
+				[everyCullingPtr, tickCount]()
+				{
+					everyCullingPtr->ThreadMultiViewCullJob(tickCount);
+				}
+			);
+		}
+		else
+		{
+			workerPool.Dispatch
+			(
+				[everyCullingPtr, tickCount, cameraCount]()
+				{
+					for (std::uint32_t cameraIndex = 0; cameraIndex < cameraCount; cameraIndex++)
+					{
+						everyCullingPtr->ThreadCullJob(cameraIndex, tickCount);
+					}
+				}
+			);
+		}
+
+		everyCulling.WaitToFinishCullJobOfAllCameras();
+		workerPool.WaitIdle();
+	}
+
+	// Report -------------------------------------------------------------------------------------
+
+	std::uint64_t HashVisibility(const BenchScene& scene, const std::uint32_t cameraIndex, std::uint32_t& outVisibleCount)
+	{
+		// FNV-1a over visibility of every entity
+		std::uint64_t hash = 14695981039346656037ull;
+		outVisibleCount = 0;
+		for (const BenchEntity& entity : scene.mEntities)
+		{
+			const bool isVisible = entity.mEntityBlockViewer.GetIsCulled(cameraIndex) == false;
+			outVisibleCount += isVisible ? 1 : 0;
+			hash = (hash ^ (isVisible ? 1u : 0u)) * 1099511628211ull;
+		}
+		return hash;
+	}
+
+	/// <summary>
+	/// Count visible entities of each LOD selected for the camera
+	/// </summary>
+	std::vector<std::uint32_t> CountVisibleEntitiesOfLODs(const BenchScene& scene, const std::uint32_t cameraIndex, const std::uint32_t lodCount)
+	{
+		std::vector<std::uint32_t> visibleEntityCounts(lodCount, 0);
+		for (const BenchEntity& entity : scene.mEntities)
+		{
+			if (entity.mEntityBlockViewer.GetIsCulled(cameraIndex) == false)
+			{
+				visibleEntityCounts[entity.mEntityBlockViewer.GetLODIndex(cameraIndex)]++;
+			}
+		}
+		return visibleEntityCounts;
+	}
+
+	/// <summary>
+	/// Check compacted list of visible entities has every visible entity once
+	/// </summary>
+	bool CheckVisibleEntityCompaction(const culling::EveryCulling& everyCulling, const BenchScene& scene, const std::uint32_t cameraIndex, size_t& outCompactedVisibleCount)
+	{
+		std::vector<std::uint64_t> visibleEntityIndices;
+		everyCulling.mVisibleEntityCompaction->CopyVisibleEntities(cameraIndex, visibleEntityIndices);
+		outCompactedVisibleCount = visibleEntityIndices.size();
+
+		// order of compacted list isn't deterministic
+		std::sort(visibleEntityIndices.begin(), visibleEntityIndices.end());
+
+		size_t compactedIndex = 0;
+		for (std::uint32_t entityIndex = 0; entityIndex < scene.mEntities.size(); entityIndex++)
+		{
+			if (scene.mEntities[entityIndex].mEntityBlockViewer.GetIsCulled(cameraIndex) == false)
+			{
+				if (compactedIndex >= visibleEntityIndices.size() || visibleEntityIndices[compactedIndex] != entityIndex)
+				{
+					return false;
+				}
+				compactedIndex++;
+			}
+		}
+		return compactedIndex == visibleEntityIndices.size();
+	}
+
+	/// <summary>
+	/// Cull current scene for every enabled state of DistanceCulling, ViewFrustumCulling
+	/// with separated culling modules, FusedCulling and MultiViewCulling,
+	/// and check visibility hashes of FusedCulling and MultiViewCulling are same with separated culling modules.
+	/// Occlusion culling and temporal coherence are disabled while checking, as result of them depends on last frames.
+	/// Enabled state of culling modules is restored after checking
+	/// </summary>
+	bool CheckCullingPaths(culling::EveryCulling& everyCulling, const BenchScene& scene, BenchWorkerPool& workerPool, const std::uint32_t cameraCount)
+	{
+		using CullingModuleType = culling::EveryCulling::CullingModuleType;
+
+		const bool isDistanceCullingEnabled = everyCulling.mDistanceCulling->IsEnabled;
+		const bool isViewFrustumCullingEnabled = everyCulling.mViewFrustumCulling->IsEnabled;
+		const bool isMaskedSWOcclusionCullingEnabled = everyCulling.mMaskedSWOcclusionCulling->IsEnabled;
+		const bool isFusedCullingEnabled = everyCulling.mFusedCulling->IsEnabled;
+		const bool isMultiViewCullingEnabled = everyCulling.mMultiViewCulling->IsEnabled;
+		const bool isTemporalCoherenceEnabled = everyCulling.IsTemporalCoherenceEnabled();
+
+		everyCulling.SetEnabledCullingModule(CullingModuleType::MaskedSWOcclusionCulling, false);
+		everyCulling.SetTemporalCoherenceEnabled(false);
+
+		static const char* const CULLING_PATH_NAMES[3] = { "separated", "fused", "multi view" };
+
+		bool isAllMatched = true;
+		for (std::uint32_t enabledStateIndex = 0; enabledStateIndex < 4; enabledStateIndex++)
+		{
+			const bool isDistanceCullingEnabledInCheck = (enabledStateIndex & 1) != 0;
+			const bool isViewFrustumCullingEnabledInCheck = (enabledStateIndex & 2) != 0;
+			everyCulling.SetEnabledCullingModule(CullingModuleType::DistanceCulling, isDistanceCullingEnabledInCheck);
+			everyCulling.SetEnabledCullingModule(CullingModuleType::ViewFrustumCulling, isViewFrustumCullingEnabledInCheck);
+
+			std::vector<std::uint64_t> separatedVisibilityHashes(cameraCount, 0);
+			for (std::uint32_t cullingPathIndex = 0; cullingPathIndex < 3; cullingPathIndex++)
+			{
+				everyCulling.SetEnabledCullingModule(CullingModuleType::FusedCulling, cullingPathIndex == 1);
+				everyCulling.SetEnabledCullingModule(CullingModuleType::MultiViewCulling, cullingPathIndex == 2);
+
+				everyCulling.PreCullJob();
+				CullFrame(everyCulling, workerPool, cameraCount, cullingPathIndex == 2);
+
+				for (std::uint32_t cameraIndex = 0; cameraIndex < cameraCount; cameraIndex++)
+				{
+					std::uint32_t visibleCount;
+					const std::uint64_t visibilityHash = HashVisibility(scene, cameraIndex, visibleCount);
+					if (cullingPathIndex == 0)
+					{
+						separatedVisibilityHashes[cameraIndex] = visibilityHash;
+					}
+					else if (visibilityHash != separatedVisibilityHashes[cameraIndex])
+					{
+						std::printf
+						(
+							"  culling path MISMATCH : %s, distance %s, frustum %s, camera %u\n",
+							CULLING_PATH_NAMES[cullingPathIndex], isDistanceCullingEnabledInCheck ? "on" : "off", isViewFrustumCullingEnabledInCheck ? "on" : "off", cameraIndex
+						);
+						isAllMatched = false;
+					}
+				}
+			}
+		}
+
+		everyCulling.SetEnabledCullingModule(CullingModuleType::DistanceCulling, isDistanceCullingEnabled);
+		everyCulling.SetEnabledCullingModule(CullingModuleType::ViewFrustumCulling, isViewFrustumCullingEnabled);
+		everyCulling.SetEnabledCullingModule(CullingModuleType::MaskedSWOcclusionCulling, isMaskedSWOcclusionCullingEnabled);
+		everyCulling.SetEnabledCullingModule(CullingModuleType::FusedCulling, isFusedCullingEnabled);
+		everyCulling.SetEnabledCullingModule(CullingModuleType::MultiViewCulling, isMultiViewCullingEnabled);
+		everyCulling.SetTemporalCoherenceEnabled(isTemporalCoherenceEnabled);
+
+		return isAllMatched;
+	}
+
+	double ElapsedMilliseconds(const std::chrono::steady_clock::time_point start, const std::chrono::steady_clock::time_point end)
+	{
+		return std::chrono::duration<double, std::milli>(end - start).count();
+	}
+}
+
+int main(int argc, char** argv)
+{
+	BenchOptions options;
+	if (ParseOptions(argc, argv, options) == false)
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	std::unique_ptr<culling::EveryCulling> everyCulling = std::make_unique<culling::EveryCulling>(options.mWidth, options.mHeight);
+	everyCulling->SetEnabledCullingModule(culling::EveryCulling::CullingModuleType::DistanceCulling, options.mEnableDistanceCulling);
+	everyCulling->SetEnabledCullingModule(culling::EveryCulling::CullingModuleType::ViewFrustumCulling, options.mEnableViewFrustumCulling);
+	everyCulling->SetEnabledCullingModule(culling::EveryCulling::CullingModuleType::MaskedSWOcclusionCulling, options.mEnableMaskedSWOcclusionCulling);
+	everyCulling->SetEnabledCullingModule(culling::EveryCulling::CullingModuleType::FusedCulling, options.mEnableFusedCulling);
+	everyCulling->SetEnabledCullingModule(culling::EveryCulling::CullingModuleType::MultiViewCulling, options.mEnableMultiViewCulling);
+	everyCulling->SetEnabledCullingModule(culling::EveryCulling::CullingModuleType::HierarchyCulling, options.mEnableHierarchyCulling);
+	everyCulling->SetEnabledCullingModule(culling::EveryCulling::CullingModuleType::VisibleEntityCompaction, options.mEnableVisibleEntityCompaction);
+	everyCulling->SetTemporalCoherenceEnabled(options.mEnableTemporalCoherence);
+	if (options.mSIMDInstructionSetName.empty() == false)
+	{
+		bool isSuccess = false;
+		for (const culling::SIMDInstructionSet instructionSet : { culling::SIMDInstructionSet::SSE4_1, culling::SIMDInstructionSet::AVX2, culling::SIMDInstructionSet::AVX512 })
+		{
+			if (options.mSIMDInstructionSetName == culling::GetSIMDInstructionSetName(instructionSet))
+			{
+				isSuccess = everyCulling->SetSIMDInstructionSet(instructionSet);
+				break;
+			}
+		}
+
+		if (isSuccess == false)
+		{
+			std::fprintf(stderr, "instruction set %s isn't supported\n", options.mSIMDInstructionSetName.c_str());
+			return 1;
+		}
+	}
+	everyCulling->mMaskedSWOcclusionCulling->mSolveMeshRoleStage.SetOccluderAABBScreenSpaceMinArea(500.0f);
+	everyCulling->mPreCulling->SetLODHysteresis(static_cast<float>(EVERYCULLING_MIN(options.mLODHysteresisPercentage, 99u)) / 100.0f);
+
+	if (options.mNumaPolicy != culling::EntityBlockArenaNumaPolicy::FirstTouch && everyCulling->SetEntityBlockArenaNumaPolicy(options.mNumaPolicy, options.mNumaNode) == false)
+	{
+		std::fprintf(stderr, "numa policy can't be applied. first touch policy is used\n");
+	}
+
+	BenchScene scene;
+	CreateScene(*everyCulling, options, scene);
+	// Baked before shadow views are set, as baker culls with cameras of the EveryCulling
+	double pvsBakeElapsedTime = 0.0;
+	size_t pvsCompressedBitsetSize = 0;
+	if (options.mPVSCellCount != 0 && BakePVS(*everyCulling, options, pvsBakeElapsedTime, pvsCompressedBitsetSize) == false)
+	{
+		std::fprintf(stderr, "pvs bake file %s can't be written or loaded\n", PVS_BAKE_FILE_PATH);
+		return 1;
+	}
+	const std::uint32_t cameraCount = options.mCameraCount + options.mShadowCascadeCount;
+	everyCulling->SetCameraCount(cameraCount);
+	if (options.mShadowCascadeCount != 0)
+	{
+		everyCulling->SetEnabledCullingModule(culling::EveryCulling::CullingModuleType::ShadowCasterCulling, true);
+		for (std::uint32_t cascadeIndex = 0; cascadeIndex < options.mShadowCascadeCount; cascadeIndex++)
+		{
+			everyCulling->mShadowCasterCulling->SetShadowView(options.mCameraCount + cascadeIndex, culling::ShadowLightType::Directional, SHADOW_LIGHT_DIRECTION, 0);
+		}
+	}
+	if (options.mPortalCellCount != 0)
+	{
+		CreatePortalCells(*everyCulling, options);
+	}
+	if (options.mMinScreenSpaceSize != 0 || options.mShadowMinScreenSpaceSize != 0)
+	{
+		everyCulling->SetEnabledCullingModule(culling::EveryCulling::CullingModuleType::ScreenSpaceSizeCulling, true);
+		for (std::uint32_t cameraIndex = 0; cameraIndex < cameraCount; cameraIndex++)
+		{
+			const bool isShadowCascade = (cameraIndex >= options.mCameraCount);
+			const std::uint32_t minScreenSpaceSize = (isShadowCascade == true && options.mShadowMinScreenSpaceSize != 0) ? options.mShadowMinScreenSpaceSize : options.mMinScreenSpaceSize;
+			everyCulling->mScreenSpaceSizeCulling->SetMinScreenSpaceSize(cameraIndex, static_cast<float>(minScreenSpaceSize));
+		}
+	}
+	// Enabled after PVS is baked, so every sample point of bake is occlusion culled
+	culling::OcclusionCostModel& occlusionCostModel = everyCulling->mMaskedSWOcclusionCulling->mCostModel;
+	occlusionCostModel.SetEnabled(options.mEnableAdaptiveOcclusionCulling);
+	if (options.mOccludedEntitySavedTime != 0)
+	{
+		occlusionCostModel.SetOccludedEntitySavedTime(static_cast<float>(options.mOccludedEntitySavedTime));
+	}
+
+	std::printf("EveryCulling benchmark\n");
+	std::printf("  entities %u, occluders %u, cameras %u, threads %u\n", options.mEntityCount, options.mOccluderCount, options.mCameraCount, options.mThreadCount);
+	if (options.mOccluderSubdivisionCount > 1 || options.mEnableOccluderMeshLOD == true)
+	{
+		std::printf
+		(
+			"  occluder mesh %zu triangles, coarse LOD %s\n",
+			scene.mOccluderMesh.mIndices.size() / 3, (options.mEnableOccluderMeshLOD == true) ? "12 triangles" : "off"
+		);
+	}
+	if (options.mShadowCascadeCount != 0)
+	{
+		std::printf("  shadow cascades %u ( camera %u ~ %u )\n", options.mShadowCascadeCount, options.mCameraCount, cameraCount - 1);
+	}
+	if (options.mPortalCellCount != 0)
+	{
+		std::printf("  portal cells %u x %u\n", options.mPortalCellCount, options.mPortalCellCount);
+	}
+	if (options.mMinScreenSpaceSize != 0 || options.mShadowMinScreenSpaceSize != 0)
+	{
+		std::printf("  min screen space size %u px, shadow cascades %u px\n", options.mMinScreenSpaceSize, (options.mShadowMinScreenSpaceSize != 0) ? options.mShadowMinScreenSpaceSize : options.mMinScreenSpaceSize);
+	}
+	const std::uint32_t lodCount = EVERYCULLING_MIN(EVERYCULLING_MAX(options.mLODCount, 1u), MAX_BENCH_LOD_COUNT);
+	if (lodCount > 1)
+	{
+		std::printf("  lods %u, hysteresis %.2f\n", lodCount, everyCulling->mPreCulling->GetLODHysteresis());
+	}
+	if (options.mEnableAdaptiveOcclusionCulling == true)
+	{
+		std::printf("  adaptive occlusion culling, occluded entity saves %.0f ns\n", (options.mOccludedEntitySavedTime != 0) ? static_cast<double>(options.mOccludedEntitySavedTime) : static_cast<double>(EVERYCULLING_DEFAULT_OCCLUDED_ENTITY_SAVED_TIME));
+	}
+	if (options.mPVSCellCount != 0)
+	{
+		std::printf
+		(
+			"  pvs cells %u x %u, %u sample points per cell, baked in %.1f ms, %.1f KB compressed\n",
+			options.mPVSCellCount, options.mPVSCellCount, options.mPVSSamplePointCountPerAxis * options.mPVSSamplePointCountPerAxis * options.mPVSSamplePointCountPerAxis,
+			pvsBakeElapsedTime, static_cast<double>(pvsCompressedBitsetSize) / 1024.0
+		);
+	}
+	std::printf("  frames %u ( warmup %u ), seed %u, world %.0f, resolution %u x %u\n", options.mFrameCount, options.mWarmupFrameCount, options.mSeed, options.mWorldSize, options.mWidth, options.mHeight);
+	std::printf("  entity blocks %zu, entity culling kernel %s\n", everyCulling->GetActiveEntityBlockCount(), culling::GetSIMDInstructionSetName(everyCulling->GetSIMDInstructionSet()));
+	std::printf
+	(
+		"  entity block arena %.1f MB committed, huge page %s\n\n", 
+		static_cast<double>(everyCulling->GetEntityBlockArena().GetCommittedSize()) / (1024.0 * 1024.0),
+		everyCulling->GetEntityBlockArena().IsHugePageAdvised() ? "advised" : "unavailable"
+	);
+
+	BenchWorkerPool workerPool{ options.mThreadCount };
+
+	const std::vector<const culling::CullingModule*> cullingModules
+	{
+		everyCulling->mHierarchyCulling.get(),
+		everyCulling->mMultiViewCulling.get(),
+		everyCulling->mFusedCulling.get(),
+		everyCulling->mPreCulling.get(),
+		everyCulling->mDistanceCulling.get(),
+		everyCulling->mViewFrustumCulling.get(),
+		everyCulling->mShadowCasterCulling.get(),
+		everyCulling->mPortalCulling.get(),
+		everyCulling->mPVSCulling.get(),
+		everyCulling->mScreenSpaceSizeCulling.get(),
+		everyCulling->mMaskedSWOcclusionCulling.get(),
+		&(everyCulling->mMaskedSWOcclusionCulling->mSolveMeshRoleStage),
+		&(everyCulling->mMaskedSWOcclusionCulling->mBinTrianglesStage),
+		&(everyCulling->mMaskedSWOcclusionCulling->mRasterizeTrianglesStage),
+		&(everyCulling->mMaskedSWOcclusionCulling->mQueryOccludeeStage),
+		everyCulling->mVisibleEntityCompaction.get()
+	};
+
+	std::map<std::string, double> stageElapsedTimes;
+	// sum of waited time of all threads, max waited time of a thread
+	std::vector<std::pair<double, double>> stageWaitedTimes(cullingModules.size(), { 0.0, 0.0 });
+	double entityUpdateElapsedTime = 0.0;
+	double cullElapsedTime = 0.0;
+	// measured bin cycles whose occlusion culling is skipped, sum of binned indice budget of bin cycles running it
+	std::uint32_t measuredBinCycleCount = 0;
+	std::vector<std::pair<std::uint32_t, std::uint64_t>> occlusionCostModelDecisions(cameraCount, { 0, 0 });
+
+	const std::uint32_t totalFrameCount = options.mWarmupFrameCount + options.mFrameCount;
+	for (std::uint32_t frameIndex = 0; frameIndex < totalFrameCount; frameIndex++)
+	{
+		const bool isMeasuredFrame = frameIndex >= options.mWarmupFrameCount;
+
+		const std::chrono::steady_clock::time_point updateStartTime = std::chrono::steady_clock::now();
+
+		ChurnEntities(*everyCulling, scene, workerPool, frameIndex, options.mChurnEntityPercentage, options.mIsParallelChurn);
+		UpdateCameras(*everyCulling, options, scene);
+		everyCulling->PreCullJob();
+		UpdateEntities(scene, frameIndex, options.mIsBatchUpdate);
+		if (options.mIsBatchUpdate == true)
+		{
+			UpdateEntitiesWithBatch(*everyCulling, scene, workerPool);
+		}
+
+		const std::chrono::steady_clock::time_point cullStartTime = std::chrono::steady_clock::now();
+
+		const unsigned long long tickCount = everyCulling->GetTickCount();
+		CullFrame(*everyCulling, workerPool, cameraCount, options.mEnableMultiViewCulling);
+
+		const std::chrono::steady_clock::time_point cullEndTime = std::chrono::steady_clock::now();
+
+		if (isMeasuredFrame == true)
+		{
+			entityUpdateElapsedTime += ElapsedMilliseconds(updateStartTime, cullStartTime);
+			cullElapsedTime += ElapsedMilliseconds(cullStartTime, cullEndTime);
+
+			for (const auto& profilingData : everyCulling->mEveryCullingProfiler.GetProfilingDatas())
+			{
+				if (profilingData.second.mEndTime >= cullStartTime)
+				{
+					stageElapsedTimes[std::string{ profilingData.first }] += profilingData.second.mElapsedTime;
+				}
+			}
+
+			if (options.mEnableAdaptiveOcclusionCulling == true && EVERYCULLING_WHEN_TO_BIN_TRIANGLE(tickCount))
+			{
+				measuredBinCycleCount++;
+				for (std::uint32_t cameraIndex = 0; cameraIndex < cameraCount; cameraIndex++)
+				{
+					if (occlusionCostModel.GetIsOcclusionCullingSkipped(cameraIndex) == true)
+					{
+						occlusionCostModelDecisions[cameraIndex].first++;
+					}
+					else
+					{
+						occlusionCostModelDecisions[cameraIndex].second += occlusionCostModel.GetBinnedIndiceBudget(cameraIndex);
+					}
+				}
+			}
+
+			for (size_t moduleIndex = 0; moduleIndex < cullingModules.size(); moduleIndex++)
+			{
+				double maxWaitedTime = 0.0;
+				for (std::uint32_t threadIndex = 0; threadIndex < EVERYCULLING_MAX_THREAD_COUNT; threadIndex++)
+				{
+					const double waitedTime = cullingModules[moduleIndex]->GetWaitedTime(threadIndex);
+					stageWaitedTimes[moduleIndex].first += waitedTime;
+					maxWaitedTime = EVERYCULLING_MAX(maxWaitedTime, waitedTime);
+				}
+				stageWaitedTimes[moduleIndex].second += maxWaitedTime;
+			}
+		}
+	}
+
+	const double measuredFrameCount = static_cast<double>(EVERYCULLING_MAX(1u, options.mFrameCount));
+
+	std::printf("Stage timings ( ms per frame, one sampled thread )\n");
+	for (const auto& stageElapsedTime : stageElapsedTimes)
+	{
+		std::printf("  %-32s %10.4f\n", stageElapsedTime.first.c_str(), stageElapsedTime.second / measuredFrameCount);
+	}
+
+	std::printf("\nStage barrier wait ( ms per frame, sum of all threads / slowest waiting thread )\n");
+	for (size_t moduleIndex = 0; moduleIndex < cullingModules.size(); moduleIndex++)
+	{
+		std::printf
+		(
+			"  %-32s %10.4f %10.4f\n", 
+			cullingModules[moduleIndex]->GetCullingModuleName(), 
+			stageWaitedTimes[moduleIndex].first / measuredFrameCount, 
+			stageWaitedTimes[moduleIndex].second / measuredFrameCount
+		);
+	}
+
+	std::printf("\nFrame timings ( ms per frame )\n");
+	std::printf("  %-32s %10.4f\n", "PreCullJob + entity update", entityUpdateElapsedTime / measuredFrameCount);
+	std::printf("  %-32s %10.4f\n", "Cull job ( all cameras )", cullElapsedTime / measuredFrameCount);
+
+	if (options.mEnableAdaptiveOcclusionCulling == true)
+	{
+		std::printf("\nAdaptive occlusion culling ( measured bin cycles %u )\n", measuredBinCycleCount);
+		std::printf
+		(
+			"  us per camera : solve mesh role %.2f, query %.2f / ns per binned indice : bin %.2f, rasterize %.2f\n",
+			occlusionCostModel.GetStageTimePerWork(culling::OcclusionCullingStage::SolveMeshRole) / 1000.0f,
+			occlusionCostModel.GetStageTimePerWork(culling::OcclusionCullingStage::QueryOccludee) / 1000.0f,
+			occlusionCostModel.GetStageTimePerWork(culling::OcclusionCullingStage::BinTriangles),
+			occlusionCostModel.GetStageTimePerWork(culling::OcclusionCullingStage::RasterizeOccluders)
+		);
+		for (std::uint32_t cameraIndex = 0; cameraIndex < cameraCount; cameraIndex++)
+		{
+			const std::uint32_t ranBinCycleCount = measuredBinCycleCount - occlusionCostModelDecisions[cameraIndex].first;
+			std::printf
+			(
+				"  camera %u : skipped %u, ran %u with avg binned indice budget %llu, occluded ratio %.3f\n",
+				cameraIndex, occlusionCostModelDecisions[cameraIndex].first, ranBinCycleCount,
+				static_cast<unsigned long long>((ranBinCycleCount != 0) ? occlusionCostModelDecisions[cameraIndex].second / ranBinCycleCount : 0),
+				occlusionCostModel.GetOccludedEntityRatio(cameraIndex)
+			);
+		}
+	}
+
+	std::printf("\nCulling result ( last frame )\n");
+	std::printf("  entity blocks %zu\n", everyCulling->GetActiveEntityBlockCount());
+	for (std::uint32_t cameraIndex = 0; cameraIndex < cameraCount; cameraIndex++)
+	{
+		std::uint32_t visibleCount;
+		const std::uint64_t visibilityHash = HashVisibility(scene, cameraIndex, visibleCount);
+		std::printf
+		(
+			"  camera %u : visible %u, culled %u, visibility hash %016llx\n",
+			cameraIndex, visibleCount, options.mEntityCount - visibleCount, static_cast<unsigned long long>(visibilityHash)
+		);
+
+		if (lodCount > 1)
+		{
+			std::printf("  camera %u : visible entities of lod", cameraIndex);
+			for (const std::uint32_t visibleEntityCount : CountVisibleEntitiesOfLODs(scene, cameraIndex, lodCount))
+			{
+				std::printf(" %u", visibleEntityCount);
+			}
+			std::printf("\n");
+		}
+
+		if (options.mEnableVisibleEntityCompaction == true)
+		{
+			size_t compactedVisibleCount;
+			const bool isMatched = CheckVisibleEntityCompaction(*everyCulling, scene, cameraIndex, compactedVisibleCount);
+			std::printf
+			(
+				"  camera %u : compacted visible %zu in %zu chunks, %s\n",
+				cameraIndex, compactedVisibleCount, everyCulling->mVisibleEntityCompaction->GetVisibleEntityChunkCount(cameraIndex), isMatched ? "matches visibility" : "MISMATCH"
+			);
+		}
+	}
+
+	if (options.mCheckCullingPaths == true)
+	{
+		std::printf("\nCulling paths ( distance / frustum on, off x separated, fused, multi view )\n");
+		const bool isMatched = CheckCullingPaths(*everyCulling, scene, workerPool, cameraCount);
+		std::printf("  %s\n", isMatched ? "every culling path matches separated culling modules" : "MISMATCH");
+	}
+
+	if (options.mPVSCellCount != 0)
+	{
+		everyCulling->mPVSCulling->UnloadBakeFile();
+		std::remove(PVS_BAKE_FILE_PATH);
+	}
+
+	return 0;
+}
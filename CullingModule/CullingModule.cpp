@@ -2,20 +2,123 @@
 
 #include "../EveryCulling.h"
 
+thread_local std::uint32_t culling::CullingModule::LocalThreadIndexOfCullJob = 0;
+
+namespace
+{
+	EVERYCULLING_FORCE_INLINE std::uint64_t PackEntityBlockRange(const std::uint32_t beginIndex, const std::uint32_t endIndex)
+	{
+		return static_cast<std::uint64_t>(beginIndex) | (static_cast<std::uint64_t>(endIndex) << 32);
+	}
+
+	EVERYCULLING_FORCE_INLINE void UnpackEntityBlockRange(const std::uint64_t packedRange, std::uint32_t& outBeginIndex, std::uint32_t& outEndIndex)
+	{
+		outBeginIndex = static_cast<std::uint32_t>(packedRange & 0xFFFFFFFF);
+		outEndIndex = static_cast<std::uint32_t>(packedRange >> 32);
+	}
+
+	EVERYCULLING_FORCE_INLINE bool PopFrontOfEntityBlockRange
+	(
+		std::atomic<std::uint64_t>& packedRange, 
+		const std::memory_order memoryOrder, 
+		std::uint32_t& outEntityBlockIndex
+	)
+	{
+		std::uint64_t currentPackedRange = packedRange.load(std::memory_order_relaxed);
+		while (true)
+		{
+			std::uint32_t beginIndex, endIndex;
+			UnpackEntityBlockRange(currentPackedRange, beginIndex, endIndex);
+			if (beginIndex >= endIndex)
+			{
+				return false;
+			}
+
+			if (packedRange.compare_exchange_weak(currentPackedRange, PackEntityBlockRange(beginIndex + 1, endIndex), memoryOrder, std::memory_order_relaxed) == true)
+			{
+				outEntityBlockIndex = beginIndex;
+				return true;
+			}
+		}
+	}
+}
+
+bool culling::CullingModule::StealEntityBlockRange
+(
+	const size_t cameraIndex,
+	const std::uint32_t maxStolenEntityBlockCount,
+	const std::memory_order memoryOrder,
+	std::uint32_t& outBeginIndex,
+	std::uint32_t& outEndIndex
+)
+{
+	assert(maxStolenEntityBlockCount > 0);
+
+	const std::uint32_t threadIndex = LocalThreadIndexOfCullJob;
+	for (std::uint32_t victimOffset = 1; victimOffset <= EVERYCULLING_MAX_THREAD_COUNT; victimOffset++)
+	{
+		std::atomic<std::uint64_t>& victimRange = mCullJobState.mEntityBlockRanges[cameraIndex][(threadIndex + victimOffset) % EVERYCULLING_MAX_THREAD_COUNT].mPackedRange;
+
+		std::uint64_t currentPackedRange = victimRange.load(std::memory_order_relaxed);
+		while (true)
+		{
+			std::uint32_t beginIndex, endIndex;
+			UnpackEntityBlockRange(currentPackedRange, beginIndex, endIndex);
+			if (beginIndex >= endIndex)
+			{
+				break;
+			}
+
+			// steal half of remaining blocks ( at least one block ) from end of range
+			const std::uint32_t remainedEntityBlockCount = endIndex - beginIndex;
+			const std::uint32_t stolenEntityBlockCount = EVERYCULLING_MIN(maxStolenEntityBlockCount, EVERYCULLING_MAX(1u, remainedEntityBlockCount / 2));
+
+			if (victimRange.compare_exchange_weak(currentPackedRange, PackEntityBlockRange(beginIndex, endIndex - stolenEntityBlockCount), memoryOrder, std::memory_order_relaxed) == true)
+			{
+				outBeginIndex = endIndex - stolenEntityBlockCount;
+				outEndIndex = endIndex;
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
 culling::EntityBlock* culling::CullingModule::GetNextEntityBlock(const size_t cameraIndex, const bool forceOrdering)
 {
-	// TODO : Implement Cache Friendly GetNextEntityBlock to prevent cache coherency.
-	//        After thread finished its blocks, steal other threads's block. 
-	// Ex)
-	// First Thread : 1 4 7 10  ....
-	// Second Thread : 2 5 8 11 ....
-	// Third Thread : 3 6 9 12 ....
-	//
+	const std::memory_order memoryOrder = (forceOrdering == true) ? std::memory_order_seq_cst : std::memory_order_relaxed;
+	const std::uint32_t threadIndex = LocalThreadIndexOfCullJob;
 
-	const std::uint32_t currentEntityBlockIndex = mCullJobState.mCurrentCulledEntityBlockIndex[cameraIndex].fetch_add(1, forceOrdering == true ? std::memory_order_seq_cst : std::memory_order_relaxed);
+	bool isEntityBlockFound = false;
+	std::uint32_t currentEntityBlockIndex = 0;
 
-	const size_t entityBlockCount = mCullingSystem->GetActiveEntityBlockCount();
-	EntityBlock* const currentEntityBlock = (currentEntityBlockIndex >= entityBlockCount) ? (nullptr) : (mCullingSystem->GetActiveEntityBlockList()[currentEntityBlockIndex]);
+	if (threadIndex < EVERYCULLING_MAX_THREAD_COUNT)
+	{
+		std::atomic<std::uint64_t>& ownedRange = mCullJobState.mEntityBlockRanges[cameraIndex][threadIndex].mPackedRange;
+
+		isEntityBlockFound = PopFrontOfEntityBlockRange(ownedRange, memoryOrder, currentEntityBlockIndex);
+		if (isEntityBlockFound == false)
+		{
+			std::uint32_t stolenBeginIndex, stolenEndIndex;
+			isEntityBlockFound = StealEntityBlockRange(cameraIndex, UINT32_MAX, memoryOrder, stolenBeginIndex, stolenEndIndex);
+			if (isEntityBlockFound == true)
+			{
+				// Owned range is empty, so other threads don't touch it. ( they don't steal from empty range )
+				// Stolen blocks are put to owned range, then other threads can steal them again
+				currentEntityBlockIndex = stolenBeginIndex;
+				ownedRange.store(PackEntityBlockRange(stolenBeginIndex + 1, stolenEndIndex), memoryOrder);
+			}
+		}
+	}
+	else
+	{
+		// thread without range steals one block at a time
+		std::uint32_t stolenEndIndex;
+		isEntityBlockFound = StealEntityBlockRange(cameraIndex, 1, memoryOrder, currentEntityBlockIndex, stolenEndIndex);
+	}
+
+	EntityBlock* const currentEntityBlock = (isEntityBlockFound == false) ? (nullptr) : (mCullingSystem->GetActiveEntityBlockList()[currentEntityBlockIndex]);
 
 	if(currentEntityBlock != nullptr)
 	{
@@ -25,11 +128,6 @@ culling::EntityBlock* culling::CullingModule::GetNextEntityBlock(const size_t ca
 	return currentEntityBlock;
 }
 
-size_t culling::CullingModule::ComputeEndEntityBlockIndexOfThread(const std::int32_t threadIndex)
-{
-	return mCullingSystem->GetActiveEntityBlockCount() - (mCullingSystem->GetActiveEntityBlockCount() % threadIndex);
-}
-
 culling::CullingModule::CullingModule
 (
 	EveryCulling* cullingSystem
@@ -41,11 +139,36 @@ culling::CullingModule::CullingModule
 
 culling::CullingModule::~CullingModule() = default;
 
+#ifdef EVERYCULLING_PROFILING_CULLING
+void culling::CullingModule::AddWaitedTime(const std::uint32_t threadIndex, const std::chrono::steady_clock::duration waitedTime)
+{
+	const std::uint32_t slotIndex = EVERYCULLING_MIN(threadIndex, static_cast<std::uint32_t>(EVERYCULLING_MAX_THREAD_COUNT - 1));
+	mWaitedTimeOfThreads[slotIndex].fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(waitedTime).count(), std::memory_order_relaxed);
+}
+
+double culling::CullingModule::GetWaitedTime(const std::uint32_t threadIndex) const
+{
+	assert(threadIndex < EVERYCULLING_MAX_THREAD_COUNT);
+	return static_cast<double>(mWaitedTimeOfThreads[threadIndex].load(std::memory_order_relaxed)) / 1000000.0;
+}
+#endif
+
 void culling::CullingModule::ResetCullingModule(const unsigned long long currentTickCount)
 {
-	for (std::atomic<std::uint32_t>& atomicVal : mCullJobState.mCurrentCulledEntityBlockIndex)
+	// Split entity blocks into contiguous ranges, one range per thread.
+	// Thread count of last cull job is used as expected thread count. ( ThreadCullJob of EveryCulling gives index to a thread )
+	const std::uint64_t entityBlockCount = mCullingSystem->GetActiveEntityBlockCount();
+	for (size_t cameraIndex = 0; cameraIndex < mCullJobState.mEntityBlockRanges.size(); cameraIndex++)
 	{
-		atomicVal.store(0, std::memory_order_relaxed);
+		const std::uint32_t lastRunningThreadCount = mCullingSystem->GetRunningThreadCount(cameraIndex);
+		const std::uint64_t rangeCount = (lastRunningThreadCount == 0) ? EVERYCULLING_MAX_THREAD_COUNT : EVERYCULLING_MIN(lastRunningThreadCount, static_cast<std::uint32_t>(EVERYCULLING_MAX_THREAD_COUNT));
+
+		for (std::uint64_t rangeIndex = 0; rangeIndex < EVERYCULLING_MAX_THREAD_COUNT; rangeIndex++)
+		{
+			const std::uint32_t beginIndex = static_cast<std::uint32_t>(EVERYCULLING_MIN(rangeIndex, rangeCount) * entityBlockCount / rangeCount);
+			const std::uint32_t endIndex = static_cast<std::uint32_t>(EVERYCULLING_MIN(rangeIndex + 1, rangeCount) * entityBlockCount / rangeCount);
+			mCullJobState.mEntityBlockRanges[cameraIndex][rangeIndex].mPackedRange.store(PackEntityBlockRange(beginIndex, endIndex), std::memory_order_relaxed);
+		}
 	}
 	
 
@@ -53,10 +176,25 @@ void culling::CullingModule::ResetCullingModule(const unsigned long long current
 	{
 		atomicVal.store(0, std::memory_order_relaxed);
 	}
+
+#ifdef EVERYCULLING_PROFILING_CULLING
+	for (std::atomic<std::uint64_t>& waitedTime : mWaitedTimeOfThreads)
+	{
+		waitedTime.store(0, std::memory_order_relaxed);
+	}
+#endif
+}
+
+void culling::CullingModule::OnSetCameraCount(const size_t cameraCount)
+{
+	mCullJobState.mEntityBlockRanges.Resize(cameraCount);
+	mCullJobState.mFinishedThreadCount.Resize(cameraCount);
 }
 
-void culling::CullingModule::ThreadCullJob(const size_t cameraIndex, const unsigned long long currentTickCount)
+void culling::CullingModule::ThreadCullJob(const size_t cameraIndex, const std::uint32_t threadIndex, const unsigned long long currentTickCount)
 {
+	LocalThreadIndexOfCullJob = threadIndex;
+
 	std::atomic_thread_fence(std::memory_order_acquire);
 	CullBlockEntityJob(cameraIndex, currentTickCount);
 
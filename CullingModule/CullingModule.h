@@ -2,9 +2,11 @@
 
 #include <array>
 #include <atomic>
+#include <chrono>
 
 #include "../EveryCullingCore.h"
 #include "../DataType/EntityBlock.h"
+#include "../DataType/PerCameraArray.h"
 #include "../EveryCulling.h"
 
 namespace culling
@@ -12,11 +14,24 @@ namespace culling
 	class EveryCulling;
 	struct EntityBlock;
 
+	/// <summary>
+	/// Range of entity block index [ begin, end ) owned by a thread.
+	/// Owner thread pops from begin, other threads steal from end.
+	/// begin is stored at low 32 bit, end is stored at high 32 bit so that both can be updated with one CAS.
+	/// Aligned to cache line size to prevent false sharing between threads
+	/// </summary>
+	struct alignas(EVERYCULLING_CACHE_LINE_SIZE) EntityBlockRange
+	{
+		std::atomic<std::uint64_t> mPackedRange;
+	};
+
+	/// <summary>
+	/// Sized to camera count ( CullingModule::OnSetCameraCount )
+	/// </summary>
 	struct CullJobState
 	{
-		std::array<std::atomic<std::uint32_t>, EVERYCULLING_MAX_CAMERA_COUNT> mCurrentCulledEntityBlockIndex;
-		char padding2[64];
-		std::array<std::atomic<std::uint32_t>, EVERYCULLING_MAX_CAMERA_COUNT> mFinishedThreadCount;
+		culling::PerCameraArray<std::array<EntityBlockRange, EVERYCULLING_MAX_THREAD_COUNT>> mEntityBlockRanges;
+		culling::PerCameraArray<std::atomic<std::uint32_t>> mFinishedThreadCount;
 	};
 	class CullingModule
 	{
@@ -24,8 +39,34 @@ namespace culling
 		
 		CullJobState mCullJobState;
 
+		/// <summary>
+		/// Index of thread in cull job of current camera.
+		/// EveryCulling gives same index to a thread for all culling modules of a camera,
+		/// so a thread visits same entity blocks in consecutive culling modules
+		/// </summary>
+		static thread_local std::uint32_t LocalThreadIndexOfCullJob;
+
+#ifdef EVERYCULLING_PROFILING_CULLING
+		/// <summary>
+		/// Time each thread waited other threads at end of this culling module. ( nanoseconds )
+		/// Threads with same thread index of different cameras are summed up.
+		/// Threads whose index exceed EVERYCULLING_MAX_THREAD_COUNT are summed up to last slot
+		/// </summary>
+		std::array<std::atomic<std::uint64_t>, EVERYCULLING_MAX_THREAD_COUNT> mWaitedTimeOfThreads;
+#endif
 
-		size_t ComputeEndEntityBlockIndexOfThread(const std::int32_t threadIndex);
+		/// <summary>
+		/// Steal end of entity block range of other threads.
+		/// return false if every range is consumed
+		/// </summary>
+		bool StealEntityBlockRange
+		(
+			const size_t cameraIndex, 
+			const std::uint32_t maxStolenEntityBlockCount, 
+			const std::memory_order memoryOrder, 
+			std::uint32_t& outBeginIndex, 
+			std::uint32_t& outEndIndex
+		);
 
 	protected:
 
@@ -34,11 +75,22 @@ namespace culling
 		/// <summary>
 		/// return next entity block
 		///	if consume all entity block, return nullptr
+		///
+		/// Each thread pops entity block from its own range first.
+		/// After the range is consumed, steal half of remaining range of other thread
 		/// </summary>
 		/// <param name="cameraIndex"></param>
 		/// <returns></returns>
 		culling::EntityBlock* GetNextEntityBlock(const size_t cameraIndex, const bool forceOrdering = true);
 
+		/// <summary>
+		/// Index of calling thread in cull job of current camera. Exactly one thread of each camera gets 0
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE static std::uint32_t GetLocalThreadIndexOfCullJob()
+		{
+			return LocalThreadIndexOfCullJob;
+		}
+
 	public:
 
 		CullingModule(EveryCulling* cullingSystem);
@@ -52,6 +104,14 @@ namespace culling
 			return mCullJobState.mFinishedThreadCount[cameraIndex];
 		}
 
+#ifdef EVERYCULLING_PROFILING_CULLING
+		void AddWaitedTime(const std::uint32_t threadIndex, const std::chrono::steady_clock::duration waitedTime);
+		/// <summary>
+		/// Get time the thread waited other threads at end of this culling module in current cull job ( milliseconds )
+		/// </summary>
+		double GetWaitedTime(const std::uint32_t threadIndex) const;
+#endif
+
 
 
 		virtual void OnSetViewProjectionMatrix(const size_t cameraIndex, const culling::Mat4x4& cameraViewProjectionMatrix)
@@ -66,9 +126,10 @@ namespace culling
 		virtual void OnSetCameraRotation(const size_t cameraIndex, const culling::Vec4& cameraRotation)
 		{
 		}
-		virtual void OnSetCameraCount(const size_t cameraCount)
-		{
-		}
+		/// <summary>
+		/// Resize per camera state. Overriding function should call this
+		/// </summary>
+		virtual void OnSetCameraCount(const size_t cameraCount);
 		virtual void OnSetCameraFarClipPlaneDistance(const size_t cameraIndex, const float farClipPlaneDistance)
 		{
 		}
@@ -90,7 +151,7 @@ namespace culling
 			const size_t cameraIndex, const unsigned long long currentTickCount
 		) = 0;
 		
-		void ThreadCullJob(const size_t cameraIndex, const unsigned long long currentTickCount);
+		void ThreadCullJob(const size_t cameraIndex, const std::uint32_t threadIndex, const unsigned long long currentTickCount);
 
 		virtual const char* GetCullingModuleName() const = 0;
 	};
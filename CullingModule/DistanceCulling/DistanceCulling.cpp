@@ -1,6 +1,19 @@
 #include "DistanceCulling.h"
 
-static_assert(EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK % 2 == 0);
+#include "../../EveryCulling.h"
+#include "../../DataType/Math/Common.h"
+#include "../EntityCullingKernel/EntityCullingKernel.h"
+
+bool culling::DistanceCulling::CheckIsEntityBlockCulled
+(
+	const size_t cameraIndex,
+	const culling::EntityBlock* const entityBlock
+) const
+{
+	return
+		entityBlock->IsAggregateBoundingVolumeValid(mCullingSystem->GetTickCount()) == true &&
+		culling::CheckIsAABBFartherThan(entityBlock->mAggregateAABBMinWorldPoint, entityBlock->mAggregateAABBMaxWorldPoint, mCullingSystem->GetCameraWorldPosition(cameraIndex), entityBlock->mAggregateMaxDesiredMaxDrawDistance + EVERYCULLING_BOUNDING_SPHRE_RADIUS_MARGIN);
+}
 
 void culling::DistanceCulling::DoDistanceCulling
 (
@@ -8,25 +21,56 @@ void culling::DistanceCulling::DoDistanceCulling
 	culling::EntityBlock* const entityBlock
 )
 {
-	const culling::Vec3 cameraWorldPos = mCullingSystem->GetCameraWorldPosition(cameraIndex);
-	const culling::EVERYCULLING_M256F vectorizedCameraWorldPos = _mm256_setr_ps(cameraWorldPos.x, cameraWorldPos.y, cameraWorldPos.z, 0.0f, cameraWorldPos.x, cameraWorldPos.y, cameraWorldPos.z, 0.0f);
-
-	const size_t entityCount = entityBlock->mCurrentEntityCount;
-	for(size_t entityIndex = 0 ; entityIndex < entityCount ; entityIndex += 2)
+	// Every entity of the block is unchanged, so result of last tick is still valid
+	if (mCullingSystem->IsTemporalVisibilityReusable(cameraIndex) == true && entityBlock->GetChangedEntityMask() == 0)
 	{
-		const culling::EVERYCULLING_M256F& vectorizedEntityWolrdPos = *reinterpret_cast<const culling::EVERYCULLING_M256F*>(entityBlock->mWorldPositionAndWorldBoundingSphereRadius + entityIndex); // Bounding Sphere's Radius is located at index 4, 7
+		entityBlock->ApplyTemporalVisibleBitflag(cameraIndex);
+		return;
+	}
 
-		const culling::EVERYCULLING_M256F subOfCameraWorldPosAndEntityPos = _mm256_sub_ps(vectorizedCameraWorldPos, vectorizedEntityWolrdPos);
-		const culling::EVERYCULLING_M256F sqrOfSubOfCameraWorldPosAndEntityPos = _mm256_mul_ps(subOfCameraWorldPosAndEntityPos, subOfCameraWorldPosAndEntityPos);
+	if (entityBlock->IsAllEntitiesCulled(cameraIndex) == false)
+	{
+		DoDistanceCullingOfEntities(cameraIndex, entityBlock);
+	}
 
-		const float sqrDistanceOfFirstEntity = reinterpret_cast<const float*>(&sqrOfSubOfCameraWorldPosAndEntityPos)[0] + reinterpret_cast<const float*>(&sqrOfSubOfCameraWorldPosAndEntityPos)[1] + reinterpret_cast<const float*>(&sqrOfSubOfCameraWorldPosAndEntityPos)[2];
-		const float sqrDistanceOfSecondEntity = reinterpret_cast<const float*>(&sqrOfSubOfCameraWorldPosAndEntityPos)[4] + reinterpret_cast<const float*>(&sqrOfSubOfCameraWorldPosAndEntityPos)[5] + reinterpret_cast<const float*>(&sqrOfSubOfCameraWorldPosAndEntityPos)[6];
+	if (mCullingSystem->IsTemporalCoherenceEnabled() == true)
+	{
+		entityBlock->StoreTemporalVisibleBitflag(cameraIndex);
+	}
+}
 
-		entityBlock->UpdateIsCulled(entityIndex, cameraIndex, sqrDistanceOfFirstEntity > entityBlock->GetDesiredMaxDrawDistance(entityIndex) * entityBlock->GetDesiredMaxDrawDistance(entityIndex));
-		entityBlock->UpdateIsCulled(entityIndex + 1, cameraIndex, sqrDistanceOfSecondEntity > entityBlock->GetDesiredMaxDrawDistance(entityIndex + 1) * entityBlock->GetDesiredMaxDrawDistance(entityIndex + 1));
+void culling::DistanceCulling::DoDistanceCullingOfEntities
+(
+	const size_t cameraIndex,
+	culling::EntityBlock* const entityBlock
+)
+{
+	// Whole entity block is culled when aggregate bounding volume of the block is far from camera
+	if (CheckIsEntityBlockCulled(cameraIndex, entityBlock) == true)
+	{
+		entityBlock->SetAllEntitiesCulled(cameraIndex);
+		return;
 	}
 
-	
+	const culling::Vec3 cameraWorldPos = mCullingSystem->GetCameraWorldPosition(cameraIndex);
+	const float* const positionAndRadius = reinterpret_cast<const float*>(entityBlock->mWorldPositionAndWorldBoundingSphereRadius);
+
+	char* const visibleBitflag = entityBlock->GetVisibleBitflag(cameraIndex);
+	const size_t cameraBitIndex = culling::EntityBlock::GetCameraBitIndex(cameraIndex);
+
+	switch (mCullingSystem->GetSIMDInstructionSet())
+	{
+	case culling::SIMDInstructionSet::SSE4_1:
+		culling::entityCullingKernel::DistanceCulling_SSE4_1(cameraWorldPos.data(), positionAndRadius, entityBlock->mDesiredMaxDrawDistance, visibleBitflag, entityBlock->mCurrentEntityCount, cameraBitIndex);
+		break;
+	case culling::SIMDInstructionSet::AVX512:
+		culling::entityCullingKernel::DistanceCulling_AVX512(cameraWorldPos.data(), positionAndRadius, entityBlock->mDesiredMaxDrawDistance, visibleBitflag, entityBlock->mCurrentEntityCount, cameraBitIndex);
+		break;
+	case culling::SIMDInstructionSet::AVX2:
+	default:
+		culling::entityCullingKernel::DistanceCulling_AVX2(cameraWorldPos.data(), positionAndRadius, entityBlock->mDesiredMaxDrawDistance, visibleBitflag, entityBlock->mCurrentEntityCount, cameraBitIndex);
+		break;
+	}
 }
 
 culling::DistanceCulling::DistanceCulling(EveryCulling* const everyCulling)
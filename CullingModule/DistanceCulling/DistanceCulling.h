@@ -26,19 +26,34 @@ namespace culling
 	/// </summary>
 	class DistanceCulling : public CullingModule
 	{
-
 	private:
 
-		void DoDistanceCulling
+		void DoDistanceCullingOfEntities
 		(
 			const size_t cameraIndex,
 			culling::EntityBlock* const entityBlock
 		);
 
+
 	public:
 
 		DistanceCulling(EveryCulling* const everyCulling);
 
+		/// <summary>
+		/// Check if aggregate bounding volume of the entity block is farther than max desired draw distance of its entities.
+		/// Return false if aggregate bounding volume isn't computed at this tick
+		/// </summary>
+		bool CheckIsEntityBlockCulled(const size_t cameraIndex, const culling::EntityBlock* const entityBlock) const;
+
+		/// <summary>
+		/// Cull entities of the entity block with kernel of SIMD instruction set selected by EveryCulling
+		/// </summary>
+		void DoDistanceCulling
+		(
+			const size_t cameraIndex,
+			culling::EntityBlock* const entityBlock
+		);
+
 		const char* GetCullingModuleName() const override;
 		void CullBlockEntityJob(const size_t cameraIndex, const unsigned long long currentTickCount) override;
 	};
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "../../EveryCullingCore.h"
+
+#include <cstddef>
+#include <cstring>
+
+// Entity culling kernels compiled for each instruction set.
+//
+// Each variant is compiled in its own translation unit with its own compiler flags,
+// so this header and kernel translation units don't include SIMD_Core.h or inline helpers of other headers.
+// Kernels only take raw pointers to entity block data.
+//
+// Kernels read EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK ( 16 ) entries at most and write visibility bit of entities over entityCount.
+// ( Setting value to invalid index is acceptable, same with EntityBlock::UpdateIsCulled )
+// Visibility bit is only cleared, never set.
+// cameraIndex of kernels is bit index of the camera in visibility bytes of its camera group ( EntityBlock::GetCameraBitIndex ), so it's less than 8.
+//
+// Kernels are compiled with floating point contraction disabled, so every variant returns same result.
+
+namespace culling
+{
+	namespace entityCullingKernel
+	{
+		/// <summary>
+		/// Cull entities out of view frustum
+		/// </summary>
+		/// <param name="eightPlanes">SIMDFrustumPlanes::mFrustumPlanes</param>
+		/// <param name="positionAndRadius">EntityBlock::mWorldPositionAndWorldBoundingSphereRadius ( x, y, z, radius )</param>
+		/// <param name="visibleBitflag">EntityBlock::GetVisibleBitflag</param>
+		void ViewFrustumCulling_SSE4_1(const float* const eightPlanes, const float* const positionAndRadius, char* const visibleBitflag, const size_t entityCount, const size_t cameraIndex);
+		void ViewFrustumCulling_AVX2(const float* const eightPlanes, const float* const positionAndRadius, char* const visibleBitflag, const size_t entityCount, const size_t cameraIndex);
+		void ViewFrustumCulling_AVX512(const float* const eightPlanes, const float* const positionAndRadius, char* const visibleBitflag, const size_t entityCount, const size_t cameraIndex);
+
+		/// <summary>
+		/// Cull entities farther than desired max draw distance from camera
+		/// </summary>
+		/// <param name="cameraWorldPosition">x, y, z</param>
+		/// <param name="positionAndRadius">EntityBlock::mWorldPositionAndWorldBoundingSphereRadius ( x, y, z, radius )</param>
+		/// <param name="desiredMaxDrawDistance">EntityBlock::mDesiredMaxDrawDistance</param>
+		/// <param name="visibleBitflag">EntityBlock::GetVisibleBitflag</param>
+		void DistanceCulling_SSE4_1(const float* const cameraWorldPosition, const float* const positionAndRadius, const float* const desiredMaxDrawDistance, char* const visibleBitflag, const size_t entityCount, const size_t cameraIndex);
+		void DistanceCulling_AVX2(const float* const cameraWorldPosition, const float* const positionAndRadius, const float* const desiredMaxDrawDistance, char* const visibleBitflag, const size_t entityCount, const size_t cameraIndex);
+		void DistanceCulling_AVX512(const float* const cameraWorldPosition, const float* const positionAndRadius, const float* const desiredMaxDrawDistance, char* const visibleBitflag, const size_t entityCount, const size_t cameraIndex);
+
+		/// <summary>
+		/// Do distance culling and view frustum culling of entities for every camera of a camera group.
+		/// Bounding sphere of entities is loaded once for all cameras,
+		/// and visibility bytes of entities are written once after every camera is tested.
+		/// Result is same with calling DistanceCulling and ViewFrustumCulling kernel of enabled tests for each camera
+		/// </summary>
+		/// <param name="cameraEightPlanes">SIMDFrustumPlanes::mFrustumPlanes of first camera of the group. Planes of next cameras follow it ( 32 floats per camera )</param>
+		/// <param name="cameraWorldPositions">x, y, z of first camera of the group. Positions of next cameras follow it ( culling::Vec3 array )</param>
+		/// <param name="cameraBits">Bit i is set if camera of bit index i is tested</param>
+		/// <param name="positionAndRadius">EntityBlock::mWorldPositionAndWorldBoundingSphereRadius ( x, y, z, radius )</param>
+		/// <param name="desiredMaxDrawDistance">EntityBlock::mDesiredMaxDrawDistance</param>
+		/// <param name="visibleBitflag">EntityBlock::GetVisibleBitflag</param>
+		/// <param name="isDistanceCullingEnabled">If false, entities aren't culled by distance</param>
+		/// <param name="isViewFrustumCullingEnabled">If false, entities aren't culled by view frustum</param>
+		void MultiViewCulling_SSE4_1(const float* const cameraEightPlanes, const float* const cameraWorldPositions, const std::uint32_t cameraBits, const float* const positionAndRadius, const float* const desiredMaxDrawDistance, char* const visibleBitflag, const size_t entityCount, const bool isDistanceCullingEnabled, const bool isViewFrustumCullingEnabled);
+		void MultiViewCulling_AVX2(const float* const cameraEightPlanes, const float* const cameraWorldPositions, const std::uint32_t cameraBits, const float* const positionAndRadius, const float* const desiredMaxDrawDistance, char* const visibleBitflag, const size_t entityCount, const bool isDistanceCullingEnabled, const bool isViewFrustumCullingEnabled);
+		void MultiViewCulling_AVX512(const float* const cameraEightPlanes, const float* const cameraWorldPositions, const std::uint32_t cameraBits, const float* const positionAndRadius, const float* const desiredMaxDrawDistance, char* const visibleBitflag, const size_t entityCount, const bool isDistanceCullingEnabled, const bool isViewFrustumCullingEnabled);
+
+		/// <summary>
+		/// Write user data of entities visible from the camera to outUserDatas in entity order and return count of them ( stream compaction ).
+		/// Entries after returned count can be overwritten, so outUserDatas should have room for EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK entries
+		/// </summary>
+		/// <param name="visibleBitflag">EntityBlock::GetVisibleBitflag</param>
+		/// <param name="userDatas">EntityBlockColdData::mUserDatas</param>
+		size_t CompactVisibleEntities_SSE4_1(const char* const visibleBitflag, const std::uint64_t* const userDatas, const size_t entityCount, const size_t cameraIndex, std::uint64_t* const outUserDatas);
+		size_t CompactVisibleEntities_AVX2(const char* const visibleBitflag, const std::uint64_t* const userDatas, const size_t entityCount, const size_t cameraIndex, std::uint64_t* const outUserDatas);
+		size_t CompactVisibleEntities_AVX512(const char* const visibleBitflag, const std::uint64_t* const userDatas, const size_t entityCount, const size_t cameraIndex, std::uint64_t* const outUserDatas);
+
+		/// <summary>
+		/// Spread 8 bit mask to lowest bit of each byte
+		/// i-th byte of ( mask * 0x0101010101010101 ) & 0x8040201008040201 has only i-th bit of mask.
+		/// Adding 0x7F to the byte set highest bit of the byte if the byte isn't zero
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE std::uint64_t SpreadBitMaskToBytes(const std::uint64_t eightBitMask)
+		{
+			return ((((eightBitMask * 0x0101010101010101) & 0x8040201008040201) + 0x7F7F7F7F7F7F7F7F) >> 7) & 0x0101010101010101;
+		}
+
+		/// <summary>
+		/// Count of 1 bits of mask. Kernels aren't compiled with popcnt instruction
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE std::uint32_t CountSetBits(std::uint32_t mask)
+		{
+			mask = mask - ((mask >> 1) & 0x55555555);
+			mask = (mask & 0x33333333) + ((mask >> 2) & 0x33333333);
+			return (((mask + (mask >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24;
+		}
+
+		/// <summary>
+		/// Check if any of eight entities from visibleBitflag is visible from the camera
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE bool IsAnyOfEightEntityVisible(const char* const visibleBitflag, const size_t cameraIndex)
+		{
+			std::uint64_t visibleBitflags;
+			std::memcpy(&visibleBitflags, visibleBitflag, sizeof(std::uint64_t));
+			return (visibleBitflags & (0x0101010101010101 << cameraIndex)) != 0;
+		}
+
+		/// <summary>
+		/// Bit i is set if any of eight entities from visibleBitflag is visible from camera of bit index i
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE std::uint32_t GetCameraBitsOfEightEntity(const char* const visibleBitflag)
+		{
+			std::uint64_t visibleBitflags;
+			std::memcpy(&visibleBitflags, visibleBitflag, sizeof(std::uint64_t));
+			visibleBitflags |= visibleBitflags >> 32;
+			visibleBitflags |= visibleBitflags >> 16;
+			visibleBitflags |= visibleBitflags >> 8;
+			return static_cast<std::uint32_t>(visibleBitflags & 0xFF);
+		}
+
+		/// <summary>
+		/// Visible bit of the camera of eight entities whose bit of passedMask is 0. Used to clear bits of several cameras at once
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE std::uint64_t GetCulledBitsOfEightEntity(const std::uint32_t passedMask, const size_t cameraIndex)
+		{
+			return (~SpreadBitMaskToBytes(passedMask & 0xFF) & 0x0101010101010101) << cameraIndex;
+		}
+
+		/// <summary>
+		/// Clear visible bit of eight entities from visibleBitflag whose bit of passedMask is 0
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE void UpdateIsCulledOfEightEntity(char* const visibleBitflag, const std::uint32_t passedMask, const size_t cameraIndex)
+		{
+			std::uint64_t visibleBitflags;
+			std::memcpy(&visibleBitflags, visibleBitflag, sizeof(std::uint64_t));
+			visibleBitflags &= ~GetCulledBitsOfEightEntity(passedMask, cameraIndex);
+			std::memcpy(visibleBitflag, &visibleBitflags, sizeof(std::uint64_t));
+		}
+	}
+}
@@ -0,0 +1,249 @@
+#include "EntityCullingKernel.h"
+
+#include <immintrin.h>
+
+// This translation unit is compiled with AVX2
+
+namespace
+{
+	/// <summary>
+	/// Transpose AoS ( x, y, z, r ) of eight points to SoA
+	/// </summary>
+	EVERYCULLING_FORCE_INLINE void TransposeEightPoint
+	(
+		const float* const point, 
+		__m256& pointX, 
+		__m256& pointY, 
+		__m256& pointZ, 
+		__m256& pointR
+	)
+	{
+		// lane 0 ~ 3 of 128bit lane : point[0] ~ point[3], point[4] ~ point[7]
+		const __m256 point04 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(point + 0)), _mm_loadu_ps(point + 16), 1);
+		const __m256 point15 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(point + 4)), _mm_loadu_ps(point + 20), 1);
+		const __m256 point26 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(point + 8)), _mm_loadu_ps(point + 24), 1);
+		const __m256 point37 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(point + 12)), _mm_loadu_ps(point + 28), 1);
+
+		const __m256 xy01 = _mm256_unpacklo_ps(point04, point15); // x0 x1 y0 y1 | x4 x5 y4 y5
+		const __m256 zr01 = _mm256_unpackhi_ps(point04, point15); // z0 z1 r0 r1 | z4 z5 r4 r5
+		const __m256 xy23 = _mm256_unpacklo_ps(point26, point37); // x2 x3 y2 y3 | x6 x7 y6 y7
+		const __m256 zr23 = _mm256_unpackhi_ps(point26, point37); // z2 z3 r2 r3 | z6 z7 r6 r7
+
+		pointX = _mm256_shuffle_ps(xy01, xy23, _MM_SHUFFLE(1, 0, 1, 0));
+		pointY = _mm256_shuffle_ps(xy01, xy23, _MM_SHUFFLE(3, 2, 3, 2));
+		pointZ = _mm256_shuffle_ps(zr01, zr23, _MM_SHUFFLE(1, 0, 1, 0));
+		pointR = _mm256_shuffle_ps(zr01, zr23, _MM_SHUFFLE(3, 2, 3, 2));
+	}
+
+	struct CompactPermutationTable
+	{
+		alignas(32) std::uint32_t mIndices[16][8];
+	};
+
+	/// <summary>
+	/// mIndices[mask] moves 64 bit lanes of four bit mask to front for _mm256_permutevar8x32_epi32
+	/// </summary>
+	constexpr CompactPermutationTable MakeCompactPermutationTable()
+	{
+		CompactPermutationTable compactPermutationTable{};
+		for (std::uint32_t mask = 0; mask < 16; mask++)
+		{
+			std::uint32_t packedLaneIndex = 0;
+			for (std::uint32_t laneIndex = 0; laneIndex < 4; laneIndex++)
+			{
+				if ((mask & (1u << laneIndex)) != 0)
+				{
+					compactPermutationTable.mIndices[mask][packedLaneIndex * 2] = laneIndex * 2;
+					compactPermutationTable.mIndices[mask][packedLaneIndex * 2 + 1] = laneIndex * 2 + 1;
+					packedLaneIndex++;
+				}
+			}
+		}
+		return compactPermutationTable;
+	}
+
+	constexpr CompactPermutationTable COMPACT_PERMUTATION_TABLE = MakeCompactPermutationTable();
+}
+
+void culling::entityCullingKernel::ViewFrustumCulling_AVX2
+(
+	const float* const eightPlanes, 
+	const float* const positionAndRadius, 
+	char* const visibleBitflag, 
+	const size_t entityCount, 
+	const size_t cameraIndex
+)
+{
+	for (size_t entityIndex = 0; entityIndex < entityCount; entityIndex += 8)
+	{
+		// if all eight entities are already culled, skip test
+		if (IsAnyOfEightEntityVisible(visibleBitflag + entityIndex, cameraIndex) == false)
+		{
+			continue;
+		}
+
+		__m256 pointX, pointY, pointZ, pointR;
+		TransposeEightPoint(positionAndRadius + entityIndex * 4, pointX, pointY, pointZ, pointR);
+		pointR = _mm256_or_ps(_mm256_add_ps(pointR, _mm256_set1_ps(EVERYCULLING_BOUNDING_SPHRE_RADIUS_MARGIN)), _mm256_set1_ps(-0.0f)); // -r
+
+		__m256 isInFrustum = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+		for (size_t planeIndex = 0; planeIndex < 6; planeIndex++)
+		{
+			// component of plane 0 ~ 3 is stored at eightPlanes[0 ~ 3][planeIndex], plane 4, 5 is stored at eightPlanes[4 ~ 7][planeIndex - 4]
+			const float* const plane = (planeIndex < 4) ? (eightPlanes + planeIndex) : (eightPlanes + 16 + (planeIndex - 4));
+
+			// Same operation order with SSE4.1 kernel to get same result
+			__m256 dot = _mm256_add_ps(_mm256_mul_ps(pointZ, _mm256_broadcast_ss(plane + 8)), _mm256_broadcast_ss(plane + 12));
+			dot = _mm256_add_ps(_mm256_mul_ps(pointY, _mm256_broadcast_ss(plane + 4)), dot);
+			dot = _mm256_add_ps(_mm256_mul_ps(pointX, _mm256_broadcast_ss(plane + 0)), dot);
+
+			isInFrustum = _mm256_and_ps(isInFrustum, _mm256_cmp_ps(dot, pointR, _CMP_GT_OQ));
+		}
+
+		UpdateIsCulledOfEightEntity(visibleBitflag + entityIndex, static_cast<std::uint32_t>(_mm256_movemask_ps(isInFrustum)), cameraIndex);
+	}
+}
+
+void culling::entityCullingKernel::DistanceCulling_AVX2
+(
+	const float* const cameraWorldPosition, 
+	const float* const positionAndRadius, 
+	const float* const desiredMaxDrawDistance, 
+	char* const visibleBitflag, 
+	const size_t entityCount, 
+	const size_t cameraIndex
+)
+{
+	const __m256 cameraX = _mm256_set1_ps(cameraWorldPosition[0]);
+	const __m256 cameraY = _mm256_set1_ps(cameraWorldPosition[1]);
+	const __m256 cameraZ = _mm256_set1_ps(cameraWorldPosition[2]);
+
+	for (size_t entityIndex = 0; entityIndex < entityCount; entityIndex += 8)
+	{
+		if (IsAnyOfEightEntityVisible(visibleBitflag + entityIndex, cameraIndex) == false)
+		{
+			continue;
+		}
+
+		__m256 pointX, pointY, pointZ, pointR;
+		TransposeEightPoint(positionAndRadius + entityIndex * 4, pointX, pointY, pointZ, pointR);
+
+		const __m256 subX = _mm256_sub_ps(cameraX, pointX);
+		const __m256 subY = _mm256_sub_ps(cameraY, pointY);
+		const __m256 subZ = _mm256_sub_ps(cameraZ, pointZ);
+
+		// ( x * x + y * y ) + z * z. Same operation order with SSE4.1 kernel to get same result
+		const __m256 sqrDistance = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(subX, subX), _mm256_mul_ps(subY, subY)), _mm256_mul_ps(subZ, subZ));
+
+		const __m256 maxDrawDistance = _mm256_loadu_ps(desiredMaxDrawDistance + entityIndex);
+		const __m256 isInDrawDistance = _mm256_cmp_ps(sqrDistance, _mm256_mul_ps(maxDrawDistance, maxDrawDistance), _CMP_NGT_UQ); // !( sqrDistance > maxDrawDistance * maxDrawDistance )
+
+		UpdateIsCulledOfEightEntity(visibleBitflag + entityIndex, static_cast<std::uint32_t>(_mm256_movemask_ps(isInDrawDistance)), cameraIndex);
+	}
+}
+
+void culling::entityCullingKernel::MultiViewCulling_AVX2
+(
+	const float* const cameraEightPlanes,
+	const float* const cameraWorldPositions,
+	const std::uint32_t cameraBits,
+	const float* const positionAndRadius,
+	const float* const desiredMaxDrawDistance,
+	char* const visibleBitflag,
+	const size_t entityCount,
+	const bool isDistanceCullingEnabled,
+	const bool isViewFrustumCullingEnabled
+)
+{
+	for (size_t entityIndex = 0; entityIndex < entityCount; entityIndex += 8)
+	{
+		// cameras which all eight entities are already culled from are skipped
+		const std::uint32_t testedCameraBits = cameraBits & GetCameraBitsOfEightEntity(visibleBitflag + entityIndex);
+		if (testedCameraBits == 0)
+		{
+			continue;
+		}
+
+		__m256 pointX, pointY, pointZ, pointR;
+		TransposeEightPoint(positionAndRadius + entityIndex * 4, pointX, pointY, pointZ, pointR);
+		const __m256 negativeRadius = _mm256_or_ps(_mm256_add_ps(pointR, _mm256_set1_ps(EVERYCULLING_BOUNDING_SPHRE_RADIUS_MARGIN)), _mm256_set1_ps(-0.0f)); // -r
+		const __m256 maxDrawDistance = _mm256_loadu_ps(desiredMaxDrawDistance + entityIndex);
+		const __m256 sqrMaxDrawDistance = _mm256_mul_ps(maxDrawDistance, maxDrawDistance);
+
+		std::uint64_t culledBits = 0;
+		for (size_t cameraIndex = 0; cameraIndex < 8; cameraIndex++)
+		{
+			if ((testedCameraBits & (1u << cameraIndex)) == 0)
+			{
+				continue;
+			}
+
+			// Same operations with DistanceCulling_AVX2 and ViewFrustumCulling_AVX2
+			__m256 isVisible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+			if (isDistanceCullingEnabled == true)
+			{
+				const float* const cameraWorldPosition = cameraWorldPositions + cameraIndex * 3;
+				const __m256 subX = _mm256_sub_ps(_mm256_set1_ps(cameraWorldPosition[0]), pointX);
+				const __m256 subY = _mm256_sub_ps(_mm256_set1_ps(cameraWorldPosition[1]), pointY);
+				const __m256 subZ = _mm256_sub_ps(_mm256_set1_ps(cameraWorldPosition[2]), pointZ);
+				const __m256 sqrDistance = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(subX, subX), _mm256_mul_ps(subY, subY)), _mm256_mul_ps(subZ, subZ));
+
+				isVisible = _mm256_cmp_ps(sqrDistance, sqrMaxDrawDistance, _CMP_NGT_UQ);
+			}
+
+			if (isViewFrustumCullingEnabled == true)
+			{
+				const float* const eightPlanes = cameraEightPlanes + cameraIndex * 32;
+				for (size_t planeIndex = 0; planeIndex < 6; planeIndex++)
+				{
+					const float* const plane = (planeIndex < 4) ? (eightPlanes + planeIndex) : (eightPlanes + 16 + (planeIndex - 4));
+
+					__m256 dot = _mm256_add_ps(_mm256_mul_ps(pointZ, _mm256_broadcast_ss(plane + 8)), _mm256_broadcast_ss(plane + 12));
+					dot = _mm256_add_ps(_mm256_mul_ps(pointY, _mm256_broadcast_ss(plane + 4)), dot);
+					dot = _mm256_add_ps(_mm256_mul_ps(pointX, _mm256_broadcast_ss(plane + 0)), dot);
+
+					isVisible = _mm256_and_ps(isVisible, _mm256_cmp_ps(dot, negativeRadius, _CMP_GT_OQ));
+				}
+			}
+
+			culledBits |= GetCulledBitsOfEightEntity(static_cast<std::uint32_t>(_mm256_movemask_ps(isVisible)), cameraIndex);
+		}
+
+		// Bits of every camera are written with one store
+		std::uint64_t visibleBitflags;
+		std::memcpy(&visibleBitflags, visibleBitflag + entityIndex, sizeof(std::uint64_t));
+		visibleBitflags &= ~culledBits;
+		std::memcpy(visibleBitflag + entityIndex, &visibleBitflags, sizeof(std::uint64_t));
+	}
+}
+
+size_t culling::entityCullingKernel::CompactVisibleEntities_AVX2
+(
+	const char* const visibleBitflag, 
+	const std::uint64_t* const userDatas, 
+	const size_t entityCount, 
+	const size_t cameraIndex, 
+	std::uint64_t* const outUserDatas
+)
+{
+	const __m128i cameraBit = _mm_set1_epi8(static_cast<char>(1 << cameraIndex));
+	const __m128i visibleBit = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(visibleBitflag)), cameraBit);
+	const std::uint32_t visibleMask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(visibleBit, cameraBit))) & ((1u << entityCount) - 1);
+
+	size_t visibleEntityCount = 0;
+	for (size_t entityIndex = 0; entityIndex < entityCount; entityIndex += 4)
+	{
+		const std::uint32_t fourEntityMask = (visibleMask >> entityIndex) & 0xF;
+		if (fourEntityMask == 0)
+		{
+			continue;
+		}
+
+		// Four entries are stored and output position advances by count of visible entities
+		const __m256i fourUserData = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(userDatas + entityIndex));
+		const __m256i permutation = _mm256_load_si256(reinterpret_cast<const __m256i*>(COMPACT_PERMUTATION_TABLE.mIndices[fourEntityMask]));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(outUserDatas + visibleEntityCount), _mm256_permutevar8x32_epi32(fourUserData, permutation));
+		visibleEntityCount += CountSetBits(fourEntityMask);
+	}
+	return visibleEntityCount;
+}
@@ -0,0 +1,249 @@
+#include "EntityCullingKernel.h"
+
+#if EVERYCULLING_AVX512_KERNEL == 1
+
+#include <immintrin.h>
+
+// This translation unit is compiled with AVX512F
+
+namespace
+{
+	/// <summary>
+	/// Transpose AoS ( x, y, z, r ) of sixteen points to SoA
+	/// </summary>
+	EVERYCULLING_FORCE_INLINE void TransposeSixteenPoint
+	(
+		const float* const point, 
+		__m512& pointX, 
+		__m512& pointY, 
+		__m512& pointZ, 
+		__m512& pointR
+	)
+	{
+		const __m512 point0123 = _mm512_loadu_ps(point + 0);
+		const __m512 point4567 = _mm512_loadu_ps(point + 16);
+		const __m512 point89AB = _mm512_loadu_ps(point + 32);
+		const __m512 pointCDEF = _mm512_loadu_ps(point + 48);
+
+		const __m512i xIndex = _mm512_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28, 0, 4, 8, 12, 16, 20, 24, 28);
+		const __m512i yIndex = _mm512_setr_epi32(1, 5, 9, 13, 17, 21, 25, 29, 1, 5, 9, 13, 17, 21, 25, 29);
+		const __m512i zIndex = _mm512_setr_epi32(2, 6, 10, 14, 18, 22, 26, 30, 2, 6, 10, 14, 18, 22, 26, 30);
+		const __m512i rIndex = _mm512_setr_epi32(3, 7, 11, 15, 19, 23, 27, 31, 3, 7, 11, 15, 19, 23, 27, 31);
+
+		// lower 256 bit : component of point 0 ~ 7, higher 256 bit : same with lower 256 bit
+		const __m512 x01234567 = _mm512_permutex2var_ps(point0123, xIndex, point4567);
+		const __m512 y01234567 = _mm512_permutex2var_ps(point0123, yIndex, point4567);
+		const __m512 z01234567 = _mm512_permutex2var_ps(point0123, zIndex, point4567);
+		const __m512 r01234567 = _mm512_permutex2var_ps(point0123, rIndex, point4567);
+
+		const __m512 x89ABCDEF = _mm512_permutex2var_ps(point89AB, xIndex, pointCDEF);
+		const __m512 y89ABCDEF = _mm512_permutex2var_ps(point89AB, yIndex, pointCDEF);
+		const __m512 z89ABCDEF = _mm512_permutex2var_ps(point89AB, zIndex, pointCDEF);
+		const __m512 r89ABCDEF = _mm512_permutex2var_ps(point89AB, rIndex, pointCDEF);
+
+		pointX = _mm512_shuffle_f32x4(x01234567, x89ABCDEF, _MM_SHUFFLE(1, 0, 1, 0));
+		pointY = _mm512_shuffle_f32x4(y01234567, y89ABCDEF, _MM_SHUFFLE(1, 0, 1, 0));
+		pointZ = _mm512_shuffle_f32x4(z01234567, z89ABCDEF, _MM_SHUFFLE(1, 0, 1, 0));
+		pointR = _mm512_shuffle_f32x4(r01234567, r89ABCDEF, _MM_SHUFFLE(1, 0, 1, 0));
+	}
+
+	/// <summary>
+	/// Check if any of entities from visibleBitflag is visible from the camera, and return 16 bit mask of visible entities
+	/// </summary>
+	EVERYCULLING_FORCE_INLINE std::uint32_t GetVisibleMaskOfSixteenEntity(const char* const visibleBitflag, const size_t entityCount, const size_t cameraIndex)
+	{
+		std::uint32_t visibleMask = 0;
+		for (size_t entityIndex = 0; entityIndex < entityCount && entityIndex < 16; entityIndex++)
+		{
+			visibleMask |= (std::uint32_t)((visibleBitflag[entityIndex] >> cameraIndex) & 1) << entityIndex;
+		}
+		return visibleMask;
+	}
+
+	EVERYCULLING_FORCE_INLINE void UpdateIsCulledOfSixteenEntity(char* const visibleBitflag, const __mmask16 passedMask, const size_t cameraIndex)
+	{
+		culling::entityCullingKernel::UpdateIsCulledOfEightEntity(visibleBitflag, static_cast<std::uint32_t>(passedMask) & 0xFF, cameraIndex);
+		culling::entityCullingKernel::UpdateIsCulledOfEightEntity(visibleBitflag + 8, static_cast<std::uint32_t>(passedMask) >> 8, cameraIndex);
+	}
+}
+
+void culling::entityCullingKernel::ViewFrustumCulling_AVX512
+(
+	const float* const eightPlanes, 
+	const float* const positionAndRadius, 
+	char* const visibleBitflag, 
+	const size_t entityCount, 
+	const size_t cameraIndex
+)
+{
+	for (size_t entityIndex = 0; entityIndex < entityCount; entityIndex += 16)
+	{
+		// if all sixteen entities are already culled, skip test
+		if (GetVisibleMaskOfSixteenEntity(visibleBitflag + entityIndex, entityCount - entityIndex, cameraIndex) == 0)
+		{
+			continue;
+		}
+
+		__m512 pointX, pointY, pointZ, pointR;
+		TransposeSixteenPoint(positionAndRadius + entityIndex * 4, pointX, pointY, pointZ, pointR);
+		pointR = _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(_mm512_add_ps(pointR, _mm512_set1_ps(EVERYCULLING_BOUNDING_SPHRE_RADIUS_MARGIN))), _mm512_set1_epi32(static_cast<int>(0x80000000)))); // -r
+
+		__mmask16 isInFrustum = 0xFFFF;
+		for (size_t planeIndex = 0; planeIndex < 6; planeIndex++)
+		{
+			// component of plane 0 ~ 3 is stored at eightPlanes[0 ~ 3][planeIndex], plane 4, 5 is stored at eightPlanes[4 ~ 7][planeIndex - 4]
+			const float* const plane = (planeIndex < 4) ? (eightPlanes + planeIndex) : (eightPlanes + 16 + (planeIndex - 4));
+
+			// Same operation order with SSE4.1 kernel to get same result
+			__m512 dot = _mm512_add_ps(_mm512_mul_ps(pointZ, _mm512_set1_ps(plane[8])), _mm512_set1_ps(plane[12]));
+			dot = _mm512_add_ps(_mm512_mul_ps(pointY, _mm512_set1_ps(plane[4])), dot);
+			dot = _mm512_add_ps(_mm512_mul_ps(pointX, _mm512_set1_ps(plane[0])), dot);
+
+			isInFrustum = _mm512_mask_cmp_ps_mask(isInFrustum, dot, pointR, _CMP_GT_OQ);
+		}
+
+		UpdateIsCulledOfSixteenEntity(visibleBitflag + entityIndex, isInFrustum, cameraIndex);
+	}
+}
+
+void culling::entityCullingKernel::DistanceCulling_AVX512
+(
+	const float* const cameraWorldPosition, 
+	const float* const positionAndRadius, 
+	const float* const desiredMaxDrawDistance, 
+	char* const visibleBitflag, 
+	const size_t entityCount, 
+	const size_t cameraIndex
+)
+{
+	const __m512 cameraX = _mm512_set1_ps(cameraWorldPosition[0]);
+	const __m512 cameraY = _mm512_set1_ps(cameraWorldPosition[1]);
+	const __m512 cameraZ = _mm512_set1_ps(cameraWorldPosition[2]);
+
+	for (size_t entityIndex = 0; entityIndex < entityCount; entityIndex += 16)
+	{
+		if (GetVisibleMaskOfSixteenEntity(visibleBitflag + entityIndex, entityCount - entityIndex, cameraIndex) == 0)
+		{
+			continue;
+		}
+
+		__m512 pointX, pointY, pointZ, pointR;
+		TransposeSixteenPoint(positionAndRadius + entityIndex * 4, pointX, pointY, pointZ, pointR);
+
+		const __m512 subX = _mm512_sub_ps(cameraX, pointX);
+		const __m512 subY = _mm512_sub_ps(cameraY, pointY);
+		const __m512 subZ = _mm512_sub_ps(cameraZ, pointZ);
+
+		// ( x * x + y * y ) + z * z. Same operation order with SSE4.1 kernel to get same result
+		const __m512 sqrDistance = _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(subX, subX), _mm512_mul_ps(subY, subY)), _mm512_mul_ps(subZ, subZ));
+
+		const __m512 maxDrawDistance = _mm512_loadu_ps(desiredMaxDrawDistance + entityIndex);
+		const __mmask16 isInDrawDistance = _mm512_cmp_ps_mask(sqrDistance, _mm512_mul_ps(maxDrawDistance, maxDrawDistance), _CMP_NGT_UQ); // !( sqrDistance > maxDrawDistance * maxDrawDistance )
+
+		UpdateIsCulledOfSixteenEntity(visibleBitflag + entityIndex, isInDrawDistance, cameraIndex);
+	}
+}
+
+void culling::entityCullingKernel::MultiViewCulling_AVX512
+(
+	const float* const cameraEightPlanes,
+	const float* const cameraWorldPositions,
+	const std::uint32_t cameraBits,
+	const float* const positionAndRadius,
+	const float* const desiredMaxDrawDistance,
+	char* const visibleBitflag,
+	const size_t entityCount,
+	const bool isDistanceCullingEnabled,
+	const bool isViewFrustumCullingEnabled
+)
+{
+	for (size_t entityIndex = 0; entityIndex < entityCount; entityIndex += 16)
+	{
+		// cameras which all sixteen entities are already culled from are skipped
+		const std::uint32_t testedCameraBits = cameraBits & (GetCameraBitsOfEightEntity(visibleBitflag + entityIndex) | GetCameraBitsOfEightEntity(visibleBitflag + entityIndex + 8));
+		if (testedCameraBits == 0)
+		{
+			continue;
+		}
+
+		__m512 pointX, pointY, pointZ, pointR;
+		TransposeSixteenPoint(positionAndRadius + entityIndex * 4, pointX, pointY, pointZ, pointR);
+		const __m512 negativeRadius = _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(_mm512_add_ps(pointR, _mm512_set1_ps(EVERYCULLING_BOUNDING_SPHRE_RADIUS_MARGIN))), _mm512_set1_epi32(static_cast<int>(0x80000000)))); // -r
+		const __m512 maxDrawDistance = _mm512_loadu_ps(desiredMaxDrawDistance + entityIndex);
+		const __m512 sqrMaxDrawDistance = _mm512_mul_ps(maxDrawDistance, maxDrawDistance);
+
+		std::uint64_t culledBits[2] = { 0, 0 };
+		for (size_t cameraIndex = 0; cameraIndex < 8; cameraIndex++)
+		{
+			if ((testedCameraBits & (1u << cameraIndex)) == 0)
+			{
+				continue;
+			}
+
+			// Same operations with DistanceCulling_AVX512 and ViewFrustumCulling_AVX512
+			__mmask16 isVisible = static_cast<__mmask16>(0xFFFF);
+			if (isDistanceCullingEnabled == true)
+			{
+				const float* const cameraWorldPosition = cameraWorldPositions + cameraIndex * 3;
+				const __m512 subX = _mm512_sub_ps(_mm512_set1_ps(cameraWorldPosition[0]), pointX);
+				const __m512 subY = _mm512_sub_ps(_mm512_set1_ps(cameraWorldPosition[1]), pointY);
+				const __m512 subZ = _mm512_sub_ps(_mm512_set1_ps(cameraWorldPosition[2]), pointZ);
+				const __m512 sqrDistance = _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(subX, subX), _mm512_mul_ps(subY, subY)), _mm512_mul_ps(subZ, subZ));
+
+				isVisible = _mm512_cmp_ps_mask(sqrDistance, sqrMaxDrawDistance, _CMP_NGT_UQ);
+			}
+
+			if (isViewFrustumCullingEnabled == true)
+			{
+				const float* const eightPlanes = cameraEightPlanes + cameraIndex * 32;
+				for (size_t planeIndex = 0; planeIndex < 6; planeIndex++)
+				{
+					const float* const plane = (planeIndex < 4) ? (eightPlanes + planeIndex) : (eightPlanes + 16 + (planeIndex - 4));
+
+					__m512 dot = _mm512_add_ps(_mm512_mul_ps(pointZ, _mm512_set1_ps(plane[8])), _mm512_set1_ps(plane[12]));
+					dot = _mm512_add_ps(_mm512_mul_ps(pointY, _mm512_set1_ps(plane[4])), dot);
+					dot = _mm512_add_ps(_mm512_mul_ps(pointX, _mm512_set1_ps(plane[0])), dot);
+
+					isVisible = _mm512_mask_cmp_ps_mask(isVisible, dot, negativeRadius, _CMP_GT_OQ);
+				}
+			}
+
+			culledBits[0] |= GetCulledBitsOfEightEntity(static_cast<std::uint32_t>(isVisible) & 0xFF, cameraIndex);
+			culledBits[1] |= GetCulledBitsOfEightEntity(static_cast<std::uint32_t>(isVisible) >> 8, cameraIndex);
+		}
+
+		// Bits of every camera are written with one store
+		const __m128i visibleBitflags = _mm_loadu_si128(reinterpret_cast<const __m128i*>(visibleBitflag + entityIndex));
+		const __m128i culledBitflags = _mm_set_epi64x(static_cast<long long>(culledBits[1]), static_cast<long long>(culledBits[0]));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(visibleBitflag + entityIndex), _mm_andnot_si128(culledBitflags, visibleBitflags));
+	}
+}
+
+size_t culling::entityCullingKernel::CompactVisibleEntities_AVX512
+(
+	const char* const visibleBitflag, 
+	const std::uint64_t* const userDatas, 
+	const size_t entityCount, 
+	const size_t cameraIndex, 
+	std::uint64_t* const outUserDatas
+)
+{
+	const std::uint32_t visibleMask = GetVisibleMaskOfSixteenEntity(visibleBitflag, entityCount, cameraIndex);
+
+	size_t visibleEntityCount = 0;
+	for (size_t entityIndex = 0; entityIndex < entityCount; entityIndex += 8)
+	{
+		const __mmask8 eightEntityMask = static_cast<__mmask8>(visibleMask >> entityIndex);
+		if (eightEntityMask == 0)
+		{
+			continue;
+		}
+
+		const __m512i eightUserData = _mm512_loadu_si512(userDatas + entityIndex);
+		_mm512_storeu_si512(outUserDatas + visibleEntityCount, _mm512_maskz_compress_epi64(eightEntityMask, eightUserData));
+		visibleEntityCount += CountSetBits(eightEntityMask);
+	}
+	return visibleEntityCount;
+}
+
+#endif
@@ -0,0 +1,203 @@
+#include "EntityCullingKernel.h"
+
+#include <smmintrin.h>
+
+// This translation unit is compiled with SSE4.1 ( without AVX )
+
+void culling::entityCullingKernel::ViewFrustumCulling_SSE4_1
+(
+	const float* const eightPlanes, 
+	const float* const positionAndRadius, 
+	char* const visibleBitflag, 
+	const size_t entityCount, 
+	const size_t cameraIndex
+)
+{
+	const __m128* const m128f_eightPlanes = reinterpret_cast<const __m128*>(eightPlanes); // x of plane 0, 1, 2, 3  and y of plane 0, 1, 2, 3 
+	const __m128 radiusMargin = _mm_set1_ps(EVERYCULLING_BOUNDING_SPHRE_RADIUS_MARGIN);
+	const __m128 negativeZero = _mm_set1_ps(-0.0f);
+
+	for (size_t entityIndex = 0; entityIndex < entityCount; entityIndex += 2)
+	{
+		const bool isFirstEntityVisible = (visibleBitflag[entityIndex] & (1 << cameraIndex)) != 0;
+		const bool isSecondEntityVisible = (entityIndex + 1 < entityCount) && ((visibleBitflag[entityIndex + 1] & (1 << cameraIndex)) != 0);
+		if (isFirstEntityVisible == false && isSecondEntityVisible == false)
+		{
+			continue;
+		}
+
+		const __m128 pointA = _mm_load_ps(positionAndRadius + entityIndex * 4);
+		const __m128 pointB = _mm_load_ps(positionAndRadius + entityIndex * 4 + 4);
+
+		const __m128 posA_xxxx = _mm_shuffle_ps(pointA, pointA, _MM_SHUFFLE(0, 0, 0, 0));
+		const __m128 posA_yyyy = _mm_shuffle_ps(pointA, pointA, _MM_SHUFFLE(1, 1, 1, 1));
+		const __m128 posA_zzzz = _mm_shuffle_ps(pointA, pointA, _MM_SHUFFLE(2, 2, 2, 2));
+		const __m128 posA_rrrr = _mm_or_ps(_mm_add_ps(_mm_shuffle_ps(pointA, pointA, _MM_SHUFFLE(3, 3, 3, 3)), radiusMargin), negativeZero); // -r
+
+		__m128 dotPosA = _mm_add_ps(_mm_mul_ps(posA_zzzz, m128f_eightPlanes[2]), m128f_eightPlanes[3]);
+		dotPosA = _mm_add_ps(_mm_mul_ps(posA_yyyy, m128f_eightPlanes[1]), dotPosA);
+		dotPosA = _mm_add_ps(_mm_mul_ps(posA_xxxx, m128f_eightPlanes[0]), dotPosA); // dot Pos A with Plane 0, dot Pos A with Plane 1, dot Pos A with Plane 2, dot Pos A with Plane 3
+
+		const __m128 posB_xxxx = _mm_shuffle_ps(pointB, pointB, _MM_SHUFFLE(0, 0, 0, 0));
+		const __m128 posB_yyyy = _mm_shuffle_ps(pointB, pointB, _MM_SHUFFLE(1, 1, 1, 1));
+		const __m128 posB_zzzz = _mm_shuffle_ps(pointB, pointB, _MM_SHUFFLE(2, 2, 2, 2));
+		const __m128 posB_rrrr = _mm_or_ps(_mm_add_ps(_mm_shuffle_ps(pointB, pointB, _MM_SHUFFLE(3, 3, 3, 3)), radiusMargin), negativeZero); // -r
+
+		__m128 dotPosB = _mm_add_ps(_mm_mul_ps(posB_zzzz, m128f_eightPlanes[2]), m128f_eightPlanes[3]);
+		dotPosB = _mm_add_ps(_mm_mul_ps(posB_yyyy, m128f_eightPlanes[1]), dotPosB);
+		dotPosB = _mm_add_ps(_mm_mul_ps(posB_xxxx, m128f_eightPlanes[0]), dotPosB); // dot Pos B with Plane 0, dot Pos B with Plane 1, dot Pos B with Plane 2, dot Pos B with Plane 3
+
+		const __m128 posAB_xxxx = _mm_shuffle_ps(pointA, pointB, _MM_SHUFFLE(0, 0, 0, 0)); // x of point A, x of point A, x of point B, x of point B
+		const __m128 posAB_yyyy = _mm_shuffle_ps(pointA, pointB, _MM_SHUFFLE(1, 1, 1, 1));
+		const __m128 posAB_zzzz = _mm_shuffle_ps(pointA, pointB, _MM_SHUFFLE(2, 2, 2, 2));
+		const __m128 posAB_rrrr = _mm_or_ps(_mm_add_ps(_mm_shuffle_ps(pointA, pointB, _MM_SHUFFLE(3, 3, 3, 3)), radiusMargin), negativeZero);
+
+		__m128 dotPosAB45 = _mm_add_ps(_mm_mul_ps(posAB_zzzz, m128f_eightPlanes[6]), m128f_eightPlanes[7]);
+		dotPosAB45 = _mm_add_ps(_mm_mul_ps(posAB_yyyy, m128f_eightPlanes[5]), dotPosAB45);
+		dotPosAB45 = _mm_add_ps(_mm_mul_ps(posAB_xxxx, m128f_eightPlanes[4]), dotPosAB45); // dot Pos A with Plane 4, 5, dot Pos B with Plane 4, 5
+
+		dotPosA = _mm_cmpgt_ps(dotPosA, posA_rrrr); // if elemenet[i] have value 1, Pos A is in frustum Plane[i] ( 0 <= i < 4 )
+		dotPosB = _mm_cmpgt_ps(dotPosB, posB_rrrr); // if elemenet[i] have value 1, Pos B is in frustum Plane[i] ( 0 <= i < 4 )
+		dotPosAB45 = _mm_cmpgt_ps(dotPosAB45, posAB_rrrr);
+
+		const __m128 dotPosA45 = _mm_blend_ps(dotPosAB45, dotPosA, 0xC); // Is In Plane with Plane[4], Plane[5], Plane[2], Plane[3]
+		const __m128 dotPosB45 = _mm_blend_ps(dotPosB, dotPosAB45, 0xC); // Is In Plane with Plane[0], Plane[1], Plane[4], Plane[5]
+
+		const __m128 RMaskA = _mm_and_ps(dotPosA, dotPosA45); //when everty bits is 1, PointA is in frustum
+		const __m128 RMaskB = _mm_and_ps(dotPosB, dotPosB45); //when everty bits is 1, PointB is in frustum
+
+		const bool isPointAInFrustum = _mm_movemask_ps(RMaskA) == 0xF;
+		const bool isPointBInFrustum = _mm_movemask_ps(RMaskB) == 0xF;
+
+		visibleBitflag[entityIndex] &= ~((char)(!isPointAInFrustum) << cameraIndex);
+		visibleBitflag[entityIndex + 1] &= ~((char)(!isPointBInFrustum) << cameraIndex);
+	}
+}
+
+void culling::entityCullingKernel::DistanceCulling_SSE4_1
+(
+	const float* const cameraWorldPosition, 
+	const float* const positionAndRadius, 
+	const float* const desiredMaxDrawDistance, 
+	char* const visibleBitflag, 
+	const size_t entityCount, 
+	const size_t cameraIndex
+)
+{
+	const __m128 vectorizedCameraWorldPos = _mm_setr_ps(cameraWorldPosition[0], cameraWorldPosition[1], cameraWorldPosition[2], 0.0f);
+
+	for (size_t entityIndex = 0; entityIndex < entityCount; entityIndex++)
+	{
+		const __m128 subOfCameraWorldPosAndEntityPos = _mm_sub_ps(vectorizedCameraWorldPos, _mm_load_ps(positionAndRadius + entityIndex * 4));
+		const __m128 sqrOfSubOfCameraWorldPosAndEntityPos = _mm_mul_ps(subOfCameraWorldPosAndEntityPos, subOfCameraWorldPosAndEntityPos);
+
+		float sqrOfSub[4];
+		_mm_storeu_ps(sqrOfSub, sqrOfSubOfCameraWorldPosAndEntityPos);
+		const float sqrDistance = sqrOfSub[0] + sqrOfSub[1] + sqrOfSub[2];
+
+		const bool isCulled = sqrDistance > desiredMaxDrawDistance[entityIndex] * desiredMaxDrawDistance[entityIndex];
+		visibleBitflag[entityIndex] &= ~((char)isCulled << cameraIndex);
+	}
+}
+
+void culling::entityCullingKernel::MultiViewCulling_SSE4_1
+(
+	const float* const cameraEightPlanes,
+	const float* const cameraWorldPositions,
+	const std::uint32_t cameraBits,
+	const float* const positionAndRadius,
+	const float* const desiredMaxDrawDistance,
+	char* const visibleBitflag,
+	const size_t entityCount,
+	const bool isDistanceCullingEnabled,
+	const bool isViewFrustumCullingEnabled
+)
+{
+	for (size_t entityIndex = 0; entityIndex < entityCount; entityIndex += 4)
+	{
+		std::uint32_t visibleBitflags;
+		std::memcpy(&visibleBitflags, visibleBitflag + entityIndex, sizeof(std::uint32_t));
+
+		// cameras which all four entities are already culled from are skipped
+		const std::uint32_t testedCameraBits = cameraBits & (visibleBitflags | (visibleBitflags >> 8) | (visibleBitflags >> 16) | (visibleBitflags >> 24)) & 0xFF;
+		if (testedCameraBits == 0)
+		{
+			continue;
+		}
+
+		// Four entities are tested at once instead of two entities of ViewFrustumCulling_SSE4_1. Each dot product is computed in same order
+		__m128 pointX = _mm_load_ps(positionAndRadius + entityIndex * 4);
+		__m128 pointY = _mm_load_ps(positionAndRadius + entityIndex * 4 + 4);
+		__m128 pointZ = _mm_load_ps(positionAndRadius + entityIndex * 4 + 8);
+		__m128 pointR = _mm_load_ps(positionAndRadius + entityIndex * 4 + 12);
+		_MM_TRANSPOSE4_PS(pointX, pointY, pointZ, pointR);
+		const __m128 negativeRadius = _mm_or_ps(_mm_add_ps(pointR, _mm_set1_ps(EVERYCULLING_BOUNDING_SPHRE_RADIUS_MARGIN)), _mm_set1_ps(-0.0f)); // -r
+		const __m128 maxDrawDistance = _mm_loadu_ps(desiredMaxDrawDistance + entityIndex);
+		const __m128 sqrMaxDrawDistance = _mm_mul_ps(maxDrawDistance, maxDrawDistance);
+
+		std::uint64_t culledBits = 0;
+		for (size_t cameraIndex = 0; cameraIndex < 8; cameraIndex++)
+		{
+			if ((testedCameraBits & (1u << cameraIndex)) == 0)
+			{
+				continue;
+			}
+
+			__m128 isVisible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+			if (isDistanceCullingEnabled == true)
+			{
+				const float* const cameraWorldPosition = cameraWorldPositions + cameraIndex * 3;
+				const __m128 subX = _mm_sub_ps(_mm_set1_ps(cameraWorldPosition[0]), pointX);
+				const __m128 subY = _mm_sub_ps(_mm_set1_ps(cameraWorldPosition[1]), pointY);
+				const __m128 subZ = _mm_sub_ps(_mm_set1_ps(cameraWorldPosition[2]), pointZ);
+				const __m128 sqrDistance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(subX, subX), _mm_mul_ps(subY, subY)), _mm_mul_ps(subZ, subZ));
+
+				isVisible = _mm_cmpngt_ps(sqrDistance, sqrMaxDrawDistance);
+			}
+
+			if (isViewFrustumCullingEnabled == true)
+			{
+				const float* const eightPlanes = cameraEightPlanes + cameraIndex * 32;
+				for (size_t planeIndex = 0; planeIndex < 6; planeIndex++)
+				{
+					const float* const plane = (planeIndex < 4) ? (eightPlanes + planeIndex) : (eightPlanes + 16 + (planeIndex - 4));
+
+					__m128 dot = _mm_add_ps(_mm_mul_ps(pointZ, _mm_set1_ps(plane[8])), _mm_set1_ps(plane[12]));
+					dot = _mm_add_ps(_mm_mul_ps(pointY, _mm_set1_ps(plane[4])), dot);
+					dot = _mm_add_ps(_mm_mul_ps(pointX, _mm_set1_ps(plane[0])), dot);
+
+					isVisible = _mm_and_ps(isVisible, _mm_cmpgt_ps(dot, negativeRadius));
+				}
+			}
+
+			culledBits |= GetCulledBitsOfEightEntity(static_cast<std::uint32_t>(_mm_movemask_ps(isVisible)), cameraIndex);
+		}
+
+		// Bits of every camera are written with one store
+		visibleBitflags &= ~static_cast<std::uint32_t>(culledBits);
+		std::memcpy(visibleBitflag + entityIndex, &visibleBitflags, sizeof(std::uint32_t));
+	}
+}
+
+size_t culling::entityCullingKernel::CompactVisibleEntities_SSE4_1
+(
+	const char* const visibleBitflag, 
+	const std::uint64_t* const userDatas, 
+	const size_t entityCount, 
+	const size_t cameraIndex, 
+	std::uint64_t* const outUserDatas
+)
+{
+	const __m128i cameraBit = _mm_set1_epi8(static_cast<char>(1 << cameraIndex));
+	const __m128i visibleBit = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(visibleBitflag)), cameraBit);
+	const std::uint32_t visibleMask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(visibleBit, cameraBit))) & ((1u << entityCount) - 1);
+
+	// Every entry is written and output position advances only for visible entity, so there is no branch
+	size_t visibleEntityCount = 0;
+	for (size_t entityIndex = 0; entityIndex < entityCount; entityIndex++)
+	{
+		outUserDatas[visibleEntityCount] = userDatas[entityIndex];
+		visibleEntityCount += (visibleMask >> entityIndex) & 1;
+	}
+	return visibleEntityCount;
+}
@@ -0,0 +1,81 @@
+#include "FusedCulling.h"
+
+#include "../../EveryCulling.h"
+#include "../PreCulling/PreCulling.h"
+#include "../DistanceCulling/DistanceCulling.h"
+#include "../ViewFrustumCulling/ViewFrustumCulling.h"
+
+void culling::FusedCulling::DoFusedCulling
+(
+	const size_t cameraIndex,
+	culling::EntityBlock* const entityBlock
+)
+{
+	assert(entityBlock->mCurrentEntityCount != 0);
+
+	const size_t entityCount = entityBlock->mCurrentEntityCount;
+
+	// PreCulling : Cull disabled entities, update bounding sphere of enabled entities
+	for (size_t entityIndex = 0; entityIndex < entityCount; entityIndex++)
+	{
+		if (entityBlock->GetIsObjectEnabled(entityIndex) == true)
+		{
+			entityBlock->UpdateBoundingSphereRadius(entityIndex);
+		}
+		else
+		{
+			entityBlock->SetCulled(entityIndex, cameraIndex);
+		}
+	}
+	entityBlock->UpdateAggregateBoundingVolume(mCullingSystem->GetTickCount());
+
+	// DistanceCulling, ViewFrustumCulling run only while their modules are enabled, so result is same with separated culling modules
+	if (mCullingSystem->mDistanceCulling->IsEnabled == true)
+	{
+		mCullingSystem->mDistanceCulling->DoDistanceCulling(cameraIndex, entityBlock);
+	}
+
+	// ViewFrustumCulling ( entities already culled are skipped )
+	if (mCullingSystem->mViewFrustumCulling->IsEnabled == true)
+	{
+		mCullingSystem->mViewFrustumCulling->DoViewFrustumCulling(cameraIndex, entityBlock);
+	}
+
+	// PreCulling : Project aabb of survived entities to screen space
+	PreCulling* const preCulling = mCullingSystem->mPreCulling.get();
+	for (size_t entityIndex = 0; entityIndex < entityCount; entityIndex++)
+	{
+		if (entityBlock->GetIsCulled(entityIndex, cameraIndex) == false)
+		{
+			preCulling->ComputeScreenSpaceMinMaxAABBAndMinZ(cameraIndex, entityBlock, entityIndex);
+		}
+	}
+}
+
+culling::FusedCulling::FusedCulling(EveryCulling* const everyCulling)
+	: CullingModule(everyCulling)
+{
+	IsEnabled = false;
+}
+
+void culling::FusedCulling::CullBlockEntityJob(const size_t cameraIndex, const unsigned long long currentTickCount)
+{
+	while (true)
+	{
+		culling::EntityBlock* const nextEntityBlock = GetNextEntityBlock(cameraIndex);
+
+		if (nextEntityBlock != nullptr)
+		{
+			DoFusedCulling(cameraIndex, nextEntityBlock);
+		}
+		else
+		{
+			break;
+		}
+	}
+}
+
+const char* culling::FusedCulling::GetCullingModuleName() const
+{
+	return "FusedCulling";
+}
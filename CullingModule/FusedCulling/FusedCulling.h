@@ -0,0 +1,39 @@
+#pragma once
+
+#include "../../EveryCullingCore.h"
+
+#include "../CullingModule.h"
+
+namespace culling
+{
+	/// <summary>
+	/// Do PreCulling, DistanceCulling, ViewFrustumCulling in one pass over each entity block.
+	///
+	/// Distance test and bounding sphere - frustum test are done first,
+	/// and screen space aabb is projected only for entities which survived the tests.
+	/// This saves two passes over entity blocks and two barriers between culling modules.
+	/// Visibility result is same with result of separated culling modules.
+	///
+	/// This module is disabled by default. ( use EveryCulling::SetEnabledCullingModule )
+	/// While this module is enabled, PreCulling, DistanceCulling, ViewFrustumCulling modules don't run. ( their enabled state isn't changed )
+	/// Distance test and frustum test are done only while DistanceCulling, ViewFrustumCulling modules are enabled.
+	/// MultiViewCulling takes precedence over this module while both are enabled.
+	/// </summary>
+	class FusedCulling : public CullingModule
+	{
+	private:
+
+		void DoFusedCulling
+		(
+			const size_t cameraIndex,
+			culling::EntityBlock* const entityBlock
+		);
+
+	public:
+
+		FusedCulling(EveryCulling* const everyCulling);
+
+		void CullBlockEntityJob(const size_t cameraIndex, const unsigned long long currentTickCount) override;
+		const char* GetCullingModuleName() const override;
+	};
+}
@@ -0,0 +1,390 @@
+#include "HierarchyCulling.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+#include "../DistanceCulling/DistanceCulling.h"
+#include "../ViewFrustumCulling/ViewFrustumCulling.h"
+#include "../../DataType/Math/Common.h"
+
+#define EVERYCULLING_INVALID_HIERARCHY_NODE_INDEX ((std::uint32_t)-1)
+
+culling::HierarchyCulling::HierarchyCulling(EveryCulling* const everyCulling)
+	: CullingModule(everyCulling), mHierarchyUpdatedTickCount{ (unsigned long long)-1 }, mBuiltActiveEntityBlockListVersion{ (std::uint64_t)-1 }
+{
+	IsEnabled = false;
+}
+
+void culling::HierarchyCulling::ResetCullingModule(const unsigned long long currentTickCount)
+{
+	CullingModule::ResetCullingModule(currentTickCount);
+
+	for (std::atomic<std::uint32_t>& nextSubtreeIndex : mNextSubtreeIndex)
+	{
+		nextSubtreeIndex.store(0, std::memory_order_relaxed);
+	}
+}
+
+void culling::HierarchyCulling::OnSetCameraCount(const size_t cameraCount)
+{
+	CullingModule::OnSetCameraCount(cameraCount);
+
+	mNextSubtreeIndex.Resize(cameraCount);
+}
+
+void culling::HierarchyCulling::ClearEntityData(EntityBlock* currentEntityBlock, size_t entityIndex)
+{
+	// entity count of the block is decremented
+	currentEntityBlock->bIsBoundingVolumeDirty = true;
+}
+
+void culling::HierarchyCulling::ComputeEntityBlockBound
+(
+	const culling::EntityBlock* const entityBlock,
+	culling::EntityBlockHierarchyNode& outNode
+) const
+{
+	outNode.mAABBMinWorldPoint = culling::Vec3{ FLT_MAX, FLT_MAX, FLT_MAX };
+	outNode.mAABBMaxWorldPoint = culling::Vec3{ -FLT_MAX, -FLT_MAX, -FLT_MAX };
+	outNode.mMaxDesiredMaxDrawDistance = 0.0f;
+
+	for (size_t entityIndex = 0; entityIndex < entityBlock->mCurrentEntityCount; entityIndex++)
+	{
+		const culling::Vec3& position = entityBlock->GetEntityWorldPositionAndBoudingSphereRadius(entityIndex).GetPosition();
+		// Bounding sphere radius of this frame isn't written yet ( PreCulling )
+		const float radius = entityBlock->ComputeBoundingSphereRadius(entityIndex);
+
+		outNode.mAABBMinWorldPoint.x = EVERYCULLING_MIN(outNode.mAABBMinWorldPoint.x, position.x - radius);
+		outNode.mAABBMinWorldPoint.y = EVERYCULLING_MIN(outNode.mAABBMinWorldPoint.y, position.y - radius);
+		outNode.mAABBMinWorldPoint.z = EVERYCULLING_MIN(outNode.mAABBMinWorldPoint.z, position.z - radius);
+		outNode.mAABBMaxWorldPoint.x = EVERYCULLING_MAX(outNode.mAABBMaxWorldPoint.x, position.x + radius);
+		outNode.mAABBMaxWorldPoint.y = EVERYCULLING_MAX(outNode.mAABBMaxWorldPoint.y, position.y + radius);
+		outNode.mAABBMaxWorldPoint.z = EVERYCULLING_MAX(outNode.mAABBMaxWorldPoint.z, position.z + radius);
+		outNode.mMaxDesiredMaxDrawDistance = EVERYCULLING_MAX(outNode.mMaxDesiredMaxDrawDistance, entityBlock->mDesiredMaxDrawDistance[entityIndex]);
+	}
+}
+
+std::uint32_t culling::HierarchyCulling::BuildNode
+(
+	const std::uint32_t parentNodeIndex,
+	const std::uint32_t firstLeafIndex,
+	const std::uint32_t leafCount,
+	const std::vector<culling::EntityBlockHierarchyNode>& entityBlockBounds,
+	std::vector<std::uint32_t>& entityBlockIndices
+)
+{
+	assert(leafCount > 0);
+
+	const std::uint32_t nodeIndex = static_cast<std::uint32_t>(mNodes.size());
+	mNodes.emplace_back();
+	mNodes[nodeIndex].mParentNodeIndex = parentNodeIndex;
+	mNodes[nodeIndex].mFirstLeafIndex = firstLeafIndex;
+	mNodes[nodeIndex].mLeafCount = leafCount;
+	mNodes[nodeIndex].mRightChildNodeIndex = EVERYCULLING_INVALID_HIERARCHY_NODE_INDEX;
+
+	if (leafCount == 1)
+	{
+		const std::uint32_t entityBlockIndex = entityBlockIndices[firstLeafIndex];
+		mNodes[nodeIndex].mAABBMinWorldPoint = entityBlockBounds[entityBlockIndex].mAABBMinWorldPoint;
+		mNodes[nodeIndex].mAABBMaxWorldPoint = entityBlockBounds[entityBlockIndex].mAABBMaxWorldPoint;
+		mNodes[nodeIndex].mMaxDesiredMaxDrawDistance = entityBlockBounds[entityBlockIndex].mMaxDesiredMaxDrawDistance;
+		mLeafNodeIndices[firstLeafIndex] = nodeIndex;
+		return nodeIndex;
+	}
+
+	// Split at median of center of entity blocks along longest axis
+	culling::Vec3 centerMin{ FLT_MAX, FLT_MAX, FLT_MAX };
+	culling::Vec3 centerMax{ -FLT_MAX, -FLT_MAX, -FLT_MAX };
+	for (std::uint32_t leafIndex = firstLeafIndex; leafIndex < firstLeafIndex + leafCount; leafIndex++)
+	{
+		const culling::EntityBlockHierarchyNode& bound = entityBlockBounds[entityBlockIndices[leafIndex]];
+		for (size_t axis = 0; axis < 3; axis++)
+		{
+			const float center = (bound.mAABBMinWorldPoint.data()[axis] + bound.mAABBMaxWorldPoint.data()[axis]) * 0.5f;
+			centerMin.data()[axis] = EVERYCULLING_MIN(centerMin.data()[axis], center);
+			centerMax.data()[axis] = EVERYCULLING_MAX(centerMax.data()[axis], center);
+		}
+	}
+
+	size_t splitAxis = 0;
+	for (size_t axis = 1; axis < 3; axis++)
+	{
+		if (centerMax.data()[axis] - centerMin.data()[axis] > centerMax.data()[splitAxis] - centerMin.data()[splitAxis])
+		{
+			splitAxis = axis;
+		}
+	}
+
+	const std::uint32_t leftLeafCount = leafCount / 2;
+	std::nth_element
+	(
+		entityBlockIndices.begin() + firstLeafIndex,
+		entityBlockIndices.begin() + firstLeafIndex + leftLeafCount,
+		entityBlockIndices.begin() + firstLeafIndex + leafCount,
+		[&entityBlockBounds, splitAxis](const std::uint32_t a, const std::uint32_t b)
+		{
+			return entityBlockBounds[a].mAABBMinWorldPoint.data()[splitAxis] + entityBlockBounds[a].mAABBMaxWorldPoint.data()[splitAxis]
+				< entityBlockBounds[b].mAABBMinWorldPoint.data()[splitAxis] + entityBlockBounds[b].mAABBMaxWorldPoint.data()[splitAxis];
+		}
+	);
+
+	const std::uint32_t leftChildNodeIndex = BuildNode(nodeIndex, firstLeafIndex, leftLeafCount, entityBlockBounds, entityBlockIndices);
+	const std::uint32_t rightChildNodeIndex = BuildNode(nodeIndex, firstLeafIndex + leftLeafCount, leafCount - leftLeafCount, entityBlockBounds, entityBlockIndices);
+	assert(leftChildNodeIndex == nodeIndex + 1);
+
+	// mNodes can be reallocated while building children
+	culling::EntityBlockHierarchyNode& node = mNodes[nodeIndex];
+	const culling::EntityBlockHierarchyNode& leftChildNode = mNodes[leftChildNodeIndex];
+	const culling::EntityBlockHierarchyNode& rightChildNode = mNodes[rightChildNodeIndex];
+	node.mRightChildNodeIndex = rightChildNodeIndex;
+	node.mAABBMinWorldPoint.x = EVERYCULLING_MIN(leftChildNode.mAABBMinWorldPoint.x, rightChildNode.mAABBMinWorldPoint.x);
+	node.mAABBMinWorldPoint.y = EVERYCULLING_MIN(leftChildNode.mAABBMinWorldPoint.y, rightChildNode.mAABBMinWorldPoint.y);
+	node.mAABBMinWorldPoint.z = EVERYCULLING_MIN(leftChildNode.mAABBMinWorldPoint.z, rightChildNode.mAABBMinWorldPoint.z);
+	node.mAABBMaxWorldPoint.x = EVERYCULLING_MAX(leftChildNode.mAABBMaxWorldPoint.x, rightChildNode.mAABBMaxWorldPoint.x);
+	node.mAABBMaxWorldPoint.y = EVERYCULLING_MAX(leftChildNode.mAABBMaxWorldPoint.y, rightChildNode.mAABBMaxWorldPoint.y);
+	node.mAABBMaxWorldPoint.z = EVERYCULLING_MAX(leftChildNode.mAABBMaxWorldPoint.z, rightChildNode.mAABBMaxWorldPoint.z);
+	node.mMaxDesiredMaxDrawDistance = EVERYCULLING_MAX(leftChildNode.mMaxDesiredMaxDrawDistance, rightChildNode.mMaxDesiredMaxDrawDistance);
+
+	return nodeIndex;
+}
+
+void culling::HierarchyCulling::BuildHierarchy()
+{
+	const std::vector<culling::EntityBlock*>& activeEntityBlockList = mCullingSystem->GetActiveEntityBlockList();
+	const std::uint32_t entityBlockCount = static_cast<std::uint32_t>(activeEntityBlockList.size());
+
+	mNodes.clear();
+	mSubtreeRootNodeIndices.clear();
+	mLeafEntityBlocks.resize(entityBlockCount);
+	mLeafNodeIndices.resize(entityBlockCount);
+
+	if (entityBlockCount == 0)
+	{
+		return;
+	}
+
+	std::vector<culling::EntityBlockHierarchyNode> entityBlockBounds(entityBlockCount);
+	std::vector<std::uint32_t> entityBlockIndices(entityBlockCount);
+	for (std::uint32_t entityBlockIndex = 0; entityBlockIndex < entityBlockCount; entityBlockIndex++)
+	{
+		ComputeEntityBlockBound(activeEntityBlockList[entityBlockIndex], entityBlockBounds[entityBlockIndex]);
+		activeEntityBlockList[entityBlockIndex]->bIsBoundingVolumeDirty = false;
+		entityBlockIndices[entityBlockIndex] = entityBlockIndex;
+	}
+
+	mNodes.reserve(entityBlockCount * 2 - 1);
+	BuildNode(EVERYCULLING_INVALID_HIERARCHY_NODE_INDEX, 0, entityBlockCount, entityBlockBounds, entityBlockIndices);
+	assert(mNodes.size() == entityBlockCount * 2 - 1);
+
+	for (std::uint32_t leafIndex = 0; leafIndex < entityBlockCount; leafIndex++)
+	{
+		mLeafEntityBlocks[leafIndex] = activeEntityBlockList[entityBlockIndices[leafIndex]];
+	}
+
+	// Split hierarchy into subtrees with less than ( entity block count / EVERYCULLING_HIERARCHY_CULLING_SUBTREE_COUNT ) entity blocks
+	// Threads pop subtree one by one
+	const std::uint32_t maxLeafCountOfSubtree = EVERYCULLING_MAX(1u, entityBlockCount / EVERYCULLING_HIERARCHY_CULLING_SUBTREE_COUNT);
+	std::vector<std::uint32_t> nodeIndexStack{ 0 };
+	while (nodeIndexStack.empty() == false)
+	{
+		const std::uint32_t nodeIndex = nodeIndexStack.back();
+		nodeIndexStack.pop_back();
+
+		if (mNodes[nodeIndex].mLeafCount <= maxLeafCountOfSubtree)
+		{
+			mSubtreeRootNodeIndices.push_back(nodeIndex);
+		}
+		else
+		{
+			nodeIndexStack.push_back(mNodes[nodeIndex].mRightChildNodeIndex);
+			nodeIndexStack.push_back(nodeIndex + 1);
+		}
+	}
+
+	mBuiltActiveEntityBlockListVersion = mCullingSystem->GetActiveEntityBlockListVersion();
+}
+
+void culling::HierarchyCulling::RefitHierarchy()
+{
+	const std::uint32_t leafCount = static_cast<std::uint32_t>(mLeafEntityBlocks.size());
+	for (std::uint32_t leafIndex = 0; leafIndex < leafCount; leafIndex++)
+	{
+		culling::EntityBlock* const entityBlock = mLeafEntityBlocks[leafIndex];
+		if (entityBlock->bIsBoundingVolumeDirty == false)
+		{
+			continue;
+		}
+		entityBlock->bIsBoundingVolumeDirty = false;
+
+		std::uint32_t nodeIndex = mLeafNodeIndices[leafIndex];
+		ComputeEntityBlockBound(entityBlock, mNodes[nodeIndex]);
+
+		// Propagate to ancestors until bound of ancestor isn't changed
+		nodeIndex = mNodes[nodeIndex].mParentNodeIndex;
+		while (nodeIndex != EVERYCULLING_INVALID_HIERARCHY_NODE_INDEX)
+		{
+			culling::EntityBlockHierarchyNode& node = mNodes[nodeIndex];
+			const culling::EntityBlockHierarchyNode& leftChildNode = mNodes[nodeIndex + 1];
+			const culling::EntityBlockHierarchyNode& rightChildNode = mNodes[node.mRightChildNodeIndex];
+
+			const culling::Vec3 aabbMinWorldPoint
+			{
+				EVERYCULLING_MIN(leftChildNode.mAABBMinWorldPoint.x, rightChildNode.mAABBMinWorldPoint.x),
+				EVERYCULLING_MIN(leftChildNode.mAABBMinWorldPoint.y, rightChildNode.mAABBMinWorldPoint.y),
+				EVERYCULLING_MIN(leftChildNode.mAABBMinWorldPoint.z, rightChildNode.mAABBMinWorldPoint.z)
+			};
+			const culling::Vec3 aabbMaxWorldPoint
+			{
+				EVERYCULLING_MAX(leftChildNode.mAABBMaxWorldPoint.x, rightChildNode.mAABBMaxWorldPoint.x),
+				EVERYCULLING_MAX(leftChildNode.mAABBMaxWorldPoint.y, rightChildNode.mAABBMaxWorldPoint.y),
+				EVERYCULLING_MAX(leftChildNode.mAABBMaxWorldPoint.z, rightChildNode.mAABBMaxWorldPoint.z)
+			};
+			const float maxDesiredMaxDrawDistance = EVERYCULLING_MAX(leftChildNode.mMaxDesiredMaxDrawDistance, rightChildNode.mMaxDesiredMaxDrawDistance);
+
+			if
+			(
+				std::memcmp(&aabbMinWorldPoint, &node.mAABBMinWorldPoint, sizeof(culling::Vec3)) == 0 &&
+				std::memcmp(&aabbMaxWorldPoint, &node.mAABBMaxWorldPoint, sizeof(culling::Vec3)) == 0 &&
+				maxDesiredMaxDrawDistance == node.mMaxDesiredMaxDrawDistance
+			)
+			{
+				break;
+			}
+
+			node.mAABBMinWorldPoint = aabbMinWorldPoint;
+			node.mAABBMaxWorldPoint = aabbMaxWorldPoint;
+			node.mMaxDesiredMaxDrawDistance = maxDesiredMaxDrawDistance;
+
+			nodeIndex = node.mParentNodeIndex;
+		}
+	}
+}
+
+void culling::HierarchyCulling::UpdateHierarchy(const unsigned long long currentTickCount)
+{
+	// Entity data can be updated after PreCullJob, so hierarchy is updated at start of cull job
+	if (mHierarchyUpdatedTickCount.load(std::memory_order_acquire) != currentTickCount)
+	{
+		std::lock_guard<std::mutex> lock{ mHierarchyUpdateMutex };
+
+		if (mHierarchyUpdatedTickCount.load(std::memory_order_relaxed) != currentTickCount)
+		{
+			if (mBuiltActiveEntityBlockListVersion != mCullingSystem->GetActiveEntityBlockListVersion())
+			{
+				BuildHierarchy();
+			}
+			else
+			{
+				RefitHierarchy();
+			}
+
+			mHierarchyUpdatedTickCount.store(currentTickCount, std::memory_order_release);
+		}
+	}
+}
+
+bool culling::HierarchyCulling::CheckIsNodeCulled
+(
+	const culling::EntityBlockHierarchyNode& node,
+	const culling::Vec4* const eightPlanes,
+	const culling::Vec3& cameraWorldPosition,
+	const bool isViewFrustumCullingEnabled,
+	const bool isDistanceCullingEnabled
+) const
+{
+	// Tests are loosened by EVERYCULLING_BOUNDING_SPHRE_RADIUS_MARGIN more than per entity tests for rounding error.
+	// So node is culled only when every entity in the node is culled by per entity tests
+
+	if (isDistanceCullingEnabled == true)
+	{
+		if (culling::CheckIsAABBFartherThan(node.mAABBMinWorldPoint, node.mAABBMaxWorldPoint, cameraWorldPosition, node.mMaxDesiredMaxDrawDistance + EVERYCULLING_BOUNDING_SPHRE_RADIUS_MARGIN) == true)
+		{
+			return true;
+		}
+	}
+
+	if (isViewFrustumCullingEnabled == true)
+	{
+		if (culling::CheckIsAABBOutsideOfFrustum(node.mAABBMinWorldPoint, node.mAABBMaxWorldPoint, eightPlanes, 2.0f * EVERYCULLING_BOUNDING_SPHRE_RADIUS_MARGIN) == true)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void culling::HierarchyCulling::CullSubtree
+(
+	const size_t cameraIndex,
+	const std::uint32_t subtreeRootNodeIndex,
+	const bool isViewFrustumCullingEnabled,
+	const bool isDistanceCullingEnabled
+)
+{
+	const culling::Vec4* const eightPlanes = mCullingSystem->mViewFrustumCulling->GetSIMDPlanes()[cameraIndex].mFrustumPlanes;
+	const culling::Vec3 cameraWorldPosition = mCullingSystem->GetCameraWorldPosition(cameraIndex);
+
+	std::uint32_t nodeIndexStack[64];
+	size_t nodeIndexStackSize = 0;
+	nodeIndexStack[nodeIndexStackSize++] = subtreeRootNodeIndex;
+
+	while (nodeIndexStackSize > 0)
+	{
+		const std::uint32_t nodeIndex = nodeIndexStack[--nodeIndexStackSize];
+		const culling::EntityBlockHierarchyNode& node = mNodes[nodeIndex];
+
+		if (CheckIsNodeCulled(node, eightPlanes, cameraWorldPosition, isViewFrustumCullingEnabled, isDistanceCullingEnabled) == true)
+		{
+			// Cull every entity in entity blocks of the node
+			for (std::uint32_t leafIndex = node.mFirstLeafIndex; leafIndex < node.mFirstLeafIndex + node.mLeafCount; leafIndex++)
+			{
+				culling::EntityBlock* const entityBlock = mLeafEntityBlocks[leafIndex];
+				for (size_t entityIndex = 0; entityIndex < EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK; entityIndex++)
+				{
+					entityBlock->SetCulled(entityIndex, cameraIndex);
+				}
+			}
+		}
+		else if (node.IsLeafNode() == false)
+		{
+			// depth of hierarchy built with median split is less than 33
+			assert(nodeIndexStackSize + 2 <= 64);
+			nodeIndexStack[nodeIndexStackSize++] = node.mRightChildNodeIndex;
+			nodeIndexStack[nodeIndexStackSize++] = nodeIndex + 1;
+		}
+	}
+}
+
+void culling::HierarchyCulling::CullBlockEntityJob(const size_t cameraIndex, const unsigned long long currentTickCount)
+{
+	UpdateHierarchy(currentTickCount);
+
+	// FusedCulling, MultiViewCulling also do only tests of enabled modules, so node tests follow enabled state of the modules
+	const bool isViewFrustumCullingEnabled = mCullingSystem->mViewFrustumCulling->IsEnabled;
+	const bool isDistanceCullingEnabled = mCullingSystem->mDistanceCulling->IsEnabled;
+
+	if (isViewFrustumCullingEnabled == false && isDistanceCullingEnabled == false)
+	{
+		return;
+	}
+
+	const std::uint32_t subtreeCount = static_cast<std::uint32_t>(mSubtreeRootNodeIndices.size());
+	while (true)
+	{
+		const std::uint32_t subtreeIndex = mNextSubtreeIndex[cameraIndex].fetch_add(1, std::memory_order_relaxed);
+		if (subtreeIndex >= subtreeCount)
+		{
+			break;
+		}
+
+		CullSubtree(cameraIndex, mSubtreeRootNodeIndices[subtreeIndex], isViewFrustumCullingEnabled, isDistanceCullingEnabled);
+	}
+}
+
+const char* culling::HierarchyCulling::GetCullingModuleName() const
+{
+	return "HierarchyCulling";
+}
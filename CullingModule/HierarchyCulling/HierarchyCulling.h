@@ -0,0 +1,126 @@
+#pragma once
+
+#include "../../EveryCullingCore.h"
+
+#include "../CullingModule.h"
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace culling
+{
+	/// <summary>
+	/// Node of bounding volume hierarchy over entity blocks.
+	/// Nodes are stored in depth first order, so left child of a node is located at next index
+	/// </summary>
+	struct EntityBlockHierarchyNode
+	{
+		/// <summary>
+		/// Aabb enclosing bounding spheres of all entities in entity blocks of this node
+		/// </summary>
+		culling::Vec3 mAABBMinWorldPoint;
+		/// <summary>
+		/// Max of desired max draw distance of all entities in entity blocks of this node
+		/// </summary>
+		float mMaxDesiredMaxDrawDistance;
+		culling::Vec3 mAABBMaxWorldPoint;
+		std::uint32_t mParentNodeIndex;
+
+		/// <summary>
+		/// Entity blocks of this node are HierarchyCulling::mLeafEntityBlocks[mFirstLeafIndex, mFirstLeafIndex + mLeafCount)
+		/// </summary>
+		std::uint32_t mFirstLeafIndex;
+		std::uint32_t mLeafCount;
+		std::uint32_t mRightChildNodeIndex;
+
+		EVERYCULLING_FORCE_INLINE bool IsLeafNode() const
+		{
+			return mLeafCount == 1;
+		}
+	};
+
+	/// <summary>
+	/// Reject whole subtree of bounding volume hierarchy over entity blocks
+	/// with view frustum test and distance test before per entity tests of DistanceCulling, ViewFrustumCulling ( or FusedCulling, MultiViewCulling ) run.
+	/// Each test is done only while DistanceCulling, ViewFrustumCulling module of the test is enabled.
+	/// Visibility bit of every entity in rejected subtree is cleared, so per entity kernels skip them.
+	/// Rejection is conservative, visibility result is same with result of per entity tests.
+	///
+	/// Hierarchy is rebuilt when entity block is allocated or freed,
+	/// and refitted from entity blocks whose entity was moved ( EntityBlock::bIsBoundingVolumeDirty ).
+	/// Both is done by a thread at start of cull job of each frame.
+	///
+	/// This module is disabled by default. ( use EveryCulling::SetEnabledCullingModule )
+	/// Flat list of entity blocks is better for scenes where most entities move every frame
+	/// </summary>
+	class HierarchyCulling : public CullingModule
+	{
+	private:
+
+		std::vector<culling::EntityBlockHierarchyNode> mNodes;
+		/// <summary>
+		/// Entity blocks in depth first order of leaf nodes
+		/// </summary>
+		std::vector<culling::EntityBlock*> mLeafEntityBlocks;
+		/// <summary>
+		/// Index of leaf node of mLeafEntityBlocks[i]
+		/// </summary>
+		std::vector<std::uint32_t> mLeafNodeIndices;
+		/// <summary>
+		/// Subtrees traversed by a thread at once
+		/// </summary>
+		std::vector<std::uint32_t> mSubtreeRootNodeIndices;
+
+		culling::PerCameraArray<std::atomic<std::uint32_t>> mNextSubtreeIndex;
+
+		std::mutex mHierarchyUpdateMutex;
+		std::atomic<unsigned long long> mHierarchyUpdatedTickCount;
+		/// <summary>
+		/// EveryCulling::GetActiveEntityBlockListVersion when hierarchy is built
+		/// </summary>
+		std::uint64_t mBuiltActiveEntityBlockListVersion;
+
+		/// <summary>
+		/// Rebuild or refit hierarchy once per frame. Other threads wait until it's done
+		/// </summary>
+		void UpdateHierarchy(const unsigned long long currentTickCount);
+		void BuildHierarchy();
+		std::uint32_t BuildNode
+		(
+			const std::uint32_t parentNodeIndex,
+			const std::uint32_t firstLeafIndex,
+			const std::uint32_t leafCount,
+			const std::vector<culling::EntityBlockHierarchyNode>& entityBlockBounds,
+			std::vector<std::uint32_t>& entityBlockIndices
+		);
+		void RefitHierarchy();
+		void ComputeEntityBlockBound(const culling::EntityBlock* const entityBlock, culling::EntityBlockHierarchyNode& outNode) const;
+
+		bool CheckIsNodeCulled
+		(
+			const culling::EntityBlockHierarchyNode& node,
+			const culling::Vec4* const eightPlanes,
+			const culling::Vec3& cameraWorldPosition,
+			const bool isViewFrustumCullingEnabled,
+			const bool isDistanceCullingEnabled
+		) const;
+		void CullSubtree(const size_t cameraIndex, const std::uint32_t subtreeRootNodeIndex, const bool isViewFrustumCullingEnabled, const bool isDistanceCullingEnabled);
+
+	public:
+
+		HierarchyCulling(EveryCulling* const everyCulling);
+
+		void ResetCullingModule(const unsigned long long currentTickCount) override;
+		void OnSetCameraCount(const size_t cameraCount) override;
+		void ClearEntityData(EntityBlock* currentEntityBlock, size_t entityIndex) override;
+		void CullBlockEntityJob(const size_t cameraIndex, const unsigned long long currentTickCount) override;
+		const char* GetCullingModuleName() const override;
+
+		EVERYCULLING_FORCE_INLINE size_t GetNodeCount() const
+		{
+			return mNodes.size();
+		}
+	};
+}
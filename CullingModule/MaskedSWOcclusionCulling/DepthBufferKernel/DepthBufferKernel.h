@@ -0,0 +1,48 @@
+#pragma once
+
+#include "../../../EveryCullingCore.h"
+
+#include <cstddef>
+#include <cstdint>
+
+// Depth buffer kernels ( projecting aabb, binning and rasterizing occluders ) compiled for each instruction set.
+//
+// Each variant is compiled in its own translation unit with its own compiler flags.
+// Body of kernels is shared ( DepthBufferKernelImpl.h ), and 8 wide vectors of SIMD_Core.h are 256bit registers in AVX2 variant
+// and two 128bit halves in SSE4_1 variant.
+// AVX512 is dispatched to AVX2 variant.
+//
+// Kernels are compiled with floating point contraction disabled, so every variant returns same result.
+
+namespace culling
+{
+	class SWDepthBuffer;
+	class Tile;
+
+	namespace depthBufferKernel
+	{
+		/// <summary>
+		/// Project 8 vertices of aabb to screen space
+		/// Return mask of vertices whose homogeneous w is negative ( vertex is behind camera )
+		/// </summary>
+		/// <param name="aabbMinWorldPoint">x, y, z</param>
+		/// <param name="aabbMaxWorldPoint">x, y, z</param>
+		/// <param name="worldToClipSpaceMatrix">column major 4x4 matrix</param>
+		int ProjectAABBToScreenSpace_SSE4_1(const float* const aabbMinWorldPoint, const float* const aabbMaxWorldPoint, const float* const worldToClipSpaceMatrix, const culling::SWDepthBuffer& depthBuffer, float& outMinScreenSpacePointX, float& outMinScreenSpacePointY, float& outMaxScreenSpacePointX, float& outMaxScreenSpacePointY, float& outMinNDCZ);
+		int ProjectAABBToScreenSpace_AVX2(const float* const aabbMinWorldPoint, const float* const aabbMaxWorldPoint, const float* const worldToClipSpaceMatrix, const culling::SWDepthBuffer& depthBuffer, float& outMinScreenSpacePointX, float& outMinScreenSpacePointY, float& outMaxScreenSpacePointX, float& outMaxScreenSpacePointY, float& outMinNDCZ);
+
+		/// <summary>
+		/// Transform at most 8 triangles to screen space and bin them to tiles of depth buffer
+		/// </summary>
+		/// <param name="vertexIndices">indices of triangles to bin. indiceCount is count of remaining indices from vertexIndices</param>
+		/// <param name="modelToClipspaceMatrix">column major 4x4 matrix</param>
+		void BinTriangles_SSE4_1(culling::SWDepthBuffer& depthBuffer, const float* const vertices, const std::uint64_t verticeCount, const std::uint32_t* const vertexIndices, const std::uint64_t indiceCount, const std::uint64_t vertexStrideByte, const float* const modelToClipspaceMatrix);
+		void BinTriangles_AVX2(culling::SWDepthBuffer& depthBuffer, const float* const vertices, const std::uint64_t verticeCount, const std::uint32_t* const vertexIndices, const std::uint64_t indiceCount, const std::uint64_t vertexStrideByte, const float* const modelToClipspaceMatrix);
+
+		/// <summary>
+		/// Rasterize binned triangles of the tile and update hierarchical depth of the tile
+		/// </summary>
+		void RasterizeBinnedTriangles_SSE4_1(culling::Tile* const tile);
+		void RasterizeBinnedTriangles_AVX2(culling::Tile* const tile);
+	}
+}
@@ -0,0 +1,974 @@
+#pragma once
+
+// Body of depth buffer kernels shared by every instruction set.
+// Only kernel translation units ( DepthBufferKernel_SSE4_1.cpp, DepthBufferKernel_AVX2.cpp ) include this header.
+// Functions are declared in inline namespace of instruction set of the translation unit ( SIMD_Core.h )
+
+#include "DepthBufferKernel.h"
+
+#include <limits>
+
+#include "../SWDepthBuffer.h"
+#include "../../../DataType/Math/Triangle.h"
+#include "../Utility/vertexTransformationHelper.h"
+#include "../Utility/depthBufferTileHelper.h"
+#include "../Utility/RasterizerHelper.h"
+#include "../Utility/CoverageRasterizer.h"
+#include "../Utility/DepthValueComputer.h"
+#include "../Utility/triangleSlopeEventGetter.h"
+
+namespace culling
+{
+	namespace depthBufferKernel
+	{
+		inline namespace EVERYCULLING_M256_INSTRUCTION_SET
+		{
+			/// <summary>
+			/// frustum culling in clip space
+			/// </summary>
+			/// <param name="clipspaceVertexX"></param>
+			/// <param name="clipspaceVertexY"></param>
+			/// <param name="triangleCullMask"></param>
+			EVERYCULLING_FORCE_INLINE void Clipping
+			(
+				const culling::EVERYCULLING_M256F* const clipspaceVertexX,
+				const culling::EVERYCULLING_M256F* const clipspaceVertexY,
+				const culling::EVERYCULLING_M256F* const clipspaceVertexZ,
+				const culling::EVERYCULLING_M256F* const clipspaceVertexW,
+				std::uint32_t& triangleCullMask
+			)
+			{
+				const culling::EVERYCULLING_M256F pointANdcPositiveW = culling::EVERYCULLING_M256F_ANDNOT(culling::EVERYCULLING_M256F_SET1(-0.0f), clipspaceVertexW[0]);
+				const culling::EVERYCULLING_M256F pointBNdcPositiveW = culling::EVERYCULLING_M256F_ANDNOT(culling::EVERYCULLING_M256F_SET1(-0.0f), clipspaceVertexW[1]);
+				const culling::EVERYCULLING_M256F pointCNdcPositiveW = culling::EVERYCULLING_M256F_ANDNOT(culling::EVERYCULLING_M256F_SET1(-0.0f), clipspaceVertexW[2]);
+
+				const culling::EVERYCULLING_M256F pointANdcX = culling::EVERYCULLING_M256F_CMP_LE(culling::EVERYCULLING_M256F_ANDNOT(culling::EVERYCULLING_M256F_SET1(-0.0f), clipspaceVertexX[0]), pointANdcPositiveW); // make positive values ( https://stackoverflow.com/questions/23847377/how-does-this-function-compute-the-absolute-value-of-a-float-through-a-not-and-a )
+				const culling::EVERYCULLING_M256F pointBNdcX = culling::EVERYCULLING_M256F_CMP_LE(culling::EVERYCULLING_M256F_ANDNOT(culling::EVERYCULLING_M256F_SET1(-0.0f), clipspaceVertexX[1]), pointBNdcPositiveW);
+				const culling::EVERYCULLING_M256F pointCNdcX = culling::EVERYCULLING_M256F_CMP_LE(culling::EVERYCULLING_M256F_ANDNOT(culling::EVERYCULLING_M256F_SET1(-0.0f), clipspaceVertexX[2]), pointCNdcPositiveW);
+				const culling::EVERYCULLING_M256F pointANdcY = culling::EVERYCULLING_M256F_CMP_LE(culling::EVERYCULLING_M256F_ANDNOT(culling::EVERYCULLING_M256F_SET1(-0.0f), clipspaceVertexY[0]), pointANdcPositiveW);
+				const culling::EVERYCULLING_M256F pointBNdcY = culling::EVERYCULLING_M256F_CMP_LE(culling::EVERYCULLING_M256F_ANDNOT(culling::EVERYCULLING_M256F_SET1(-0.0f), clipspaceVertexY[1]), pointBNdcPositiveW);
+				const culling::EVERYCULLING_M256F pointCNdcY = culling::EVERYCULLING_M256F_CMP_LE(culling::EVERYCULLING_M256F_ANDNOT(culling::EVERYCULLING_M256F_SET1(-0.0f), clipspaceVertexY[2]), pointCNdcPositiveW);
+				const culling::EVERYCULLING_M256F pointANdcZ = culling::EVERYCULLING_M256F_CMP_LE(culling::EVERYCULLING_M256F_ANDNOT(culling::EVERYCULLING_M256F_SET1(-0.0f), clipspaceVertexZ[0]), pointANdcPositiveW);
+				const culling::EVERYCULLING_M256F pointBNdcZ = culling::EVERYCULLING_M256F_CMP_LE(culling::EVERYCULLING_M256F_ANDNOT(culling::EVERYCULLING_M256F_SET1(-0.0f), clipspaceVertexZ[1]), pointBNdcPositiveW);
+				const culling::EVERYCULLING_M256F pointCNdcZ = culling::EVERYCULLING_M256F_CMP_LE(culling::EVERYCULLING_M256F_ANDNOT(culling::EVERYCULLING_M256F_SET1(-0.0f), clipspaceVertexZ[2]), pointCNdcPositiveW);
+
+				culling::EVERYCULLING_M256I pointAInFrustum = culling::EVERYCULLING_M256I_AND(culling::EVERYCULLING_M256I_AND(*reinterpret_cast<const culling::EVERYCULLING_M256I*>(&pointANdcX), *reinterpret_cast<const culling::EVERYCULLING_M256I*>(&pointANdcY)), *reinterpret_cast<const culling::EVERYCULLING_M256I*>(&pointANdcZ));
+				culling::EVERYCULLING_M256I pointBInFrustum = culling::EVERYCULLING_M256I_AND(culling::EVERYCULLING_M256I_AND(*reinterpret_cast<const culling::EVERYCULLING_M256I*>(&pointBNdcX), *reinterpret_cast<const culling::EVERYCULLING_M256I*>(&pointBNdcY)), *reinterpret_cast<const culling::EVERYCULLING_M256I*>(&pointBNdcZ));
+				culling::EVERYCULLING_M256I pointCInFrustum = culling::EVERYCULLING_M256I_AND(culling::EVERYCULLING_M256I_AND(*reinterpret_cast<const culling::EVERYCULLING_M256I*>(&pointCNdcX), *reinterpret_cast<const culling::EVERYCULLING_M256I*>(&pointCNdcY)), *reinterpret_cast<const culling::EVERYCULLING_M256I*>(&pointCNdcZ));
+
+				// if All vertices of triangle is out of volume, cull the triangle
+				const culling::EVERYCULLING_M256I verticesInFrustum = culling::EVERYCULLING_M256I_OR(culling::EVERYCULLING_M256I_OR(*reinterpret_cast<const culling::EVERYCULLING_M256I*>(&pointAInFrustum), *reinterpret_cast<const culling::EVERYCULLING_M256I*>(&pointBInFrustum)), *reinterpret_cast<const culling::EVERYCULLING_M256I*>(&pointCInFrustum));
+
+				triangleCullMask &= culling::EVERYCULLING_M256F_MOVEMASK(*reinterpret_cast<const culling::EVERYCULLING_M256F*>(&verticesInFrustum));
+			}
+
+			EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F ComputePositiveWMask
+			(
+				const culling::EVERYCULLING_M256F* const clipspaceVertexW
+			)
+			{
+				const culling::EVERYCULLING_M256F pointA_W_IsNegativeValue = culling::EVERYCULLING_M256F_CMP_GE(clipspaceVertexW[0], culling::EVERYCULLING_M256F_SET1(std::numeric_limits<float>::epsilon()));
+				const culling::EVERYCULLING_M256F pointB_W_IsNegativeValue = culling::EVERYCULLING_M256F_CMP_GE(clipspaceVertexW[1], culling::EVERYCULLING_M256F_SET1(std::numeric_limits<float>::epsilon()));
+				const culling::EVERYCULLING_M256F pointC_W_IsNegativeValue = culling::EVERYCULLING_M256F_CMP_GE(clipspaceVertexW[2], culling::EVERYCULLING_M256F_SET1(std::numeric_limits<float>::epsilon()));
+
+				return culling::EVERYCULLING_M256F_AND(pointA_W_IsNegativeValue, culling::EVERYCULLING_M256F_AND(pointB_W_IsNegativeValue, pointC_W_IsNegativeValue));
+
+			}
+
+
+
+			/// <summary>
+			/// BackFace Culling
+			/// Result is stored in triangleCullMask
+			/// </summary>
+			/// <param name="screenPixelX"></param>
+			/// <param name="screenPixelY"></param>
+			/// <param name="ndcSpaceVertexZ"></param>
+			/// <param name="triangleCullMask"></param>
+			EVERYCULLING_FORCE_INLINE void BackfaceCulling
+			(
+				culling::EVERYCULLING_M256F* const screenPixelX,
+				culling::EVERYCULLING_M256F* const screenPixelY,
+				std::uint32_t& triangleCullMask
+			)
+			{
+				culling::EVERYCULLING_M256F triArea1 = culling::EVERYCULLING_M256F_MUL(culling::EVERYCULLING_M256F_SUB(screenPixelX[1], screenPixelX[0]), culling::EVERYCULLING_M256F_SUB(screenPixelY[2], screenPixelY[0]));
+				culling::EVERYCULLING_M256F triArea2 = culling::EVERYCULLING_M256F_MUL(culling::EVERYCULLING_M256F_SUB(screenPixelX[0], screenPixelX[2]), culling::EVERYCULLING_M256F_SUB(screenPixelY[0], screenPixelY[1]));
+				culling::EVERYCULLING_M256F triArea = culling::EVERYCULLING_M256F_SUB(triArea1, triArea2);
+				culling::EVERYCULLING_M256F ccwMask = culling::EVERYCULLING_M256F_CMP_GT(triArea, culling::EVERYCULLING_M256F_SET1(std::numeric_limits<float>::epsilon()));
+
+				// Return a lane mask with all front faces set
+				triangleCullMask &= culling::EVERYCULLING_M256F_MOVEMASK(ccwMask);
+			}
+
+
+
+			EVERYCULLING_FORCE_INLINE void PassTrianglesToTileBin
+			(
+				culling::SWDepthBuffer& depthBuffer,
+
+				const culling::EVERYCULLING_M256F& pointAScreenPixelPosX,
+				const culling::EVERYCULLING_M256F& pointAScreenPixelPosY,
+				const culling::EVERYCULLING_M256F& pointANdcSpaceVertexZ,
+
+				const culling::EVERYCULLING_M256F& pointBScreenPixelPosX,
+				const culling::EVERYCULLING_M256F& pointBScreenPixelPosY,
+				const culling::EVERYCULLING_M256F& pointBNdcSpaceVertexZ,
+
+				const culling::EVERYCULLING_M256F& pointCScreenPixelPosX,
+				const culling::EVERYCULLING_M256F& pointCScreenPixelPosY,
+				const culling::EVERYCULLING_M256F& pointCNdcSpaceVertexZ,
+
+				const std::uint32_t& triangleCullMask, 
+				const size_t triangleCountPerLoop,
+				const culling::EVERYCULLING_M256I& outBinBoundingBoxMinX, 
+				const culling::EVERYCULLING_M256I& outBinBoundingBoxMinY,
+				const culling::EVERYCULLING_M256I& outBinBoundingBoxMaxX,
+				const culling::EVERYCULLING_M256I& outBinBoundingBoxMaxY
+			)
+			{
+				for (size_t triangleIndex = 0; triangleIndex < triangleCountPerLoop; triangleIndex++)
+				{
+					if ((triangleCullMask & (1 << triangleIndex)) != 0x00000000)
+					{
+						const int intersectingMinBoxX = (reinterpret_cast<const int*>(&outBinBoundingBoxMinX))[triangleIndex]; // this is screen space coordinate
+						const int intersectingMinBoxY = (reinterpret_cast<const int*>(&outBinBoundingBoxMinY))[triangleIndex];
+						const int intersectingMaxBoxX = (reinterpret_cast<const int*>(&outBinBoundingBoxMaxX))[triangleIndex];
+						const int intersectingMaxBoxY = (reinterpret_cast<const int*>(&outBinBoundingBoxMaxY))[triangleIndex];
+
+						assert(intersectingMinBoxX <= intersectingMaxBoxX);
+						assert(intersectingMinBoxY <= intersectingMaxBoxY);
+
+						const int startBoxIndexX = EVERYCULLING_MIN((int)(depthBuffer.mResolution.mColumnTileCount - 1), intersectingMinBoxX / EVERYCULLING_TILE_WIDTH);
+						const int startBoxIndexY = EVERYCULLING_MIN((int)(depthBuffer.mResolution.mRowTileCount - 1), intersectingMinBoxY / EVERYCULLING_TILE_HEIGHT);
+						const int endBoxIndexX = EVERYCULLING_MIN((int)(depthBuffer.mResolution.mColumnTileCount - 1), intersectingMaxBoxX / EVERYCULLING_TILE_WIDTH);
+						const int endBoxIndexY = EVERYCULLING_MIN((int)(depthBuffer.mResolution.mRowTileCount - 1), intersectingMaxBoxY / EVERYCULLING_TILE_HEIGHT);
+
+						assert(startBoxIndexX >= 0 && startBoxIndexX < (int)(depthBuffer.mResolution.mColumnTileCount));
+						assert(startBoxIndexY >= 0 && startBoxIndexY < (int)(depthBuffer.mResolution.mRowTileCount));
+
+						assert(endBoxIndexX >= 0 && endBoxIndexX <= (int)(depthBuffer.mResolution.mColumnTileCount));
+						assert(endBoxIndexY >= 0 && endBoxIndexY <= (int)(depthBuffer.mResolution.mRowTileCount));
+
+						for (int y = startBoxIndexY; y <= endBoxIndexY; y++)
+						{
+							for (int x = startBoxIndexX; x <= endBoxIndexX; x++)
+							{
+								Tile* const targetTile = depthBuffer.GetTile(static_cast<std::uint32_t>(y), static_cast<std::uint32_t>(x));
+
+								//assert(targetTile->mBinnedTriangleList.GetIsBinFull() == false);
+
+								const size_t triListIndex = targetTile->mBinnedTriangleCount++;
+
+								if(triListIndex < BIN_TRIANGLE_CAPACITY_PER_TILE)
+								{
+									targetTile->mBinnedTriangleList[triListIndex].PointAVertexX = (reinterpret_cast<const float*>(&pointAScreenPixelPosX))[triangleIndex];
+									targetTile->mBinnedTriangleList[triListIndex].PointAVertexY = (reinterpret_cast<const float*>(&pointAScreenPixelPosY))[triangleIndex];
+									targetTile->mBinnedTriangleList[triListIndex].PointAVertexZ = (reinterpret_cast<const float*>(&pointANdcSpaceVertexZ))[triangleIndex];
+
+									targetTile->mBinnedTriangleList[triListIndex].PointBVertexX = (reinterpret_cast<const float*>(&pointBScreenPixelPosX))[triangleIndex];
+									targetTile->mBinnedTriangleList[triListIndex].PointBVertexY = (reinterpret_cast<const float*>(&pointBScreenPixelPosY))[triangleIndex];
+									targetTile->mBinnedTriangleList[triListIndex].PointBVertexZ = (reinterpret_cast<const float*>(&pointBNdcSpaceVertexZ))[triangleIndex];
+
+									targetTile->mBinnedTriangleList[triListIndex].PointCVertexX = (reinterpret_cast<const float*>(&pointCScreenPixelPosX))[triangleIndex];
+									targetTile->mBinnedTriangleList[triListIndex].PointCVertexY = (reinterpret_cast<const float*>(&pointCScreenPixelPosY))[triangleIndex];
+									targetTile->mBinnedTriangleList[triListIndex].PointCVertexZ = (reinterpret_cast<const float*>(&pointCNdcSpaceVertexZ))[triangleIndex];
+								}
+							}
+						}
+					}
+				}
+			}
+
+
+
+
+			/// <summary>
+			/// Gather Vertex from VertexList with IndiceList
+			/// 
+			/// first float of outVerticesX[0] have Triangle1's Point1 X
+			/// first float of outVerticesX[1] have Triangle1's Point2 X
+			/// first float of outVerticesX[2] have Triangle1's Point3 X
+			/// 
+			/// second float of outVerticesX[0] have Triangle2's Point1 X
+			/// second float of outVerticesX[1] have Triangle2's Point2 X
+			/// second float of outVerticesX[2] have Triangle2's Point3 X
+			/// </summary>
+			/// <param name="vertices"></param>
+			/// <param name="vertexIndices"></param>
+			/// <param name="indiceCount"></param>
+			/// <param name="currentIndiceIndex"></param>
+			/// <param name="vertexStrideByte">
+			/// how far next vertex point is from current vertex point 
+			/// ex) 
+			/// 1.0f(Point1_X), 2.0f(Point2_Y), 0.0f(Point3_Z), 3.0f(Normal_X), 3.0f(Normal_Y), 3.0f(Normal_Z),  1.0f(Point1_X), 2.0f(Point2_Y), 0.0f(Point3_Z)
+			/// --> vertexStride is 6 * 4(float)
+			/// </param>
+			/// <param name="fetchTriangleCount"></param>
+			/// <param name="outVerticesX"></param>
+			/// <param name="outVerticesY"></param>
+			/// <param name="triangleCullMask"></param>
+			EVERYCULLING_FORCE_INLINE void GatherVertices
+			(
+				const float* const vertices,
+				const size_t verticeCount,
+				const std::uint32_t* const vertexIndices, 
+				const size_t indiceCount, 
+				const size_t currentIndiceIndex, 
+				const size_t vertexStrideByte, 
+				const size_t fetchTriangleCount,
+				culling::EVERYCULLING_M256F* outVerticesX, 
+				culling::EVERYCULLING_M256F* outVerticesY, 
+				culling::EVERYCULLING_M256F* outVerticesZ
+			)
+			{
+				assert(indiceCount % 3 == 0);
+				assert(currentIndiceIndex % 3 == 0);
+				assert(indiceCount != 0); // TODO : implement gatherVertices when there is no indiceCount
+
+				//Gather Indices
+				const std::uint32_t* currentVertexIndices = vertexIndices + currentIndiceIndex;
+				const culling::EVERYCULLING_M256I indiceIndexs = culling::EVERYCULLING_M256I_SETR(0, 3, 6, 9, 12, 15, 18, 21);
+				static const culling::EVERYCULLING_M256I SIMD_LANE_MASK[9] = {
+					culling::EVERYCULLING_M256I_SETR(0,  0,  0,  0,  0,  0,  0,  0),
+					culling::EVERYCULLING_M256I_SETR(~0,  0,  0,  0,  0,  0,  0,  0),
+					culling::EVERYCULLING_M256I_SETR(~0, ~0,  0,  0,  0,  0,  0,  0),
+					culling::EVERYCULLING_M256I_SETR(~0, ~0, ~0,  0,  0,  0,  0,  0),
+					culling::EVERYCULLING_M256I_SETR(~0, ~0, ~0, ~0,  0,  0,  0,  0),
+					culling::EVERYCULLING_M256I_SETR(~0, ~0, ~0, ~0, ~0,  0,  0,  0),
+					culling::EVERYCULLING_M256I_SETR(~0, ~0, ~0, ~0, ~0, ~0,  0,  0),
+					culling::EVERYCULLING_M256I_SETR(~0, ~0, ~0, ~0, ~0, ~0, ~0,  0),
+					culling::EVERYCULLING_M256I_SETR(~0, ~0, ~0, ~0, ~0, ~0, ~0, ~0)
+				};
+
+				// Compute per-lane index list offset that guards against out of bounds memory accesses
+				const culling::EVERYCULLING_M256I safeIndiceIndexs = culling::EVERYCULLING_M256I_AND(indiceIndexs, SIMD_LANE_MASK[fetchTriangleCount]);
+
+				culling::EVERYCULLING_M256I m256i_indices[3];
+				//If stride is 7
+				//Current Value 
+				//m256i_indices[0] : 0 ( first vertex index ), 3, 6,  9, 12, 15, 18, 21
+				//m256i_indices[1] : 1 ( second vertex index ), 4, 7, 10, 13, 16, 19, 22
+				//m256i_indices[2] : 2, 5, 8, 11, 14, 17, 20, 23
+				//Point1 indices of Triangles
+				m256i_indices[0] = culling::EVERYCULLING_M256I_GATHER(reinterpret_cast<const int*>(currentVertexIndices + 0), safeIndiceIndexs); // why 4? -> vertexIndices is std::uint32_t( 4byte )
+				//Point2 indices of Triangles
+				m256i_indices[1] = culling::EVERYCULLING_M256I_GATHER(reinterpret_cast<const int*>(currentVertexIndices + 1), safeIndiceIndexs);
+				//Point3 indices of Triangles
+				m256i_indices[2] = culling::EVERYCULLING_M256I_GATHER(reinterpret_cast<const int*>(currentVertexIndices + 2), safeIndiceIndexs);
+
+				if(vertexStrideByte > 0)
+				{
+					//Consider Stride
+					//If StrideByte is 28
+					//m256i_indices[0] : 0 * 28, 3 * 28, 6 * 28,  9 * 28, 12 * 28, 15 * 28, 18 * 28, 21 * 28
+					//m256i_indices[1] : 1 * 28, 4 * 28, 7 * 28, 10 * 28, 13 * 28, 16 * 28, 19 * 28, 22 * 28
+					//m256i_indices[2] : 2 * 28, 5 * 28, 8 * 28, 11 * 28, 14 * 28, 17 * 28, 20 * 28, 23 * 28
+					const culling::EVERYCULLING_M256I m256i_stride = culling::EVERYCULLING_M256I_SET1(static_cast<int>(vertexStrideByte));
+					m256i_indices[0] = culling::EVERYCULLING_M256I_MULLO(m256i_indices[0], m256i_stride);
+					m256i_indices[1] = culling::EVERYCULLING_M256I_MULLO(m256i_indices[1], m256i_stride);
+					m256i_indices[2] = culling::EVERYCULLING_M256I_MULLO(m256i_indices[2], m256i_stride);
+				}
+
+
+				//Gather vertexs
+				//Should consider vertexStride(vertices isn't stored contiguously because generally vertex datas is stored with uv, normal datas...) 
+				//And Should consider z value
+				for (size_t i = 0; i < 3; i++)
+				{
+					outVerticesX[i] = culling::EVERYCULLING_M256F_GATHER((float*)vertices, m256i_indices[i]);
+					outVerticesY[i] = culling::EVERYCULLING_M256F_GATHER((float*)vertices + 1, m256i_indices[i]);
+					outVerticesZ[i] = culling::EVERYCULLING_M256F_GATHER((float*)vertices + 2, m256i_indices[i]);
+				}
+			}
+
+			/// <summary>
+			/// Bin Triangles
+			/// </summary>
+			/// <param name="vertices"></param>
+			/// <param name="vertexIndices"></param>
+			/// <param name="indiceCount"></param>
+			/// <param name="vertexStrideByte">
+			/// how far next vertex point is from current vertex point 
+			/// ex) 
+			/// 1.0f(Point1_X), 2.0f(Point2_Y), 0.0f(Point3_Z), 3.0f(Normal_X), 3.0f(Normal_Y), 3.0f(Normal_Z),  1.0f(Point1_X), 2.0f(Point2_Y), 0.0f(Point3_Z)
+			/// --> vertexStride is 6 * 4(float)
+			/// </param>
+			/// <param name="modelToClipspaceMatrix"></param>
+			EVERYCULLING_FORCE_INLINE void BinTriangles
+			(
+				culling::SWDepthBuffer& depthBuffer,
+				const float* const vertices,
+				const uint64_t verticeCount,
+				const std::uint32_t* const vertexIndices,
+				const uint64_t indiceCount,
+				const uint64_t vertexStrideByte,
+				const float* const modelToClipspaceMatrix
+			)
+			{
+				assert(indiceCount > 0);
+
+				const uint64_t fetchTriangleCount = EVERYCULLING_MIN(8, indiceCount / 3);
+				assert(fetchTriangleCount != 0);
+
+				// First 4 bits show if traingle is valid
+				// Current Value : 00000000 00000000 00000000 11111111
+				std::uint32_t triangleCullMask = (1 << fetchTriangleCount) - 1;
+
+
+				//Why Size of array is 3?
+				//A culling::EVERYCULLING_M256F can have 8 floating-point
+				//A TwoDTriangle have 3 point
+				//So If you have just one culling::EVERYCULLING_M256F variable, a floating-point is unused.
+				//Not to make unused space, 12 floating point is required per axis
+				// culling::EVERYCULLING_M256F * 3 -> 8 TwoDTriangle with no unused space
+
+				//We don't need z value in Binning stage!!!
+				// Triangle's First Vertex X is in ndcSpaceVertexX[0][0]
+				// Triangle's Second Vertex X is in ndcSpaceVertexX[0][1]
+				// Triangle's Third Vertex X is in ndcSpaceVertexX[0][2]
+				culling::EVERYCULLING_M256F ndcSpaceVertexX[3], ndcSpaceVertexY[3], ndcSpaceVertexZ[3], oneDividedByW[3];
+
+				//Gather Vertex with indice
+				//WE ARRIVE AT MODEL SPACE COORDINATE!
+				GatherVertices(vertices, verticeCount, vertexIndices, indiceCount, 0, vertexStrideByte, fetchTriangleCount, ndcSpaceVertexX, ndcSpaceVertexY, ndcSpaceVertexZ);
+
+
+				//////////////////////////////////////////////////
+
+
+				for (int i = 0; i < 3; i++)
+				{
+					oneDividedByW[i] = culling::EVERYCULLING_M256F_MUL_AND_ADD(ndcSpaceVertexX[i], culling::EVERYCULLING_M256F_SET1(modelToClipspaceMatrix[3]), culling::EVERYCULLING_M256F_MUL_AND_ADD(ndcSpaceVertexY[i], culling::EVERYCULLING_M256F_SET1(modelToClipspaceMatrix[7]), culling::EVERYCULLING_M256F_MUL_AND_ADD(ndcSpaceVertexZ[i], culling::EVERYCULLING_M256F_SET1(modelToClipspaceMatrix[11]), culling::EVERYCULLING_M256F_SET1(modelToClipspaceMatrix[15]))));
+				}
+
+				const culling::EVERYCULLING_M256F positiveWMask = ComputePositiveWMask(oneDividedByW);
+
+				const culling::EVERYCULLING_M256I allOne = culling::EVERYCULLING_M256I_SET1(-1);
+				const culling::EVERYCULLING_M256F negativeWMask = culling::EVERYCULLING_M256F_XOR(positiveWMask, *reinterpret_cast<const culling::EVERYCULLING_M256F*>(&allOne));
+				triangleCullMask &= culling::EVERYCULLING_M256F_MOVEMASK(*reinterpret_cast<const culling::EVERYCULLING_M256F*>(&positiveWMask));
+				if (triangleCullMask == 0x00000000)
+				{
+					return;
+				}
+
+				/*
+				for (int i = 0; i < 3; i++)
+				{
+					const culling::EVERYCULLING_M256F point_W_IsNegativeValue = culling::EVERYCULLING_M256F_CMP_LT(oneDividedByW[i], culling::EVERYCULLING_M256F_SET1(std::numeric_limits<float>::epsilon()));
+					oneDividedByW[i] = culling::EVERYCULLING_M256F_SELECT(oneDividedByW[i], culling::EVERYCULLING_M256F_SET1(1.0f), point_W_IsNegativeValue);
+				}
+				*/
+
+
+				//////////////////////////////////////////////////
+
+
+				//Convert Model space Vertex To Clip space Vertex
+				//WE ARRIVE AT CLIP SPACE COORDINATE. W IS NOT 1
+				culling::vertexTransformationHelper::TransformThreeVerticesToClipSpace
+				(
+					ndcSpaceVertexX,
+					ndcSpaceVertexY,
+					ndcSpaceVertexZ,
+					modelToClipspaceMatrix
+				);
+
+
+
+				Clipping(ndcSpaceVertexX, ndcSpaceVertexY, ndcSpaceVertexZ, oneDividedByW, triangleCullMask);
+				if (triangleCullMask == 0x00000000)
+				{
+					return;
+				}
+
+
+
+				for (int i = 0; i < 3; i++)
+				{
+					oneDividedByW[i] = culling::EVERYCULLING_M256F_DIV(culling::EVERYCULLING_M256F_SET1(1.0f), oneDividedByW[i]);
+				}
+
+				//////////////////////////////////////////////////
+
+				// Now Z value is on NDC coordinate
+				for (int i = 0; i < 3; i++)
+				{
+					ndcSpaceVertexZ[i] = culling::EVERYCULLING_M256F_MUL(ndcSpaceVertexZ[i], oneDividedByW[i]);
+				}
+
+				//////////////////////////////////////////////////
+
+				culling::EVERYCULLING_M256F screenPixelPosX[3], screenPixelPosY[3];
+				culling::vertexTransformationHelper::ConvertClipSpaceThreeVerticesToScreenPixelSpace(ndcSpaceVertexX, ndcSpaceVertexY, oneDividedByW, screenPixelPosX, screenPixelPosY, depthBuffer);
+
+				BackfaceCulling(screenPixelPosX, screenPixelPosY, triangleCullMask);
+
+				if (triangleCullMask == 0x00000000)
+				{
+					return;
+				}
+
+
+				//////////////////////////////////////////////////
+
+
+				Sort_8_3DTriangles
+				(
+					screenPixelPosX[0],
+					screenPixelPosY[0],
+					ndcSpaceVertexZ[0],
+
+					screenPixelPosX[1],
+					screenPixelPosY[1],
+					ndcSpaceVertexZ[1],
+
+					screenPixelPosX[2],
+					screenPixelPosY[2],
+					ndcSpaceVertexZ[2]
+				);
+
+
+				culling::EVERYCULLING_M256F LEFT_MIDDLE_POINT_X;
+				culling::EVERYCULLING_M256F LEFT_MIDDLE_POINT_Y;
+				culling::EVERYCULLING_M256F LEFT_MIDDLE_POINT_Z;
+
+				culling::EVERYCULLING_M256F RIGHT_MIDDLE_POINT_X;
+				culling::EVERYCULLING_M256F RIGHT_MIDDLE_POINT_Y;
+				culling::EVERYCULLING_M256F RIGHT_MIDDLE_POINT_Z;
+
+
+				// split triangle
+				culling::rasterizerHelper::GetMiddlePointOfTriangle
+				(
+					screenPixelPosX[0],
+					screenPixelPosY[0],
+					ndcSpaceVertexZ[0],
+
+					screenPixelPosX[1],
+					screenPixelPosY[1],
+					ndcSpaceVertexZ[1],
+
+					screenPixelPosX[2],
+					screenPixelPosY[2],
+					ndcSpaceVertexZ[2],
+
+					LEFT_MIDDLE_POINT_X,
+					LEFT_MIDDLE_POINT_Y,
+					LEFT_MIDDLE_POINT_Z,
+
+					RIGHT_MIDDLE_POINT_X,
+					RIGHT_MIDDLE_POINT_Y,
+					RIGHT_MIDDLE_POINT_Z
+				);
+
+#ifdef EVERYCULLING_DEBUG_CULLING
+
+
+
+#endif
+
+
+				{
+					//Bin Bottom Flat Triangle
+
+
+					culling::EVERYCULLING_M256I outBinBoundingBoxMinX, outBinBoundingBoxMinY, outBinBoundingBoxMaxX, outBinBoundingBoxMaxY;
+					//Bin Triangles to tiles
+
+					//Compute Bin Bounding Box
+					//Get Intersecting Bin List
+					culling::depthBufferTileHelper::ComputeBinBoundingBoxFromThreeVertices
+					(
+						screenPixelPosX[0],
+						screenPixelPosY[0],
+
+						LEFT_MIDDLE_POINT_X,
+						LEFT_MIDDLE_POINT_Y,
+
+						RIGHT_MIDDLE_POINT_X,
+						RIGHT_MIDDLE_POINT_Y,
+
+						outBinBoundingBoxMinX,
+						outBinBoundingBoxMinY,
+						outBinBoundingBoxMaxX,
+						outBinBoundingBoxMaxY,
+						depthBuffer
+					);
+
+#ifdef EVERYCULLING_DEBUG_CULLING
+					for (size_t triangleIndex = 0; triangleIndex < fetchTriangleCount; triangleIndex++)
+					{
+						if ((triangleCullMask & (1 << triangleIndex)) != 0x00000000)
+						{
+							assert(reinterpret_cast<const int*>(&outBinBoundingBoxMinX)[triangleIndex] <= reinterpret_cast<const int*>(&outBinBoundingBoxMaxX)[triangleIndex]);
+							assert(reinterpret_cast<const int*>(&outBinBoundingBoxMinY)[triangleIndex] <= reinterpret_cast<const int*>(&outBinBoundingBoxMaxY)[triangleIndex]);
+						}
+					}
+#endif
+
+					// Pass triangle in counter clock wise
+					PassTrianglesToTileBin
+					(
+						depthBuffer,
+
+						screenPixelPosX[0],
+						screenPixelPosY[0],
+						ndcSpaceVertexZ[0],
+
+						LEFT_MIDDLE_POINT_X,
+						LEFT_MIDDLE_POINT_Y,
+						LEFT_MIDDLE_POINT_Z,
+
+						RIGHT_MIDDLE_POINT_X,
+						RIGHT_MIDDLE_POINT_Y,
+						RIGHT_MIDDLE_POINT_Z,
+
+						triangleCullMask,
+						fetchTriangleCount,
+						outBinBoundingBoxMinX,
+						outBinBoundingBoxMinY,
+						outBinBoundingBoxMaxX,
+						outBinBoundingBoxMaxY
+					);
+				}
+
+
+				{
+					//Bin Top Flat Triangle
+
+					culling::EVERYCULLING_M256I outBinBoundingBoxMinX, outBinBoundingBoxMinY, outBinBoundingBoxMaxX, outBinBoundingBoxMaxY;
+
+					culling::depthBufferTileHelper::ComputeBinBoundingBoxFromThreeVertices
+					(
+						screenPixelPosX[2],
+						screenPixelPosY[2],
+
+						RIGHT_MIDDLE_POINT_X,
+						RIGHT_MIDDLE_POINT_Y,
+
+						LEFT_MIDDLE_POINT_X,
+						LEFT_MIDDLE_POINT_Y,
+
+						outBinBoundingBoxMinX,
+						outBinBoundingBoxMinY,
+						outBinBoundingBoxMaxX,
+						outBinBoundingBoxMaxY,
+						depthBuffer
+					);
+
+#ifdef EVERYCULLING_DEBUG_CULLING
+					for (size_t triangleIndex = 0; triangleIndex < fetchTriangleCount; triangleIndex++)
+					{
+						if ((triangleCullMask & (1 << triangleIndex)) != 0x00000000)
+						{
+							assert(reinterpret_cast<const int*>(&outBinBoundingBoxMinX)[triangleIndex] <= reinterpret_cast<const int*>(&outBinBoundingBoxMaxX)[triangleIndex]);
+							assert(reinterpret_cast<const int*>(&outBinBoundingBoxMinY)[triangleIndex] <= reinterpret_cast<const int*>(&outBinBoundingBoxMaxY)[triangleIndex]);
+						}
+					}
+#endif
+
+					// Pass triangle in counter clock wise
+					PassTrianglesToTileBin
+					(
+						depthBuffer,
+
+						screenPixelPosX[2],
+						screenPixelPosY[2],
+						ndcSpaceVertexZ[2],
+
+						RIGHT_MIDDLE_POINT_X,
+						RIGHT_MIDDLE_POINT_Y,
+						RIGHT_MIDDLE_POINT_Z,
+
+						LEFT_MIDDLE_POINT_X,
+						LEFT_MIDDLE_POINT_Y,
+						LEFT_MIDDLE_POINT_Z,
+
+						triangleCullMask,
+						fetchTriangleCount,
+						outBinBoundingBoxMinX,
+						outBinBoundingBoxMinY,
+						outBinBoundingBoxMaxX,
+						outBinBoundingBoxMaxY
+					);
+				}
+			}
+
+			/// <summary>
+			/// https://www.slideshare.net/IntelSoftware/masked-software-occlusion-culling 46p
+			///
+			///	Original : One Row is configous 32bit ( 4byte )
+			///	After shuffled : One 8 x 4 tile is configous 32bit ( 4byte )
+			///
+			/// Shuffle Coverage Mask
+			///
+			/// 77777777 77777777 77777777 77777777
+			/// 66666666 66666666 66666666 66666666
+			/// 55555555 55555555 55555555 55555555
+			/// 44444444 44444444 44444444 44444444 <-- ( fourth tile. 1, 0 )
+			/// 33333333 33333333 33333333 33333333
+			/// 22222222 22222222 22222222 22222222
+			/// 11111111 11111111 11111111 11111111 <-- ( second tile. 0, 1 )
+			/// 00000000 00000000 00000000 00000000 <-- ( first tile. 0, 0 )
+			///
+			///   |
+			///   |
+			///	  V
+			///
+			/// 44444444 55555555 66666666 777777777
+			/// 44444444 55555555 66666666 777777777
+			/// 44444444 55555555 66666666 777777777
+			/// 44444444 55555555 66666666 777777777
+			/// 00000000 11111111 22222222 333333333
+			/// 00000000 11111111 22222222 333333333
+			/// 00000000 11111111 22222222 333333333
+			/// 00000000 11111111 22222222 333333333
+			///
+			/// </summary>
+			/// <param name="coverageMask"></param>
+			/// <returns></returns>
+			EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I ShuffleCoverageMask(const culling::EVERYCULLING_M256I& coverageMask)
+			{
+				static const culling::EVERYCULLING_M256I shuffleMask
+				=
+				culling::EVERYCULLING_M256I_SETR_EPI8
+				(
+					0, 4, 8, 12,
+					1, 5, 9, 13,
+					2, 6, 10, 14,
+					3, 7, 11, 15,
+
+					0, 4, 8, 12,
+					1, 5, 9, 13,
+					2, 6, 10, 14,
+					3, 7, 11, 15
+				);
+
+				return culling::EVERYCULLING_M256I_SHUFFLE_EPI8(coverageMask, shuffleMask);
+			}
+
+			/// <summary>
+			/// Compute Depth in Bin of Tile(Sub Tile)
+			/// 
+			/// CoverageMask, z0DepthMax, z1DepthMax, Triangle Max Depth
+			/// 
+			/// reference : 
+			/// https://stackoverflow.com/questions/24441631/how-exactly-does-opengl-do-perspectively-correct-linear-interpolation
+			/// https://www.rose-hulman.edu/class/cs/csse351/m10/triangle_fill.pdf
+			/// https://www.comp.nus.edu.sg/~lowkl/publications/lowk_persp_interp_techrep.pdf
+			/// </summary>
+			EVERYCULLING_FORCE_INLINE void RasterizeBinnedTriangles
+			(
+				culling::Tile* const tile
+			)
+			{
+				assert(tile != nullptr);
+
+				const culling::Vec2 tileOriginPoint{ static_cast<float>(tile->GetLeftBottomTileOrginX()), static_cast<float>(tile->GetLeftBottomTileOrginY()) };
+
+				size_t binnedTriangleCount = tile->mBinnedTriangleCount;
+				binnedTriangleCount = EVERYCULLING_MIN(binnedTriangleCount, BIN_TRIANGLE_CAPACITY_PER_TILE);
+
+				for (size_t triangleIndex = 0; triangleIndex < binnedTriangleCount; triangleIndex++)
+				{
+					//Triangle is already counter clock wise, and front facing
+					const float TriPointA_X = tile->mBinnedTriangleList[triangleIndex].PointAVertexX;
+					const float TriPointA_Y = tile->mBinnedTriangleList[triangleIndex].PointAVertexY;
+					const float TriPointA_Z = tile->mBinnedTriangleList[triangleIndex].PointAVertexZ;
+					const float TriPointB_X = tile->mBinnedTriangleList[triangleIndex].PointBVertexX;
+					const float TriPointB_Y = tile->mBinnedTriangleList[triangleIndex].PointBVertexY;
+					const float TriPointB_Z = tile->mBinnedTriangleList[triangleIndex].PointBVertexZ;
+					const float TriPointC_X = tile->mBinnedTriangleList[triangleIndex].PointCVertexX;
+					const float TriPointC_Y = tile->mBinnedTriangleList[triangleIndex].PointCVertexY;
+					const float TriPointC_Z = tile->mBinnedTriangleList[triangleIndex].PointCVertexZ;
+
+					culling::EVERYCULLING_M256I LeftSlopeEventOfTriangle;
+					culling::EVERYCULLING_M256I RightSlopeEventOfTriangle;
+
+
+					//second point ( pointB ) should be left(x) of third point ( pointA )
+
+					{
+						const float sortedTriPointB_X = TriPointB_X >= TriPointC_X ? TriPointC_X : TriPointB_X;
+						const float sortedTriPointB_Y = TriPointB_X >= TriPointC_X ? TriPointC_Y : TriPointB_Y;
+
+						const float sortedTriPointC_X = TriPointB_X >= TriPointC_X ? TriPointB_X : TriPointC_X;
+						const float sortedTriPointC_Y = TriPointB_X >= TriPointC_X ? TriPointB_Y : TriPointC_Y;
+
+						culling::triangleSlopeHelper::GatherBottomFlatTriangleSlopeEvent
+						(
+							tileOriginPoint,
+							LeftSlopeEventOfTriangle,
+							RightSlopeEventOfTriangle,
+
+							TriPointA_X,
+							TriPointA_Y,
+
+							sortedTriPointB_X,
+							sortedTriPointB_Y,
+
+							sortedTriPointC_X,
+							sortedTriPointC_Y
+						);
+
+
+						LeftSlopeEventOfTriangle = culling::EVERYCULLING_M256I_MAX(culling::EVERYCULLING_M256I_MIN(LeftSlopeEventOfTriangle, culling::EVERYCULLING_M256I_SET1(EVERYCULLING_TILE_WIDTH)), culling::EVERYCULLING_M256I_SET1(0));
+						RightSlopeEventOfTriangle = culling::EVERYCULLING_M256I_MAX(culling::EVERYCULLING_M256I_MIN(RightSlopeEventOfTriangle, culling::EVERYCULLING_M256I_SET1(EVERYCULLING_TILE_WIDTH)), culling::EVERYCULLING_M256I_SET1(0));
+					}
+
+					culling::EVERYCULLING_M256I CoverageMask = culling::EVERYCULLING_M256I_SETZERO(); // clear coverage mask
+					culling::EVERYCULLING_M256F subTileMaxDepth = culling::EVERYCULLING_M256F_SET1((float)EVERYCULLING_MIN_DEPTH_VALUE); // clear subTileMaxDepth
+
+					const float minY = EVERYCULLING_MIN(EVERYCULLING_MIN(TriPointA_Y, TriPointB_Y), TriPointC_Y);
+					const float maxY = EVERYCULLING_MAX(EVERYCULLING_MAX(TriPointA_Y, TriPointB_Y), TriPointC_Y);
+
+					{
+
+						culling::CoverageRasterizer::FillFlatTriangleBatch
+						(
+							CoverageMask,
+							tileOriginPoint,
+
+							LeftSlopeEventOfTriangle,
+							RightSlopeEventOfTriangle,
+							minY,
+							maxY
+						);
+
+						// ShuffleCoverageMask is really cheap!!.
+						// Branchless is faster than considering triangleCount, triangleMask
+						CoverageMask = ShuffleCoverageMask(CoverageMask);
+
+						// 44444444 55555555 66666666 77777777
+						// 44444444 55555555 66666666 77777777
+						// 44444444 55555555 66666666 77777777
+						// 44444444 55555555 66666666 77777777
+						// 
+						// 00000000 11111111 22222222 33333333
+						// 00000000 11111111 22222222 33333333
+						// 00000000 11111111 22222222 33333333
+						// 00000000 11111111 22222222 33333333
+						//
+						// --> 256bit
+						//
+						//
+						//
+						// 0 : CoverageMask ( 0 ~ 32 )
+						// 1 : CoverageMask ( 32 ~ 64 )
+						// 2 : CoverageMask ( 64 ~ 96 )
+						// 3 : CoverageMask ( 96 ~ 128 )
+						// 4 : CoverageMask ( 128 ~ 160 )
+						// 5 : CoverageMask ( 160 ~ 192 )
+						// 6 : CoverageMask ( 192 ~ 224 )
+						// 7 : CoverageMask ( 224 ~ 256 )
+
+					}
+
+
+
+
+
+					culling::DepthValueComputer::ComputeFlatTriangleMaxDepthValue
+					(
+						subTileMaxDepth,
+						tileOriginPoint.x,
+						tileOriginPoint.y,
+
+						TriPointA_X,
+						TriPointA_Y,
+						TriPointA_Z,
+
+						TriPointB_X,
+						TriPointB_Y,
+						TriPointB_Z,
+
+						TriPointC_X,
+						TriPointC_Y,
+						TriPointC_Z,
+
+						LeftSlopeEventOfTriangle,
+						RightSlopeEventOfTriangle,
+
+						minY,
+						maxY
+					);
+
+
+
+
+					// algo : if coverage mask is full, overrite tile->mHizDatas.L1SubTileMaxDepthValue to tile->mHizDatas.lMaxDepthValue and clear coverage mask
+
+
+
+							// exclude L1 depth of sub tile with zero coverage mask 
+					const culling::EVERYCULLING_M256I tileCoverageMaskIsZero = culling::EVERYCULLING_M256I_CMP_EQ(CoverageMask, culling::EVERYCULLING_M256I_SET1(0));
+					subTileMaxDepth = culling::EVERYCULLING_M256F_SELECT(subTileMaxDepth, culling::EVERYCULLING_M256F_SET1(-1.0f), *reinterpret_cast<const culling::EVERYCULLING_M256F*>(&tileCoverageMaskIsZero));
+
+					culling::EVERYCULLING_M256F& l0SubTileMaxDepthValue = *reinterpret_cast<culling::EVERYCULLING_M256F*>(tile->mHizDatas.L0SubTileMaxDepthValue);
+					culling::EVERYCULLING_M256F& l1SubTileMaxDepthValue = *reinterpret_cast<culling::EVERYCULLING_M256F*>(tile->mHizDatas.L1SubTileMaxDepthValue);
+					culling::EVERYCULLING_M256I& l1CoverageMask = *reinterpret_cast<culling::EVERYCULLING_M256I*>(tile->mHizDatas.L1CoverageMask);
+
+					l1SubTileMaxDepthValue = culling::EVERYCULLING_M256F_MAX(l1SubTileMaxDepthValue, subTileMaxDepth);
+					l1CoverageMask = culling::EVERYCULLING_M256I_OR(l1CoverageMask, CoverageMask);
+
+					const culling::EVERYCULLING_M256I maskCoveredByOne = culling::EVERYCULLING_M256I_CMP_EQ(l1CoverageMask, culling::EVERYCULLING_M256I_SET1(-1));
+					l0SubTileMaxDepthValue = culling::EVERYCULLING_M256F_SELECT(l0SubTileMaxDepthValue, culling::EVERYCULLING_M256F_MIN(l0SubTileMaxDepthValue, l1SubTileMaxDepthValue), *reinterpret_cast<const culling::EVERYCULLING_M256F*>(&maskCoveredByOne));
+					l1SubTileMaxDepthValue = culling::EVERYCULLING_M256F_SELECT(l1SubTileMaxDepthValue, culling::EVERYCULLING_M256F_SET1((float)EVERYCULLING_MIN_DEPTH_VALUE), *reinterpret_cast<const culling::EVERYCULLING_M256F*>(&maskCoveredByOne));
+					const culling::EVERYCULLING_M256F maskBlendResult = culling::EVERYCULLING_M256F_SELECT(*reinterpret_cast<const culling::EVERYCULLING_M256F*>(&l1CoverageMask), culling::EVERYCULLING_M256F_SETZERO(), *reinterpret_cast<const culling::EVERYCULLING_M256F*>(&maskCoveredByOne));
+					l1CoverageMask = *reinterpret_cast<const culling::EVERYCULLING_M256I*>(&maskBlendResult);
+
+					// Compute max depth value of subtiles's L0 max depth value
+					float maxDepthValue = -1.0f;
+					for (size_t i = 0; i < 8; i++)
+					{
+						maxDepthValue = EVERYCULLING_MAX(maxDepthValue, tile->mHizDatas.L0SubTileMaxDepthValue[i]);
+					}
+					tile->mHizDatas.L0MaxDepthValue = maxDepthValue;
+					assert(maxDepthValue >= -1.0f && maxDepthValue <= 1.0f);
+
+#ifdef EVERYCULLING_DEBUG_CULLING
+					const culling::EVERYCULLING_M256I test
+						=
+						culling::EVERYCULLING_M256I_SETR_EPI8
+						(
+							0, 4, 8, 12,
+							1, 5, 9, 13,
+							2, 6, 10, 14,
+							3, 7, 11, 15,
+							4, 2, 2, 1,
+							10, 5, 9, 5,
+							11, 3, 10, 4,
+							10, 1, 11, 1
+						);
+
+					const culling::EVERYCULLING_M256I correctTestResult
+						=
+						culling::EVERYCULLING_M256I_SETR_EPI8
+						(
+							0, 1, 2, 3,
+							4, 5, 6, 7,
+							8, 9, 10, 11,
+							12, 13, 14, 15,
+							4, 10, 11, 10,
+							2, 5, 3, 1,
+							2, 9, 10, 11,
+							1, 5, 4, 1
+						);
+
+
+					const culling::EVERYCULLING_M256I testResult = ShuffleCoverageMask(test);
+
+					assert(culling::EVERYCULLING_M256I_TEST_ALL_ONES(culling::EVERYCULLING_M256I_CMP_EQ_EPI8(correctTestResult, testResult)));
+
+#endif
+
+				}
+
+			}
+
+			EVERYCULLING_FORCE_INLINE int ProjectAABBToScreenSpace
+			(
+				const float* const aabbMinWorldPoint,
+				const float* const aabbMaxWorldPoint,
+				const float* const worldToClipSpaceMatrix,
+				const culling::SWDepthBuffer& depthBuffer,
+				float& outMinScreenSpacePointX,
+				float& outMinScreenSpacePointY,
+				float& outMaxScreenSpacePointX,
+				float& outMaxScreenSpacePointY,
+				float& outMinNDCZ
+			)
+			{
+				culling::EVERYCULLING_M256F aabbVertexX = culling::EVERYCULLING_M256F_SETR(aabbMinWorldPoint[0], aabbMinWorldPoint[0], aabbMinWorldPoint[0], aabbMinWorldPoint[0], aabbMaxWorldPoint[0], aabbMaxWorldPoint[0], aabbMaxWorldPoint[0], aabbMaxWorldPoint[0]);
+				culling::EVERYCULLING_M256F aabbVertexY = culling::EVERYCULLING_M256F_SETR(aabbMinWorldPoint[1], aabbMinWorldPoint[1], aabbMaxWorldPoint[1], aabbMaxWorldPoint[1], aabbMinWorldPoint[1], aabbMinWorldPoint[1], aabbMaxWorldPoint[1], aabbMaxWorldPoint[1]);
+				culling::EVERYCULLING_M256F aabbVertexZ = culling::EVERYCULLING_M256F_SETR(aabbMinWorldPoint[2], aabbMaxWorldPoint[2], aabbMinWorldPoint[2], aabbMaxWorldPoint[2], aabbMinWorldPoint[2], aabbMaxWorldPoint[2], aabbMinWorldPoint[2], aabbMaxWorldPoint[2]);
+				culling::EVERYCULLING_M256F aabbVertexW;
+
+				// Convert world space to clip space
+				culling::vertexTransformationHelper::TransformVertexToClipSpace
+				(
+					aabbVertexX,
+					aabbVertexY,
+					aabbVertexZ,
+					aabbVertexW,
+					worldToClipSpaceMatrix
+				);
+
+				const culling::EVERYCULLING_M256F isHomogeneousWNegative = culling::EVERYCULLING_M256F_CMP_LT(aabbVertexW, culling::EVERYCULLING_M256F_SET1(std::numeric_limits<float>::epsilon()));
+
+				const culling::EVERYCULLING_M256F oneDividedByW = culling::EVERYCULLING_M256F_DIV(culling::EVERYCULLING_M256F_SET1(1.0f), aabbVertexW);
+
+				// Convert clip space to ndc space
+				culling::vertexTransformationHelper::ConvertClipSpaceVertexToNDCSpace
+				(
+					aabbVertexX,
+					aabbVertexY,
+					aabbVertexZ,
+					oneDividedByW
+				);
+
+				culling::EVERYCULLING_M256F screenPixelPosX, screenPixelPosY;
+				culling::vertexTransformationHelper::ConvertNDCSpaceVertexToScreenPixelSpace
+				(
+					aabbVertexX,
+					aabbVertexY,
+					screenPixelPosX, 
+					screenPixelPosY, 
+					depthBuffer
+				);
+
+
+
+
+				// Compute min, max sreen space X, Y
+
+
+				// Do clamp min, max screen space
+				float minX = std::numeric_limits<float>::max();
+				float minY = std::numeric_limits<float>::max();
+				float maxX = -std::numeric_limits<float>::max();
+				float maxY = -std::numeric_limits<float>::max();
+
+				// set max value to invalid vertex index
+				// this is for branchless codes
+
+				screenPixelPosX = culling::EVERYCULLING_M256F_SELECT(screenPixelPosX, culling::EVERYCULLING_M256F_SET1(std::numeric_limits<float>::max()), isHomogeneousWNegative);
+				screenPixelPosY = culling::EVERYCULLING_M256F_SELECT(screenPixelPosY, culling::EVERYCULLING_M256F_SET1(std::numeric_limits<float>::max()), isHomogeneousWNegative);
+				for(int i = 0 ; i < 8 ; i++)
+				{
+					minX = EVERYCULLING_MIN(minX, reinterpret_cast<const float*>(&screenPixelPosX)[i]);
+					minY = EVERYCULLING_MIN(minY, reinterpret_cast<const float*>(&screenPixelPosY)[i]);
+				}
+
+				screenPixelPosX = culling::EVERYCULLING_M256F_SELECT(screenPixelPosX, culling::EVERYCULLING_M256F_SET1(-std::numeric_limits<float>::max()), isHomogeneousWNegative);
+				screenPixelPosY = culling::EVERYCULLING_M256F_SELECT(screenPixelPosY, culling::EVERYCULLING_M256F_SET1(-std::numeric_limits<float>::max()), isHomogeneousWNegative);
+				for (int i = 0; i < 8; i++)
+				{
+					maxX = EVERYCULLING_MAX(maxX, reinterpret_cast<const float*>(&screenPixelPosX)[i]);
+					maxY = EVERYCULLING_MAX(maxY, reinterpret_cast<const float*>(&screenPixelPosY)[i]);
+				}
+
+				outMinScreenSpacePointX = minX;
+				outMinScreenSpacePointY = minY;
+
+				outMaxScreenSpacePointX = maxX;
+				outMaxScreenSpacePointY = maxY;
+
+
+				// Compute min depth value
+
+				aabbVertexZ = culling::EVERYCULLING_M256F_SELECT(aabbVertexZ, culling::EVERYCULLING_M256F_SET1(std::numeric_limits<float>::max()), isHomogeneousWNegative);
+				float aabbMinDepthValue = std::numeric_limits<float>::max();
+				for (size_t i = 0; i < 8; i++)
+				{
+					aabbMinDepthValue = EVERYCULLING_MIN(aabbMinDepthValue, reinterpret_cast<const float*>(&aabbVertexZ)[i]);
+				}
+
+				outMinNDCZ = aabbMinDepthValue;
+
+				return culling::EVERYCULLING_M256F_MOVEMASK(isHomogeneousWNegative);
+			}
+		}
+	}
+}
@@ -0,0 +1,41 @@
+#include "DepthBufferKernelImpl.h"
+
+// This translation unit is compiled with AVX2
+
+int culling::depthBufferKernel::ProjectAABBToScreenSpace_AVX2
+(
+	const float* const aabbMinWorldPoint,
+	const float* const aabbMaxWorldPoint,
+	const float* const worldToClipSpaceMatrix,
+	const culling::SWDepthBuffer& depthBuffer,
+	float& outMinScreenSpacePointX,
+	float& outMinScreenSpacePointY,
+	float& outMaxScreenSpacePointX,
+	float& outMaxScreenSpacePointY,
+	float& outMinNDCZ
+)
+{
+	return ProjectAABBToScreenSpace(aabbMinWorldPoint, aabbMaxWorldPoint, worldToClipSpaceMatrix, depthBuffer, outMinScreenSpacePointX, outMinScreenSpacePointY, outMaxScreenSpacePointX, outMaxScreenSpacePointY, outMinNDCZ);
+}
+
+void culling::depthBufferKernel::BinTriangles_AVX2
+(
+	culling::SWDepthBuffer& depthBuffer,
+	const float* const vertices,
+	const std::uint64_t verticeCount,
+	const std::uint32_t* const vertexIndices,
+	const std::uint64_t indiceCount,
+	const std::uint64_t vertexStrideByte,
+	const float* const modelToClipspaceMatrix
+)
+{
+	BinTriangles(depthBuffer, vertices, verticeCount, vertexIndices, indiceCount, vertexStrideByte, modelToClipspaceMatrix);
+}
+
+void culling::depthBufferKernel::RasterizeBinnedTriangles_AVX2
+(
+	culling::Tile* const tile
+)
+{
+	RasterizeBinnedTriangles(tile);
+}
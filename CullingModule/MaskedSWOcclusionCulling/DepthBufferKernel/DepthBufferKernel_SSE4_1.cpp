@@ -0,0 +1,41 @@
+#include "DepthBufferKernelImpl.h"
+
+// This translation unit is compiled with SSE4.1 ( without AVX ). 8 wide vectors are two 128bit halves
+
+int culling::depthBufferKernel::ProjectAABBToScreenSpace_SSE4_1
+(
+	const float* const aabbMinWorldPoint,
+	const float* const aabbMaxWorldPoint,
+	const float* const worldToClipSpaceMatrix,
+	const culling::SWDepthBuffer& depthBuffer,
+	float& outMinScreenSpacePointX,
+	float& outMinScreenSpacePointY,
+	float& outMaxScreenSpacePointX,
+	float& outMaxScreenSpacePointY,
+	float& outMinNDCZ
+)
+{
+	return ProjectAABBToScreenSpace(aabbMinWorldPoint, aabbMaxWorldPoint, worldToClipSpaceMatrix, depthBuffer, outMinScreenSpacePointX, outMinScreenSpacePointY, outMaxScreenSpacePointX, outMaxScreenSpacePointY, outMinNDCZ);
+}
+
+void culling::depthBufferKernel::BinTriangles_SSE4_1
+(
+	culling::SWDepthBuffer& depthBuffer,
+	const float* const vertices,
+	const std::uint64_t verticeCount,
+	const std::uint32_t* const vertexIndices,
+	const std::uint64_t indiceCount,
+	const std::uint64_t vertexStrideByte,
+	const float* const modelToClipspaceMatrix
+)
+{
+	BinTriangles(depthBuffer, vertices, verticeCount, vertexIndices, indiceCount, vertexStrideByte, modelToClipspaceMatrix);
+}
+
+void culling::depthBufferKernel::RasterizeBinnedTriangles_SSE4_1
+(
+	culling::Tile* const tile
+)
+{
+	RasterizeBinnedTriangles(tile);
+}
@@ -3,6 +3,8 @@
 #include "Stage/BinTrianglesStage.h"
 #include "Stage/RasterizeOccludersStage.h"
 
+#include "../../DataType/EntityBlock.h"
+
 void culling::MaskedSWOcclusionCulling::ResetDepthBuffer(const unsigned long long currentTickCount)
 {
 	mDepthBuffer.Reset(currentTickCount);
@@ -43,10 +45,38 @@ void culling::MaskedSWOcclusionCulling::ResetState(const unsigned long long curr
 	}
 
 	mOccluderListManager.ResetOccluderList();
+	mCostModel.ResetState(currentTickCount);
+}
+
+void culling::MaskedSWOcclusionCulling::OnSetCameraCount(const size_t cameraCount)
+{
+	CullingModule::OnSetCameraCount(cameraCount);
+
+	mCostModel.OnSetCameraCount(cameraCount);
 }
 
 void culling::MaskedSWOcclusionCulling::CullBlockEntityJob(const size_t cameraIndex, const unsigned long long currentTickCount)
 {
+	// Survived entities are used only when OcclusionCostModel decides at bin tick
+	if (mCostModel.IsEnabled() == true && mSolveMeshRoleStage.IsEnabled == true && EVERYCULLING_WHEN_TO_BIN_TRIANGLE(currentTickCount))
+	{
+		std::uint32_t survivedEntityCount = 0;
+		while (true)
+		{
+			culling::EntityBlock* const nextEntityBlock = GetNextEntityBlock(cameraIndex);
+
+			if (nextEntityBlock != nullptr)
+			{
+				survivedEntityCount += nextEntityBlock->GetVisibleEntityCount(cameraIndex);
+			}
+			else
+			{
+				break;
+			}
+		}
+
+		mCostModel.AddSurvivedEntityCount(cameraIndex, survivedEntityCount);
+	}
 }
 
 const char* culling::MaskedSWOcclusionCulling::GetCullingModuleName() const
@@ -15,6 +15,7 @@
 #include "Stage/QueryOccludeeStage.h"
 
 #include "OccluderListManager.h"
+#include "OcclusionCostModel.h"
 
 #define INVALID_BINNED_OCCLUDER_COUNT (std::int32_t)(-1)
 
@@ -28,7 +29,7 @@ namespace culling
 	/// Masked SW Occlusion Culling
 	/// 
 	/// 
-	/// Supported SIMD Version : AVX2
+	/// Supported SIMD Version : SSE4.1, AVX2 ( DepthBufferKernel.h )
 	/// 
 	/// How Wokrs ? : 
 	/// Please read "MaskedSWOcclusionCulling_HowWorks.md" file
@@ -55,6 +56,10 @@ namespace culling
 	public:
 
 		OccluderListManager mOccluderListManager;
+		/// <summary>
+		/// Skip or bound occlusion culling of each camera with measured cost. Disabled by default
+		/// </summary>
+		OcclusionCostModel mCostModel;
 		
 		culling::EveryCulling* const mEveryCulling;
 
@@ -73,6 +78,10 @@ namespace culling
 		);
 	
 		void ResetState(const unsigned long long currentTickCount);
+		void OnSetCameraCount(const size_t cameraCount) override;
+		/// <summary>
+		/// Count entities surviving culling modules before it for OcclusionCostModel
+		/// </summary>
 		void CullBlockEntityJob(const size_t cameraIndex, const unsigned long long currentTickCount) override;
 		const char* GetCullingModuleName() const override;
 
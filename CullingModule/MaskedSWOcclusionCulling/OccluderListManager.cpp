@@ -9,7 +9,7 @@ culling::OccluderListManager::OccluderListManager()
 	ResetOccluderList();
 }
 
-void culling::OccluderListManager::AddOccluder(EntityBlock* const entityBlock, const size_t entityIndexInEntityBlock)
+void culling::OccluderListManager::AddOccluder(EntityBlock* const entityBlock, const size_t entityIndexInEntityBlock, const std::uint32_t meshLODIndex)
 {
 	const size_t occluderIndex = mOccluderCount++;
 
@@ -17,6 +17,7 @@ void culling::OccluderListManager::AddOccluder(EntityBlock* const entityBlock, c
 	{
 		mOccluderList[occluderIndex].mEntityBlock = entityBlock;
 		mOccluderList[occluderIndex].mEntityIndexInEntityBlock = entityIndexInEntityBlock;
+		mOccluderList[occluderIndex].mMeshLODIndex = meshLODIndex;
 	}
 }
 
@@ -52,6 +53,21 @@ std::vector<culling::OccluderData> culling::OccluderListManager::GetSortedOcclud
 	return occluderList;
 }
 
+std::uint64_t culling::OccluderListManager::GetOccluderIndiceCount() const
+{
+	const size_t occluderCount = mOccluderCount;
+
+	std::uint64_t occluderIndiceCount = 0;
+	for (size_t occluderIndex = 0; occluderIndex < EVERYCULLING_MIN(occluderCount, OCCLUDER_LIST_POOL_SIZE); occluderIndex++)
+	{
+		const culling::OccluderData& occluderData = mOccluderList[occluderIndex];
+		const culling::VertexData& vertexData = occluderData.mEntityBlock->mColdData->mVertexDatas[occluderData.mEntityIndexInEntityBlock];
+		occluderIndiceCount += (occluderData.mMeshLODIndex == 0) ? vertexData.mIndiceCount : vertexData.mCoarseMeshLODs[occluderData.mMeshLODIndex - 1].mIndiceCount;
+	}
+
+	return occluderIndiceCount;
+}
+
 void culling::OccluderListManager::ResetOccluderList()
 {
 	mOccluderCount = 0;
@@ -18,6 +18,10 @@ namespace culling
 	{
 		EntityBlock* mEntityBlock;
 		size_t mEntityIndexInEntityBlock;
+		/// <summary>
+		/// LOD of occluder mesh selected in SolveMeshRoleStage. 0 : mesh set with EntityBlockViewer::SetMeshVertexData
+		/// </summary>
+		std::uint32_t mMeshLODIndex;
 	};
 
 	class OccluderListManager
@@ -31,9 +35,13 @@ namespace culling
 	public:
 
 		OccluderListManager();
-		void AddOccluder(EntityBlock* const entityBlock, const size_t entityIndexInEntityBlock);
+		void AddOccluder(EntityBlock* const entityBlock, const size_t entityIndexInEntityBlock, const std::uint32_t meshLODIndex);
 
 		std::vector<OccluderData> GetSortedOccluderList(const culling::Vec3& cameraWorldPos) const;
+		/// <summary>
+		/// Sum of indice count of selected mesh LOD of occluders in list
+		/// </summary>
+		std::uint64_t GetOccluderIndiceCount() const;
 
 		void ResetOccluderList();
 	};
@@ -0,0 +1,284 @@
+#include "OcclusionCostModel.h"
+
+#include <cassert>
+
+namespace
+{
+	// Depth buffer rasterized at a bin cycle is queried at every tick of the cycle
+	constexpr float QUERY_COUNT_PER_BIN_CYCLE = (EVERYCULLING_RASTERIZE_DEPTH_BUFFER_FOR_TWO_FRAMES == 1) ? 2.0f : 1.0f;
+
+	EVERYCULLING_FORCE_INLINE void UpdateRunningAverage(float& runningAverage, const float measuredValue)
+	{
+		runningAverage = (runningAverage < 0.0f) ? measuredValue : runningAverage + (measuredValue - runningAverage) * EVERYCULLING_OCCLUSION_COST_MODEL_SMOOTHING;
+	}
+}
+
+culling::OcclusionCostModel::OcclusionCostModel()
+	:
+	mIsEnabled{ false },
+	mOccludedEntitySavedTime{ EVERYCULLING_DEFAULT_OCCLUDED_ENTITY_SAVED_TIME },
+	mMinSurvivedEntityCount{ EVERYCULLING_DEFAULT_OCCLUSION_CULLING_MIN_SURVIVED_ENTITY_COUNT },
+	mProbeInterval{ EVERYCULLING_DEFAULT_OCCLUSION_COST_MODEL_PROBE_INTERVAL }
+{
+	for (size_t stageIndex = 0; stageIndex < static_cast<size_t>(culling::OcclusionCullingStage::Count); stageIndex++)
+	{
+		mStageTimes[stageIndex].store(0, std::memory_order_relaxed);
+		mStageWorkCounts[stageIndex].store(0, std::memory_order_relaxed);
+		mStageTimePerWorks[stageIndex] = -1.0f;
+	}
+}
+
+void culling::OcclusionCostModel::SetEnabled(const bool isEnabled)
+{
+	mIsEnabled = isEnabled;
+
+	for (size_t cameraIndex = 0; cameraIndex < mIsOcclusionCullingSkipped.size(); cameraIndex++)
+	{
+		mIsOcclusionCullingSkipped[cameraIndex] = false;
+		mIsPreviousOcclusionCullingSkipped[cameraIndex] = false;
+		mSkippedBinCycleCounts[cameraIndex] = 0;
+		mBinnedIndiceBudgets[cameraIndex] = EVERYCULLING_MAX_BINNED_INDICE_COUNT;
+	}
+}
+
+void culling::OcclusionCostModel::SetOccludedEntitySavedTime(const float occludedEntitySavedTime)
+{
+	assert(occludedEntitySavedTime >= 0.0f);
+	mOccludedEntitySavedTime = occludedEntitySavedTime;
+}
+
+void culling::OcclusionCostModel::SetMinSurvivedEntityCount(const std::uint32_t minSurvivedEntityCount)
+{
+	mMinSurvivedEntityCount = minSurvivedEntityCount;
+}
+
+void culling::OcclusionCostModel::SetProbeInterval(const std::uint32_t probeInterval)
+{
+	mProbeInterval = probeInterval;
+}
+
+void culling::OcclusionCostModel::OnSetCameraCount(const size_t cameraCount)
+{
+	const size_t previousCameraCount = mIsOcclusionCullingSkipped.size();
+	mSurvivedEntityCounts.Resize(cameraCount);
+	mQueriedEntityCounts.Resize(cameraCount);
+	mOccludedEntityCounts.Resize(cameraCount);
+	mOccludedEntityRatios.Resize(cameraCount);
+	mIsOcclusionCullingSkipped.Resize(cameraCount);
+	mIsPreviousOcclusionCullingSkipped.Resize(cameraCount);
+	mSkippedBinCycleCounts.Resize(cameraCount);
+	mBinnedIndiceBudgets.Resize(cameraCount);
+	mDecisionTickCounts.Resize(cameraCount);
+	mBudgetTickCounts.Resize(cameraCount);
+	for (size_t cameraIndex = previousCameraCount; cameraIndex < cameraCount; cameraIndex++)
+	{
+		mOccludedEntityRatios[cameraIndex] = -1.0f;
+		mIsOcclusionCullingSkipped[cameraIndex] = false;
+		mIsPreviousOcclusionCullingSkipped[cameraIndex] = false;
+		mSkippedBinCycleCounts[cameraIndex] = 0;
+		mBinnedIndiceBudgets[cameraIndex] = EVERYCULLING_MAX_BINNED_INDICE_COUNT;
+		mDecisionTickCounts[cameraIndex].store((unsigned long long)-1, std::memory_order_relaxed);
+		mBudgetTickCounts[cameraIndex].store((unsigned long long)-1, std::memory_order_relaxed);
+	}
+}
+
+void culling::OcclusionCostModel::ResetState(const unsigned long long currentTickCount)
+{
+	for (std::atomic<std::uint32_t>& survivedEntityCount : mSurvivedEntityCounts)
+	{
+		survivedEntityCount.store(0, std::memory_order_relaxed);
+	}
+
+	if (EVERYCULLING_WHEN_TO_BIN_TRIANGLE(currentTickCount))
+	{
+		// Rasterized indices are indices binned at same bin cycle
+		const std::uint64_t binnedIndiceCount = mStageWorkCounts[static_cast<size_t>(culling::OcclusionCullingStage::BinTriangles)].load(std::memory_order_relaxed);
+		mStageWorkCounts[static_cast<size_t>(culling::OcclusionCullingStage::RasterizeOccluders)].store(binnedIndiceCount, std::memory_order_relaxed);
+
+		for (size_t stageIndex = 0; stageIndex < static_cast<size_t>(culling::OcclusionCullingStage::Count); stageIndex++)
+		{
+			const std::uint64_t stageTime = mStageTimes[stageIndex].exchange(0, std::memory_order_relaxed);
+			const std::uint64_t stageWorkCount = mStageWorkCounts[stageIndex].exchange(0, std::memory_order_relaxed);
+			if (stageWorkCount > 0)
+			{
+				UpdateRunningAverage(mStageTimePerWorks[stageIndex], static_cast<float>(stageTime) / static_cast<float>(stageWorkCount));
+			}
+		}
+
+		for (size_t cameraIndex = 0; cameraIndex < mOccludedEntityRatios.size(); cameraIndex++)
+		{
+			const std::uint64_t queriedEntityCount = mQueriedEntityCounts[cameraIndex].exchange(0, std::memory_order_relaxed);
+			const std::uint64_t occludedEntityCount = mOccludedEntityCounts[cameraIndex].exchange(0, std::memory_order_relaxed);
+			if (queriedEntityCount > 0)
+			{
+				UpdateRunningAverage(mOccludedEntityRatios[cameraIndex], static_cast<float>(occludedEntityCount) / static_cast<float>(queriedEntityCount));
+			}
+		}
+	}
+}
+
+void culling::OcclusionCostModel::AddSurvivedEntityCount(const size_t cameraIndex, const std::uint32_t survivedEntityCount)
+{
+	mSurvivedEntityCounts[cameraIndex].fetch_add(survivedEntityCount, std::memory_order_relaxed);
+}
+
+void culling::OcclusionCostModel::AddStageTime(const culling::OcclusionCullingStage stage, const std::chrono::steady_clock::duration time, const std::uint64_t workCount)
+{
+	if (mIsEnabled == true)
+	{
+		mStageTimes[static_cast<size_t>(stage)].fetch_add(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(time).count()), std::memory_order_relaxed);
+		mStageWorkCounts[static_cast<size_t>(stage)].fetch_add(workCount, std::memory_order_relaxed);
+	}
+}
+
+void culling::OcclusionCostModel::AddQueryResult(const size_t cameraIndex, const std::uint64_t queriedEntityCount, const std::uint64_t occludedEntityCount)
+{
+	mQueriedEntityCounts[cameraIndex].fetch_add(queriedEntityCount, std::memory_order_relaxed);
+	mOccludedEntityCounts[cameraIndex].fetch_add(occludedEntityCount, std::memory_order_relaxed);
+}
+
+void culling::OcclusionCostModel::EstimateEntityCostAndBenefit(const size_t cameraIndex, float& outEntityCost, float& outBenefit) const
+{
+	const float survivedEntityCount = static_cast<float>(mSurvivedEntityCounts[cameraIndex].load(std::memory_order_relaxed));
+	const float solveMeshRoleTimePerCamera = mStageTimePerWorks[static_cast<size_t>(culling::OcclusionCullingStage::SolveMeshRole)];
+	const float queryOccludeeTimePerCamera = mStageTimePerWorks[static_cast<size_t>(culling::OcclusionCullingStage::QueryOccludee)];
+
+	outEntityCost = (solveMeshRoleTimePerCamera < 0.0f || queryOccludeeTimePerCamera < 0.0f) ? -1.0f : solveMeshRoleTimePerCamera + QUERY_COUNT_PER_BIN_CYCLE * queryOccludeeTimePerCamera;
+	outBenefit = (mOccludedEntityRatios[cameraIndex] < 0.0f) ? -1.0f : survivedEntityCount * mOccludedEntityRatios[cameraIndex] * mOccludedEntitySavedTime * QUERY_COUNT_PER_BIN_CYCLE;
+}
+
+float culling::OcclusionCostModel::GetTimePerBinnedIndice() const
+{
+	const float binTrianglesTimePerIndice = mStageTimePerWorks[static_cast<size_t>(culling::OcclusionCullingStage::BinTriangles)];
+	const float rasterizeOccludersTimePerIndice = mStageTimePerWorks[static_cast<size_t>(culling::OcclusionCullingStage::RasterizeOccluders)];
+
+	return (binTrianglesTimePerIndice < 0.0f || rasterizeOccludersTimePerIndice < 0.0f) ? -1.0f : binTrianglesTimePerIndice + rasterizeOccludersTimePerIndice;
+}
+
+bool culling::OcclusionCostModel::DecideOcclusionCulling(const size_t cameraIndex, const unsigned long long currentTickCount)
+{
+	if (mIsEnabled == false)
+	{
+		return true;
+	}
+
+	if (mDecisionTickCounts[cameraIndex].load(std::memory_order_acquire) != currentTickCount)
+	{
+		std::lock_guard<std::mutex> lock{ mDecisionMutex };
+
+		if (mDecisionTickCounts[cameraIndex].load(std::memory_order_relaxed) != currentTickCount)
+		{
+			mIsPreviousOcclusionCullingSkipped[cameraIndex] = mIsOcclusionCullingSkipped[cameraIndex];
+
+			bool isSkipped = false;
+			std::uint64_t binnedIndiceBudget = EVERYCULLING_MAX_BINNED_INDICE_COUNT;
+
+			if (mSurvivedEntityCounts[cameraIndex].load(std::memory_order_relaxed) < mMinSurvivedEntityCount)
+			{
+				isSkipped = true;
+			}
+			else if (mProbeInterval == 0 || mSkippedBinCycleCounts[cameraIndex] < mProbeInterval)
+			{
+				float entityCost, benefit;
+				EstimateEntityCostAndBenefit(cameraIndex, entityCost, benefit);
+
+				// Run with full budget until every cost is measured
+				const float timePerBinnedIndice = GetTimePerBinnedIndice();
+				if (entityCost >= 0.0f && benefit >= 0.0f && timePerBinnedIndice >= 0.0f)
+				{
+					if (benefit <= entityCost)
+					{
+						isSkipped = true;
+					}
+					else if (timePerBinnedIndice > 0.0f)
+					{
+						const float affordableIndiceCount = (benefit - entityCost) / timePerBinnedIndice;
+						binnedIndiceBudget = (affordableIndiceCount < static_cast<float>(EVERYCULLING_MAX_BINNED_INDICE_COUNT)) ? static_cast<std::uint64_t>(affordableIndiceCount) : EVERYCULLING_MAX_BINNED_INDICE_COUNT;
+					}
+				}
+			}
+
+			mIsOcclusionCullingSkipped[cameraIndex] = isSkipped;
+			mBinnedIndiceBudgets[cameraIndex] = (isSkipped == true) ? 0 : binnedIndiceBudget;
+			if (isSkipped == true)
+			{
+				mSkippedBinCycleCounts[cameraIndex]++;
+			}
+
+			mDecisionTickCounts[cameraIndex].store(currentTickCount, std::memory_order_release);
+		}
+	}
+
+	return mIsOcclusionCullingSkipped[cameraIndex] == false;
+}
+
+std::uint64_t culling::OcclusionCostModel::DecideBinnedIndiceBudget(const size_t cameraIndex, const unsigned long long currentTickCount, const std::uint64_t occluderIndiceCount)
+{
+	if (mIsEnabled == false)
+	{
+		return EVERYCULLING_MAX_BINNED_INDICE_COUNT;
+	}
+
+	if (mBudgetTickCounts[cameraIndex].load(std::memory_order_acquire) != currentTickCount)
+	{
+		std::lock_guard<std::mutex> lock{ mDecisionMutex };
+
+		if (mBudgetTickCounts[cameraIndex].load(std::memory_order_relaxed) != currentTickCount)
+		{
+			assert(mIsOcclusionCullingSkipped[cameraIndex] == false);
+
+			// Budget is enough to bin occluders, or at least EVERYCULLING_OCCLUSION_COST_MODEL_MIN_BINNED_INDICE_COUNT indices of near occluders
+			if (mBinnedIndiceBudgets[cameraIndex] < EVERYCULLING_MIN(occluderIndiceCount, EVERYCULLING_OCCLUSION_COST_MODEL_MIN_BINNED_INDICE_COUNT))
+			{
+				mIsOcclusionCullingSkipped[cameraIndex] = true;
+				mBinnedIndiceBudgets[cameraIndex] = 0;
+				mSkippedBinCycleCounts[cameraIndex]++;
+			}
+			else
+			{
+				mBinnedIndiceBudgets[cameraIndex] = EVERYCULLING_MIN(mBinnedIndiceBudgets[cameraIndex], occluderIndiceCount);
+				mSkippedBinCycleCounts[cameraIndex] = 0;
+			}
+
+			mBudgetTickCounts[cameraIndex].store(currentTickCount, std::memory_order_release);
+		}
+	}
+
+	return mBinnedIndiceBudgets[cameraIndex];
+}
+
+bool culling::OcclusionCostModel::GetIsOcclusionCullingSkipped(const size_t cameraIndex) const
+{
+	return mIsEnabled == true && mIsOcclusionCullingSkipped[cameraIndex] == true;
+}
+
+bool culling::OcclusionCostModel::GetIsDepthBufferRasterized(const size_t cameraIndex, const unsigned long long currentTickCount) const
+{
+	if (mIsEnabled == false)
+	{
+		return true;
+	}
+
+	// Depth buffer queried at tick not rasterizing it is rasterized at previous bin cycle
+	return (EVERYCULLING_WHEN_TO_RASTERIZE_DEPTHBUFFER(currentTickCount)) ? (mIsOcclusionCullingSkipped[cameraIndex] == false) : (mIsPreviousOcclusionCullingSkipped[cameraIndex] == false);
+}
+
+std::uint64_t culling::OcclusionCostModel::GetBinnedIndiceBudget(const size_t cameraIndex) const
+{
+	return (mIsEnabled == true) ? mBinnedIndiceBudgets[cameraIndex] : EVERYCULLING_MAX_BINNED_INDICE_COUNT;
+}
+
+std::uint32_t culling::OcclusionCostModel::GetSurvivedEntityCount(const size_t cameraIndex) const
+{
+	return mSurvivedEntityCounts[cameraIndex].load(std::memory_order_relaxed);
+}
+
+float culling::OcclusionCostModel::GetOccludedEntityRatio(const size_t cameraIndex) const
+{
+	return mOccludedEntityRatios[cameraIndex];
+}
+
+float culling::OcclusionCostModel::GetStageTimePerWork(const culling::OcclusionCullingStage stage) const
+{
+	return mStageTimePerWorks[static_cast<size_t>(stage)];
+}
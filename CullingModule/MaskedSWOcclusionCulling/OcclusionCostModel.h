@@ -0,0 +1,167 @@
+#pragma once
+
+#include "../../EveryCullingCore.h"
+
+#include "../../DataType/PerCameraArray.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+namespace culling
+{
+	/// <summary>
+	/// Stages of MaskedSWOcclusionCulling whose time is measured by OcclusionCostModel
+	/// </summary>
+	enum class OcclusionCullingStage : std::uint32_t
+	{
+		/// <summary>
+		/// Work : run for a camera. Time mostly comes from iterating every entity block
+		/// </summary>
+		SolveMeshRole,
+		/// <summary>
+		/// Work : binned indice
+		/// </summary>
+		BinTriangles,
+		/// <summary>
+		/// Work : indice binned in same bin cycle. Fixed time of iterating tiles makes time per indice bigger as fewer indices are binned
+		/// </summary>
+		RasterizeOccluders,
+		/// <summary>
+		/// Work : run for a camera. Time mostly comes from iterating every entity block
+		/// </summary>
+		QueryOccludee,
+		Count
+	};
+
+	/// <summary>
+	/// Decide per camera whether MaskedSWOcclusionCulling is worth its cost, instead of enabling or disabling it for every camera.
+	///
+	/// Decision is made once per camera at each bin cycle ( tick binning triangles and tick rasterizing them ).
+	/// Entities surviving culling modules before MaskedSWOcclusionCulling are counted,
+	/// and occlusion culling is skipped when few entities survive, or when expected render time saved by occluded entities
+	/// ( survived entities * running average of occluded ratio * saved time per entity ) is smaller than expected time of
+	/// SolveMeshRoleStage and QueryOccludeeStage ( running average of measured time per camera ).
+	/// Otherwise left time bounds count of binned indices ( running average of measured time of BinTrianglesStage and RasterizeOccludersStage per indice ).
+	/// Occluders are binned from near to far, so farther occluders are dropped first.
+	/// When left time can't pay fixed time of rasterizing tiles, time per indice grows as budget shrinks until occlusion culling is skipped.
+	/// Occlusion culling skipped for EVERYCULLING_DEFAULT_OCCLUSION_COST_MODEL_PROBE_INTERVAL bin cycles runs once to measure occluded ratio again.
+	///
+	/// Resolution of depth buffer isn't scaled, as depth buffer and bins are shared by cameras.
+	///
+	/// This is disabled by default. ( use SetEnabled )
+	/// </summary>
+	class OcclusionCostModel
+	{
+	private:
+
+		bool mIsEnabled;
+		float mOccludedEntitySavedTime;
+		std::uint32_t mMinSurvivedEntityCount;
+		std::uint32_t mProbeInterval;
+
+		/// <summary>
+		/// Measured at current bin cycle. Folded to running averages at start of next bin cycle
+		/// </summary>
+		std::atomic<std::uint64_t> mStageTimes[static_cast<size_t>(culling::OcclusionCullingStage::Count)];
+		std::atomic<std::uint64_t> mStageWorkCounts[static_cast<size_t>(culling::OcclusionCullingStage::Count)];
+		/// <summary>
+		/// Running average of time per work of stages in nanoseconds. Negative : not measured yet
+		/// </summary>
+		float mStageTimePerWorks[static_cast<size_t>(culling::OcclusionCullingStage::Count)];
+
+		/// <summary>
+		/// Entities surviving culling modules before MaskedSWOcclusionCulling at this tick
+		/// </summary>
+		culling::PerCameraArray<std::atomic<std::uint32_t>> mSurvivedEntityCounts;
+		culling::PerCameraArray<std::atomic<std::uint64_t>> mQueriedEntityCounts;
+		culling::PerCameraArray<std::atomic<std::uint64_t>> mOccludedEntityCounts;
+		/// <summary>
+		/// Running average of ratio of queried entities culled by QueryOccludeeStage. Negative : not measured yet
+		/// </summary>
+		culling::PerCameraArray<float> mOccludedEntityRatios;
+
+		culling::PerCameraArray<bool> mIsOcclusionCullingSkipped;
+		/// <summary>
+		/// Decision of previous bin cycle. With EVERYCULLING_RASTERIZE_DEPTH_BUFFER_FOR_TWO_FRAMES, depth buffer queried at bin tick is rasterized at previous bin cycle
+		/// </summary>
+		culling::PerCameraArray<bool> mIsPreviousOcclusionCullingSkipped;
+		culling::PerCameraArray<std::uint32_t> mSkippedBinCycleCounts;
+		culling::PerCameraArray<std::uint64_t> mBinnedIndiceBudgets;
+
+		/// <summary>
+		/// Decisions are made once per tick for each camera. Other threads wait until it's done
+		/// </summary>
+		culling::PerCameraArray<std::atomic<unsigned long long>> mDecisionTickCounts;
+		culling::PerCameraArray<std::atomic<unsigned long long>> mBudgetTickCounts;
+		std::mutex mDecisionMutex;
+
+		/// <summary>
+		/// Expected time of SolveMeshRoleStage and QueryOccludeeStage of camera in a bin cycle, and render time saved by them
+		/// </summary>
+		void EstimateEntityCostAndBenefit(const size_t cameraIndex, float& outEntityCost, float& outBenefit) const;
+		float GetTimePerBinnedIndice() const;
+
+	public:
+
+		OcclusionCostModel();
+
+		void SetEnabled(const bool isEnabled);
+		EVERYCULLING_FORCE_INLINE bool IsEnabled() const
+		{
+			return mIsEnabled;
+		}
+
+		/// <summary>
+		/// Render time saved by an occluded entity in nanoseconds. ( ex. average cpu and gpu time of draw call of an entity )
+		/// </summary>
+		void SetOccludedEntitySavedTime(const float occludedEntitySavedTime);
+		void SetMinSurvivedEntityCount(const std::uint32_t minSurvivedEntityCount);
+		/// <summary>
+		/// 0 : skipped occlusion culling never runs again to measure occluded ratio until survived entities or measured cost change
+		/// </summary>
+		void SetProbeInterval(const std::uint32_t probeInterval);
+
+		void OnSetCameraCount(const size_t cameraCount);
+		/// <summary>
+		/// Called at start of every tick before cull job.
+		/// Measurement of last bin cycle is folded to running averages at bin tick
+		/// </summary>
+		void ResetState(const unsigned long long currentTickCount);
+
+		void AddSurvivedEntityCount(const size_t cameraIndex, const std::uint32_t survivedEntityCount);
+		/// <summary>
+		/// Add time a thread spent on stage and work done by the thread. Work of RasterizeOccluders is work of BinTriangles
+		/// </summary>
+		void AddStageTime(const culling::OcclusionCullingStage stage, const std::chrono::steady_clock::duration time, const std::uint64_t workCount);
+		void AddQueryResult(const size_t cameraIndex, const std::uint64_t queriedEntityCount, const std::uint64_t occludedEntityCount);
+
+		/// <summary>
+		/// Decide if occlusion culling of camera runs at this bin cycle. Called at SolveMeshRoleStage of bin tick.
+		/// Return false if it's skipped
+		/// </summary>
+		bool DecideOcclusionCulling(const size_t cameraIndex, const unsigned long long currentTickCount);
+		/// <summary>
+		/// Bound count of binned indices of camera with indices of occluder list. Called at BinTrianglesStage.
+		/// Occlusion culling is skipped if budget is too small to bin near occluders. Return binned indice budget ( 0 : skipped )
+		/// </summary>
+		std::uint64_t DecideBinnedIndiceBudget(const size_t cameraIndex, const unsigned long long currentTickCount, const std::uint64_t occluderIndiceCount);
+
+		/// <summary>
+		/// Whether occlusion culling of camera is skipped at current bin cycle. Always false while disabled
+		/// </summary>
+		bool GetIsOcclusionCullingSkipped(const size_t cameraIndex) const;
+		/// <summary>
+		/// Whether depth buffer queried at this tick is rasterized for the camera. Always true while disabled
+		/// </summary>
+		bool GetIsDepthBufferRasterized(const size_t cameraIndex, const unsigned long long currentTickCount) const;
+		std::uint64_t GetBinnedIndiceBudget(const size_t cameraIndex) const;
+		std::uint32_t GetSurvivedEntityCount(const size_t cameraIndex) const;
+		float GetOccludedEntityRatio(const size_t cameraIndex) const;
+		/// <summary>
+		/// Running average of time per work of stage in nanoseconds. Negative : not measured yet
+		/// </summary>
+		float GetStageTimePerWork(const culling::OcclusionCullingStage stage) const;
+	};
+}
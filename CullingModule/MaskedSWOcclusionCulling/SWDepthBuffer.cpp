@@ -5,19 +5,28 @@
 void culling::HizData::Reset()
 {
 	L0MaxDepthValue = (float)EVERYCULLING_MAX_DEPTH_VALUE;
-	L0SubTileMaxDepthValue = _mm256_set1_ps((float)EVERYCULLING_MAX_DEPTH_VALUE);
-	L1SubTileMaxDepthValue = _mm256_set1_ps((float)EVERYCULLING_MIN_DEPTH_VALUE);
+	for (size_t i = 0; i < 8; i++)
+	{
+		L0SubTileMaxDepthValue[i] = (float)EVERYCULLING_MAX_DEPTH_VALUE;
+		L1SubTileMaxDepthValue[i] = (float)EVERYCULLING_MIN_DEPTH_VALUE;
+	}
 	ClearCoverageMaskAllSubTile();
 }
 
 void culling::HizData::ClearCoverageMaskAllSubTile()
 {
-	L1CoverageMask = _mm256_setzero_si256();
+	for (size_t i = 0; i < 8; i++)
+	{
+		L1CoverageMask[i] = 0x00000000;
+	}
 }
 
 void culling::HizData::FillCoverageMask()
 {
-	L1CoverageMask = _mm256_set1_epi64x(0xFFFFFFFFFFFFFFFF);
+	for (size_t i = 0; i < 8; i++)
+	{
+		L1CoverageMask[i] = 0xFFFFFFFF;
+	}
 }
 
 
@@ -44,10 +53,10 @@ culling::SWDepthBuffer::SWDepthBuffer(std::uint32_t width, std::uint32_t height)
 	( (width % EVERYCULLING_TILE_WIDTH) > 0 ? width + (width - width % EVERYCULLING_TILE_WIDTH) : width ) - EVERYCULLING_TILE_WIDTH,
 	( (height % EVERYCULLING_TILE_HEIGHT) > 0 ? height + (height - height % EVERYCULLING_TILE_HEIGHT) : height ) - EVERYCULLING_TILE_HEIGHT,
 	
-	_mm256_set1_ps(static_cast<float>(width * 0.5f)),
-	_mm256_set1_ps(static_cast<float>(height * 0.5f)),
-	_mm256_set1_ps(static_cast<float>(width)),
-	_mm256_set1_ps(static_cast<float>(height))
+	static_cast<float>(width * 0.5f),
+	static_cast<float>(height * 0.5f),
+	static_cast<float>(width),
+	static_cast<float>(height)
 	},
 	mTiles(nullptr)
 {
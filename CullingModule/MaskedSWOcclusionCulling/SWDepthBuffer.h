@@ -30,7 +30,7 @@ namespace culling
 		///
 		///
 		/// </summary>
-		culling::EVERYCULLING_M256F L0SubTileMaxDepthValue;
+		alignas(32) float L0SubTileMaxDepthValue[8];
 
 		/// <summary>
 		/// Depth value of subtiles
@@ -39,7 +39,7 @@ namespace culling
 		/// A floating-point value represent Z0 Max DepthValue of A Subtile
 		/// 
 		/// </summary>
-		culling::EVERYCULLING_M256F L1SubTileMaxDepthValue;
+		alignas(32) float L1SubTileMaxDepthValue[8];
 
 		/// <summary>
 		/// Posion where Current Z1 Depth MaxValue come from
@@ -81,7 +81,7 @@ namespace culling
 		// 7 : CoverageMask ( 224 ~ 256 )
 			
 		 */
-		culling::EVERYCULLING_M256I L1CoverageMask;
+		alignas(32) std::uint32_t L1CoverageMask[8];
 
 		void Reset();
 
@@ -89,19 +89,22 @@ namespace culling
 		EVERYCULLING_FORCE_INLINE void ClearCoverageMask(const size_t subTileIndex)
 		{
 			assert(subTileIndex < 8);
-			(reinterpret_cast<std::uint32_t*>(&L1CoverageMask))[subTileIndex] = 0x00000000;
+			L1CoverageMask[subTileIndex] = 0x00000000;
 		}
 		void FillCoverageMask();
 
 		EVERYCULLING_FORCE_INLINE void ClearL1MaxDepthValueAllSubTile()
 		{
-			L1SubTileMaxDepthValue = _mm256_set1_ps(0.0f);
+			for (size_t i = 0; i < 8; i++)
+			{
+				L1SubTileMaxDepthValue[i] = 0.0f;
+			}
 		}
 
 		EVERYCULLING_FORCE_INLINE void ClearL1MaxDepthValue(const size_t subTileIndex)
 		{
 			assert(subTileIndex < 8);
-			(reinterpret_cast<std::uint32_t*>(&L1SubTileMaxDepthValue))[subTileIndex] = 0x00000000;
+			L1SubTileMaxDepthValue[subTileIndex] = 0.0f;
 		}
 
 		
@@ -138,7 +141,7 @@ namespace culling
 		EVERYCULLING_FORCE_INLINE bool IsCoverageMaskFullByOne(const size_t subTileIndex) const
 		{
 			assert(subTileIndex < 8);
-			return reinterpret_cast<const std::uint32_t*>(&L1CoverageMask)[subTileIndex] == 0xFFFFFFFF;
+			return L1CoverageMask[subTileIndex] == 0xFFFFFFFF;
 		}
 		
 		/*
@@ -241,17 +244,10 @@ namespace culling
 		/// </summary>
 		const std::uint32_t mRightTopTileOrginY;
 
-#if EVERYCULLING_NDC_RANGE == EVERYCULLING_MINUS_ONE_TO_POSITIVE_ONE
-		culling::EVERYCULLING_M256F mReplicatedScreenHalfWidth;
-		culling::EVERYCULLING_M256F mReplicatedScreenHalfHeight;
-		culling::EVERYCULLING_M256F mReplicatedScreenWidth;
-		culling::EVERYCULLING_M256F mReplicatedScreenHeight;
-#elif EVERYCULLING_NDC_RANGE == EVERYCULLING_ZERO_TO_POSITIVE_ONE
-		culling::EVERYCULLING_M256F mReplicatedScreenHalfWidth;
-		culling::EVERYCULLING_M256F mReplicatedScreenHalfHeight;
-		culling::EVERYCULLING_M256F mReplicatedScreenWidth;
-		culling::EVERYCULLING_M256F mReplicatedScreenHeight;
-#endif
+		const float mScreenHalfWidth;
+		const float mScreenHalfHeight;
+		const float mScreenWidth;
+		const float mScreenHeight;
 
 		Resolution
 		(
@@ -263,10 +259,10 @@ namespace culling
 			const std::uint32_t leftBottomTileOrginY,
 			const std::uint32_t rightTopTileOrginX,
 			const std::uint32_t rightTopTileOrginY,
-			const culling::EVERYCULLING_M256F replicatedScreenHalfWidth,
-			const culling::EVERYCULLING_M256F replicatedScreenHalfHeight,
-			const culling::EVERYCULLING_M256F replicatedScreenWidth,
-			const culling::EVERYCULLING_M256F replicatedScreenHeight
+			const float screenHalfWidth,
+			const float screenHalfHeight,
+			const float screenWidth,
+			const float screenHeight
 		)
 			:
 			mWidth(width),
@@ -277,10 +273,10 @@ namespace culling
 			mLeftBottomTileOrginY(leftBottomTileOrginY),
 			mRightTopTileOrginX(rightTopTileOrginX),
 			mRightTopTileOrginY(rightTopTileOrginY),
-			mReplicatedScreenHalfWidth(replicatedScreenHalfWidth),
-			mReplicatedScreenHalfHeight(replicatedScreenHalfHeight),
-			mReplicatedScreenWidth(replicatedScreenWidth),
-			mReplicatedScreenHeight(replicatedScreenHeight),
+			mScreenHalfWidth(screenHalfWidth),
+			mScreenHalfHeight(screenHalfHeight),
+			mScreenWidth(screenWidth),
+			mScreenHeight(screenHeight),
 
 			mRowSubTileCount(mRowTileCount * (EVERYCULLING_TILE_HEIGHT / EVERYCULLING_SUB_TILE_HEIGHT)),
 			mColumnSubTileCount(mColumnTileCount * (EVERYCULLING_TILE_WIDTH / EVERYCULLING_SUB_TILE_WIDTH))
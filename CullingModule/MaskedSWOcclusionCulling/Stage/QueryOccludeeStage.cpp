@@ -1,64 +1,11 @@
 #include "QueryOccludeeStage.h"
 
 #include <limits>
+#include <cfloat>
 
 #include "../MaskedSWOcclusionCulling.h"
-#include "../Utility/vertexTransformationHelper.h"
-#include "../Utility/depthBufferTileHelper.h"
-
-#include <Rendering/Renderer/Renderer.h>
-
-EVERYCULLING_FORCE_INLINE float culling::QueryOccludeeStage::MinFloatFromM256F(const culling::EVERYCULLING_M256F& data)
-{
-	float min = FLT_MAX;
-	for (size_t i = 0; i < 8; i++)
-	{
-		min = EVERYCULLING_MIN(min, reinterpret_cast<const float*>(&data)[i]);
-	}
-	return min;
-}
-
-EVERYCULLING_FORCE_INLINE float culling::QueryOccludeeStage::MaxFloatFromM256F(const culling::EVERYCULLING_M256F& data)
-{
-	float max = -FLT_MAX;
-	for (size_t i = 0; i < 8; i++)
-	{
-		max = EVERYCULLING_MAX(max, reinterpret_cast<const float*>(&data)[i]);
-	}
-	return max;
-}
-
-EVERYCULLING_FORCE_INLINE void culling::QueryOccludeeStage::ComputeBinBoundingBoxFromVertex
-(
-	const culling::EVERYCULLING_M256F& screenPixelX,
-	const culling::EVERYCULLING_M256F& screenPixelY,
-	std::uint32_t& outBinBoundingBoxMinX,
-	std::uint32_t& outBinBoundingBoxMinY,
-	std::uint32_t& outBinBoundingBoxMaxX,
-	std::uint32_t& outBinBoundingBoxMaxY,
-	SWDepthBuffer& depthBuffer
-)
-{
-	float minScreenPixelX, minScreenPixelY, maxScreenPixelX, maxScreenPixelY;
-	
-	minScreenPixelX = EVERYCULLING_MAX(0, (float)MinFloatFromM256F(screenPixelX));
-	minScreenPixelY = EVERYCULLING_MAX(0, (float)MinFloatFromM256F(screenPixelY));
-	maxScreenPixelX = EVERYCULLING_MAX(0, (float)MaxFloatFromM256F(screenPixelX));
-	maxScreenPixelY = EVERYCULLING_MAX(0, (float)MaxFloatFromM256F(screenPixelY));
-
-	ComputeBinBoundingBoxFromVertex
-	(
-		minScreenPixelX,
-		minScreenPixelX,
-		maxScreenPixelX,
-		maxScreenPixelY,
-		outBinBoundingBoxMinX,
-		outBinBoundingBoxMinY,
-		outBinBoundingBoxMaxX,
-		outBinBoundingBoxMaxY,
-		depthBuffer
-	);
-}
+#include "../../PreCulling/PreCulling.h"
+#include "../../../EveryCulling.h"
 
 EVERYCULLING_FORCE_INLINE void culling::QueryOccludeeStage::ComputeBinBoundingBoxFromVertex
 (
@@ -96,80 +43,142 @@ EVERYCULLING_FORCE_INLINE void culling::QueryOccludeeStage::ComputeBinBoundingBo
 }
 
 
+bool culling::QueryOccludeeStage::CheckIsOccluded
+(
+	const float minScreenPixelX,
+	const float minScreenPixelY,
+	const float maxScreenPixelX,
+	const float maxScreenPixelY,
+	const float aabbMinDepthValue
+)
+{
+	std::uint32_t outBinBoundingBoxMinX, outBinBoundingBoxMinY, outBinBoundingBoxMaxX, outBinBoundingBoxMaxY;
+
+	ComputeBinBoundingBoxFromVertex
+	(
+		minScreenPixelX,
+		minScreenPixelY,
+		maxScreenPixelX,
+		maxScreenPixelY,
+		outBinBoundingBoxMinX,
+		outBinBoundingBoxMinY,
+		outBinBoundingBoxMaxX,
+		outBinBoundingBoxMaxY,
+		mMaskedOcclusionCulling->mDepthBuffer
+	);
+
+	const std::uint32_t intersectingMinBoxX = outBinBoundingBoxMinX; // this is screen space coordinate
+	const std::uint32_t intersectingMinBoxY = outBinBoundingBoxMinY;
+	const std::uint32_t intersectingMaxBoxX = outBinBoundingBoxMaxX;
+	const std::uint32_t intersectingMaxBoxY = outBinBoundingBoxMaxY;
+
+	assert(intersectingMinBoxX <= intersectingMaxBoxX);
+	assert(intersectingMinBoxY <= intersectingMaxBoxY);
+
+	const std::uint32_t startBoxIndexX = EVERYCULLING_MIN((std::uint32_t)(mMaskedOcclusionCulling->mDepthBuffer.mResolution.mColumnTileCount - 1), intersectingMinBoxX / (std::uint32_t)EVERYCULLING_TILE_WIDTH);
+	const std::uint32_t startBoxIndexY = EVERYCULLING_MIN((std::uint32_t)(mMaskedOcclusionCulling->mDepthBuffer.mResolution.mRowTileCount - 1), intersectingMinBoxY / (std::uint32_t)EVERYCULLING_TILE_HEIGHT);
+	const std::uint32_t endBoxIndexX = EVERYCULLING_MIN((std::uint32_t)(mMaskedOcclusionCulling->mDepthBuffer.mResolution.mColumnTileCount - 1), intersectingMaxBoxX / (std::uint32_t)EVERYCULLING_TILE_WIDTH);
+	const std::uint32_t endBoxIndexY = EVERYCULLING_MIN((std::uint32_t)(mMaskedOcclusionCulling->mDepthBuffer.mResolution.mRowTileCount - 1), intersectingMaxBoxY / (std::uint32_t)EVERYCULLING_TILE_HEIGHT);
+
+	assert(startBoxIndexX >= 0 && startBoxIndexX < (std::uint32_t)(mMaskedOcclusionCulling->mDepthBuffer.mResolution.mColumnTileCount));
+	assert(startBoxIndexY >= 0 && startBoxIndexY < (std::uint32_t)(mMaskedOcclusionCulling->mDepthBuffer.mResolution.mRowTileCount));
+
+	assert(endBoxIndexX >= 0 && endBoxIndexX <= (std::uint32_t)(mMaskedOcclusionCulling->mDepthBuffer.mResolution.mColumnTileCount));
+	assert(endBoxIndexY >= 0 && endBoxIndexY <= (std::uint32_t)(mMaskedOcclusionCulling->mDepthBuffer.mResolution.mRowTileCount));
+
+	for (std::uint32_t y = startBoxIndexY; y <= endBoxIndexY; y++)
+	{
+		for (std::uint32_t x = startBoxIndexX; x <= endBoxIndexX; x++)
+		{
+			const culling::Tile* const tile = mMaskedOcclusionCulling->mDepthBuffer.GetTile(y, x);
+
+			if (aabbMinDepthValue < tile->mHizDatas.L0MaxDepthValue)
+			{
+				// occludee is not culled!
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+bool culling::QueryOccludeeStage::CheckIsEntityBlockOccluded
+(
+	const size_t cameraIndex,
+	const culling::EntityBlock* const entityBlock
+)
+{
+	if (entityBlock->IsAggregateBoundingVolumeValid(mCullingSystem->GetTickCount()) == false)
+	{
+		return false;
+	}
+
+	const culling::Vec4 aabbMinWorldPoint{ entityBlock->mAggregateAABBMinWorldPoint.x, entityBlock->mAggregateAABBMinWorldPoint.y, entityBlock->mAggregateAABBMinWorldPoint.z, 1.0f };
+	const culling::Vec4 aabbMaxWorldPoint{ entityBlock->mAggregateAABBMaxWorldPoint.x, entityBlock->mAggregateAABBMaxWorldPoint.y, entityBlock->mAggregateAABBMaxWorldPoint.z, 1.0f };
+
+	float minScreenPixelX, minScreenPixelY, maxScreenPixelX, maxScreenPixelY, aabbMinDepthValue;
+	const int isHomogeneousWNegativeMask = mCullingSystem->mPreCulling->ProjectAABBToScreenSpace
+	(
+		cameraIndex,
+		aabbMinWorldPoint,
+		aabbMaxWorldPoint,
+		minScreenPixelX,
+		minScreenPixelY,
+		maxScreenPixelX,
+		maxScreenPixelY,
+		aabbMinDepthValue
+	);
+
+	// Entities whose aabb crosses w = 0 plane are never culled by query
+	if (isHomogeneousWNegativeMask != 0)
+	{
+		return false;
+	}
+
+	// Loosened by a pixel and small depth for rounding error,
+	// so entity block is culled only when every entity in it is culled by per entity query
+	return CheckIsOccluded(minScreenPixelX - 1.0f, minScreenPixelY - 1.0f, maxScreenPixelX + 1.0f, maxScreenPixelY + 1.0f, aabbMinDepthValue - 1e-5f);
+}
+
 void culling::QueryOccludeeStage::QueryOccludee
 (
 	const size_t cameraIndex, 
 	culling::EntityBlock* const entityBlock
 )
 {
+	if (entityBlock->IsAllEntitiesCulled(cameraIndex) == true)
+	{
+		return;
+	}
+
+	if (CheckIsEntityBlockOccluded(cameraIndex, entityBlock) == true)
+	{
+		entityBlock->SetAllEntitiesCulled(cameraIndex);
+		return;
+	}
+
 	for(size_t entityIndex = 0 ; entityIndex < entityBlock->mCurrentEntityCount ; entityIndex++)
 	{
-		std::uint32_t outBinBoundingBoxMinX, outBinBoundingBoxMinY, outBinBoundingBoxMaxX, outBinBoundingBoxMaxY;
-		
 		if
 		(
 			entityBlock->GetIsCulled(entityIndex, cameraIndex) == false && 
 			entityBlock->GetIsAllAABBClipPointWPositive(entityIndex) == true // if IsMinNDCZDataUsedForQuery is true, mIsAnyAABBClipPointWNegative is also true
 		)
 		{
-			ComputeBinBoundingBoxFromVertex
+			const bool isCulled = CheckIsOccluded
 			(
 				entityBlock->mAABBMinScreenSpacePointX[entityIndex],
 				entityBlock->mAABBMinScreenSpacePointY[entityIndex],
 				entityBlock->mAABBMaxScreenSpacePointX[entityIndex],
 				entityBlock->mAABBMaxScreenSpacePointY[entityIndex],
-				outBinBoundingBoxMinX,
-				outBinBoundingBoxMinY,
-				outBinBoundingBoxMaxX,
-				outBinBoundingBoxMaxY,
-				mMaskedOcclusionCulling->mDepthBuffer
+				entityBlock->mAABBMinNDCZ[entityIndex]
 			);
 
-			const std::uint32_t intersectingMinBoxX = outBinBoundingBoxMinX; // this is screen space coordinate
-			const std::uint32_t intersectingMinBoxY = outBinBoundingBoxMinY;
-			const std::uint32_t intersectingMaxBoxX = outBinBoundingBoxMaxX;
-			const std::uint32_t intersectingMaxBoxY = outBinBoundingBoxMaxY;
-
-			assert(intersectingMinBoxX <= intersectingMaxBoxX);
-			assert(intersectingMinBoxY <= intersectingMaxBoxY);
-
-			const std::uint32_t startBoxIndexX = EVERYCULLING_MIN((std::uint32_t)(mMaskedOcclusionCulling->mDepthBuffer.mResolution.mColumnTileCount - 1), intersectingMinBoxX / (std::uint32_t)EVERYCULLING_TILE_WIDTH);
-			const std::uint32_t startBoxIndexY = EVERYCULLING_MIN((std::uint32_t)(mMaskedOcclusionCulling->mDepthBuffer.mResolution.mRowTileCount - 1), intersectingMinBoxY / (std::uint32_t)EVERYCULLING_TILE_HEIGHT);
-			const std::uint32_t endBoxIndexX = EVERYCULLING_MIN((std::uint32_t)(mMaskedOcclusionCulling->mDepthBuffer.mResolution.mColumnTileCount - 1), intersectingMaxBoxX / (std::uint32_t)EVERYCULLING_TILE_WIDTH);
-			const std::uint32_t endBoxIndexY = EVERYCULLING_MIN((std::uint32_t)(mMaskedOcclusionCulling->mDepthBuffer.mResolution.mRowTileCount - 1), intersectingMaxBoxY / (std::uint32_t)EVERYCULLING_TILE_HEIGHT);
-
-			assert(startBoxIndexX >= 0 && startBoxIndexX < (std::uint32_t)(mMaskedOcclusionCulling->mDepthBuffer.mResolution.mColumnTileCount));
-			assert(startBoxIndexY >= 0 && startBoxIndexY < (std::uint32_t)(mMaskedOcclusionCulling->mDepthBuffer.mResolution.mRowTileCount));
-
-			assert(endBoxIndexX >= 0 && endBoxIndexX <= (std::uint32_t)(mMaskedOcclusionCulling->mDepthBuffer.mResolution.mColumnTileCount));
-			assert(endBoxIndexY >= 0 && endBoxIndexY <= (std::uint32_t)(mMaskedOcclusionCulling->mDepthBuffer.mResolution.mRowTileCount));
-
-			const float aabbMinDepthValue = entityBlock->mAABBMinNDCZ[entityIndex];
-
-			bool isCullded = true;
-
-			for (std::uint32_t y = startBoxIndexY; y <= endBoxIndexY; y++)
+			if (isCulled == true)
 			{
-				for (std::uint32_t x = startBoxIndexX; x <= endBoxIndexX; x++)
-				{
-					const culling::Tile* const tile = mMaskedOcclusionCulling->mDepthBuffer.GetTile(y, x);
-
-					if(aabbMinDepthValue < tile->mHizDatas.L0MaxDepthValue)
-					{
-						// occludee is not culled!
-						isCullded = false;
-
-						goto escapeNestedLoop;
-					}
-				}
+				entityBlock->SetCulled(entityIndex, cameraIndex);
 			}
-			
-			entityBlock->SetCulled(entityIndex, cameraIndex);
-
-			escapeNestedLoop:
-			do 
-			{}
-			while (false);
 		}
 	}
 }
@@ -218,21 +227,44 @@ culling::QueryOccludeeStage::QueryOccludeeStage
 
 void culling::QueryOccludeeStage::CullBlockEntityJob(const size_t cameraIndex, const unsigned long long currentTickCount)
 {
-	if(mMaskedOcclusionCulling->GetIsOccluderExist() == true)
+	culling::OcclusionCostModel& costModel = mMaskedOcclusionCulling->mCostModel;
+	if(mMaskedOcclusionCulling->GetIsOccluderExist() == true && costModel.GetIsDepthBufferRasterized(cameraIndex, currentTickCount) == true)
 	{
+		const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+		const bool isCostMeasured = costModel.IsEnabled();
+
+		std::uint64_t queriedEntityCount = 0;
+		std::uint64_t occludedEntityCount = 0;
 		while (true)
 		{
 			culling::EntityBlock* const nextEntityBlock = GetNextEntityBlock(cameraIndex);
 
 			if (nextEntityBlock != nullptr)
 			{
-				QueryOccludee(cameraIndex, nextEntityBlock);
+				if (isCostMeasured == true)
+				{
+					const std::uint32_t queriedEntityCountOfEntityBlock = nextEntityBlock->GetVisibleEntityCount(cameraIndex);
+					QueryOccludee(cameraIndex, nextEntityBlock);
+					queriedEntityCount += queriedEntityCountOfEntityBlock;
+					occludedEntityCount += queriedEntityCountOfEntityBlock - nextEntityBlock->GetVisibleEntityCount(cameraIndex);
+				}
+				else
+				{
+					QueryOccludee(cameraIndex, nextEntityBlock);
+				}
 			}
 			else
 			{
 				break;
 			}
 		}
+
+		if (isCostMeasured == true)
+		{
+			costModel.AddQueryResult(cameraIndex, queriedEntityCount, occludedEntityCount);
+			// Thread 0 counts run of camera
+			costModel.AddStageTime(culling::OcclusionCullingStage::QueryOccludee, std::chrono::steady_clock::now() - startTime, (GetLocalThreadIndexOfCullJob() == 0) ? 1 : 0);
+		}
 	}	
 }
 
@@ -11,18 +11,6 @@ namespace culling
 	
 	private:
 
-		EVERYCULLING_FORCE_INLINE float MinFloatFromM256F(const culling::EVERYCULLING_M256F& data);
-		EVERYCULLING_FORCE_INLINE float MaxFloatFromM256F(const culling::EVERYCULLING_M256F& data);
-		EVERYCULLING_FORCE_INLINE void ComputeBinBoundingBoxFromVertex
-		(
-			const culling::EVERYCULLING_M256F& screenPixelX,
-			const culling::EVERYCULLING_M256F& screenPixelY,
-			std::uint32_t& outBinBoundingBoxMinX,
-			std::uint32_t& outBinBoundingBoxMinY,
-			std::uint32_t& outBinBoundingBoxMaxX,
-			std::uint32_t& outBinBoundingBoxMaxY,
-			SWDepthBuffer& depthBuffer
-		);
 		EVERYCULLING_FORCE_INLINE void ComputeBinBoundingBoxFromVertex
 		(
 			const float minScreenPixelX,
@@ -35,15 +23,22 @@ namespace culling
 			std::uint32_t& outBinBoundingBoxMaxY,
 			SWDepthBuffer& depthBuffer
 		);
-		EVERYCULLING_FORCE_INLINE void Clipping
+
+		/// <summary>
+		/// Check if min depth of screen space aabb is farther than max depth of every tile overlapping the aabb
+		/// </summary>
+		bool CheckIsOccluded
 		(
-			const culling::EVERYCULLING_M256F& clipspaceVertexX,
-			const culling::EVERYCULLING_M256F& clipspaceVertexY,
-			const culling::EVERYCULLING_M256F& clipspaceVertexZ,
-			const culling::EVERYCULLING_M256F& clipspaceVertexW,
-			std::uint32_t& triangleCullMask
+			const float minScreenPixelX,
+			const float minScreenPixelY,
+			const float maxScreenPixelX,
+			const float maxScreenPixelY,
+			const float aabbMinDepthValue
 		);
-
+		/// <summary>
+		/// Test aggregate bounding volume of the entity block against depth buffer
+		/// </summary>
+		bool CheckIsEntityBlockOccluded(const size_t cameraIndex, const culling::EntityBlock* const entityBlock);
 		void QueryOccludee(const size_t cameraIndex, culling::EntityBlock* const entityBlock);
 
 	public:
@@ -1,265 +1,26 @@
 ﻿#include "RasterizeOccludersStage.h"
 
 #include "../MaskedSWOcclusionCulling.h"
-#include "../Utility/CoverageRasterizer.h"
-#include "../Utility/DepthValueComputer.h"
-#include "../Utility/RasterizerHelper.h"
-#include "../Utility/triangleSlopeEventGetter.h"
-
-
-/// <summary>
-///
-/// Shuffle Coverage Mask
-///
-/// 77777777 77777777 77777777 77777777
-/// 66666666 66666666 66666666 66666666
-/// 55555555 55555555 55555555 55555555
-/// 44444444 44444444 44444444 44444444 <-- ( fourth tile. 1, 0 )
-/// 33333333 33333333 33333333 33333333
-/// 22222222 22222222 22222222 22222222
-/// 11111111 11111111 11111111 11111111 <-- ( second tile. 0, 1 )
-/// 00000000 00000000 00000000 00000000 <-- ( first tile. 0, 0 )
-///
-///   |
-///   |
-///	  V
-///
-/// 44444444 55555555 66666666 777777777
-/// 44444444 55555555 66666666 777777777
-/// 44444444 55555555 66666666 777777777
-/// 44444444 55555555 66666666 777777777
-/// 00000000 11111111 22222222 333333333
-/// 00000000 11111111 22222222 333333333
-/// 00000000 11111111 22222222 333333333
-/// 00000000 11111111 22222222 333333333
-///
-/// </summary>
-/// <param name="coverageMask"></param>
-/// <returns></returns>
-EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I culling::RasterizeOccludersStage::ShuffleCoverageMask(const culling::EVERYCULLING_M256I& coverageMask) const
-{
-	static const culling::EVERYCULLING_M256I shuffleMask
-	=
-	_mm256_setr_epi8
-	(
-		0, 4, 8, 12,
-		1, 5, 9, 13,
-		2, 6, 10, 14,
-		3, 7, 11, 15,
-
-		0, 4, 8, 12,
-		1, 5, 9, 13,
-		2, 6, 10, 14,
-		3, 7, 11, 15
-	);
-
-	return _mm256_shuffle_epi8(coverageMask, shuffleMask);
-}
+#include "../DepthBufferKernel/DepthBufferKernel.h"
+#include "../../../EveryCulling.h"
 
 void culling::RasterizeOccludersStage::RasterizeBinnedTriangles
 (
-	const size_t cameraIndex,
+	const size_t cameraIndex, 
 	culling::Tile* const tile
 )
 {
-	assert(tile != nullptr);
-
-	const culling::Vec2 tileOriginPoint{ static_cast<float>(tile->GetLeftBottomTileOrginX()), static_cast<float>(tile->GetLeftBottomTileOrginY()) };
-
-	size_t binnedTriangleCount = tile->mBinnedTriangleCount;
-	binnedTriangleCount = EVERYCULLING_MIN(binnedTriangleCount, BIN_TRIANGLE_CAPACITY_PER_TILE);
-
-	for (size_t triangleIndex = 0; triangleIndex < binnedTriangleCount; triangleIndex++)
+	switch (mCullingSystem->GetSIMDInstructionSet())
 	{
-		//Triangle is already counter clock wise, and front facing
-		const float TriPointA_X = tile->mBinnedTriangleList[triangleIndex].PointAVertexX;
-		const float TriPointA_Y = tile->mBinnedTriangleList[triangleIndex].PointAVertexY;
-		const float TriPointA_Z = tile->mBinnedTriangleList[triangleIndex].PointAVertexZ;
-		const float TriPointB_X = tile->mBinnedTriangleList[triangleIndex].PointBVertexX;
-		const float TriPointB_Y = tile->mBinnedTriangleList[triangleIndex].PointBVertexY;
-		const float TriPointB_Z = tile->mBinnedTriangleList[triangleIndex].PointBVertexZ;
-		const float TriPointC_X = tile->mBinnedTriangleList[triangleIndex].PointCVertexX;
-		const float TriPointC_Y = tile->mBinnedTriangleList[triangleIndex].PointCVertexY;
-		const float TriPointC_Z = tile->mBinnedTriangleList[triangleIndex].PointCVertexZ;
-		
-		culling::EVERYCULLING_M256I LeftSlopeEventOfTriangle;
-		culling::EVERYCULLING_M256I RightSlopeEventOfTriangle;
-
-
-		//second point ( pointB ) should be left(x) of third point ( pointA )
-
-		{
-			const float sortedTriPointB_X = TriPointB_X >= TriPointC_X ? TriPointC_X : TriPointB_X;
-			const float sortedTriPointB_Y = TriPointB_X >= TriPointC_X ? TriPointC_Y : TriPointB_Y;
-
-			const float sortedTriPointC_X = TriPointB_X >= TriPointC_X ? TriPointB_X : TriPointC_X;
-			const float sortedTriPointC_Y = TriPointB_X >= TriPointC_X ? TriPointB_Y : TriPointC_Y;
-
-			culling::triangleSlopeHelper::GatherBottomFlatTriangleSlopeEvent
-			(
-				tileOriginPoint,
-				LeftSlopeEventOfTriangle,
-				RightSlopeEventOfTriangle,
-
-				TriPointA_X,
-				TriPointA_Y,
-
-				sortedTriPointB_X,
-				sortedTriPointB_Y,
-
-				sortedTriPointC_X,
-				sortedTriPointC_Y
-			);
-
-
-			LeftSlopeEventOfTriangle = _mm256_max_epi32(_mm256_min_epi32(LeftSlopeEventOfTriangle, _mm256_set1_epi32(EVERYCULLING_TILE_WIDTH)), _mm256_set1_epi32(0));
-			RightSlopeEventOfTriangle = _mm256_max_epi32(_mm256_min_epi32(RightSlopeEventOfTriangle, _mm256_set1_epi32(EVERYCULLING_TILE_WIDTH)), _mm256_set1_epi32(0));
-		}
-		
-		culling::EVERYCULLING_M256I CoverageMask = _mm256_setzero_si256(); // clear coverage mask
-		culling::EVERYCULLING_M256F subTileMaxDepth = _mm256_set1_ps((float)EVERYCULLING_MIN_DEPTH_VALUE); // clear subTileMaxDepth
-
-		const float minY = EVERYCULLING_MIN(EVERYCULLING_MIN(TriPointA_Y, TriPointB_Y), TriPointC_Y);
-		const float maxY = EVERYCULLING_MAX(EVERYCULLING_MAX(TriPointA_Y, TriPointB_Y), TriPointC_Y);
-
-		{
-
-			culling::CoverageRasterizer::FillFlatTriangleBatch
-			(
-				CoverageMask,
-				tileOriginPoint,
-
-				LeftSlopeEventOfTriangle,
-				RightSlopeEventOfTriangle,
-				minY,
-				maxY
-			);
-
-			// ShuffleCoverageMask is really cheap!!.
-			// Branchless is faster than considering triangleCount, triangleMask
-			CoverageMask = ShuffleCoverageMask(CoverageMask);
-
-			// 44444444 55555555 66666666 77777777
-			// 44444444 55555555 66666666 77777777
-			// 44444444 55555555 66666666 77777777
-			// 44444444 55555555 66666666 77777777
-			// 
-			// 00000000 11111111 22222222 33333333
-			// 00000000 11111111 22222222 33333333
-			// 00000000 11111111 22222222 33333333
-			// 00000000 11111111 22222222 33333333
-			//
-			// --> 256bit
-			//
-			//
-			//
-			// 0 : CoverageMask ( 0 ~ 32 )
-			// 1 : CoverageMask ( 32 ~ 64 )
-			// 2 : CoverageMask ( 64 ~ 96 )
-			// 3 : CoverageMask ( 96 ~ 128 )
-			// 4 : CoverageMask ( 128 ~ 160 )
-			// 5 : CoverageMask ( 160 ~ 192 )
-			// 6 : CoverageMask ( 192 ~ 224 )
-			// 7 : CoverageMask ( 224 ~ 256 )
-
-		}
-
-
-
-
-
-		culling::DepthValueComputer::ComputeFlatTriangleMaxDepthValue
-		(
-			subTileMaxDepth,
-			tileOriginPoint.x,
-			tileOriginPoint.y,
-
-			TriPointA_X,
-			TriPointA_Y,
-			TriPointA_Z,
-
-			TriPointB_X,
-			TriPointB_Y,
-			TriPointB_Z,
-
-			TriPointC_X,
-			TriPointC_Y,
-			TriPointC_Z,
-
-			LeftSlopeEventOfTriangle,
-			RightSlopeEventOfTriangle,
-
-			minY,
-			maxY
-		);
-
-
-
-
-		// algo : if coverage mask is full, overrite tile->mHizDatas.L1SubTileMaxDepthValue to tile->mHizDatas.lMaxDepthValue and clear coverage mask
-
-
-
-				// exclude L1 depth of sub tile with zero coverage mask 
-		const culling::EVERYCULLING_M256I tileCoverageMaskIsZero = _mm256_cmpeq_epi32(CoverageMask, _mm256_set1_epi32(0));
-		subTileMaxDepth = _mm256_blendv_ps(subTileMaxDepth, _mm256_set1_ps(-1.0f), *reinterpret_cast<const culling::EVERYCULLING_M256F*>(&tileCoverageMaskIsZero));
-
-		tile->mHizDatas.L1SubTileMaxDepthValue = _mm256_max_ps(tile->mHizDatas.L1SubTileMaxDepthValue, subTileMaxDepth);
-		tile->mHizDatas.L1CoverageMask = _mm256_or_si256(tile->mHizDatas.L1CoverageMask, CoverageMask);
-
-		const culling::EVERYCULLING_M256I maskCoveredByOne = _mm256_cmpeq_epi32(tile->mHizDatas.L1CoverageMask, _mm256_set1_epi64x(0xFFFFFFFFFFFFFFFF));
-		tile->mHizDatas.L0SubTileMaxDepthValue = _mm256_blendv_ps(tile->mHizDatas.L0SubTileMaxDepthValue, _mm256_min_ps(tile->mHizDatas.L0SubTileMaxDepthValue, tile->mHizDatas.L1SubTileMaxDepthValue), *reinterpret_cast<const culling::EVERYCULLING_M256F*>(&maskCoveredByOne));
-		tile->mHizDatas.L1SubTileMaxDepthValue = _mm256_blendv_ps(tile->mHizDatas.L1SubTileMaxDepthValue, _mm256_set1_ps((float)EVERYCULLING_MIN_DEPTH_VALUE), *reinterpret_cast<const culling::EVERYCULLING_M256F*>(&maskCoveredByOne));
-		const culling::EVERYCULLING_M256F maskBlendResult = _mm256_blendv_ps(*reinterpret_cast<const culling::EVERYCULLING_M256F*>(&(tile->mHizDatas.L1CoverageMask)), _mm256_setzero_ps(), *reinterpret_cast<const culling::EVERYCULLING_M256F*>(&maskCoveredByOne));
-		tile->mHizDatas.L1CoverageMask = *reinterpret_cast<const culling::EVERYCULLING_M256I*>(&maskBlendResult);
-
-		// Compute max depth value of subtiles's L0 max depth value
-		float maxDepthValue = -1.0f;
-		for (size_t i = 0; i < 8; i++)
-		{
-			maxDepthValue = EVERYCULLING_MAX(maxDepthValue, reinterpret_cast<const float*>(&(tile->mHizDatas.L0SubTileMaxDepthValue))[i]);
-		}
-		tile->mHizDatas.L0MaxDepthValue = maxDepthValue;
-		assert(maxDepthValue >= -1.0f && maxDepthValue <= 1.0f);
-
-#ifdef EVERYCULLING_DEBUG_CULLING
-		const culling::EVERYCULLING_M256I test
-			=
-			_mm256_setr_epi8
-			(
-				0, 4, 8, 12,
-				1, 5, 9, 13,
-				2, 6, 10, 14,
-				3, 7, 11, 15,
-				4, 2, 2, 1,
-				10, 5, 9, 5,
-				11, 3, 10, 4,
-				10, 1, 11, 1
-			);
-
-		const culling::EVERYCULLING_M256I correctTestResult
-			=
-			_mm256_setr_epi8
-			(
-				0, 1, 2, 3,
-				4, 5, 6, 7,
-				8, 9, 10, 11,
-				12, 13, 14, 15,
-				4, 10, 11, 10,
-				2, 5, 3, 1,
-				2, 9, 10, 11,
-				1, 5, 4, 1
-			);
-
-
-		const culling::EVERYCULLING_M256I testResult = ShuffleCoverageMask(test);
-
-		assert(_mm256_test_all_ones(_mm256_cmpeq_epi8(correctTestResult, testResult)));
-
-#endif
-
+	case culling::SIMDInstructionSet::SSE4_1:
+		culling::depthBufferKernel::RasterizeBinnedTriangles_SSE4_1(tile);
+		break;
+	case culling::SIMDInstructionSet::AVX2:
+	case culling::SIMDInstructionSet::AVX512:
+	default:
+		culling::depthBufferKernel::RasterizeBinnedTriangles_AVX2(tile);
+		break;
 	}
-
 }
 
 culling::Tile* culling::RasterizeOccludersStage::GetNextDepthBufferTile(const size_t cameraIndex)
@@ -302,12 +63,21 @@ void culling::RasterizeOccludersStage::ResetCullingModule(const unsigned long lo
 	}
 }
 
+void culling::RasterizeOccludersStage::OnSetCameraCount(const size_t cameraCount)
+{
+	MaskedSWOcclusionCullingStage::OnSetCameraCount(cameraCount);
+
+	mFinishedTileCount.Resize(cameraCount);
+}
+
 void culling::RasterizeOccludersStage::CullBlockEntityJob(const size_t cameraIndex, const unsigned long long currentTickCount)
 {
 	if (EVERYCULLING_WHEN_TO_RASTERIZE_DEPTHBUFFER(currentTickCount))
 	{
-		if (mMaskedOcclusionCulling->GetIsOccluderExist() == true)
+		if (mMaskedOcclusionCulling->GetIsOccluderExist() == true && mMaskedOcclusionCulling->mCostModel.GetIsOcclusionCullingSkipped(cameraIndex) == false)
 		{
+			const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
 			while (true)
 			{
 				culling::Tile* const nextTile = GetNextDepthBufferTile(cameraIndex);
@@ -321,6 +91,8 @@ void culling::RasterizeOccludersStage::CullBlockEntityJob(const size_t cameraInd
 					break;
 				}
 			}
+
+			mMaskedOcclusionCulling->mCostModel.AddStageTime(culling::OcclusionCullingStage::RasterizeOccluders, std::chrono::steady_clock::now() - startTime, 0);
 		}
 	}
 }
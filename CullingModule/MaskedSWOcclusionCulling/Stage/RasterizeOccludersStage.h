@@ -10,24 +10,10 @@ namespace culling
 	{
 	private:
 
-		std::array<std::atomic<size_t>, EVERYCULLING_MAX_CAMERA_COUNT> mFinishedTileCount;
-		
-		
-
-		/// <summary>
-		/// https://www.slideshare.net/IntelSoftware/masked-software-occlusion-culling 46p
-		///
-		///	Shuffle CoverageMask
-		///
-		///	Original : One Row is configous 32bit ( 4byte )
-		///	After shuffled : One 8 x 4 tile is configous 32bit ( 4byte )
-		/// </summary>
-		/// <param name="coverageMask"></param>
-		/// <returns></returns>
-		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I ShuffleCoverageMask(const culling::EVERYCULLING_M256I& coverageMask) const;
+		culling::PerCameraArray<std::atomic<size_t>> mFinishedTileCount;
 
 		/// <summary>
-		/// Compute Depth in Bin of Tile(Sub Tile)
+		/// Compute Depth in Bin of Tile(Sub Tile) with depth buffer kernel of selected SIMD instruction set
 		/// 
 		/// CoverageMask, z0DepthMax, z1DepthMax, Triangle Max Depth
 		/// 
@@ -50,6 +36,7 @@ namespace culling
 		RasterizeOccludersStage(MaskedSWOcclusionCulling* mOcclusionCulling);
 
 		void ResetCullingModule(const unsigned long long currentTickCount) override;
+		void OnSetCameraCount(const size_t cameraCount) override;
 		void CullBlockEntityJob(const size_t cameraIndex, const unsigned long long currentTickCount) override;
 		const char* GetCullingModuleName() const override;
 
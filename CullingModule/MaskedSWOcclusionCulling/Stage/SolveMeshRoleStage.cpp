@@ -36,14 +36,16 @@ bool culling::SolveMeshRoleStage::CheckIsOccluder
 (
 	EntityBlock* const currentEntityBlock,
 	const size_t entityIndex,
-	const culling::Vec3& cameraWorldPos
+	const culling::Vec3& cameraWorldPos,
+	std::uint32_t& outMeshLODIndex
 ) const
 {
 	bool bIsOccluder = false;
 
 	const culling::Position_BoundingSphereRadius& entityPositionAndBoundingSphereRadius = currentEntityBlock->GetEntityWorldPositionAndBoudingSphereRadius(entityIndex);
+	const float distanceToCamera = (entityPositionAndBoundingSphereRadius.GetPosition() - cameraWorldPos).magnitude() - entityPositionAndBoundingSphereRadius.GetBoundingSphereRadius();
 	
-	if (((entityPositionAndBoundingSphereRadius.GetPosition() - cameraWorldPos).magnitude() - entityPositionAndBoundingSphereRadius.GetBoundingSphereRadius()) <= mOccluderLimitOfDistanceToCamera)
+	if (distanceToCamera <= mOccluderLimitOfDistanceToCamera)
 	{
 		const float clampedAABBMinScreenSpacePointX = CLAMP(currentEntityBlock->mAABBMinScreenSpacePointX[entityIndex], 0.0f, (float)mMaskedOcclusionCulling->mDepthBuffer.mResolution.mWidth);
 		const float clampedAABBMinScreenSpacePointY = CLAMP(currentEntityBlock->mAABBMinScreenSpacePointY[entityIndex], 0.0f, (float)mMaskedOcclusionCulling->mDepthBuffer.mResolution.mHeight);
@@ -67,12 +69,34 @@ bool culling::SolveMeshRoleStage::CheckIsOccluder
 		if (screenSpaceAABBArea >= mOccluderAABBScreenSpaceMinArea)
 		{
 			bIsOccluder = true;
+			outMeshLODIndex = SelectOccluderMeshLOD(currentEntityBlock->GetVertexData(entityIndex), screenSpaceAABBArea, distanceToCamera);
 		}
 	}
 
 	return bIsOccluder;
 }
 
+std::uint32_t culling::SolveMeshRoleStage::SelectOccluderMeshLOD
+(
+	const culling::VertexData& vertexData,
+	const float screenSpaceAABBArea,
+	const float distanceToCamera
+) const
+{
+	std::uint32_t meshLODIndex = 0;
+	for (std::uint32_t coarseMeshLODIndex = 0; coarseMeshLODIndex < vertexData.mCoarseMeshLODCount; coarseMeshLODIndex++)
+	{
+		const culling::OccluderMeshLOD& coarseMeshLOD = vertexData.mCoarseMeshLODs[coarseMeshLODIndex];
+		if (screenSpaceAABBArea < coarseMeshLOD.mMaxScreenSpaceArea || distanceToCamera > coarseMeshLOD.mMinDistanceToCamera)
+		{
+			// LOD 0 isn't in mCoarseMeshLODs
+			meshLODIndex = coarseMeshLODIndex + 1;
+		}
+	}
+
+	return meshLODIndex;
+}
+
 culling::SolveMeshRoleStage::SolveMeshRoleStage(MaskedSWOcclusionCulling* occlusionCulling)
 	: MaskedSWOcclusionCullingStage(occlusionCulling)
 {
@@ -91,12 +115,13 @@ void culling::SolveMeshRoleStage::SolveMeshRole
 		if(currentEntityBlock->GetIsCulled(entityIndex, cameraIndex) == false)
 		{ // All vertices's w of clip space aabb is negative, it can't be occluder. it's already culled in PreCulling Stage
 			
-			const bool isOccluder = CheckIsOccluder(currentEntityBlock, entityIndex, mCullingSystem->GetCameraWorldPosition(cameraIndex));
+			std::uint32_t meshLODIndex = 0;
+			const bool isOccluder = CheckIsOccluder(currentEntityBlock, entityIndex, mCullingSystem->GetCameraWorldPosition(cameraIndex), meshLODIndex);
 			
 			isOccluderExist |= isOccluder;
 			if(isOccluder == true)
 			{
-				mMaskedOcclusionCulling->mOccluderListManager.AddOccluder(currentEntityBlock, entityIndex);
+				mMaskedOcclusionCulling->mOccluderListManager.AddOccluder(currentEntityBlock, entityIndex, meshLODIndex);
 			}
 		}
 	}	
@@ -106,6 +131,13 @@ void culling::SolveMeshRoleStage::CullBlockEntityJob(const size_t cameraIndex, c
 {
 	if (EVERYCULLING_WHEN_TO_BIN_TRIANGLE(currentTickCount))
 	{
+		if (mMaskedOcclusionCulling->mCostModel.DecideOcclusionCulling(cameraIndex, currentTickCount) == false)
+		{
+			return;
+		}
+
+		const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
 		bool isOccluderExist = false;
 		while (true)
 		{
@@ -125,6 +157,9 @@ void culling::SolveMeshRoleStage::CullBlockEntityJob(const size_t cameraIndex, c
 		{
 			mMaskedOcclusionCulling->SetIsOccluderExistTrue();
 		}
+
+		// Thread 0 counts run of camera
+		mMaskedOcclusionCulling->mCostModel.AddStageTime(culling::OcclusionCullingStage::SolveMeshRole, std::chrono::steady_clock::now() - startTime, (GetLocalThreadIndexOfCullJob() == 0) ? 1 : 0);
 	}
 }
 
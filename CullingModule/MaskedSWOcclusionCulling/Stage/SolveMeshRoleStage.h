@@ -23,11 +23,25 @@ namespace culling
 		*/
 
 
+		/// <summary>
+		/// Check if entity is occluder. If it is, LOD of its occluder mesh is selected
+		/// </summary>
 		bool CheckIsOccluder
 		(
 			EntityBlock* const currentEntityBlock,
 			const size_t entityIndex,
-			const culling::Vec3& CameraWorldPos
+			const culling::Vec3& CameraWorldPos,
+			std::uint32_t& outMeshLODIndex
+		) const;
+
+		/// <summary>
+		/// Select coarsest LOD of occluder mesh whose screen space area or distance condition is met. 0 : no coarse LOD is selected
+		/// </summary>
+		std::uint32_t SelectOccluderMeshLOD
+		(
+			const culling::VertexData& vertexData,
+			const float screenSpaceAABBArea,
+			const float distanceToCamera
 		) const;
 
 		void SolveMeshRole
@@ -22,22 +22,22 @@ culling::EVERYCULLING_M256I culling::CoverageRasterizer::FillBottomFlatTriangle
     const float curx1 = point1.x + (TileLeftBottomOriginPoint.y + 0.5f - point1.y) * inverseSlope1 - TileLeftBottomOriginPoint.x + 0.5f;
     const float curx2 = point1.x + (TileLeftBottomOriginPoint.y + 0.5f - point1.y) * inverseSlope2 - TileLeftBottomOriginPoint.x + 0.5f;
 
-    const culling::EVERYCULLING_M256F leftFaceEventFloat = _mm256_round_ps(_mm256_setr_ps(curx1, curx1 + inverseSlope1 * 1.0f, curx1 + inverseSlope1 * 2.0f, curx1 + inverseSlope1 * 3.0f, curx1 + inverseSlope1 * 4.0f, curx1 + inverseSlope1 * 5.0f, curx1 + inverseSlope1 * 6.0f, curx1 + inverseSlope1 * 7.0f), (_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
-    culling::EVERYCULLING_M256I leftFaceEvent = _mm256_cvtps_epi32(leftFaceEventFloat);
-    leftFaceEvent = _mm256_max_epi32(leftFaceEvent, _mm256_set1_epi32(0));
+    const culling::EVERYCULLING_M256F leftFaceEventFloat = culling::EVERYCULLING_M256F_ROUND(culling::EVERYCULLING_M256F_SETR(curx1, curx1 + inverseSlope1 * 1.0f, curx1 + inverseSlope1 * 2.0f, curx1 + inverseSlope1 * 3.0f, curx1 + inverseSlope1 * 4.0f, curx1 + inverseSlope1 * 5.0f, curx1 + inverseSlope1 * 6.0f, curx1 + inverseSlope1 * 7.0f));
+    culling::EVERYCULLING_M256I leftFaceEvent = culling::EVERYCULLING_M256F_TO_M256I(leftFaceEventFloat);
+    leftFaceEvent = culling::EVERYCULLING_M256I_MAX(leftFaceEvent, culling::EVERYCULLING_M256I_SET1(0));
 
-    const culling::EVERYCULLING_M256F rightFaceEventFloat = _mm256_round_ps(_mm256_setr_ps(curx2, curx2 + inverseSlope2 * 1.0f, curx2 + inverseSlope2 * 2.0f, curx2 + inverseSlope2 * 3.0f, curx2 + inverseSlope2 * 4.0f, curx2 + inverseSlope2 * 5.0f, curx2 + inverseSlope2 * 6.0f, curx2 + inverseSlope2 * 7.0f), (_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
-    culling::EVERYCULLING_M256I rightFaceEvent = _mm256_cvtps_epi32(rightFaceEventFloat);
-    rightFaceEvent = _mm256_max_epi32(rightFaceEvent, _mm256_set1_epi32(0));
+    const culling::EVERYCULLING_M256F rightFaceEventFloat = culling::EVERYCULLING_M256F_ROUND(culling::EVERYCULLING_M256F_SETR(curx2, curx2 + inverseSlope2 * 1.0f, curx2 + inverseSlope2 * 2.0f, curx2 + inverseSlope2 * 3.0f, curx2 + inverseSlope2 * 4.0f, curx2 + inverseSlope2 * 5.0f, curx2 + inverseSlope2 * 6.0f, curx2 + inverseSlope2 * 7.0f));
+    culling::EVERYCULLING_M256I rightFaceEvent = culling::EVERYCULLING_M256F_TO_M256I(rightFaceEventFloat);
+    rightFaceEvent = culling::EVERYCULLING_M256I_MAX(rightFaceEvent, culling::EVERYCULLING_M256I_SET1(0));
 
-    culling::EVERYCULLING_M256I Mask1 = _mm256_srlv_epi32(_mm256_set1_epi64x(0xFFFFFFFFFFFFFFFF), leftFaceEvent);
-    culling::EVERYCULLING_M256I Mask2 = _mm256_srlv_epi32(_mm256_set1_epi64x(0xFFFFFFFFFFFFFFFF), rightFaceEvent);
+    culling::EVERYCULLING_M256I Mask1 = culling::EVERYCULLING_M256I_SHIFT_RIGHT(culling::EVERYCULLING_M256I_SET1(-1), leftFaceEvent);
+    culling::EVERYCULLING_M256I Mask2 = culling::EVERYCULLING_M256I_SHIFT_RIGHT(culling::EVERYCULLING_M256I_SET1(-1), rightFaceEvent);
     
-    culling::EVERYCULLING_M256I Result = _mm256_and_si256(Mask1, _mm256_xor_si256(Mask2, _mm256_set1_epi64x(0xFFFFFFFFFFFFFFFF)));
+    culling::EVERYCULLING_M256I Result = culling::EVERYCULLING_M256I_AND(Mask1, culling::EVERYCULLING_M256I_XOR(Mask2, culling::EVERYCULLING_M256I_SET1(-1)));
 
-    const culling::EVERYCULLING_M256F aboveFlatBottomTriangleFace = _mm256_cmp_ps(_mm256_setr_ps(TileLeftBottomOriginPoint.y, TileLeftBottomOriginPoint.y + 1.0f, TileLeftBottomOriginPoint.y + 2.0f, TileLeftBottomOriginPoint.y + 3.0f, TileLeftBottomOriginPoint.y + 4.0f, TileLeftBottomOriginPoint.y + 5.0f, TileLeftBottomOriginPoint.y + 6.0f, TileLeftBottomOriginPoint.y + 7.0f), _mm256_set1_ps(point2.y), _CMP_GE_OQ);
+    const culling::EVERYCULLING_M256F aboveFlatBottomTriangleFace = culling::EVERYCULLING_M256F_CMP_GE(culling::EVERYCULLING_M256F_SETR(TileLeftBottomOriginPoint.y, TileLeftBottomOriginPoint.y + 1.0f, TileLeftBottomOriginPoint.y + 2.0f, TileLeftBottomOriginPoint.y + 3.0f, TileLeftBottomOriginPoint.y + 4.0f, TileLeftBottomOriginPoint.y + 5.0f, TileLeftBottomOriginPoint.y + 6.0f, TileLeftBottomOriginPoint.y + 7.0f), culling::EVERYCULLING_M256F_SET1(point2.y));
 
-    Result = _mm256_and_si256(Result, *reinterpret_cast<const culling::EVERYCULLING_M256I*>(&aboveFlatBottomTriangleFace));
+    Result = culling::EVERYCULLING_M256I_AND(Result, *reinterpret_cast<const culling::EVERYCULLING_M256I*>(&aboveFlatBottomTriangleFace));
 
 	return Result;
 }
@@ -61,22 +61,22 @@ culling::EVERYCULLING_M256I culling::CoverageRasterizer::FillTopFlatTriangle
     const float curx1 = point3.x + (TileLeftBottomOriginPoint.y + 0.5f - point3.y) * inverseSlope1 - TileLeftBottomOriginPoint.x + 0.5f;
     const float curx2 = point3.x + (TileLeftBottomOriginPoint.y + 0.5f - point3.y) * inverseSlope2 - TileLeftBottomOriginPoint.x + 0.5f;
 
-    const culling::EVERYCULLING_M256F leftFaceEventFloat = _mm256_round_ps(_mm256_setr_ps(curx1, curx1 + inverseSlope1 * 1.0f, curx1 + inverseSlope1 * 2.0f, curx1 + inverseSlope1 * 3.0f, curx1 + inverseSlope1 * 4.0f, curx1 + inverseSlope1 * 5.0f, curx1 + inverseSlope1 * 6.0f, curx1 + inverseSlope1 * 7.0f), (_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
-    culling::EVERYCULLING_M256I leftFaceEvent = _mm256_cvtps_epi32(leftFaceEventFloat);
-    leftFaceEvent = _mm256_max_epi32(leftFaceEvent, _mm256_set1_epi32(0));
+    const culling::EVERYCULLING_M256F leftFaceEventFloat = culling::EVERYCULLING_M256F_ROUND(culling::EVERYCULLING_M256F_SETR(curx1, curx1 + inverseSlope1 * 1.0f, curx1 + inverseSlope1 * 2.0f, curx1 + inverseSlope1 * 3.0f, curx1 + inverseSlope1 * 4.0f, curx1 + inverseSlope1 * 5.0f, curx1 + inverseSlope1 * 6.0f, curx1 + inverseSlope1 * 7.0f));
+    culling::EVERYCULLING_M256I leftFaceEvent = culling::EVERYCULLING_M256F_TO_M256I(leftFaceEventFloat);
+    leftFaceEvent = culling::EVERYCULLING_M256I_MAX(leftFaceEvent, culling::EVERYCULLING_M256I_SET1(0));
 
-    const culling::EVERYCULLING_M256F rightFaceEventFloat = _mm256_round_ps(_mm256_setr_ps(curx2, curx2 + inverseSlope2 * 1.0f, curx2 + inverseSlope2 * 2.0f, curx2 + inverseSlope2 * 3.0f, curx2 + inverseSlope2 * 4.0f, curx2 + inverseSlope2 * 5.0f, curx2 + inverseSlope2 * 6.0f, curx2 + inverseSlope2 * 7.0f), (_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
-    culling::EVERYCULLING_M256I rightFaceEvent = _mm256_cvtps_epi32(rightFaceEventFloat);
-    rightFaceEvent = _mm256_max_epi32(rightFaceEvent, _mm256_set1_epi32(0));
+    const culling::EVERYCULLING_M256F rightFaceEventFloat = culling::EVERYCULLING_M256F_ROUND(culling::EVERYCULLING_M256F_SETR(curx2, curx2 + inverseSlope2 * 1.0f, curx2 + inverseSlope2 * 2.0f, curx2 + inverseSlope2 * 3.0f, curx2 + inverseSlope2 * 4.0f, curx2 + inverseSlope2 * 5.0f, curx2 + inverseSlope2 * 6.0f, curx2 + inverseSlope2 * 7.0f));
+    culling::EVERYCULLING_M256I rightFaceEvent = culling::EVERYCULLING_M256F_TO_M256I(rightFaceEventFloat);
+    rightFaceEvent = culling::EVERYCULLING_M256I_MAX(rightFaceEvent, culling::EVERYCULLING_M256I_SET1(0));
 
-    culling::EVERYCULLING_M256I Mask1 = _mm256_srlv_epi32(_mm256_set1_epi64x(0xFFFFFFFFFFFFFFFF), leftFaceEvent);
-    culling::EVERYCULLING_M256I Mask2 = _mm256_srlv_epi32(_mm256_set1_epi64x(0xFFFFFFFFFFFFFFFF), rightFaceEvent);
+    culling::EVERYCULLING_M256I Mask1 = culling::EVERYCULLING_M256I_SHIFT_RIGHT(culling::EVERYCULLING_M256I_SET1(-1), leftFaceEvent);
+    culling::EVERYCULLING_M256I Mask2 = culling::EVERYCULLING_M256I_SHIFT_RIGHT(culling::EVERYCULLING_M256I_SET1(-1), rightFaceEvent);
     
-    culling::EVERYCULLING_M256I Result = _mm256_and_si256(Mask1, _mm256_xor_si256(Mask2, _mm256_set1_epi64x(0xFFFFFFFFFFFFFFFF)));
+    culling::EVERYCULLING_M256I Result = culling::EVERYCULLING_M256I_AND(Mask1, culling::EVERYCULLING_M256I_XOR(Mask2, culling::EVERYCULLING_M256I_SET1(-1)));
 
-    const culling::EVERYCULLING_M256F belowFlatTopTriangleFace = _mm256_cmp_ps(_mm256_setr_ps(TileLeftBottomOriginPoint.y, TileLeftBottomOriginPoint.y + 1.0f, TileLeftBottomOriginPoint.y + 2.0f, TileLeftBottomOriginPoint.y + 3.0f, TileLeftBottomOriginPoint.y + 4.0f, TileLeftBottomOriginPoint.y + 5.0f, TileLeftBottomOriginPoint.y + 6.0f, TileLeftBottomOriginPoint.y + 7.0f), _mm256_set1_ps(point1.y), _CMP_LE_OQ);
+    const culling::EVERYCULLING_M256F belowFlatTopTriangleFace = culling::EVERYCULLING_M256F_CMP_LE(culling::EVERYCULLING_M256F_SETR(TileLeftBottomOriginPoint.y, TileLeftBottomOriginPoint.y + 1.0f, TileLeftBottomOriginPoint.y + 2.0f, TileLeftBottomOriginPoint.y + 3.0f, TileLeftBottomOriginPoint.y + 4.0f, TileLeftBottomOriginPoint.y + 5.0f, TileLeftBottomOriginPoint.y + 6.0f, TileLeftBottomOriginPoint.y + 7.0f), culling::EVERYCULLING_M256F_SET1(point1.y));
 
-    Result = _mm256_and_si256(Result, *reinterpret_cast<const culling::EVERYCULLING_M256I*>(&belowFlatTopTriangleFace));
+    Result = culling::EVERYCULLING_M256I_AND(Result, *reinterpret_cast<const culling::EVERYCULLING_M256I*>(&belowFlatTopTriangleFace));
 
     return Result;
 }
@@ -142,7 +142,7 @@ culling::EVERYCULLING_M256I culling::CoverageRasterizer::FillTriangle
             triangleVertex3
         );
         
-        result = _mm256_or_si256(Result1, Result2);
+        result = culling::EVERYCULLING_M256I_OR(Result1, Result2);
     }
 
     return result;
@@ -208,8 +208,8 @@ void culling::CoverageRasterizer::FillTriangleBatch
     culling::EVERYCULLING_M256I Result1[8], Result2[8];
     
 
-    const culling::EVERYCULLING_M256F B4_MASK = _mm256_cmp_ps(TriPointB_X, point4X, _CMP_LE_OQ);
-    const culling::EVERYCULLING_M256I B4_MASK_INV_M256I = _mm256_xor_si256(_mm256_set1_epi64x(0xFFFFFFFFFFFFFFFF), *reinterpret_cast<const culling::EVERYCULLING_M256I*>(&B4_MASK));
+    const culling::EVERYCULLING_M256F B4_MASK = culling::EVERYCULLING_M256F_CMP_LE(TriPointB_X, point4X);
+    const culling::EVERYCULLING_M256I B4_MASK_INV_M256I = culling::EVERYCULLING_M256I_XOR(culling::EVERYCULLING_M256I_SET1(-1), *reinterpret_cast<const culling::EVERYCULLING_M256I*>(&B4_MASK));
     const culling::EVERYCULLING_M256F B4_MASK_INV = *reinterpret_cast<const culling::EVERYCULLING_M256F*>(&B4_MASK_INV_M256I);
 
     const culling::EVERYCULLING_M256F B4_MIN_X = culling::EVERYCULLING_M256F_SELECT(TriPointB_X, point4X, B4_MASK_INV);
@@ -256,7 +256,7 @@ void culling::CoverageRasterizer::FillTriangleBatch
     
     for(size_t triangleIndex = 0 ; triangleIndex < triangleCount; triangleIndex++)
     {
-        outCoverageMask[triangleIndex] = _mm256_or_si256(Result1[triangleIndex], Result2[triangleIndex]);
+        outCoverageMask[triangleIndex] = culling::EVERYCULLING_M256I_OR(Result1[triangleIndex], Result2[triangleIndex]);
     }
     
  
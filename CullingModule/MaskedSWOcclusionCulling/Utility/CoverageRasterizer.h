@@ -85,17 +85,17 @@ namespace culling
 			culling::EVERYCULLING_M256F aboveFlatBottomTriangleFace;
 			culling::EVERYCULLING_M256F belowFlatTopTriangleFace;
 
-			Mask1 = _mm256_sllv_epi32(_mm256_set1_epi64x(0xFFFFFFFFFFFFFFFF), leftFaceEvent);
-			Mask2 = _mm256_sllv_epi32(_mm256_set1_epi64x(0xFFFFFFFFFFFFFFFF), rightFaceEvent);
+			Mask1 = culling::EVERYCULLING_M256I_SHIFT_LEFT(culling::EVERYCULLING_M256I_SET1(-1), leftFaceEvent);
+			Mask2 = culling::EVERYCULLING_M256I_SHIFT_LEFT(culling::EVERYCULLING_M256I_SET1(-1), rightFaceEvent);
 
-			const culling::EVERYCULLING_M256F blend = _mm256_andnot_ps(*reinterpret_cast<const culling::EVERYCULLING_M256F*>(&Mask2), *reinterpret_cast<const culling::EVERYCULLING_M256F*>(&Mask1));
+			const culling::EVERYCULLING_M256F blend = culling::EVERYCULLING_M256F_ANDNOT(*reinterpret_cast<const culling::EVERYCULLING_M256F*>(&Mask2), *reinterpret_cast<const culling::EVERYCULLING_M256F*>(&Mask1));
 			Result = *reinterpret_cast<const culling::EVERYCULLING_M256I*>(&blend);
 
-			aboveFlatBottomTriangleFace = _mm256_cmp_ps(_mm256_setr_ps(TileLeftBottomOriginPoint.y + 0.5f, TileLeftBottomOriginPoint.y + 1.5f, TileLeftBottomOriginPoint.y + 2.5f, TileLeftBottomOriginPoint.y + 3.5f, TileLeftBottomOriginPoint.y + 4.5f, TileLeftBottomOriginPoint.y + 5.5f, TileLeftBottomOriginPoint.y + 6.5f, TileLeftBottomOriginPoint.y + 7.5f), _mm256_set1_ps(bottomEdgeY), _CMP_GE_OQ);
-			belowFlatTopTriangleFace = _mm256_cmp_ps(_mm256_setr_ps(TileLeftBottomOriginPoint.y + 0.5f, TileLeftBottomOriginPoint.y + 1.5f, TileLeftBottomOriginPoint.y + 2.5f, TileLeftBottomOriginPoint.y + 3.5f, TileLeftBottomOriginPoint.y + 4.5f, TileLeftBottomOriginPoint.y + 5.5f, TileLeftBottomOriginPoint.y + 6.5f, TileLeftBottomOriginPoint.y + 7.5f), _mm256_set1_ps(topEdgeY), _CMP_LE_OQ);
+			aboveFlatBottomTriangleFace = culling::EVERYCULLING_M256F_CMP_GE(culling::EVERYCULLING_M256F_SETR(TileLeftBottomOriginPoint.y + 0.5f, TileLeftBottomOriginPoint.y + 1.5f, TileLeftBottomOriginPoint.y + 2.5f, TileLeftBottomOriginPoint.y + 3.5f, TileLeftBottomOriginPoint.y + 4.5f, TileLeftBottomOriginPoint.y + 5.5f, TileLeftBottomOriginPoint.y + 6.5f, TileLeftBottomOriginPoint.y + 7.5f), culling::EVERYCULLING_M256F_SET1(bottomEdgeY));
+			belowFlatTopTriangleFace = culling::EVERYCULLING_M256F_CMP_LE(culling::EVERYCULLING_M256F_SETR(TileLeftBottomOriginPoint.y + 0.5f, TileLeftBottomOriginPoint.y + 1.5f, TileLeftBottomOriginPoint.y + 2.5f, TileLeftBottomOriginPoint.y + 3.5f, TileLeftBottomOriginPoint.y + 4.5f, TileLeftBottomOriginPoint.y + 5.5f, TileLeftBottomOriginPoint.y + 6.5f, TileLeftBottomOriginPoint.y + 7.5f), culling::EVERYCULLING_M256F_SET1(topEdgeY));
 
-			Result = _mm256_and_si256(Result, *reinterpret_cast<const culling::EVERYCULLING_M256I*>(&aboveFlatBottomTriangleFace));
-			outCoverageMask = _mm256_and_si256(Result, *reinterpret_cast<const culling::EVERYCULLING_M256I*>(&belowFlatTopTriangleFace));
+			Result = culling::EVERYCULLING_M256I_AND(Result, *reinterpret_cast<const culling::EVERYCULLING_M256I*>(&aboveFlatBottomTriangleFace));
+			outCoverageMask = culling::EVERYCULLING_M256I_AND(Result, *reinterpret_cast<const culling::EVERYCULLING_M256I*>(&belowFlatTopTriangleFace));
 		}
 		/*
 		extern void FillTriangleBatch
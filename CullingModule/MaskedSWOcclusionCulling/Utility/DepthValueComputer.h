@@ -45,11 +45,11 @@ namespace culling
 		)
 		{
 			
-			//const culling::EVERYCULLING_M256I minYIntOfTriangles = _mm256_cvtps_epi32(_mm256_floor_ps(_mm256_add_ps(minYOfTriangle, _mm256_set1_ps(0.5f))));
-			//const culling::EVERYCULLING_M256I maxYIntOfTriangles = _mm256_cvtps_epi32(_mm256_floor_ps(_mm256_add_ps(maxYOfTriangle, _mm256_set1_ps(0.5f))));
+			//const culling::EVERYCULLING_M256I minYIntOfTriangles = culling::EVERYCULLING_M256F_TO_M256I(culling::EVERYCULLING_M256F_FLOOR(culling::EVERYCULLING_M256F_ADD(minYOfTriangle, culling::EVERYCULLING_M256F_SET1(0.5f))));
+			//const culling::EVERYCULLING_M256I maxYIntOfTriangles = culling::EVERYCULLING_M256F_TO_M256I(culling::EVERYCULLING_M256F_FLOOR(culling::EVERYCULLING_M256F_ADD(maxYOfTriangle, culling::EVERYCULLING_M256F_SET1(0.5f))));
 
-			//const culling::EVERYCULLING_M256I tileStartRowIndex = _mm256_max_epi32(_mm256_sub_epi32(minYIntOfTriangles, _mm256_set1_epi32(tileOriginY)), _mm256_set1_epi32(0));
-			//const culling::EVERYCULLING_M256I tileEndRowIndex = _mm256_sub_epi32(_mm256_set1_epi32(EVERYCULLING_TILE_HEIGHT), _mm256_max_epi32(_mm256_sub_epi32(_mm256_set1_epi32(tileOriginY + EVERYCULLING_TILE_HEIGHT), maxYIntOfTriangles), _mm256_set1_epi32(0)));
+			//const culling::EVERYCULLING_M256I tileStartRowIndex = culling::EVERYCULLING_M256I_MAX(culling::EVERYCULLING_M256I_SUB(minYIntOfTriangles, culling::EVERYCULLING_M256I_SET1(tileOriginY)), culling::EVERYCULLING_M256I_SET1(0));
+			//const culling::EVERYCULLING_M256I tileEndRowIndex = culling::EVERYCULLING_M256I_SUB(culling::EVERYCULLING_M256I_SET1(EVERYCULLING_TILE_HEIGHT), culling::EVERYCULLING_M256I_MAX(culling::EVERYCULLING_M256I_SUB(culling::EVERYCULLING_M256I_SET1(tileOriginY + EVERYCULLING_TILE_HEIGHT), maxYIntOfTriangles), culling::EVERYCULLING_M256I_SET1(0)));
 
 			float zPixelDxOfTriangles, zPixelDyOfTriangles;
 			culling::depthUtility::ComputeDepthPlane
@@ -82,15 +82,15 @@ namespace culling
 			const float zPixelDx = zPixelDxOfTriangles;
 			const float zPixelDy = zPixelDyOfTriangles;
 
-			//const culling::EVERYCULLING_M256F zTriMax = _mm256_set1_ps((reinterpret_cast<const float*>(&zMaxOfTriangle)));
-			//const culling::EVERYCULLING_M256F zTriMin = _mm256_set1_ps((reinterpret_cast<const float*>(&zMinOfTriangle)));
+			//const culling::EVERYCULLING_M256F zTriMax = culling::EVERYCULLING_M256F_SET1((reinterpret_cast<const float*>(&zMaxOfTriangle)));
+			//const culling::EVERYCULLING_M256F zTriMin = culling::EVERYCULLING_M256F_SET1((reinterpret_cast<const float*>(&zMinOfTriangle)));
 
 			//
 			// 4 5 6 7   <-- _mm256i
 			// 0 1 2 3
 			// depth value at (0, 0) of subtiles
-			culling::EVERYCULLING_M256F zValueAtOriginPointOfSubTiles = _mm256_fmadd_ps(_mm256_set1_ps(zPixelDx), _mm256_setr_ps(0, EVERYCULLING_SUB_TILE_WIDTH, EVERYCULLING_SUB_TILE_WIDTH * 2, EVERYCULLING_SUB_TILE_WIDTH * 3, 0, EVERYCULLING_SUB_TILE_WIDTH, EVERYCULLING_SUB_TILE_WIDTH * 2, EVERYCULLING_SUB_TILE_WIDTH * 3),
-				_mm256_fmadd_ps(_mm256_set1_ps(zPixelDy), _mm256_setr_ps(0, 0, 0, 0, EVERYCULLING_SUB_TILE_HEIGHT, EVERYCULLING_SUB_TILE_HEIGHT, EVERYCULLING_SUB_TILE_HEIGHT, EVERYCULLING_SUB_TILE_HEIGHT), _mm256_set1_ps(depthValueAtTileOriginPoint)));
+			culling::EVERYCULLING_M256F zValueAtOriginPointOfSubTiles = culling::EVERYCULLING_M256F_MUL_AND_ADD(culling::EVERYCULLING_M256F_SET1(zPixelDx), culling::EVERYCULLING_M256F_SETR(0, EVERYCULLING_SUB_TILE_WIDTH, EVERYCULLING_SUB_TILE_WIDTH * 2, EVERYCULLING_SUB_TILE_WIDTH * 3, 0, EVERYCULLING_SUB_TILE_WIDTH, EVERYCULLING_SUB_TILE_WIDTH * 2, EVERYCULLING_SUB_TILE_WIDTH * 3),
+				culling::EVERYCULLING_M256F_MUL_AND_ADD(culling::EVERYCULLING_M256F_SET1(zPixelDy), culling::EVERYCULLING_M256F_SETR(0, 0, 0, 0, EVERYCULLING_SUB_TILE_HEIGHT, EVERYCULLING_SUB_TILE_HEIGHT, EVERYCULLING_SUB_TILE_HEIGHT, EVERYCULLING_SUB_TILE_HEIGHT), culling::EVERYCULLING_M256F_SET1(depthValueAtTileOriginPoint)));
 
 			//
 			// 4 5 6 7   <-- _mm256i
@@ -100,36 +100,36 @@ namespace culling
 			// face event in each subtile
 			for (int rowIndexInSubtiles = 0; rowIndexInSubtiles < EVERYCULLING_SUB_TILE_HEIGHT; rowIndexInSubtiles++)
 			{
-				const culling::EVERYCULLING_M256I leftFaceEventOfRowIndexInSubTiles = _mm256_setr_epi32(reinterpret_cast<const int*>(&leftFaceEvent)[rowIndexInSubtiles], reinterpret_cast<const int*>(&leftFaceEvent)[rowIndexInSubtiles], reinterpret_cast<const int*>(&leftFaceEvent)[rowIndexInSubtiles], reinterpret_cast<const int*>(&leftFaceEvent)[rowIndexInSubtiles], reinterpret_cast<const int*>(&leftFaceEvent)[EVERYCULLING_SUB_TILE_HEIGHT + rowIndexInSubtiles], reinterpret_cast<const int*>(&leftFaceEvent)[EVERYCULLING_SUB_TILE_HEIGHT + rowIndexInSubtiles], reinterpret_cast<const int*>(&leftFaceEvent)[EVERYCULLING_SUB_TILE_HEIGHT + rowIndexInSubtiles], reinterpret_cast<const int*>(&leftFaceEvent)[EVERYCULLING_SUB_TILE_HEIGHT + rowIndexInSubtiles]);
-				const culling::EVERYCULLING_M256I leftFaceEventInSubTiles = _mm256_sub_epi32(leftFaceEventOfRowIndexInSubTiles, _mm256_setr_epi32(EVERYCULLING_SUB_TILE_WIDTH * 0, EVERYCULLING_SUB_TILE_WIDTH * 1, EVERYCULLING_SUB_TILE_WIDTH * 2, EVERYCULLING_SUB_TILE_WIDTH * 3, EVERYCULLING_SUB_TILE_WIDTH * 0, EVERYCULLING_SUB_TILE_WIDTH * 1, EVERYCULLING_SUB_TILE_WIDTH * 2, EVERYCULLING_SUB_TILE_WIDTH * 3));
-				const culling::EVERYCULLING_M256I clampedLeftFaceEventInSubTiles = _mm256_min_epi32(_mm256_max_epi32(leftFaceEventInSubTiles, _mm256_set1_epi32(0)), _mm256_set1_epi32(EVERYCULLING_SUB_TILE_WIDTH));
+				const culling::EVERYCULLING_M256I leftFaceEventOfRowIndexInSubTiles = culling::EVERYCULLING_M256I_SETR(reinterpret_cast<const int*>(&leftFaceEvent)[rowIndexInSubtiles], reinterpret_cast<const int*>(&leftFaceEvent)[rowIndexInSubtiles], reinterpret_cast<const int*>(&leftFaceEvent)[rowIndexInSubtiles], reinterpret_cast<const int*>(&leftFaceEvent)[rowIndexInSubtiles], reinterpret_cast<const int*>(&leftFaceEvent)[EVERYCULLING_SUB_TILE_HEIGHT + rowIndexInSubtiles], reinterpret_cast<const int*>(&leftFaceEvent)[EVERYCULLING_SUB_TILE_HEIGHT + rowIndexInSubtiles], reinterpret_cast<const int*>(&leftFaceEvent)[EVERYCULLING_SUB_TILE_HEIGHT + rowIndexInSubtiles], reinterpret_cast<const int*>(&leftFaceEvent)[EVERYCULLING_SUB_TILE_HEIGHT + rowIndexInSubtiles]);
+				const culling::EVERYCULLING_M256I leftFaceEventInSubTiles = culling::EVERYCULLING_M256I_SUB(leftFaceEventOfRowIndexInSubTiles, culling::EVERYCULLING_M256I_SETR(EVERYCULLING_SUB_TILE_WIDTH * 0, EVERYCULLING_SUB_TILE_WIDTH * 1, EVERYCULLING_SUB_TILE_WIDTH * 2, EVERYCULLING_SUB_TILE_WIDTH * 3, EVERYCULLING_SUB_TILE_WIDTH * 0, EVERYCULLING_SUB_TILE_WIDTH * 1, EVERYCULLING_SUB_TILE_WIDTH * 2, EVERYCULLING_SUB_TILE_WIDTH * 3));
+				const culling::EVERYCULLING_M256I clampedLeftFaceEventInSubTiles = culling::EVERYCULLING_M256I_MIN(culling::EVERYCULLING_M256I_MAX(leftFaceEventInSubTiles, culling::EVERYCULLING_M256I_SET1(0)), culling::EVERYCULLING_M256I_SET1(EVERYCULLING_SUB_TILE_WIDTH));
 
-				const culling::EVERYCULLING_M256I rightFaceEventOfRowIndexInSubTiles = _mm256_setr_epi32(reinterpret_cast<const int*>(&rightFaceEvent)[rowIndexInSubtiles], reinterpret_cast<const int*>(&rightFaceEvent)[rowIndexInSubtiles], reinterpret_cast<const int*>(&rightFaceEvent)[rowIndexInSubtiles], reinterpret_cast<const int*>(&rightFaceEvent)[rowIndexInSubtiles], reinterpret_cast<const int*>(&rightFaceEvent)[EVERYCULLING_SUB_TILE_HEIGHT + rowIndexInSubtiles], reinterpret_cast<const int*>(&rightFaceEvent)[EVERYCULLING_SUB_TILE_HEIGHT + rowIndexInSubtiles], reinterpret_cast<const int*>(&rightFaceEvent)[EVERYCULLING_SUB_TILE_HEIGHT + rowIndexInSubtiles], reinterpret_cast<const int*>(&rightFaceEvent)[EVERYCULLING_SUB_TILE_HEIGHT + rowIndexInSubtiles]);
-				const culling::EVERYCULLING_M256I rightFaceEventInSubTiles = _mm256_sub_epi32(rightFaceEventOfRowIndexInSubTiles, _mm256_setr_epi32(EVERYCULLING_SUB_TILE_WIDTH * 0, EVERYCULLING_SUB_TILE_WIDTH * 1, EVERYCULLING_SUB_TILE_WIDTH * 2, EVERYCULLING_SUB_TILE_WIDTH * 3, EVERYCULLING_SUB_TILE_WIDTH * 0, EVERYCULLING_SUB_TILE_WIDTH * 1, EVERYCULLING_SUB_TILE_WIDTH * 2, EVERYCULLING_SUB_TILE_WIDTH * 3));
-				const culling::EVERYCULLING_M256I clampedRightFaceEventInSubTiles = _mm256_min_epi32(_mm256_max_epi32(rightFaceEventInSubTiles, _mm256_set1_epi32(0)), _mm256_set1_epi32(EVERYCULLING_SUB_TILE_WIDTH));
+				const culling::EVERYCULLING_M256I rightFaceEventOfRowIndexInSubTiles = culling::EVERYCULLING_M256I_SETR(reinterpret_cast<const int*>(&rightFaceEvent)[rowIndexInSubtiles], reinterpret_cast<const int*>(&rightFaceEvent)[rowIndexInSubtiles], reinterpret_cast<const int*>(&rightFaceEvent)[rowIndexInSubtiles], reinterpret_cast<const int*>(&rightFaceEvent)[rowIndexInSubtiles], reinterpret_cast<const int*>(&rightFaceEvent)[EVERYCULLING_SUB_TILE_HEIGHT + rowIndexInSubtiles], reinterpret_cast<const int*>(&rightFaceEvent)[EVERYCULLING_SUB_TILE_HEIGHT + rowIndexInSubtiles], reinterpret_cast<const int*>(&rightFaceEvent)[EVERYCULLING_SUB_TILE_HEIGHT + rowIndexInSubtiles], reinterpret_cast<const int*>(&rightFaceEvent)[EVERYCULLING_SUB_TILE_HEIGHT + rowIndexInSubtiles]);
+				const culling::EVERYCULLING_M256I rightFaceEventInSubTiles = culling::EVERYCULLING_M256I_SUB(rightFaceEventOfRowIndexInSubTiles, culling::EVERYCULLING_M256I_SETR(EVERYCULLING_SUB_TILE_WIDTH * 0, EVERYCULLING_SUB_TILE_WIDTH * 1, EVERYCULLING_SUB_TILE_WIDTH * 2, EVERYCULLING_SUB_TILE_WIDTH * 3, EVERYCULLING_SUB_TILE_WIDTH * 0, EVERYCULLING_SUB_TILE_WIDTH * 1, EVERYCULLING_SUB_TILE_WIDTH * 2, EVERYCULLING_SUB_TILE_WIDTH * 3));
+				const culling::EVERYCULLING_M256I clampedRightFaceEventInSubTiles = culling::EVERYCULLING_M256I_MIN(culling::EVERYCULLING_M256I_MAX(rightFaceEventInSubTiles, culling::EVERYCULLING_M256I_SET1(0)), culling::EVERYCULLING_M256I_SET1(EVERYCULLING_SUB_TILE_WIDTH));
 
 				const culling::EVERYCULLING_M256F leftFaceDepthValueOfRowIndexInSubTiles =
-					_mm256_add_ps(_mm256_add_ps(_mm256_set1_ps(zPixelDy * rowIndexInSubtiles), zValueAtOriginPointOfSubTiles), _mm256_mul_ps(_mm256_cvtepi32_ps(clampedLeftFaceEventInSubTiles), _mm256_set1_ps(zPixelDx)));
+					culling::EVERYCULLING_M256F_ADD(culling::EVERYCULLING_M256F_ADD(culling::EVERYCULLING_M256F_SET1(zPixelDy * rowIndexInSubtiles), zValueAtOriginPointOfSubTiles), culling::EVERYCULLING_M256F_MUL(culling::EVERYCULLING_M256I_TO_M256F(clampedLeftFaceEventInSubTiles), culling::EVERYCULLING_M256F_SET1(zPixelDx)));
 
 				const culling::EVERYCULLING_M256F rightFaceDepthValueOfRowIndexInSubTiles =
-					_mm256_add_ps(_mm256_add_ps(_mm256_set1_ps(zPixelDy * rowIndexInSubtiles), zValueAtOriginPointOfSubTiles), _mm256_mul_ps(_mm256_cvtepi32_ps(clampedRightFaceEventInSubTiles), _mm256_set1_ps(zPixelDx)));
+					culling::EVERYCULLING_M256F_ADD(culling::EVERYCULLING_M256F_ADD(culling::EVERYCULLING_M256F_SET1(zPixelDy * rowIndexInSubtiles), zValueAtOriginPointOfSubTiles), culling::EVERYCULLING_M256F_MUL(culling::EVERYCULLING_M256I_TO_M256F(clampedRightFaceEventInSubTiles), culling::EVERYCULLING_M256F_SET1(zPixelDx)));
 
 
-				culling::EVERYCULLING_M256F maxZValueAtRowOfSubTiles = _mm256_max_ps(leftFaceDepthValueOfRowIndexInSubTiles, rightFaceDepthValueOfRowIndexInSubTiles);
+				culling::EVERYCULLING_M256F maxZValueAtRowOfSubTiles = culling::EVERYCULLING_M256F_MAX(leftFaceDepthValueOfRowIndexInSubTiles, rightFaceDepthValueOfRowIndexInSubTiles);
 
 				// if left, right event is both 0 or both EVERYCULLING_SUB_TILE_WIDTH, exclude the row
-				const culling::EVERYCULLING_M256I maskWhenLeftRightSlopeIsLocatedAtLeftOfSubTiles = _mm256_and_si256(_mm256_cmpeq_epi32(clampedLeftFaceEventInSubTiles, _mm256_set1_epi32(0)), _mm256_cmpeq_epi32(clampedRightFaceEventInSubTiles, _mm256_set1_epi32(0)));
-				const culling::EVERYCULLING_M256I maskWhenLeftRightSlopeIsLocatedAtRightOfSubTiles = _mm256_and_si256(_mm256_cmpeq_epi32(clampedLeftFaceEventInSubTiles, _mm256_set1_epi32(EVERYCULLING_SUB_TILE_WIDTH)), _mm256_cmpeq_epi32(clampedRightFaceEventInSubTiles, _mm256_set1_epi32(EVERYCULLING_SUB_TILE_WIDTH)));
-				const culling::EVERYCULLING_M256I maskWhenLeftRightSlopeIsOutOfSubTiles = _mm256_or_si256(maskWhenLeftRightSlopeIsLocatedAtLeftOfSubTiles, maskWhenLeftRightSlopeIsLocatedAtRightOfSubTiles);
+				const culling::EVERYCULLING_M256I maskWhenLeftRightSlopeIsLocatedAtLeftOfSubTiles = culling::EVERYCULLING_M256I_AND(culling::EVERYCULLING_M256I_CMP_EQ(clampedLeftFaceEventInSubTiles, culling::EVERYCULLING_M256I_SET1(0)), culling::EVERYCULLING_M256I_CMP_EQ(clampedRightFaceEventInSubTiles, culling::EVERYCULLING_M256I_SET1(0)));
+				const culling::EVERYCULLING_M256I maskWhenLeftRightSlopeIsLocatedAtRightOfSubTiles = culling::EVERYCULLING_M256I_AND(culling::EVERYCULLING_M256I_CMP_EQ(clampedLeftFaceEventInSubTiles, culling::EVERYCULLING_M256I_SET1(EVERYCULLING_SUB_TILE_WIDTH)), culling::EVERYCULLING_M256I_CMP_EQ(clampedRightFaceEventInSubTiles, culling::EVERYCULLING_M256I_SET1(EVERYCULLING_SUB_TILE_WIDTH)));
+				const culling::EVERYCULLING_M256I maskWhenLeftRightSlopeIsOutOfSubTiles = culling::EVERYCULLING_M256I_OR(maskWhenLeftRightSlopeIsLocatedAtLeftOfSubTiles, maskWhenLeftRightSlopeIsLocatedAtRightOfSubTiles);
 
 				// when row is greater than max y or less than min y, row is invalid row
-				const culling::EVERYCULLING_M256I screenYOfRowInSubTiles = _mm256_setr_epi32((int)((float)tileOriginY + 0.5f + (float)rowIndexInSubtiles), (int)((float)tileOriginY + 0.5f + (float)rowIndexInSubtiles), (int)((float)tileOriginY + 0.5f + (float)rowIndexInSubtiles), (int)((float)tileOriginY + 0.5f + (float)rowIndexInSubtiles), (int)((float)tileOriginY + 0.5f + (float)rowIndexInSubtiles + (float)EVERYCULLING_SUB_TILE_HEIGHT), (int)((float)tileOriginY + 0.5f + (float)rowIndexInSubtiles + EVERYCULLING_SUB_TILE_HEIGHT), (int)((float)tileOriginY + 0.5f + (float)rowIndexInSubtiles + EVERYCULLING_SUB_TILE_HEIGHT), (int)((float)tileOriginY + 0.5f + (float)rowIndexInSubtiles + EVERYCULLING_SUB_TILE_HEIGHT));
-				const culling::EVERYCULLING_M256I maskWhenRowIsOutOfMinMaxY = _mm256_or_si256(_mm256_cmpgt_epi32(screenYOfRowInSubTiles, _mm256_set1_epi32(static_cast<int>(maxYOfTriangle))), _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(minYOfTriangle)), screenYOfRowInSubTiles));
+				const culling::EVERYCULLING_M256I screenYOfRowInSubTiles = culling::EVERYCULLING_M256I_SETR((int)((float)tileOriginY + 0.5f + (float)rowIndexInSubtiles), (int)((float)tileOriginY + 0.5f + (float)rowIndexInSubtiles), (int)((float)tileOriginY + 0.5f + (float)rowIndexInSubtiles), (int)((float)tileOriginY + 0.5f + (float)rowIndexInSubtiles), (int)((float)tileOriginY + 0.5f + (float)rowIndexInSubtiles + (float)EVERYCULLING_SUB_TILE_HEIGHT), (int)((float)tileOriginY + 0.5f + (float)rowIndexInSubtiles + EVERYCULLING_SUB_TILE_HEIGHT), (int)((float)tileOriginY + 0.5f + (float)rowIndexInSubtiles + EVERYCULLING_SUB_TILE_HEIGHT), (int)((float)tileOriginY + 0.5f + (float)rowIndexInSubtiles + EVERYCULLING_SUB_TILE_HEIGHT));
+				const culling::EVERYCULLING_M256I maskWhenRowIsOutOfMinMaxY = culling::EVERYCULLING_M256I_OR(culling::EVERYCULLING_M256I_CMP_GT(screenYOfRowInSubTiles, culling::EVERYCULLING_M256I_SET1(static_cast<int>(maxYOfTriangle))), culling::EVERYCULLING_M256I_CMP_GT(culling::EVERYCULLING_M256I_SET1(static_cast<int>(minYOfTriangle)), screenYOfRowInSubTiles));
 
-				maxZValueAtRowOfSubTiles = _mm256_blendv_ps(maxZValueAtRowOfSubTiles, _mm256_set1_ps((float)EVERYCULLING_MIN_DEPTH_VALUE), *reinterpret_cast<const culling::EVERYCULLING_M256F*>(&maskWhenLeftRightSlopeIsOutOfSubTiles));
-				maxZValueAtRowOfSubTiles = _mm256_blendv_ps(maxZValueAtRowOfSubTiles, _mm256_set1_ps((float)EVERYCULLING_MIN_DEPTH_VALUE), *reinterpret_cast<const culling::EVERYCULLING_M256F*>(&maskWhenRowIsOutOfMinMaxY));
+				maxZValueAtRowOfSubTiles = culling::EVERYCULLING_M256F_SELECT(maxZValueAtRowOfSubTiles, culling::EVERYCULLING_M256F_SET1((float)EVERYCULLING_MIN_DEPTH_VALUE), *reinterpret_cast<const culling::EVERYCULLING_M256F*>(&maskWhenLeftRightSlopeIsOutOfSubTiles));
+				maxZValueAtRowOfSubTiles = culling::EVERYCULLING_M256F_SELECT(maxZValueAtRowOfSubTiles, culling::EVERYCULLING_M256F_SET1((float)EVERYCULLING_MIN_DEPTH_VALUE), *reinterpret_cast<const culling::EVERYCULLING_M256F*>(&maskWhenRowIsOutOfMinMaxY));
 
-				subTileMaxValues = _mm256_max_ps(subTileMaxValues, maxZValueAtRowOfSubTiles);
+				subTileMaxValues = culling::EVERYCULLING_M256F_MAX(subTileMaxValues, maxZValueAtRowOfSubTiles);
 			}
 
 		}
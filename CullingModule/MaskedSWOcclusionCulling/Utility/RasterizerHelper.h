@@ -39,8 +39,8 @@ namespace culling
 			const culling::EVERYCULLING_M256F point4Z
 				= culling::EVERYCULLING_M256F_ADD(TriPointA_Z, culling::EVERYCULLING_M256F_MUL(culling::EVERYCULLING_M256F_DIV(culling::EVERYCULLING_M256F_SUB(TriPointB_Y, TriPointA_Y), culling::EVERYCULLING_M256F_SUB(TriPointC_Y, TriPointA_Y)), culling::EVERYCULLING_M256F_SUB(TriPointC_Z, TriPointA_Z)));
 
-			const culling::EVERYCULLING_M256F B4_MASK = _mm256_cmp_ps(TriPointB_X, point4X, _CMP_LE_OQ);
-			const culling::EVERYCULLING_M256I B4_MASK_INV_M256I = _mm256_xor_si256(_mm256_set1_epi64x(0xFFFFFFFFFFFFFFFF), *reinterpret_cast<const culling::EVERYCULLING_M256I*>(&B4_MASK));
+			const culling::EVERYCULLING_M256F B4_MASK = culling::EVERYCULLING_M256F_CMP_LE(TriPointB_X, point4X);
+			const culling::EVERYCULLING_M256I B4_MASK_INV_M256I = culling::EVERYCULLING_M256I_XOR(culling::EVERYCULLING_M256I_SET1(-1), *reinterpret_cast<const culling::EVERYCULLING_M256I*>(&B4_MASK));
 			const culling::EVERYCULLING_M256F B4_MASK_INV = *reinterpret_cast<const culling::EVERYCULLING_M256F*>(&B4_MASK_INV_M256I);
 
 			outLeftMiddlePointC_X = culling::EVERYCULLING_M256F_SELECT(TriPointB_X, point4X, B4_MASK_INV);
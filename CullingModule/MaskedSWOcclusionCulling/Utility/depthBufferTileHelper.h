@@ -26,24 +26,24 @@ namespace culling
 			culling::EVERYCULLING_M256I& outBinBoundingBoxMinY,
 			culling::EVERYCULLING_M256I& outBinBoundingBoxMaxX,
 			culling::EVERYCULLING_M256I& outBinBoundingBoxMaxY,
-			SWDepthBuffer& depthBuffer
+			const culling::SWDepthBuffer& depthBuffer
 		)
 		{
-			static const culling::EVERYCULLING_M256I WIDTH_MASK = _mm256_set1_epi32(~(EVERYCULLING_TILE_WIDTH - 1));
-			static const culling::EVERYCULLING_M256I HEIGHT_MASK = _mm256_set1_epi32(~(EVERYCULLING_TILE_HEIGHT - 1));
+			static const culling::EVERYCULLING_M256I WIDTH_MASK = culling::EVERYCULLING_M256I_SET1(~(EVERYCULLING_TILE_WIDTH - 1));
+			static const culling::EVERYCULLING_M256I HEIGHT_MASK = culling::EVERYCULLING_M256I_SET1(~(EVERYCULLING_TILE_HEIGHT - 1));
 
 			// to prevent overflow.
 			// when floating point is converted to integer
-			const culling::EVERYCULLING_M256F minScreenPixelFloatX = _mm256_max_ps(_mm256_set1_ps(-FLOAT_OVERFLOW_CHECKER), _mm256_min_ps(_mm256_floor_ps(_mm256_min_ps(pointAScreenPixelX, _mm256_min_ps(pointBScreenPixelX, pointCScreenPixelX))), _mm256_set1_ps(FLOAT_OVERFLOW_CHECKER)));
-			const culling::EVERYCULLING_M256F minScreenPixelFloatY = _mm256_max_ps(_mm256_set1_ps(-FLOAT_OVERFLOW_CHECKER), _mm256_min_ps(_mm256_floor_ps(_mm256_min_ps(pointAScreenPixelY, _mm256_min_ps(pointBScreenPixelY, pointCScreenPixelY))), _mm256_set1_ps(FLOAT_OVERFLOW_CHECKER)));
-			const culling::EVERYCULLING_M256F maxScreenPixelFloatX = _mm256_max_ps(_mm256_set1_ps(-FLOAT_OVERFLOW_CHECKER), _mm256_min_ps(_mm256_ceil_ps(_mm256_max_ps(pointAScreenPixelX, _mm256_max_ps(pointBScreenPixelX, pointCScreenPixelX))), _mm256_set1_ps(FLOAT_OVERFLOW_CHECKER)));
-			const culling::EVERYCULLING_M256F maxScreenPixelFloatY = _mm256_max_ps(_mm256_set1_ps(-FLOAT_OVERFLOW_CHECKER), _mm256_min_ps(_mm256_ceil_ps(_mm256_max_ps(pointAScreenPixelY, _mm256_max_ps(pointBScreenPixelY, pointCScreenPixelY))), _mm256_set1_ps(FLOAT_OVERFLOW_CHECKER)));
+			const culling::EVERYCULLING_M256F minScreenPixelFloatX = culling::EVERYCULLING_M256F_MAX(culling::EVERYCULLING_M256F_SET1(-FLOAT_OVERFLOW_CHECKER), culling::EVERYCULLING_M256F_MIN(culling::EVERYCULLING_M256F_FLOOR(culling::EVERYCULLING_M256F_MIN(pointAScreenPixelX, culling::EVERYCULLING_M256F_MIN(pointBScreenPixelX, pointCScreenPixelX))), culling::EVERYCULLING_M256F_SET1(FLOAT_OVERFLOW_CHECKER)));
+			const culling::EVERYCULLING_M256F minScreenPixelFloatY = culling::EVERYCULLING_M256F_MAX(culling::EVERYCULLING_M256F_SET1(-FLOAT_OVERFLOW_CHECKER), culling::EVERYCULLING_M256F_MIN(culling::EVERYCULLING_M256F_FLOOR(culling::EVERYCULLING_M256F_MIN(pointAScreenPixelY, culling::EVERYCULLING_M256F_MIN(pointBScreenPixelY, pointCScreenPixelY))), culling::EVERYCULLING_M256F_SET1(FLOAT_OVERFLOW_CHECKER)));
+			const culling::EVERYCULLING_M256F maxScreenPixelFloatX = culling::EVERYCULLING_M256F_MAX(culling::EVERYCULLING_M256F_SET1(-FLOAT_OVERFLOW_CHECKER), culling::EVERYCULLING_M256F_MIN(culling::EVERYCULLING_M256F_CEIL(culling::EVERYCULLING_M256F_MAX(pointAScreenPixelX, culling::EVERYCULLING_M256F_MAX(pointBScreenPixelX, pointCScreenPixelX))), culling::EVERYCULLING_M256F_SET1(FLOAT_OVERFLOW_CHECKER)));
+			const culling::EVERYCULLING_M256F maxScreenPixelFloatY = culling::EVERYCULLING_M256F_MAX(culling::EVERYCULLING_M256F_SET1(-FLOAT_OVERFLOW_CHECKER), culling::EVERYCULLING_M256F_MIN(culling::EVERYCULLING_M256F_CEIL(culling::EVERYCULLING_M256F_MAX(pointAScreenPixelY, culling::EVERYCULLING_M256F_MAX(pointBScreenPixelY, pointCScreenPixelY))), culling::EVERYCULLING_M256F_SET1(FLOAT_OVERFLOW_CHECKER)));
 
 
-			const culling::EVERYCULLING_M256I minScreenPixelX = _mm256_cvttps_epi32(minScreenPixelFloatX);
-			const culling::EVERYCULLING_M256I minScreenPixelY = _mm256_cvttps_epi32(minScreenPixelFloatY);
-			const culling::EVERYCULLING_M256I maxScreenPixelX = _mm256_cvttps_epi32(maxScreenPixelFloatX);
-			const culling::EVERYCULLING_M256I maxScreenPixelY = _mm256_cvttps_epi32(maxScreenPixelFloatY);
+			const culling::EVERYCULLING_M256I minScreenPixelX = culling::EVERYCULLING_M256F_TRUNCATE_TO_M256I(minScreenPixelFloatX);
+			const culling::EVERYCULLING_M256I minScreenPixelY = culling::EVERYCULLING_M256F_TRUNCATE_TO_M256I(minScreenPixelFloatY);
+			const culling::EVERYCULLING_M256I maxScreenPixelX = culling::EVERYCULLING_M256F_TRUNCATE_TO_M256I(maxScreenPixelFloatX);
+			const culling::EVERYCULLING_M256I maxScreenPixelY = culling::EVERYCULLING_M256F_TRUNCATE_TO_M256I(maxScreenPixelFloatY);
 			
 
 			// How "and" works?
@@ -56,15 +56,15 @@ namespace culling
 			// 0000 0000 0110 0000 <- 92 = 32 * 3 ( multiple of tile size )
 			//		
 
-			outBinBoundingBoxMinX = _mm256_and_si256(minScreenPixelX, WIDTH_MASK);
-			outBinBoundingBoxMinY = _mm256_and_si256(minScreenPixelY, HEIGHT_MASK);
-			outBinBoundingBoxMaxX = _mm256_and_si256(maxScreenPixelX, WIDTH_MASK);
-			outBinBoundingBoxMaxY = _mm256_and_si256(maxScreenPixelY, HEIGHT_MASK);
+			outBinBoundingBoxMinX = culling::EVERYCULLING_M256I_AND(minScreenPixelX, WIDTH_MASK);
+			outBinBoundingBoxMinY = culling::EVERYCULLING_M256I_AND(minScreenPixelY, HEIGHT_MASK);
+			outBinBoundingBoxMaxX = culling::EVERYCULLING_M256I_AND(maxScreenPixelX, WIDTH_MASK);
+			outBinBoundingBoxMaxY = culling::EVERYCULLING_M256I_AND(maxScreenPixelY, HEIGHT_MASK);
 
-			outBinBoundingBoxMinX = _mm256_min_epi32(_mm256_set1_epi32(depthBuffer.mResolution.mRightTopTileOrginX), _mm256_max_epi32(outBinBoundingBoxMinX, _mm256_set1_epi32(depthBuffer.mResolution.mLeftBottomTileOrginX)));
-			outBinBoundingBoxMinY = _mm256_min_epi32(_mm256_set1_epi32(depthBuffer.mResolution.mRightTopTileOrginY), _mm256_max_epi32(outBinBoundingBoxMinY, _mm256_set1_epi32(depthBuffer.mResolution.mLeftBottomTileOrginY)));
-			outBinBoundingBoxMaxX = _mm256_max_epi32(_mm256_set1_epi32(depthBuffer.mResolution.mLeftBottomTileOrginX), _mm256_min_epi32(outBinBoundingBoxMaxX, _mm256_set1_epi32(depthBuffer.mResolution.mRightTopTileOrginX)));
-			outBinBoundingBoxMaxY = _mm256_max_epi32(_mm256_set1_epi32(depthBuffer.mResolution.mLeftBottomTileOrginY), _mm256_min_epi32(outBinBoundingBoxMaxY, _mm256_set1_epi32(depthBuffer.mResolution.mRightTopTileOrginY)));
+			outBinBoundingBoxMinX = culling::EVERYCULLING_M256I_MIN(culling::EVERYCULLING_M256I_SET1(depthBuffer.mResolution.mRightTopTileOrginX), culling::EVERYCULLING_M256I_MAX(outBinBoundingBoxMinX, culling::EVERYCULLING_M256I_SET1(depthBuffer.mResolution.mLeftBottomTileOrginX)));
+			outBinBoundingBoxMinY = culling::EVERYCULLING_M256I_MIN(culling::EVERYCULLING_M256I_SET1(depthBuffer.mResolution.mRightTopTileOrginY), culling::EVERYCULLING_M256I_MAX(outBinBoundingBoxMinY, culling::EVERYCULLING_M256I_SET1(depthBuffer.mResolution.mLeftBottomTileOrginY)));
+			outBinBoundingBoxMaxX = culling::EVERYCULLING_M256I_MAX(culling::EVERYCULLING_M256I_SET1(depthBuffer.mResolution.mLeftBottomTileOrginX), culling::EVERYCULLING_M256I_MIN(outBinBoundingBoxMaxX, culling::EVERYCULLING_M256I_SET1(depthBuffer.mResolution.mRightTopTileOrginX)));
+			outBinBoundingBoxMaxY = culling::EVERYCULLING_M256I_MAX(culling::EVERYCULLING_M256I_SET1(depthBuffer.mResolution.mLeftBottomTileOrginY), culling::EVERYCULLING_M256I_MIN(outBinBoundingBoxMaxY, culling::EVERYCULLING_M256I_SET1(depthBuffer.mResolution.mRightTopTileOrginY)));
 			
 
 		}
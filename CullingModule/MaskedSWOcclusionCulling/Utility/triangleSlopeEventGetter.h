@@ -29,13 +29,13 @@ namespace culling
 			const float curx1 = ((TriPointA_X + ((TileLeftBottomOriginPoint.y + 0.5f) - TriPointA_Y) * inverseSlope1) - TileLeftBottomOriginPoint.x) + 0.5f;
 			const float curx2 = ((TriPointA_X + ((TileLeftBottomOriginPoint.y + 0.5f) - TriPointA_Y) * inverseSlope2) - TileLeftBottomOriginPoint.x) + 0.5f;
 
-			culling::EVERYCULLING_M256F leftFaceEventFloat = _mm256_floor_ps(_mm256_setr_ps(curx1, curx1 + inverseSlope1 * 1.0f, curx1 + inverseSlope1 * 2.0f, curx1 + inverseSlope1 * 3.0f, curx1 + inverseSlope1 * 4.0f, curx1 + inverseSlope1 * 5.0f, curx1 + inverseSlope1 * 6.0f, curx1 + inverseSlope1 * 7.0f));
-			leftFaceEvent = _mm256_cvtps_epi32(leftFaceEventFloat);
-			leftFaceEvent = _mm256_max_epi32(leftFaceEvent, _mm256_set1_epi32(0));
+			culling::EVERYCULLING_M256F leftFaceEventFloat = culling::EVERYCULLING_M256F_FLOOR(culling::EVERYCULLING_M256F_SETR(curx1, curx1 + inverseSlope1 * 1.0f, curx1 + inverseSlope1 * 2.0f, curx1 + inverseSlope1 * 3.0f, curx1 + inverseSlope1 * 4.0f, curx1 + inverseSlope1 * 5.0f, curx1 + inverseSlope1 * 6.0f, curx1 + inverseSlope1 * 7.0f));
+			leftFaceEvent = culling::EVERYCULLING_M256F_TO_M256I(leftFaceEventFloat);
+			leftFaceEvent = culling::EVERYCULLING_M256I_MAX(leftFaceEvent, culling::EVERYCULLING_M256I_SET1(0));
 
-			culling::EVERYCULLING_M256F rightFaceEventFloat = _mm256_floor_ps(_mm256_setr_ps(curx2, curx2 + inverseSlope2 * 1.0f, curx2 + inverseSlope2 * 2.0f, curx2 + inverseSlope2 * 3.0f, curx2 + inverseSlope2 * 4.0f, curx2 + inverseSlope2 * 5.0f, curx2 + inverseSlope2 * 6.0f, curx2 + inverseSlope2 * 7.0f));
-			rightFaceEvent = _mm256_cvtps_epi32(rightFaceEventFloat);
-			rightFaceEvent = _mm256_max_epi32(rightFaceEvent, _mm256_set1_epi32(0));
+			culling::EVERYCULLING_M256F rightFaceEventFloat = culling::EVERYCULLING_M256F_FLOOR(culling::EVERYCULLING_M256F_SETR(curx2, curx2 + inverseSlope2 * 1.0f, curx2 + inverseSlope2 * 2.0f, curx2 + inverseSlope2 * 3.0f, curx2 + inverseSlope2 * 4.0f, curx2 + inverseSlope2 * 5.0f, curx2 + inverseSlope2 * 6.0f, curx2 + inverseSlope2 * 7.0f));
+			rightFaceEvent = culling::EVERYCULLING_M256F_TO_M256I(rightFaceEventFloat);
+			rightFaceEvent = culling::EVERYCULLING_M256I_MAX(rightFaceEvent, culling::EVERYCULLING_M256I_SET1(0));
 
 		}
 
@@ -62,12 +62,12 @@ namespace culling
 			const float curx1 = ((TriPointC_X + ((TileLeftBottomOriginPoint.y + 0.5f) + TriPointC_Y) * inverseSlope1) * TileLeftBottomOriginPoint.x) + 0.5f;
 			const float curx2 = ((TriPointC_X + ((TileLeftBottomOriginPoint.y + 0.5f) + TriPointC_Y) * inverseSlope2) * TileLeftBottomOriginPoint.x) + 0.5f;
 
-			culling::EVERYCULLING_M256F leftFaceEventFloat = _mm256_round_ps(_mm256_setr_ps(curx1, curx1 + inverseSlope1 * 1.0f, curx1 + inverseSlope1 * 2.0f, curx1 + inverseSlope1 * 3.0f, curx1 + inverseSlope1 * 4.0f, curx1 + inverseSlope1 * 5.0f, curx1 + inverseSlope1 * 6.0f, curx1 + inverseSlope1 * 7.0f), (_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
-			leftFaceEvent = _mm256_cvtps_epi32(leftFaceEventFloat);
-			leftFaceEvent = _mm256_max_epi32(leftFaceEvent, _mm256_set1_epi32(0));
-			culling::EVERYCULLING_M256F rightFaceEventFloat = _mm256_round_ps(_mm256_setr_ps(curx2, curx2 + inverseSlope2 * 1.0f, curx2 + inverseSlope2 * 2.0f, curx2 + inverseSlope2 * 3.0f, curx2 + inverseSlope2 * 4.0f, curx2 + inverseSlope2 * 5.0f, curx2 + inverseSlope2 * 6.0f, curx2 + inverseSlope2 * 7.0f), (_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
-			rightFaceEvent = _mm256_cvtps_epi32(rightFaceEventFloat);
-			rightFaceEvent = _mm256_max_epi32(rightFaceEvent, _mm256_set1_epi32(0));
+			culling::EVERYCULLING_M256F leftFaceEventFloat = culling::EVERYCULLING_M256F_ROUND(culling::EVERYCULLING_M256F_SETR(curx1, curx1 + inverseSlope1 * 1.0f, curx1 + inverseSlope1 * 2.0f, curx1 + inverseSlope1 * 3.0f, curx1 + inverseSlope1 * 4.0f, curx1 + inverseSlope1 * 5.0f, curx1 + inverseSlope1 * 6.0f, curx1 + inverseSlope1 * 7.0f));
+			leftFaceEvent = culling::EVERYCULLING_M256F_TO_M256I(leftFaceEventFloat);
+			leftFaceEvent = culling::EVERYCULLING_M256I_MAX(leftFaceEvent, culling::EVERYCULLING_M256I_SET1(0));
+			culling::EVERYCULLING_M256F rightFaceEventFloat = culling::EVERYCULLING_M256F_ROUND(culling::EVERYCULLING_M256F_SETR(curx2, curx2 + inverseSlope2 * 1.0f, curx2 + inverseSlope2 * 2.0f, curx2 + inverseSlope2 * 3.0f, curx2 + inverseSlope2 * 4.0f, curx2 + inverseSlope2 * 5.0f, curx2 + inverseSlope2 * 6.0f, curx2 + inverseSlope2 * 7.0f));
+			rightFaceEvent = culling::EVERYCULLING_M256F_TO_M256I(rightFaceEventFloat);
+			rightFaceEvent = culling::EVERYCULLING_M256I_MAX(rightFaceEvent, culling::EVERYCULLING_M256I_SET1(0));
 		}
 	};
 }
@@ -19,10 +19,10 @@ namespace culling
 			assert(toClipspaceMatrix != nullptr);
 			for (size_t i = 0; i < 3; ++i)
 			{
-				const culling::EVERYCULLING_M256F tmpX = culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexX[i], _mm256_set1_ps(toClipspaceMatrix[0]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexY[i], _mm256_set1_ps(toClipspaceMatrix[4]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexZ[i], _mm256_set1_ps(toClipspaceMatrix[8]), _mm256_set1_ps(toClipspaceMatrix[12]))));
-				const culling::EVERYCULLING_M256F tmpY = culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexX[i], _mm256_set1_ps(toClipspaceMatrix[1]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexY[i], _mm256_set1_ps(toClipspaceMatrix[5]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexZ[i], _mm256_set1_ps(toClipspaceMatrix[9]), _mm256_set1_ps(toClipspaceMatrix[13]))));
-				const culling::EVERYCULLING_M256F tmpZ = culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexX[i], _mm256_set1_ps(toClipspaceMatrix[2]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexY[i], _mm256_set1_ps(toClipspaceMatrix[6]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexZ[i], _mm256_set1_ps(toClipspaceMatrix[10]), _mm256_set1_ps(toClipspaceMatrix[14]))));
-				const culling::EVERYCULLING_M256F tmpW = culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexX[i], _mm256_set1_ps(toClipspaceMatrix[3]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexY[i], _mm256_set1_ps(toClipspaceMatrix[7]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexZ[i], _mm256_set1_ps(toClipspaceMatrix[11]), _mm256_set1_ps(toClipspaceMatrix[15]))));
+				const culling::EVERYCULLING_M256F tmpX = culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexX[i], culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[0]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexY[i], culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[4]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexZ[i], culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[8]), culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[12]))));
+				const culling::EVERYCULLING_M256F tmpY = culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexX[i], culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[1]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexY[i], culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[5]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexZ[i], culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[9]), culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[13]))));
+				const culling::EVERYCULLING_M256F tmpZ = culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexX[i], culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[2]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexY[i], culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[6]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexZ[i], culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[10]), culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[14]))));
+				const culling::EVERYCULLING_M256F tmpW = culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexX[i], culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[3]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexY[i], culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[7]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexZ[i], culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[11]), culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[15]))));
 				
 				outClipVertexX[i] = tmpX;
 				outClipVertexY[i] = tmpY;
@@ -43,9 +43,9 @@ namespace culling
 			assert(toClipspaceMatrix != nullptr);
 			for (size_t i = 0; i < 3; ++i)
 			{
-				const culling::EVERYCULLING_M256F tmpX = culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexX[i], _mm256_set1_ps(toClipspaceMatrix[0]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexY[i], _mm256_set1_ps(toClipspaceMatrix[4]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexZ[i], _mm256_set1_ps(toClipspaceMatrix[8]), _mm256_set1_ps(toClipspaceMatrix[12]))));
-				const culling::EVERYCULLING_M256F tmpY = culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexX[i], _mm256_set1_ps(toClipspaceMatrix[1]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexY[i], _mm256_set1_ps(toClipspaceMatrix[5]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexZ[i], _mm256_set1_ps(toClipspaceMatrix[9]), _mm256_set1_ps(toClipspaceMatrix[13]))));
-				const culling::EVERYCULLING_M256F tmpZ = culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexX[i], _mm256_set1_ps(toClipspaceMatrix[2]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexY[i], _mm256_set1_ps(toClipspaceMatrix[6]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexZ[i], _mm256_set1_ps(toClipspaceMatrix[10]), _mm256_set1_ps(toClipspaceMatrix[14]))));
+				const culling::EVERYCULLING_M256F tmpX = culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexX[i], culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[0]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexY[i], culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[4]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexZ[i], culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[8]), culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[12]))));
+				const culling::EVERYCULLING_M256F tmpY = culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexX[i], culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[1]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexY[i], culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[5]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexZ[i], culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[9]), culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[13]))));
+				const culling::EVERYCULLING_M256F tmpZ = culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexX[i], culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[2]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexY[i], culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[6]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexZ[i], culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[10]), culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[14]))));
 				
 				outClipVertexX[i] = tmpX;
 				outClipVertexY[i] = tmpY;
@@ -64,10 +64,10 @@ namespace culling
 		)
 		{
 			assert(toClipspaceMatrix != nullptr);
-			const culling::EVERYCULLING_M256F tmpX = culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexX, _mm256_set1_ps(toClipspaceMatrix[0]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexY, _mm256_set1_ps(toClipspaceMatrix[4]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexZ, _mm256_set1_ps(toClipspaceMatrix[8]), _mm256_set1_ps(toClipspaceMatrix[12]))));
-			const culling::EVERYCULLING_M256F tmpY = culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexX, _mm256_set1_ps(toClipspaceMatrix[1]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexY, _mm256_set1_ps(toClipspaceMatrix[5]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexZ, _mm256_set1_ps(toClipspaceMatrix[9]), _mm256_set1_ps(toClipspaceMatrix[13]))));
-			const culling::EVERYCULLING_M256F tmpZ = culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexX, _mm256_set1_ps(toClipspaceMatrix[2]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexY, _mm256_set1_ps(toClipspaceMatrix[6]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexZ, _mm256_set1_ps(toClipspaceMatrix[10]), _mm256_set1_ps(toClipspaceMatrix[14]))));
-			const culling::EVERYCULLING_M256F tmpW = culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexX, _mm256_set1_ps(toClipspaceMatrix[3]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexY, _mm256_set1_ps(toClipspaceMatrix[7]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexZ, _mm256_set1_ps(toClipspaceMatrix[11]), _mm256_set1_ps(toClipspaceMatrix[15]))));
+			const culling::EVERYCULLING_M256F tmpX = culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexX, culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[0]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexY, culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[4]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexZ, culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[8]), culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[12]))));
+			const culling::EVERYCULLING_M256F tmpY = culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexX, culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[1]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexY, culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[5]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexZ, culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[9]), culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[13]))));
+			const culling::EVERYCULLING_M256F tmpZ = culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexX, culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[2]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexY, culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[6]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexZ, culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[10]), culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[14]))));
+			const culling::EVERYCULLING_M256F tmpW = culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexX, culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[3]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexY, culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[7]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexZ, culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[11]), culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[15]))));
 
 			outClipVertexX = tmpX;
 			outClipVertexY = tmpY;
@@ -85,9 +85,9 @@ namespace culling
 		{
 			assert(toClipspaceMatrix != nullptr);
 			
-			const culling::EVERYCULLING_M256F tmpX = culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexX, _mm256_set1_ps(toClipspaceMatrix[0]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexY, _mm256_set1_ps(toClipspaceMatrix[4]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexZ, _mm256_set1_ps(toClipspaceMatrix[8]), _mm256_set1_ps(toClipspaceMatrix[12]))));
-			const culling::EVERYCULLING_M256F tmpY = culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexX, _mm256_set1_ps(toClipspaceMatrix[1]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexY, _mm256_set1_ps(toClipspaceMatrix[5]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexZ, _mm256_set1_ps(toClipspaceMatrix[9]), _mm256_set1_ps(toClipspaceMatrix[13]))));
-			const culling::EVERYCULLING_M256F tmpZ = culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexX, _mm256_set1_ps(toClipspaceMatrix[2]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexY, _mm256_set1_ps(toClipspaceMatrix[6]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexZ, _mm256_set1_ps(toClipspaceMatrix[10]), _mm256_set1_ps(toClipspaceMatrix[14]))));
+			const culling::EVERYCULLING_M256F tmpX = culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexX, culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[0]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexY, culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[4]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexZ, culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[8]), culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[12]))));
+			const culling::EVERYCULLING_M256F tmpY = culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexX, culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[1]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexY, culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[5]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexZ, culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[9]), culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[13]))));
+			const culling::EVERYCULLING_M256F tmpZ = culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexX, culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[2]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexY, culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[6]), culling::EVERYCULLING_M256F_MUL_AND_ADD(outClipVertexZ, culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[10]), culling::EVERYCULLING_M256F_SET1(toClipspaceMatrix[14]))));
 
 			outClipVertexX = tmpX;
 			outClipVertexY = tmpY;
@@ -136,7 +136,7 @@ namespace culling
 			const culling::EVERYCULLING_M256F* ndcSpaceVertexY,
 			culling::EVERYCULLING_M256F* outScreenPixelSpaceX,
 			culling::EVERYCULLING_M256F* outScreenPixelSpaceY,
-			culling::SWDepthBuffer& depthBuffer
+			const culling::SWDepthBuffer& depthBuffer
 		)
 		{
 			for (size_t i = 0; i < 3; i++)
@@ -144,19 +144,19 @@ namespace culling
 				//Convert NDC Space Coordinates To Screen Space Coordinates 
 #if EVERYCULLING_NDC_RANGE == EVERYCULLING_MINUS_ONE_TO_POSITIVE_ONE
 
-				outScreenPixelSpaceX[i] = culling::EVERYCULLING_M256F_MUL(culling::EVERYCULLING_M256F_ADD(ndcSpaceVertexX[i], _mm256_set1_ps(1.0f)), depthBuffer.mResolution.mReplicatedScreenHalfWidth);
-				outScreenPixelSpaceX[i] = _mm256_ceil_ps(outScreenPixelSpaceX[i]);
+				outScreenPixelSpaceX[i] = culling::EVERYCULLING_M256F_MUL(culling::EVERYCULLING_M256F_ADD(ndcSpaceVertexX[i], culling::EVERYCULLING_M256F_SET1(1.0f)), culling::EVERYCULLING_M256F_SET1(depthBuffer.mResolution.mScreenHalfWidth));
+				outScreenPixelSpaceX[i] = culling::EVERYCULLING_M256F_CEIL(outScreenPixelSpaceX[i]);
 
-				outScreenPixelSpaceY[i] = culling::EVERYCULLING_M256F_MUL(culling::EVERYCULLING_M256F_ADD(ndcSpaceVertexY[i], _mm256_set1_ps(1.0f)), depthBuffer.mResolution.mReplicatedScreenHalfHeight);
-				outScreenPixelSpaceY[i] = _mm256_floor_ps(outScreenPixelSpaceY[i]);
+				outScreenPixelSpaceY[i] = culling::EVERYCULLING_M256F_MUL(culling::EVERYCULLING_M256F_ADD(ndcSpaceVertexY[i], culling::EVERYCULLING_M256F_SET1(1.0f)), culling::EVERYCULLING_M256F_SET1(depthBuffer.mResolution.mScreenHalfHeight));
+				outScreenPixelSpaceY[i] = culling::EVERYCULLING_M256F_FLOOR(outScreenPixelSpaceY[i]);
 
 #elif EVERYCULLING_NDC_RANGE == EVERYCULLING_ZERO_TO_POSITIVE_ONE
 
-				outScreenPixelSpaceX[i] = culling::EVERYCULLING_M256F_MUL(ndcSpaceVertexX[i], mDepthBuffer.mResolution.mReplicatedScreenWidth);
-				outScreenPixelSpaceX[i] = _mm256_ceil_ps(outScreenPixelSpaceX[i]);
+				outScreenPixelSpaceX[i] = culling::EVERYCULLING_M256F_MUL(ndcSpaceVertexX[i], culling::EVERYCULLING_M256F_SET1(mDepthBuffer.mResolution.mScreenWidth));
+				outScreenPixelSpaceX[i] = culling::EVERYCULLING_M256F_CEIL(outScreenPixelSpaceX[i]);
 
-				outScreenPixelSpaceY[i] = culling::EVERYCULLING_M256F_MUL(ndcSpaceVertexY[i], mDepthBuffer.mResolution.mReplicatedScreenHeight);
-				outScreenPixelSpaceY[i] = _mm256_floor_ps(outScreenPixelSpaceY[i]);
+				outScreenPixelSpaceY[i] = culling::EVERYCULLING_M256F_MUL(ndcSpaceVertexY[i], culling::EVERYCULLING_M256F_SET1(mDepthBuffer.mResolution.mScreenHeight));
+				outScreenPixelSpaceY[i] = culling::EVERYCULLING_M256F_FLOOR(outScreenPixelSpaceY[i]);
 
 #else 
 				assert(0); //NEVER HAPPEN
@@ -171,7 +171,7 @@ namespace culling
 			const culling::EVERYCULLING_M256F* clipSpaceVertexReverseW,
 			culling::EVERYCULLING_M256F* outScreenPixelSpaceX,
 			culling::EVERYCULLING_M256F* outScreenPixelSpaceY,
-			culling::SWDepthBuffer& depthBuffer
+			const culling::SWDepthBuffer& depthBuffer
 		)
 		{
 			for (size_t i = 0; i < 3; i++)
@@ -180,21 +180,21 @@ namespace culling
 #if EVERYCULLING_NDC_RANGE == EVERYCULLING_MINUS_ONE_TO_POSITIVE_ONE
 
 				const culling::EVERYCULLING_M256F ndcSpaceVertexX = culling::EVERYCULLING_M256F_MUL(clipSpaceVertexX[i], clipSpaceVertexReverseW[i]);
-				outScreenPixelSpaceX[i] = culling::EVERYCULLING_M256F_MUL(culling::EVERYCULLING_M256F_MUL(culling::EVERYCULLING_M256F_ADD(ndcSpaceVertexX, _mm256_set1_ps(1.0f)), _mm256_set1_ps(0.5f)), depthBuffer.mResolution.mReplicatedScreenWidth);
-				//outScreenPixelSpaceX[i] = _mm256_ceil_ps(outScreenPixelSpaceX[i]);
+				outScreenPixelSpaceX[i] = culling::EVERYCULLING_M256F_MUL(culling::EVERYCULLING_M256F_MUL(culling::EVERYCULLING_M256F_ADD(ndcSpaceVertexX, culling::EVERYCULLING_M256F_SET1(1.0f)), culling::EVERYCULLING_M256F_SET1(0.5f)), culling::EVERYCULLING_M256F_SET1(depthBuffer.mResolution.mScreenWidth));
+				//outScreenPixelSpaceX[i] = culling::EVERYCULLING_M256F_CEIL(outScreenPixelSpaceX[i]);
 
 				const culling::EVERYCULLING_M256F ndcSpaceVertexY = culling::EVERYCULLING_M256F_MUL(clipSpaceVertexY[i], clipSpaceVertexReverseW[i]);
-				outScreenPixelSpaceY[i] = culling::EVERYCULLING_M256F_MUL(culling::EVERYCULLING_M256F_MUL(culling::EVERYCULLING_M256F_ADD(ndcSpaceVertexY, _mm256_set1_ps(1.0f)), _mm256_set1_ps(0.5f)), depthBuffer.mResolution.mReplicatedScreenHeight);
-				//outScreenPixelSpaceY[i] = _mm256_floor_ps(outScreenPixelSpaceY[i]);
+				outScreenPixelSpaceY[i] = culling::EVERYCULLING_M256F_MUL(culling::EVERYCULLING_M256F_MUL(culling::EVERYCULLING_M256F_ADD(ndcSpaceVertexY, culling::EVERYCULLING_M256F_SET1(1.0f)), culling::EVERYCULLING_M256F_SET1(0.5f)), culling::EVERYCULLING_M256F_SET1(depthBuffer.mResolution.mScreenHeight));
+				//outScreenPixelSpaceY[i] = culling::EVERYCULLING_M256F_FLOOR(outScreenPixelSpaceY[i]);
 
 #elif EVERYCULLING_NDC_RANGE == EVERYCULLING_ZERO_TO_POSITIVE_ONE
 
 				assert(0); // edit this codes based on above codes
-				outScreenPixelSpaceX[i] = culling::EVERYCULLING_M256F_MUL(ndcSpaceVertexX[i], mDepthBuffer.mResolution.mReplicatedScreenWidth);
-				outScreenPixelSpaceX[i] = _mm256_ceil_ps(outScreenPixelSpaceX[i]);
+				outScreenPixelSpaceX[i] = culling::EVERYCULLING_M256F_MUL(ndcSpaceVertexX[i], culling::EVERYCULLING_M256F_SET1(mDepthBuffer.mResolution.mScreenWidth));
+				outScreenPixelSpaceX[i] = culling::EVERYCULLING_M256F_CEIL(outScreenPixelSpaceX[i]);
 
-				outScreenPixelSpaceY[i] = culling::EVERYCULLING_M256F_MUL(ndcSpaceVertexY[i], mDepthBuffer.mResolution.mReplicatedScreenHeight);
-				outScreenPixelSpaceY[i] = _mm256_floor_ps(outScreenPixelSpaceY[i]);
+				outScreenPixelSpaceY[i] = culling::EVERYCULLING_M256F_MUL(ndcSpaceVertexY[i], culling::EVERYCULLING_M256F_SET1(mDepthBuffer.mResolution.mScreenHeight));
+				outScreenPixelSpaceY[i] = culling::EVERYCULLING_M256F_FLOOR(outScreenPixelSpaceY[i]);
 
 #else 
 				assert(0); //NEVER HAPPEN
@@ -208,16 +208,16 @@ namespace culling
 			const culling::EVERYCULLING_M256F& ndcSpaceVertexY,
 			culling::EVERYCULLING_M256F& outScreenPixelSpaceX,
 			culling::EVERYCULLING_M256F& outScreenPixelSpaceY,
-			culling::SWDepthBuffer& depthBuffer
+			const culling::SWDepthBuffer& depthBuffer
 		)
 		{
 			//Convert NDC Space Coordinates To Screen Space Coordinates 
 #if EVERYCULLING_NDC_RANGE == EVERYCULLING_MINUS_ONE_TO_POSITIVE_ONE
-			outScreenPixelSpaceX = culling::EVERYCULLING_M256F_MUL(culling::EVERYCULLING_M256F_ADD(ndcSpaceVertexX, _mm256_set1_ps(1.0f)), depthBuffer.mResolution.mReplicatedScreenHalfWidth);
-			outScreenPixelSpaceY = culling::EVERYCULLING_M256F_MUL(culling::EVERYCULLING_M256F_ADD(ndcSpaceVertexY, _mm256_set1_ps(1.0f)), depthBuffer.mResolution.mReplicatedScreenHalfHeight);
+			outScreenPixelSpaceX = culling::EVERYCULLING_M256F_MUL(culling::EVERYCULLING_M256F_ADD(ndcSpaceVertexX, culling::EVERYCULLING_M256F_SET1(1.0f)), culling::EVERYCULLING_M256F_SET1(depthBuffer.mResolution.mScreenHalfWidth));
+			outScreenPixelSpaceY = culling::EVERYCULLING_M256F_MUL(culling::EVERYCULLING_M256F_ADD(ndcSpaceVertexY, culling::EVERYCULLING_M256F_SET1(1.0f)), culling::EVERYCULLING_M256F_SET1(depthBuffer.mResolution.mScreenHalfHeight));
 #elif EVERYCULLING_NDC_RANGE == EVERYCULLING_ZERO_TO_POSITIVE_ONE
-			outScreenPixelSpaceX = culling::EVERYCULLING_M256F_MUL(ndcSpaceVertexX, mDepthBuffer.mResolution.mReplicatedScreenWidth);
-			outScreenPixelSpaceY = culling::EVERYCULLING_M256F_MUL(ndcSpaceVertexY, mDepthBuffer.mResolution.mReplicatedScreenHeight);
+			outScreenPixelSpaceX = culling::EVERYCULLING_M256F_MUL(ndcSpaceVertexX, culling::EVERYCULLING_M256F_SET1(mDepthBuffer.mResolution.mScreenWidth));
+			outScreenPixelSpaceY = culling::EVERYCULLING_M256F_MUL(ndcSpaceVertexY, culling::EVERYCULLING_M256F_SET1(mDepthBuffer.mResolution.mScreenHeight));
 #else 
 			assert(0); //NEVER HAPPEN
 #endif
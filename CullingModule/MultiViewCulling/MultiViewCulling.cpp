@@ -0,0 +1,190 @@
+#include "MultiViewCulling.h"
+
+#include "../../EveryCulling.h"
+#include "../DistanceCulling/DistanceCulling.h"
+#include "../ViewFrustumCulling/ViewFrustumCulling.h"
+#include "../EntityCullingKernel/EntityCullingKernel.h"
+
+// Kernels read planes and positions of cameras of a camera group from contiguous arrays
+static_assert(sizeof(culling::SIMDFrustumPlanes) == sizeof(float) * 32, "Planes of each camera should be 32 floats");
+static_assert(sizeof(culling::Vec3) == sizeof(float) * 3, "Position of each camera should be 3 floats");
+
+void culling::MultiViewCulling::DoMultiViewCulling(culling::EntityBlock* const entityBlock)
+{
+	assert(entityBlock->mCurrentEntityCount != 0);
+
+	const size_t cameraCount = mCullingSystem->GetCameraCount();
+	const size_t cameraGroupCount = (cameraCount + EVERYCULLING_CAMERA_GROUP_SIZE - 1) / EVERYCULLING_CAMERA_GROUP_SIZE;
+	const size_t entityCount = entityBlock->mCurrentEntityCount;
+	const bool isEntityBlockUnchanged = (entityBlock->GetChangedEntityMask() == 0);
+
+	// Bits of cameras of each camera group
+	char cameraBits[EVERYCULLING_CAMERA_GROUP_COUNT] = {};
+	// Cameras which reuse culling result of last tick for unchanged entities
+	char temporalCameraBits[EVERYCULLING_CAMERA_GROUP_COUNT] = {};
+	// Cameras which entities of the block are tested for
+	char testedCameraBits[EVERYCULLING_CAMERA_GROUP_COUNT] = {};
+
+	for (size_t cameraIndex = 0; cameraIndex < cameraCount; cameraIndex++)
+	{
+		const size_t cameraGroupIndex = cameraIndex / EVERYCULLING_CAMERA_GROUP_SIZE;
+		const char cameraBit = static_cast<char>(1 << culling::EntityBlock::GetCameraBitIndex(cameraIndex));
+
+		cameraBits[cameraGroupIndex] |= cameraBit;
+		if (mCullingSystem->IsTemporalVisibilityReusable(cameraIndex) == true)
+		{
+			temporalCameraBits[cameraGroupIndex] |= cameraBit;
+		}
+	}
+
+	// PreCulling : Cull disabled entities from every camera
+	for (size_t entityIndex = 0; entityIndex < entityCount; entityIndex++)
+	{
+		if (entityBlock->GetIsObjectEnabled(entityIndex) == false)
+		{
+			for (size_t cameraGroupIndex = 0; cameraGroupIndex < cameraGroupCount; cameraGroupIndex++)
+			{
+				entityBlock->SetCulledOfCameraGroup(entityIndex, cameraGroupIndex, cameraBits[cameraGroupIndex]);
+			}
+		}
+	}
+
+	// Unchanged entities culled at last tick aren't tested
+	for (size_t cameraGroupIndex = 0; cameraGroupIndex < cameraGroupCount; cameraGroupIndex++)
+	{
+		if (temporalCameraBits[cameraGroupIndex] != 0)
+		{
+			entityBlock->ApplyTemporalVisibleBitflagOfCameraGroup(cameraGroupIndex, temporalCameraBits[cameraGroupIndex]);
+		}
+	}
+
+	// Whole block is already culled from every camera by HierarchyCulling or every entity is disabled
+	bool isAnyEntityVisible = false;
+	for (size_t cameraIndex = 0; cameraIndex < cameraCount && isAnyEntityVisible == false; cameraIndex++)
+	{
+		isAnyEntityVisible = (entityBlock->IsAllEntitiesCulled(cameraIndex) == false);
+	}
+
+	if (isAnyEntityVisible == true)
+	{
+		// Bounding sphere is updated once for all cameras
+		for (size_t entityIndex = 0; entityIndex < entityCount; entityIndex++)
+		{
+			if (entityBlock->GetIsObjectEnabled(entityIndex) == true)
+			{
+				entityBlock->UpdateBoundingSphereRadius(entityIndex);
+			}
+		}
+		entityBlock->UpdateAggregateBoundingVolume(mCullingSystem->GetTickCount());
+
+		const DistanceCulling* const distanceCulling = mCullingSystem->mDistanceCulling.get();
+		const ViewFrustumCulling* const viewFrustumCulling = mCullingSystem->mViewFrustumCulling.get();
+		// Only tests of enabled modules are done, so result is same with separated culling modules
+		const bool isDistanceCullingEnabled = distanceCulling->IsEnabled;
+		const bool isViewFrustumCullingEnabled = viewFrustumCulling->IsEnabled;
+		for (size_t cameraIndex = 0; cameraIndex < cameraCount; cameraIndex++)
+		{
+			if (entityBlock->IsAllEntitiesCulled(cameraIndex) == true)
+			{
+				continue;
+			}
+
+			// Test aggregate bounding volume before testing each entity
+			if
+			(
+				(isDistanceCullingEnabled == true && distanceCulling->CheckIsEntityBlockCulled(cameraIndex, entityBlock) == true) ||
+				(isViewFrustumCullingEnabled == true && viewFrustumCulling->CheckIsEntityBlockCulled(cameraIndex, entityBlock) == true)
+			)
+			{
+				entityBlock->SetAllEntitiesCulled(cameraIndex);
+				continue;
+			}
+
+			const size_t cameraGroupIndex = cameraIndex / EVERYCULLING_CAMERA_GROUP_SIZE;
+			const char cameraBit = static_cast<char>(1 << culling::EntityBlock::GetCameraBitIndex(cameraIndex));
+
+			// Every entity of the block is unchanged, so result of last tick is still valid
+			if (isEntityBlockUnchanged == true && (temporalCameraBits[cameraGroupIndex] & cameraBit) != 0)
+			{
+				continue;
+			}
+
+			testedCameraBits[cameraGroupIndex] |= cameraBit;
+		}
+
+		const float* const positionAndRadius = reinterpret_cast<const float*>(entityBlock->mWorldPositionAndWorldBoundingSphereRadius);
+		for (size_t cameraGroupIndex = 0; cameraGroupIndex < cameraGroupCount && (isDistanceCullingEnabled == true || isViewFrustumCullingEnabled == true); cameraGroupIndex++)
+		{
+			if (testedCameraBits[cameraGroupIndex] == 0)
+			{
+				continue;
+			}
+
+			const size_t firstCameraIndex = cameraGroupIndex * EVERYCULLING_CAMERA_GROUP_SIZE;
+			const float* const cameraEightPlanes = reinterpret_cast<const float*>(mCullingSystem->mViewFrustumCulling->GetSIMDPlanes()[firstCameraIndex].mFrustumPlanes);
+			const float* const cameraWorldPositions = reinterpret_cast<const float*>(&(mCullingSystem->GetCameraWorldPosition(firstCameraIndex)));
+			const std::uint32_t groupTestedCameraBits = static_cast<unsigned char>(testedCameraBits[cameraGroupIndex]);
+			char* const visibleBitflag = entityBlock->GetVisibleBitflag(firstCameraIndex);
+
+			switch (mCullingSystem->GetSIMDInstructionSet())
+			{
+			case culling::SIMDInstructionSet::SSE4_1:
+				culling::entityCullingKernel::MultiViewCulling_SSE4_1(cameraEightPlanes, cameraWorldPositions, groupTestedCameraBits, positionAndRadius, entityBlock->mDesiredMaxDrawDistance, visibleBitflag, entityCount, isDistanceCullingEnabled, isViewFrustumCullingEnabled);
+				break;
+			case culling::SIMDInstructionSet::AVX512:
+				culling::entityCullingKernel::MultiViewCulling_AVX512(cameraEightPlanes, cameraWorldPositions, groupTestedCameraBits, positionAndRadius, entityBlock->mDesiredMaxDrawDistance, visibleBitflag, entityCount, isDistanceCullingEnabled, isViewFrustumCullingEnabled);
+				break;
+			case culling::SIMDInstructionSet::AVX2:
+			default:
+				culling::entityCullingKernel::MultiViewCulling_AVX2(cameraEightPlanes, cameraWorldPositions, groupTestedCameraBits, positionAndRadius, entityBlock->mDesiredMaxDrawDistance, visibleBitflag, entityCount, isDistanceCullingEnabled, isViewFrustumCullingEnabled);
+				break;
+			}
+		}
+	}
+
+	// Result of cameras which reused result of last tick for every entity isn't stored again
+	if (mCullingSystem->IsTemporalCoherenceEnabled() == true)
+	{
+		for (size_t cameraGroupIndex = 0; cameraGroupIndex < cameraGroupCount; cameraGroupIndex++)
+		{
+			const char storedCameraBits = (isEntityBlockUnchanged == true) ? (cameraBits[cameraGroupIndex] & ~temporalCameraBits[cameraGroupIndex]) : (cameraBits[cameraGroupIndex]);
+			if (storedCameraBits != 0)
+			{
+				entityBlock->StoreTemporalVisibleBitflagOfCameraGroup(cameraGroupIndex, storedCameraBits);
+			}
+		}
+	}
+}
+
+culling::MultiViewCulling::MultiViewCulling(EveryCulling* const everyCulling)
+	: CullingModule(everyCulling)
+{
+	IsEnabled = false;
+}
+
+void culling::MultiViewCulling::CullBlockEntityJob(const size_t cameraIndex, const unsigned long long currentTickCount)
+{
+	if (cameraIndex != 0)
+	{
+		return;
+	}
+
+	while (true)
+	{
+		culling::EntityBlock* const nextEntityBlock = GetNextEntityBlock(cameraIndex);
+
+		if (nextEntityBlock != nullptr)
+		{
+			DoMultiViewCulling(nextEntityBlock);
+		}
+		else
+		{
+			break;
+		}
+	}
+}
+
+const char* culling::MultiViewCulling::GetCullingModuleName() const
+{
+	return "MultiViewCulling";
+}
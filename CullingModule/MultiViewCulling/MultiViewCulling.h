@@ -0,0 +1,39 @@
+#pragma once
+
+#include "../../EveryCullingCore.h"
+
+#include "../CullingModule.h"
+
+namespace culling
+{
+	/// <summary>
+	/// Do PreCulling ( except screen space projection ), DistanceCulling, ViewFrustumCulling for every camera in one pass over entity blocks.
+	///
+	/// With separated culling modules, each entity block is streamed from memory once per camera.
+	/// This module loads bounding sphere of entities once and tests it against every camera,
+	/// and visibility bits of all cameras of a camera group are written with one store.
+	/// Visibility result is same with result of separated culling modules.
+	///
+	/// This module is disabled by default. ( use EveryCulling::SetEnabledCullingModule )
+	/// While this module is enabled, DistanceCulling, ViewFrustumCulling, FusedCulling modules don't run ( their enabled state isn't changed ).
+	/// Distance test and frustum test are done only while DistanceCulling, ViewFrustumCulling modules are enabled.
+	/// PreCulling always runs and only projects aabb of entities survived this module to screen space of each camera.
+	/// Cull job should be run with EveryCulling::ThreadMultiViewCullJob instead of EveryCulling::ThreadCullJob
+	/// </summary>
+	class MultiViewCulling : public CullingModule
+	{
+	private:
+
+		void DoMultiViewCulling(culling::EntityBlock* const entityBlock);
+
+	public:
+
+		MultiViewCulling(EveryCulling* const everyCulling);
+
+		/// <summary>
+		/// Entity blocks are culled for every camera in cull job of camera 0. Cull job of other cameras does nothing
+		/// </summary>
+		void CullBlockEntityJob(const size_t cameraIndex, const unsigned long long currentTickCount) override;
+		const char* GetCullingModuleName() const override;
+	};
+}
@@ -0,0 +1,119 @@
+#include "PVSBakeFile.h"
+
+#include <cassert>
+#include <cmath>
+
+namespace
+{
+	constexpr std::uint64_t MAX_FILL_WORD_COUNT = 0x7FFFFFFFull;
+	constexpr std::uint64_t MAX_LITERAL_WORD_COUNT = 0xFFFFFFFFull;
+	constexpr std::uint64_t FILL_BIT = 1ull << 31;
+
+	EVERYCULLING_FORCE_INLINE bool IsFillWord(const std::uint64_t word)
+	{
+		return word == 0 || word == ~0ull;
+	}
+}
+
+size_t culling::PVSGrid::GetCellCount() const
+{
+	return static_cast<size_t>(mCellCounts[0]) * mCellCounts[1] * mCellCounts[2];
+}
+
+std::uint32_t culling::PVSGrid::GetCellIndex(const culling::Vec3& worldPosition) const
+{
+	const float cellCoordinates[3] =
+	{
+		std::floor((worldPosition.x - mMinWorldPoint.x) / mCellSize.x),
+		std::floor((worldPosition.y - mMinWorldPoint.y) / mCellSize.y),
+		std::floor((worldPosition.z - mMinWorldPoint.z) / mCellSize.z)
+	};
+
+	for (size_t axisIndex = 0; axisIndex < 3; axisIndex++)
+	{
+		// Also rejects NaN
+		if ((cellCoordinates[axisIndex] >= 0.0f && cellCoordinates[axisIndex] < static_cast<float>(mCellCounts[axisIndex])) == false)
+		{
+			return EVERYCULLING_INVALID_CELL_INDEX;
+		}
+	}
+
+	return
+		static_cast<std::uint32_t>(cellCoordinates[0]) +
+		static_cast<std::uint32_t>(cellCoordinates[1]) * mCellCounts[0] +
+		static_cast<std::uint32_t>(cellCoordinates[2]) * mCellCounts[0] * mCellCounts[1];
+}
+
+culling::Vec3 culling::PVSGrid::GetCellMinWorldPoint(const std::uint32_t cellIndex) const
+{
+	assert(cellIndex < GetCellCount());
+
+	const std::uint32_t cellX = cellIndex % mCellCounts[0];
+	const std::uint32_t cellY = (cellIndex / mCellCounts[0]) % mCellCounts[1];
+	const std::uint32_t cellZ = cellIndex / (mCellCounts[0] * mCellCounts[1]);
+
+	return culling::Vec3
+	{
+		mMinWorldPoint.x + mCellSize.x * cellX,
+		mMinWorldPoint.y + mCellSize.y * cellY,
+		mMinWorldPoint.z + mCellSize.z * cellZ
+	};
+}
+
+void culling::CompressPVSBitset(const std::uint64_t* const bitsetWords, const size_t bitsetWordCount, std::vector<std::uint64_t>& outCompressedWords)
+{
+	size_t wordIndex = 0;
+	while (wordIndex < bitsetWordCount)
+	{
+		std::uint64_t fillWordCount = 0;
+		const std::uint64_t fillWord = bitsetWords[wordIndex];
+		if (IsFillWord(fillWord) == true)
+		{
+			while (wordIndex < bitsetWordCount && bitsetWords[wordIndex] == fillWord && fillWordCount < MAX_FILL_WORD_COUNT)
+			{
+				fillWordCount++;
+				wordIndex++;
+			}
+		}
+
+		const size_t literalWordBeginIndex = wordIndex;
+		while (wordIndex < bitsetWordCount && IsFillWord(bitsetWords[wordIndex]) == false && (wordIndex - literalWordBeginIndex) < MAX_LITERAL_WORD_COUNT)
+		{
+			wordIndex++;
+		}
+		const std::uint64_t literalWordCount = wordIndex - literalWordBeginIndex;
+
+		const std::uint64_t fillBit = (fillWordCount != 0 && fillWord != 0) ? FILL_BIT : 0;
+		outCompressedWords.push_back(fillWordCount | fillBit | (literalWordCount << 32));
+		outCompressedWords.insert(outCompressedWords.end(), bitsetWords + literalWordBeginIndex, bitsetWords + wordIndex);
+	}
+}
+
+bool culling::DecompressPVSBitset(const std::uint64_t* const compressedWords, const size_t compressedWordCount, std::uint64_t* const outBitsetWords, const size_t bitsetWordCount)
+{
+	size_t compressedWordIndex = 0;
+	size_t bitsetWordIndex = 0;
+	while (compressedWordIndex < compressedWordCount)
+	{
+		const std::uint64_t runHeader = compressedWords[compressedWordIndex++];
+		const std::uint64_t fillWordCount = runHeader & MAX_FILL_WORD_COUNT;
+		const std::uint64_t fillWord = ((runHeader & FILL_BIT) != 0) ? ~0ull : 0ull;
+		const std::uint64_t literalWordCount = runHeader >> 32;
+
+		if (fillWordCount + literalWordCount > bitsetWordCount - bitsetWordIndex || literalWordCount > compressedWordCount - compressedWordIndex)
+		{
+			return false;
+		}
+
+		for (std::uint64_t fillWordIndex = 0; fillWordIndex < fillWordCount; fillWordIndex++)
+		{
+			outBitsetWords[bitsetWordIndex++] = fillWord;
+		}
+		for (std::uint64_t literalWordIndex = 0; literalWordIndex < literalWordCount; literalWordIndex++)
+		{
+			outBitsetWords[bitsetWordIndex++] = compressedWords[compressedWordIndex++];
+		}
+	}
+
+	return bitsetWordIndex == bitsetWordCount;
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "../../EveryCullingCore.h"
+
+#include "../../DataType/Math/Vector.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace culling
+{
+	/// <summary>
+	/// Regular grid of cells of PVS.
+	/// Cell ( x, y, z ) has index x + y * mCellCounts[0] + z * mCellCounts[0] * mCellCounts[1]
+	/// </summary>
+	struct PVSGrid
+	{
+		culling::Vec3 mMinWorldPoint;
+		culling::Vec3 mCellSize;
+		std::uint32_t mCellCounts[3];
+
+		size_t GetCellCount() const;
+		/// <summary>
+		/// Return EVERYCULLING_INVALID_CELL_INDEX if the position is outside of grid
+		/// </summary>
+		std::uint32_t GetCellIndex(const culling::Vec3& worldPosition) const;
+		culling::Vec3 GetCellMinWorldPoint(const std::uint32_t cellIndex) const;
+	};
+
+	/// <summary>
+	/// Layout of PVS bake file :
+	///
+	/// PVSBakeFileHeader
+	/// std::uint64_t offsets[cell count + 1] : compressed bitset of cell i is at [ offsets[i], offsets[i + 1] ) bytes from start of file
+	/// compressed bitsets of cells ( CompressPVSBitset )
+	///
+	/// Everything is 8 byte aligned, so mapped file is read without copy
+	/// </summary>
+	struct PVSBakeFileHeader
+	{
+		std::uint32_t mMagic;
+		std::uint32_t mVersion;
+		culling::PVSGrid mGrid;
+		/// <summary>
+		/// Bit count of bitset of each cell. PVS index of baked entities is in [ 0, mEntityCount )
+		/// </summary>
+		std::uint32_t mEntityCount;
+	};
+
+	static_assert(sizeof(PVSBakeFileHeader) % sizeof(std::uint64_t) == 0, "Offsets following header should be 8 byte aligned");
+
+	/// <summary>
+	/// Bitset is compressed to runs of 64 bit words.
+	/// Each run starts with a header word : low 31 bit is count of fill words ( all 0 or all 1 ), bit 31 is the fill bit,
+	/// high 32 bit is count of literal words following the header.
+	/// Empty regions and fully visible regions of a level become a word
+	/// </summary>
+	void CompressPVSBitset(const std::uint64_t* const bitsetWords, const size_t bitsetWordCount, std::vector<std::uint64_t>& outCompressedWords);
+	/// <summary>
+	/// Return false if compressed words are broken or don't have bitsetWordCount words
+	/// </summary>
+	bool DecompressPVSBitset(const std::uint64_t* const compressedWords, const size_t compressedWordCount, std::uint64_t* const outBitsetWords, const size_t bitsetWordCount);
+}
@@ -0,0 +1,274 @@
+#include "PVSBaker.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <utility>
+
+#include "../../EveryCulling.h"
+#include "../../DataType/Math/Common.h"
+#include "../PreCulling/PreCulling.h"
+#include "../DistanceCulling/DistanceCulling.h"
+#include "../ViewFrustumCulling/ViewFrustumCulling.h"
+#include "../FusedCulling/FusedCulling.h"
+#include "../MultiViewCulling/MultiViewCulling.h"
+#include "../ShadowCasterCulling/ShadowCasterCulling.h"
+#include "../PortalCulling/PortalCulling.h"
+#include "../HierarchyCulling/HierarchyCulling.h"
+#include "../MaskedSWOcclusionCulling/MaskedSWOcclusionCulling.h"
+#include "../VisibleEntityCompaction/VisibleEntityCompaction.h"
+#include "PVSCulling.h"
+
+namespace
+{
+	constexpr size_t CUBE_FACE_COUNT = 6;
+	static_assert(CUBE_FACE_COUNT <= EVERYCULLING_MAX_CAMERA_COUNT, "Camera of each cube face is needed");
+
+	// Faces overlap a little, so entities at edges of faces aren't missed
+	constexpr float CUBE_FACE_FRUSTUM_MARGIN = 1.02f;
+
+	const culling::Vec3 CUBE_FACE_FORWARDS[CUBE_FACE_COUNT] =
+	{
+		{ 1.0f, 0.0f, 0.0f }, { -1.0f, 0.0f, 0.0f },
+		{ 0.0f, 1.0f, 0.0f }, { 0.0f, -1.0f, 0.0f },
+		{ 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f, -1.0f }
+	};
+	const culling::Vec3 CUBE_FACE_UPS[CUBE_FACE_COUNT] =
+	{
+		{ 0.0f, 1.0f, 0.0f }, { 0.0f, 1.0f, 0.0f },
+		{ 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f, 1.0f },
+		{ 0.0f, 1.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }
+	};
+
+	// Column major, OpenGL clip space. Forward and up are orthogonal unit vectors
+	culling::Mat4x4 MakeViewMatrix(const culling::Vec3& eye, const culling::Vec3& forward, const culling::Vec3& up)
+	{
+		const culling::Vec3 side = culling::Cross(forward, up);
+
+		culling::Mat4x4 matrix;
+		std::memset(&matrix, 0, sizeof(culling::Mat4x4));
+		matrix[0][0] = side.x;
+		matrix[1][0] = side.y;
+		matrix[2][0] = side.z;
+		matrix[0][1] = up.x;
+		matrix[1][1] = up.y;
+		matrix[2][1] = up.z;
+		matrix[0][2] = -forward.x;
+		matrix[1][2] = -forward.y;
+		matrix[2][2] = -forward.z;
+		matrix[3][0] = -culling::Dot(side, eye);
+		matrix[3][1] = -culling::Dot(up, eye);
+		matrix[3][2] = culling::Dot(forward, eye);
+		matrix[3][3] = 1.0f;
+		return matrix;
+	}
+
+	culling::Mat4x4 MakeProjectionMatrix(const float focalLengthX, const float focalLengthY, const float nearPlane, const float farPlane)
+	{
+		culling::Mat4x4 matrix;
+		std::memset(&matrix, 0, sizeof(culling::Mat4x4));
+		matrix[0][0] = focalLengthX;
+		matrix[1][1] = focalLengthY;
+		matrix[2][2] = (farPlane + nearPlane) / (nearPlane - farPlane);
+		matrix[2][3] = -1.0f;
+		matrix[3][2] = (2.0f * farPlane * nearPlane) / (nearPlane - farPlane);
+		return matrix;
+	}
+}
+
+culling::PVSBaker::PVSBaker(culling::EveryCulling& everyCulling)
+	: mEveryCulling(everyCulling), mBakeSettings(), mCompressedBitsetWords(), mCellBitsetOffsets()
+{
+}
+
+void culling::PVSBaker::RunCullJob()
+{
+	culling::EveryCulling* const everyCulling = &mEveryCulling;
+	const unsigned long long tickCount = mEveryCulling.GetTickCount();
+	const auto cullJob = [everyCulling, tickCount]()
+	{
+		for (size_t cameraIndex = 0; cameraIndex < CUBE_FACE_COUNT; cameraIndex++)
+		{
+			everyCulling->ThreadCullJob(cameraIndex, tickCount);
+		}
+	};
+
+	std::vector<std::thread> threads;
+	for (std::uint32_t threadIndex = 1; threadIndex < mBakeSettings.mThreadCount; threadIndex++)
+	{
+		threads.emplace_back(cullJob);
+	}
+	cullJob();
+
+	mEveryCulling.WaitToFinishCullJobOfAllCameras();
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+}
+
+void culling::PVSBaker::BakeCell(const std::uint32_t cellIndex, std::vector<std::uint64_t>& visibleEntityBitset)
+{
+	const culling::PVSGrid& grid = mBakeSettings.mGrid;
+	const std::uint32_t samplePointCountPerAxis = mBakeSettings.mSamplePointCountPerAxis;
+
+	// Cube face covers 90 degree on both axis of depth buffer
+	const float aspect = static_cast<float>(mEveryCulling.mMaskedSWOcclusionCulling->mDepthBuffer.mResolution.mWidth) / static_cast<float>(mEveryCulling.mMaskedSWOcclusionCulling->mDepthBuffer.mResolution.mHeight);
+	const float tanHalfFieldOfViewY = (aspect >= 1.0f) ? CUBE_FACE_FRUSTUM_MARGIN : CUBE_FACE_FRUSTUM_MARGIN / aspect;
+	const float focalLengthY = 1.0f / tanHalfFieldOfViewY;
+	const culling::Mat4x4 projectionMatrix = MakeProjectionMatrix(focalLengthY / aspect, focalLengthY, mBakeSettings.mNearClipPlaneDistance, mBakeSettings.mFarClipPlaneDistance);
+
+	const culling::Vec3 cellMinWorldPoint = grid.GetCellMinWorldPoint(cellIndex);
+	for (std::uint32_t samplePointIndex = 0; samplePointIndex < samplePointCountPerAxis * samplePointCountPerAxis * samplePointCountPerAxis; samplePointIndex++)
+	{
+		const float sampleX = (static_cast<float>(samplePointIndex % samplePointCountPerAxis) + 0.5f) / samplePointCountPerAxis;
+		const float sampleY = (static_cast<float>((samplePointIndex / samplePointCountPerAxis) % samplePointCountPerAxis) + 0.5f) / samplePointCountPerAxis;
+		const float sampleZ = (static_cast<float>(samplePointIndex / (samplePointCountPerAxis * samplePointCountPerAxis)) + 0.5f) / samplePointCountPerAxis;
+		const culling::Vec3 samplePoint
+		{
+			cellMinWorldPoint.x + grid.mCellSize.x * sampleX,
+			cellMinWorldPoint.y + grid.mCellSize.y * sampleY,
+			cellMinWorldPoint.z + grid.mCellSize.z * sampleZ
+		};
+
+		for (size_t cameraIndex = 0; cameraIndex < CUBE_FACE_COUNT; cameraIndex++)
+		{
+			culling::EveryCulling::GlobalDataForCullJob cameraData;
+			cameraData.mViewProjectionMatrix = projectionMatrix * MakeViewMatrix(samplePoint, CUBE_FACE_FORWARDS[cameraIndex], CUBE_FACE_UPS[cameraIndex]);
+			cameraData.mFieldOfViewInDegree = 2.0f * std::atan(tanHalfFieldOfViewY) / culling::DEGREE_TO_RADIAN;
+			cameraData.mCameraNearPlaneDistance = mBakeSettings.mNearClipPlaneDistance;
+			cameraData.mCameraFarPlaneDistance = mBakeSettings.mFarClipPlaneDistance;
+			cameraData.mCameraWorldPosition = samplePoint;
+			cameraData.mCameraRotation = culling::Vec4{ 0.0f, 0.0f, 0.0f, 1.0f };
+			mEveryCulling.UpdateGlobalDataForCullJob(cameraIndex, cameraData);
+		}
+
+		mEveryCulling.PreCullJob();
+		RunCullJob();
+
+		for (const culling::EntityBlock* const entityBlock : mEveryCulling.GetActiveEntityBlockList())
+		{
+			for (size_t entityIndex = 0; entityIndex < entityBlock->mCurrentEntityCount; entityIndex++)
+			{
+				const std::uint32_t pvsIndex = entityBlock->GetPVSIndex(entityIndex);
+				if (pvsIndex >= mBakeSettings.mEntityCount)
+				{
+					continue;
+				}
+
+				for (size_t cameraIndex = 0; cameraIndex < CUBE_FACE_COUNT; cameraIndex++)
+				{
+					if (entityBlock->GetIsCulled(entityIndex, cameraIndex) == false)
+					{
+						visibleEntityBitset[pvsIndex / 64] |= 1ull << (pvsIndex % 64);
+						break;
+					}
+				}
+			}
+		}
+	}
+}
+
+void culling::PVSBaker::Bake(const culling::PVSBakeSettings& bakeSettings)
+{
+	assert(bakeSettings.mSamplePointCountPerAxis != 0);
+	assert(bakeSettings.mGrid.GetCellCount() != 0);
+
+	mBakeSettings = bakeSettings;
+	mCompressedBitsetWords.clear();
+	mCellBitsetOffsets.assign(1, 0);
+
+	const size_t cameraCount = mEveryCulling.GetCameraCount();
+	const bool isTemporalCoherenceEnabled = mEveryCulling.IsTemporalCoherenceEnabled();
+	const bool isOcclusionCostModelEnabled = mEveryCulling.mMaskedSWOcclusionCulling->mCostModel.IsEnabled();
+	const std::vector<std::pair<culling::CullingModule*, bool>> cullingModuleStates
+	{
+		{ mEveryCulling.mHierarchyCulling.get(), mEveryCulling.mHierarchyCulling->IsEnabled },
+		{ mEveryCulling.mMultiViewCulling.get(), mEveryCulling.mMultiViewCulling->IsEnabled },
+		{ mEveryCulling.mFusedCulling.get(), mEveryCulling.mFusedCulling->IsEnabled },
+		{ mEveryCulling.mPreCulling.get(), mEveryCulling.mPreCulling->IsEnabled },
+		{ mEveryCulling.mDistanceCulling.get(), mEveryCulling.mDistanceCulling->IsEnabled },
+		{ mEveryCulling.mViewFrustumCulling.get(), mEveryCulling.mViewFrustumCulling->IsEnabled },
+		{ mEveryCulling.mShadowCasterCulling.get(), mEveryCulling.mShadowCasterCulling->IsEnabled },
+		{ mEveryCulling.mPortalCulling.get(), mEveryCulling.mPortalCulling->IsEnabled },
+		{ mEveryCulling.mPVSCulling.get(), mEveryCulling.mPVSCulling->IsEnabled },
+		{ &(mEveryCulling.mMaskedSWOcclusionCulling->mSolveMeshRoleStage), mEveryCulling.mMaskedSWOcclusionCulling->mSolveMeshRoleStage.IsEnabled },
+		{ &(mEveryCulling.mMaskedSWOcclusionCulling->mBinTrianglesStage), mEveryCulling.mMaskedSWOcclusionCulling->mBinTrianglesStage.IsEnabled },
+		{ &(mEveryCulling.mMaskedSWOcclusionCulling->mRasterizeTrianglesStage), mEveryCulling.mMaskedSWOcclusionCulling->mRasterizeTrianglesStage.IsEnabled },
+		{ &(mEveryCulling.mMaskedSWOcclusionCulling->mQueryOccludeeStage), mEveryCulling.mMaskedSWOcclusionCulling->mQueryOccludeeStage.IsEnabled },
+		{ mEveryCulling.mVisibleEntityCompaction.get(), mEveryCulling.mVisibleEntityCompaction->IsEnabled }
+	};
+
+	// Visibility doesn't depend on draw distance of entities or other views
+	for (const std::pair<culling::CullingModule*, bool>& cullingModuleState : cullingModuleStates)
+	{
+		cullingModuleState.first->IsEnabled = false;
+	}
+	mEveryCulling.SetEnabledCullingModule(culling::EveryCulling::CullingModuleType::PreCulling, true);
+	mEveryCulling.SetEnabledCullingModule(culling::EveryCulling::CullingModuleType::ViewFrustumCulling, true);
+	mEveryCulling.SetEnabledCullingModule(culling::EveryCulling::CullingModuleType::MaskedSWOcclusionCulling, true);
+	mEveryCulling.SetTemporalCoherenceEnabled(false);
+	// Occlusion culling skipped by cost model would be baked to PVS as visible entities
+	mEveryCulling.mMaskedSWOcclusionCulling->mCostModel.SetEnabled(false);
+	mEveryCulling.SetCameraCount(CUBE_FACE_COUNT);
+
+	const size_t cellCount = mBakeSettings.mGrid.GetCellCount();
+	std::vector<std::uint64_t> visibleEntityBitset((mBakeSettings.mEntityCount + 63) / 64);
+	for (std::uint32_t cellIndex = 0; cellIndex < cellCount; cellIndex++)
+	{
+		std::fill(visibleEntityBitset.begin(), visibleEntityBitset.end(), 0);
+		BakeCell(cellIndex, visibleEntityBitset);
+
+		culling::CompressPVSBitset(visibleEntityBitset.data(), visibleEntityBitset.size(), mCompressedBitsetWords);
+		mCellBitsetOffsets.push_back(mCompressedBitsetWords.size());
+	}
+
+	mEveryCulling.SetCameraCount(cameraCount);
+	mEveryCulling.SetTemporalCoherenceEnabled(isTemporalCoherenceEnabled);
+	mEveryCulling.mMaskedSWOcclusionCulling->mCostModel.SetEnabled(isOcclusionCostModelEnabled);
+	for (const std::pair<culling::CullingModule*, bool>& cullingModuleState : cullingModuleStates)
+	{
+		cullingModuleState.first->IsEnabled = cullingModuleState.second;
+	}
+}
+
+bool culling::PVSBaker::WriteBakeFile(const char* const filePath) const
+{
+	assert(mCellBitsetOffsets.size() == mBakeSettings.mGrid.GetCellCount() + 1);
+
+	// Value initialization zeroes padding of header written to file
+	culling::PVSBakeFileHeader header{};
+	header.mMagic = EVERYCULLING_PVS_BAKE_FILE_MAGIC;
+	header.mVersion = EVERYCULLING_PVS_BAKE_FILE_VERSION;
+	header.mGrid = mBakeSettings.mGrid;
+	header.mEntityCount = mBakeSettings.mEntityCount;
+
+	// Offsets of bitsets from start of file ( bytes )
+	const std::uint64_t firstBitsetOffset = sizeof(culling::PVSBakeFileHeader) + mCellBitsetOffsets.size() * sizeof(std::uint64_t);
+	std::vector<std::uint64_t> cellBitsetOffsets(mCellBitsetOffsets.size());
+	for (size_t cellIndex = 0; cellIndex < mCellBitsetOffsets.size(); cellIndex++)
+	{
+		cellBitsetOffsets[cellIndex] = firstBitsetOffset + mCellBitsetOffsets[cellIndex] * sizeof(std::uint64_t);
+	}
+
+	std::FILE* const file = std::fopen(filePath, "wb");
+	if (file == nullptr)
+	{
+		return false;
+	}
+
+	bool isSuccess = std::fwrite(&header, sizeof(culling::PVSBakeFileHeader), 1, file) == 1;
+	isSuccess = isSuccess && std::fwrite(cellBitsetOffsets.data(), sizeof(std::uint64_t), cellBitsetOffsets.size(), file) == cellBitsetOffsets.size();
+	isSuccess = isSuccess && std::fwrite(mCompressedBitsetWords.data(), sizeof(std::uint64_t), mCompressedBitsetWords.size(), file) == mCompressedBitsetWords.size();
+	isSuccess = (std::fclose(file) == 0) && isSuccess;
+
+	return isSuccess;
+}
+
+size_t culling::PVSBaker::GetCompressedBitsetSize() const
+{
+	return mCompressedBitsetWords.size() * sizeof(std::uint64_t);
+}
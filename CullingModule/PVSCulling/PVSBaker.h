@@ -0,0 +1,81 @@
+#pragma once
+
+#include "../../EveryCullingCore.h"
+
+#include "PVSBakeFile.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace culling
+{
+	class EveryCulling;
+
+	struct PVSBakeSettings
+	{
+		culling::PVSGrid mGrid;
+		/// <summary>
+		/// PVS index of baked entities is in [ 0, mEntityCount )
+		/// </summary>
+		std::uint32_t mEntityCount = 0;
+		/// <summary>
+		/// Each cell is sampled at mSamplePointCountPerAxis ^ 3 points evenly spread in the cell.
+		/// Entities seen only between sample points are missed, so dense sampling is needed for small occluders
+		/// </summary>
+		std::uint32_t mSamplePointCountPerAxis = 2;
+		float mNearClipPlaneDistance = 0.1f;
+		float mFarClipPlaneDistance = 3000.0f;
+		/// <summary>
+		/// Count of threads running cull job of each sample point ( including caller thread )
+		/// </summary>
+		std::uint32_t mThreadCount = 1;
+	};
+
+	/// <summary>
+	/// Bake potentially visible set of static entities of each cell of grid offline, for PVSCulling.
+	///
+	/// At each sample point of a cell, cull job is run for 6 cameras looking at faces of a cube,
+	/// with only PreCulling, ViewFrustumCulling, MaskedSWOcclusionCulling enabled.
+	/// Entities visible from any camera of any sample point are visible from the cell.
+	/// Bitset of visible entities of each cell is indexed by PVS index of entities ( EntityBlockViewer::SetPVSIndex ).
+	///
+	/// Bake with EveryCulling holding static entities of the level, before shadow views are set.
+	/// Camera count, temporal coherence and enabled culling modules of it are changed while baking and restored after it,
+	/// but camera data should be updated again before next cull job.
+	/// Don't bake while cull job is running
+	/// </summary>
+	class PVSBaker
+	{
+	private:
+
+		culling::EveryCulling& mEveryCulling;
+
+		culling::PVSBakeSettings mBakeSettings;
+		/// <summary>
+		/// Compressed bitset of cell i is mCompressedBitsetWords[mCellBitsetOffsets[i], mCellBitsetOffsets[i + 1])
+		/// </summary>
+		std::vector<std::uint64_t> mCompressedBitsetWords;
+		std::vector<std::uint64_t> mCellBitsetOffsets;
+
+		/// <summary>
+		/// Run cull job of every camera on mThreadCount threads and wait it
+		/// </summary>
+		void RunCullJob();
+		void BakeCell(const std::uint32_t cellIndex, std::vector<std::uint64_t>& visibleEntityBitset);
+
+	public:
+
+		PVSBaker(culling::EveryCulling& everyCulling);
+
+		void Bake(const culling::PVSBakeSettings& bakeSettings);
+		/// <summary>
+		/// Write baked PVS. Return false if the file can't be written
+		/// </summary>
+		bool WriteBakeFile(const char* const filePath) const;
+
+		/// <summary>
+		/// Size of compressed bitsets of all cells ( bytes )
+		/// </summary>
+		size_t GetCompressedBitsetSize() const;
+	};
+}
@@ -0,0 +1,307 @@
+#include "PVSCulling.h"
+
+#include <cassert>
+
+#include "../../EveryCulling.h"
+#include "../ShadowCasterCulling/ShadowCasterCulling.h"
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+	/// <summary>
+	/// Map whole file read only. Return nullptr if failed
+	/// </summary>
+	const std::uint8_t* MapFile(const char* const filePath, size_t& outFileSize)
+	{
+#if defined(_WIN32)
+		const HANDLE fileHandle = CreateFileA(filePath, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (fileHandle == INVALID_HANDLE_VALUE)
+		{
+			return nullptr;
+		}
+
+		LARGE_INTEGER fileSize;
+		if (GetFileSizeEx(fileHandle, &fileSize) == 0 || fileSize.QuadPart == 0)
+		{
+			CloseHandle(fileHandle);
+			return nullptr;
+		}
+
+		// Mapped view keeps file mapping alive after handles are closed
+		const HANDLE fileMappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		CloseHandle(fileHandle);
+		if (fileMappingHandle == nullptr)
+		{
+			return nullptr;
+		}
+
+		void* const mappedAddress = MapViewOfFile(fileMappingHandle, FILE_MAP_READ, 0, 0, 0);
+		CloseHandle(fileMappingHandle);
+		if (mappedAddress == nullptr)
+		{
+			return nullptr;
+		}
+
+		outFileSize = static_cast<size_t>(fileSize.QuadPart);
+		return static_cast<const std::uint8_t*>(mappedAddress);
+#else
+		const int fileDescriptor = open(filePath, O_RDONLY);
+		if (fileDescriptor < 0)
+		{
+			return nullptr;
+		}
+
+		struct stat fileStat;
+		if (fstat(fileDescriptor, &fileStat) != 0 || fileStat.st_size <= 0)
+		{
+			close(fileDescriptor);
+			return nullptr;
+		}
+
+		// Mapping stays valid after file descriptor is closed
+		void* const mappedAddress = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+		close(fileDescriptor);
+		if (mappedAddress == MAP_FAILED)
+		{
+			return nullptr;
+		}
+
+		// Bitsets of cells camera visits are read
+		madvise(mappedAddress, static_cast<size_t>(fileStat.st_size), MADV_RANDOM);
+
+		outFileSize = static_cast<size_t>(fileStat.st_size);
+		return static_cast<const std::uint8_t*>(mappedAddress);
+#endif
+	}
+
+	void UnmapFile(const std::uint8_t* const mappedAddress, const size_t fileSize)
+	{
+#if defined(_WIN32)
+		UnmapViewOfFile(mappedAddress);
+#else
+		munmap(const_cast<std::uint8_t*>(mappedAddress), fileSize);
+#endif
+	}
+}
+
+culling::PVSCulling::PVSCulling(EveryCulling* const everyCulling)
+	: CullingModule(everyCulling), mMappedBakeFile{ nullptr }, mMappedBakeFileSize{ 0 }, mBakeFileHeader{ nullptr }, mCellBitsetOffsets{ nullptr }
+{
+	IsEnabled = false;
+}
+
+culling::PVSCulling::~PVSCulling()
+{
+	UnloadBakeFile();
+}
+
+bool culling::PVSCulling::LoadBakeFile(const char* const filePath)
+{
+	UnloadBakeFile();
+
+	size_t fileSize = 0;
+	const std::uint8_t* const mappedFile = MapFile(filePath, fileSize);
+	if (mappedFile == nullptr)
+	{
+		return false;
+	}
+
+	// Check header and offsets once, so cull job reads bitsets without bound check
+	const culling::PVSBakeFileHeader* const header = reinterpret_cast<const culling::PVSBakeFileHeader*>(mappedFile);
+	bool isValid =
+		fileSize >= sizeof(culling::PVSBakeFileHeader) &&
+		header->mMagic == EVERYCULLING_PVS_BAKE_FILE_MAGIC &&
+		header->mVersion == EVERYCULLING_PVS_BAKE_FILE_VERSION &&
+		header->mGrid.GetCellCount() != 0 &&
+		header->mGrid.GetCellCount() < EVERYCULLING_INVALID_CELL_INDEX &&
+		(fileSize - sizeof(culling::PVSBakeFileHeader)) / sizeof(std::uint64_t) > header->mGrid.GetCellCount();
+
+	const std::uint64_t* const cellBitsetOffsets = reinterpret_cast<const std::uint64_t*>(mappedFile + sizeof(culling::PVSBakeFileHeader));
+	if (isValid == true)
+	{
+		const size_t cellCount = header->mGrid.GetCellCount();
+		const std::uint64_t firstBitsetOffset = sizeof(culling::PVSBakeFileHeader) + (cellCount + 1) * sizeof(std::uint64_t);
+		isValid = (cellBitsetOffsets[0] == firstBitsetOffset);
+		for (size_t cellIndex = 0; cellIndex < cellCount && isValid == true; cellIndex++)
+		{
+			isValid =
+				cellBitsetOffsets[cellIndex] <= cellBitsetOffsets[cellIndex + 1] &&
+				cellBitsetOffsets[cellIndex + 1] <= fileSize &&
+				cellBitsetOffsets[cellIndex + 1] % sizeof(std::uint64_t) == 0;
+		}
+	}
+
+	if (isValid == false)
+	{
+		UnmapFile(mappedFile, fileSize);
+		return false;
+	}
+
+	mMappedBakeFile = mappedFile;
+	mMappedBakeFileSize = fileSize;
+	mBakeFileHeader = header;
+	mCellBitsetOffsets = cellBitsetOffsets;
+
+	for (size_t cameraIndex = 0; cameraIndex < mDecompressedCellIndices.size(); cameraIndex++)
+	{
+		mDecompressedCellIndices[cameraIndex] = EVERYCULLING_INVALID_CELL_INDEX;
+		mVisibleEntityBitsets[cameraIndex].resize((mBakeFileHeader->mEntityCount + 63) / 64);
+		mCameraCellUpdatedTickCount[cameraIndex].store((unsigned long long)-1, std::memory_order_relaxed);
+	}
+
+	return true;
+}
+
+void culling::PVSCulling::UnloadBakeFile()
+{
+	if (mMappedBakeFile == nullptr)
+	{
+		return;
+	}
+
+	UnmapFile(mMappedBakeFile, mMappedBakeFileSize);
+	mMappedBakeFile = nullptr;
+	mMappedBakeFileSize = 0;
+	mBakeFileHeader = nullptr;
+	mCellBitsetOffsets = nullptr;
+
+	for (size_t cameraIndex = 0; cameraIndex < mDecompressedCellIndices.size(); cameraIndex++)
+	{
+		mCameraCellIndices[cameraIndex] = EVERYCULLING_INVALID_CELL_INDEX;
+		mDecompressedCellIndices[cameraIndex] = EVERYCULLING_INVALID_CELL_INDEX;
+	}
+}
+
+std::uint32_t culling::PVSCulling::GetCameraCellIndex(const size_t cameraIndex) const
+{
+	return mCameraCellIndices[cameraIndex];
+}
+
+void culling::PVSCulling::UpdateCameraCell(const size_t cameraIndex, const unsigned long long currentTickCount)
+{
+	if (mCameraCellUpdatedTickCount[cameraIndex].load(std::memory_order_acquire) != currentTickCount)
+	{
+		std::lock_guard<std::mutex> lock{ mCameraCellUpdateMutex };
+
+		if (mCameraCellUpdatedTickCount[cameraIndex].load(std::memory_order_relaxed) != currentTickCount)
+		{
+			// Casters invisible from cell of the light can cast shadow into receiver frustum
+			std::uint32_t cameraCellIndex = (mCullingSystem->mShadowCasterCulling->IsShadowView(cameraIndex) == true) ? EVERYCULLING_INVALID_CELL_INDEX : mBakeFileHeader->mGrid.GetCellIndex(mCullingSystem->GetCameraWorldPosition(cameraIndex));
+
+			// Decompress only when camera enters other cell
+			if (cameraCellIndex != EVERYCULLING_INVALID_CELL_INDEX && cameraCellIndex != mDecompressedCellIndices[cameraIndex])
+			{
+				const std::uint64_t* const compressedWords = reinterpret_cast<const std::uint64_t*>(mMappedBakeFile + mCellBitsetOffsets[cameraCellIndex]);
+				const size_t compressedWordCount = (mCellBitsetOffsets[cameraCellIndex + 1] - mCellBitsetOffsets[cameraCellIndex]) / sizeof(std::uint64_t);
+				std::vector<std::uint64_t>& visibleEntityBitset = mVisibleEntityBitsets[cameraIndex];
+
+				if (culling::DecompressPVSBitset(compressedWords, compressedWordCount, visibleEntityBitset.data(), visibleEntityBitset.size()) == true)
+				{
+					mDecompressedCellIndices[cameraIndex] = cameraCellIndex;
+				}
+				else
+				{
+					// Broken bitset doesn't cull anything
+					assert(false);
+					mDecompressedCellIndices[cameraIndex] = EVERYCULLING_INVALID_CELL_INDEX;
+					cameraCellIndex = EVERYCULLING_INVALID_CELL_INDEX;
+				}
+			}
+
+			mCameraCellIndices[cameraIndex] = cameraCellIndex;
+			mCameraCellUpdatedTickCount[cameraIndex].store(currentTickCount, std::memory_order_release);
+		}
+	}
+}
+
+void culling::PVSCulling::DoPVSCulling
+(
+	const size_t cameraIndex,
+	culling::EntityBlock* const entityBlock
+)
+{
+	assert(entityBlock->mCurrentEntityCount != 0);
+
+	// Result of this module depends on camera position, so it isn't stored to temporal visible bitflag
+	if (entityBlock->IsAllEntitiesCulled(cameraIndex) == true)
+	{
+		return;
+	}
+
+	const std::uint64_t* const visibleEntityBitset = mVisibleEntityBitsets[cameraIndex].data();
+	const std::uint32_t bakedEntityCount = mBakeFileHeader->mEntityCount;
+	for (size_t entityIndex = 0; entityIndex < entityBlock->mCurrentEntityCount; entityIndex++)
+	{
+		// Entities not baked aren't culled
+		const std::uint32_t pvsIndex = entityBlock->GetPVSIndex(entityIndex);
+		if (pvsIndex < bakedEntityCount && ((visibleEntityBitset[pvsIndex / 64] >> (pvsIndex % 64)) & 1) == 0)
+		{
+			entityBlock->SetCulled(entityIndex, cameraIndex);
+		}
+	}
+}
+
+void culling::PVSCulling::CullBlockEntityJob(const size_t cameraIndex, const unsigned long long currentTickCount)
+{
+	if (IsBakeFileLoaded() == false)
+	{
+		return;
+	}
+
+	UpdateCameraCell(cameraIndex, currentTickCount);
+
+	if (mCameraCellIndices[cameraIndex] == EVERYCULLING_INVALID_CELL_INDEX)
+	{
+		return;
+	}
+
+	while (true)
+	{
+		culling::EntityBlock* const nextEntityBlock = GetNextEntityBlock(cameraIndex);
+
+		if (nextEntityBlock != nullptr)
+		{
+			DoPVSCulling(cameraIndex, nextEntityBlock);
+		}
+		else
+		{
+			break;
+		}
+	}
+}
+
+const char* culling::PVSCulling::GetCullingModuleName() const
+{
+	return "PVSCulling";
+}
+
+void culling::PVSCulling::OnSetCameraCount(const size_t cameraCount)
+{
+	CullingModule::OnSetCameraCount(cameraCount);
+
+	const size_t previousCameraCount = mCameraCellIndices.size();
+	mCameraCellIndices.Resize(cameraCount);
+	mDecompressedCellIndices.Resize(cameraCount);
+	mVisibleEntityBitsets.Resize(cameraCount);
+	mCameraCellUpdatedTickCount.Resize(cameraCount);
+	for (size_t cameraIndex = previousCameraCount; cameraIndex < cameraCount; cameraIndex++)
+	{
+		mCameraCellIndices[cameraIndex] = EVERYCULLING_INVALID_CELL_INDEX;
+		mDecompressedCellIndices[cameraIndex] = EVERYCULLING_INVALID_CELL_INDEX;
+		if (IsBakeFileLoaded() == true)
+		{
+			mVisibleEntityBitsets[cameraIndex].resize((mBakeFileHeader->mEntityCount + 63) / 64);
+		}
+	}
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "../../EveryCullingCore.h"
+
+#include "../../DataType/Math/Vector.h"
+#include "../../DataType/PerCameraArray.h"
+
+#include "../CullingModule.h"
+
+#include "PVSBakeFile.h"
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace culling
+{
+	/// <summary>
+	/// Cull static entities not in potentially visible set of the cell of camera.
+	///
+	/// PVS bake file written by PVSBaker is memory mapped, so only pages of bitsets of visited cells are read from disk.
+	/// Bitset of cell of camera is decompressed once when camera enters the cell,
+	/// and entities whose bit is 0 are culled ( EntityBlockViewer::SetPVSIndex ) before MaskedSWOcclusionCulling,
+	/// so occlusion of static world is a lookup and invisible static occluders aren't rasterized.
+	/// Entities without PVS index ( dynamic entities ) are culled by MaskedSWOcclusionCulling as before.
+	/// Every entity isn't culled while camera is outside of grid of the bake file.
+	///
+	/// Visibility depends on camera position, so this module runs after modules storing temporal visible bitflag.
+	/// Shadow views aren't culled, as casters invisible from the cell can cast visible shadow.
+	///
+	/// This module is disabled by default. ( use EveryCulling::SetEnabledCullingModule )
+	/// </summary>
+	class PVSCulling : public CullingModule
+	{
+	private:
+
+		const std::uint8_t* mMappedBakeFile;
+		size_t mMappedBakeFileSize;
+		const culling::PVSBakeFileHeader* mBakeFileHeader;
+		/// <summary>
+		/// Offsets of compressed bitsets from start of file ( cell count + 1 )
+		/// </summary>
+		const std::uint64_t* mCellBitsetOffsets;
+
+		/// <summary>
+		/// Cell of camera at this tick. EVERYCULLING_INVALID_CELL_INDEX : entities aren't culled
+		/// </summary>
+		culling::PerCameraArray<std::uint32_t> mCameraCellIndices;
+		/// <summary>
+		/// Cell whose bitset is decompressed to mVisibleEntityBitsets
+		/// </summary>
+		culling::PerCameraArray<std::uint32_t> mDecompressedCellIndices;
+		culling::PerCameraArray<std::vector<std::uint64_t>> mVisibleEntityBitsets;
+		/// <summary>
+		/// Cell of camera is found once per tick for each camera. Other threads wait until it's done
+		/// </summary>
+		culling::PerCameraArray<std::atomic<unsigned long long>> mCameraCellUpdatedTickCount;
+		std::mutex mCameraCellUpdateMutex;
+
+		void UpdateCameraCell(const size_t cameraIndex, const unsigned long long currentTickCount);
+		void DoPVSCulling(const size_t cameraIndex, culling::EntityBlock* const entityBlock);
+
+	public:
+
+		PVSCulling(EveryCulling* const everyCulling);
+		~PVSCulling();
+
+		/// <summary>
+		/// Map PVS bake file. Return false if the file can't be mapped or isn't valid bake file.
+		/// Don't call this while cull job is running
+		/// </summary>
+		bool LoadBakeFile(const char* const filePath);
+		/// <summary>
+		/// Don't call this while cull job is running
+		/// </summary>
+		void UnloadBakeFile();
+		EVERYCULLING_FORCE_INLINE bool IsBakeFileLoaded() const
+		{
+			return mBakeFileHeader != nullptr;
+		}
+
+		/// <summary>
+		/// Cell of camera at this tick. Valid after this module ran at this tick
+		/// </summary>
+		std::uint32_t GetCameraCellIndex(const size_t cameraIndex) const;
+
+		void OnSetCameraCount(const size_t cameraCount) override;
+		void CullBlockEntityJob(const size_t cameraIndex, const unsigned long long currentTickCount) override;
+		const char* GetCullingModuleName() const override;
+	};
+}
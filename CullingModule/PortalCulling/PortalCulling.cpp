@@ -0,0 +1,419 @@
+#include "PortalCulling.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+#include "../../DataType/Math/Common.h"
+#include "../../EveryCulling.h"
+#include "../ViewFrustumCulling/ViewFrustumCulling.h"
+#include "../ShadowCasterCulling/ShadowCasterCulling.h"
+
+namespace
+{
+	/// <summary>
+	/// Clip convex polygon by plane. Points farther than margin behind the plane are removed.
+	/// Return false if clipped polygon has more than capacity vertices
+	/// </summary>
+	bool ClipPolygonByPlane
+	(
+		const culling::Vec3* const srcVertices,
+		const size_t srcVertexCount,
+		const culling::Vec4& plane,
+		culling::Vec3* const dstVertices,
+		const size_t dstVertexCapacity,
+		size_t& outDstVertexCount
+	)
+	{
+		const culling::Vec3 planeNormal{ plane[0], plane[1], plane[2] };
+
+		outDstVertexCount = 0;
+		for (size_t vertexIndex = 0; vertexIndex < srcVertexCount; vertexIndex++)
+		{
+			const culling::Vec3& previousVertex = srcVertices[(vertexIndex + srcVertexCount - 1) % srcVertexCount];
+			const culling::Vec3& currentVertex = srcVertices[vertexIndex];
+			const float previousDistance = culling::Dot(planeNormal, previousVertex) + plane[3] + EVERYCULLING_BOUNDING_SPHRE_RADIUS_MARGIN;
+			const float currentDistance = culling::Dot(planeNormal, currentVertex) + plane[3] + EVERYCULLING_BOUNDING_SPHRE_RADIUS_MARGIN;
+
+			// Edge crosses the plane
+			if ((previousDistance >= 0.0f) != (currentDistance >= 0.0f))
+			{
+				if (outDstVertexCount == dstVertexCapacity)
+				{
+					return false;
+				}
+
+				const float t = previousDistance / (previousDistance - currentDistance);
+				const culling::Vec3 edge = currentVertex - previousVertex;
+				dstVertices[outDstVertexCount++] = culling::Vec3{ previousVertex.x + edge.x * t, previousVertex.y + edge.y * t, previousVertex.z + edge.z * t };
+			}
+
+			if (currentDistance >= 0.0f)
+			{
+				if (outDstVertexCount == dstVertexCapacity)
+				{
+					return false;
+				}
+
+				dstVertices[outDstVertexCount++] = currentVertex;
+			}
+		}
+
+		return true;
+	}
+}
+
+culling::PortalCulling::PortalCulling(EveryCulling* const everyCulling)
+	: CullingModule(everyCulling)
+{
+	IsEnabled = false;
+}
+
+void culling::PortalCulling::SetCellGraph(std::vector<culling::PortalCell> cells, std::vector<culling::Portal> portals)
+{
+	mCells = std::move(cells);
+	mPortals = std::move(portals);
+
+	const std::uint32_t cellCount = static_cast<std::uint32_t>(mCells.size());
+
+	// Plane of portal from Newell's method, robust to slightly non planar polygon
+	mPortalPlanes.resize(mPortals.size());
+	for (size_t portalIndex = 0; portalIndex < mPortals.size(); portalIndex++)
+	{
+		const std::vector<culling::Vec3>& vertices = mPortals[portalIndex].mVertices;
+		assert(vertices.size() >= 3);
+		assert(mPortals[portalIndex].mCellIndices[0] < cellCount && mPortals[portalIndex].mCellIndices[1] < cellCount);
+
+		culling::Vec3 normal{ 0.0f, 0.0f, 0.0f };
+		culling::Vec3 centroid{ 0.0f, 0.0f, 0.0f };
+		for (size_t vertexIndex = 0; vertexIndex < vertices.size(); vertexIndex++)
+		{
+			const culling::Vec3& currentVertex = vertices[vertexIndex];
+			const culling::Vec3& nextVertex = vertices[(vertexIndex + 1) % vertices.size()];
+			normal.x += (currentVertex.y - nextVertex.y) * (currentVertex.z + nextVertex.z);
+			normal.y += (currentVertex.z - nextVertex.z) * (currentVertex.x + nextVertex.x);
+			normal.z += (currentVertex.x - nextVertex.x) * (currentVertex.y + nextVertex.y);
+			centroid = centroid + currentVertex;
+		}
+
+		const float normalMagnitude = normal.magnitude();
+		assert(normalMagnitude > 0.0f);
+		normal = culling::Vec3{ normal.x / normalMagnitude, normal.y / normalMagnitude, normal.z / normalMagnitude };
+		centroid = culling::Vec3{ centroid.x / vertices.size(), centroid.y / vertices.size(), centroid.z / vertices.size() };
+
+		mPortalPlanes[portalIndex] = culling::Vec4{ normal.x, normal.y, normal.z, -culling::Dot(normal, centroid) };
+	}
+
+	// Portals of each cell are stored contiguously
+	mCellPortalOffsets.assign(cellCount + 1, 0);
+	for (const culling::Portal& portal : mPortals)
+	{
+		mCellPortalOffsets[portal.mCellIndices[0] + 1]++;
+		mCellPortalOffsets[portal.mCellIndices[1] + 1]++;
+	}
+	for (std::uint32_t cellIndex = 0; cellIndex < cellCount; cellIndex++)
+	{
+		mCellPortalOffsets[cellIndex + 1] += mCellPortalOffsets[cellIndex];
+	}
+
+	mCellPortalIndices.resize(mCellPortalOffsets[cellCount]);
+	std::vector<std::uint32_t> cellPortalCounts(cellCount, 0);
+	for (std::uint32_t portalIndex = 0; portalIndex < static_cast<std::uint32_t>(mPortals.size()); portalIndex++)
+	{
+		for (const std::uint32_t cellIndex : mPortals[portalIndex].mCellIndices)
+		{
+			mCellPortalIndices[mCellPortalOffsets[cellIndex] + cellPortalCounts[cellIndex]++] = portalIndex;
+		}
+	}
+
+	// Cell visibility is computed with new cell graph at next cull job
+	for (std::atomic<unsigned long long>& cellVisibilityUpdatedTickCount : mCellVisibilityUpdatedTickCount)
+	{
+		cellVisibilityUpdatedTickCount.store((unsigned long long)-1, std::memory_order_relaxed);
+	}
+}
+
+void culling::PortalCulling::SetCameraCellIndex(const size_t cameraIndex, const std::uint32_t cellIndex)
+{
+	assert(cameraIndex < mCameraCellIndices.size());
+
+	mCameraCellIndices[cameraIndex] = cellIndex;
+}
+
+bool culling::PortalCulling::GetIsCellVisible(const size_t cameraIndex, const std::uint32_t cellIndex) const
+{
+	assert(cellIndex < mCells.size());
+
+	return mIsCameraInCell[cameraIndex] == false || (mCellVisibleBitsets[cameraIndex][cellIndex / 64] & ((std::uint64_t)1 << (cellIndex % 64))) != 0;
+}
+
+std::uint32_t culling::PortalCulling::FindCameraCell(const size_t cameraIndex) const
+{
+	if (mCameraCellIndices[cameraIndex] < mCells.size())
+	{
+		return mCameraCellIndices[cameraIndex];
+	}
+
+	const culling::Vec3& cameraWorldPosition = mCullingSystem->GetCameraWorldPosition(cameraIndex);
+	for (std::uint32_t cellIndex = 0; cellIndex < static_cast<std::uint32_t>(mCells.size()); cellIndex++)
+	{
+		const culling::PortalCell& cell = mCells[cellIndex];
+		if
+		(
+			cameraWorldPosition.x >= cell.mAABBMinWorldPoint.x && cameraWorldPosition.x <= cell.mAABBMaxWorldPoint.x &&
+			cameraWorldPosition.y >= cell.mAABBMinWorldPoint.y && cameraWorldPosition.y <= cell.mAABBMaxWorldPoint.y &&
+			cameraWorldPosition.z >= cell.mAABBMinWorldPoint.z && cameraWorldPosition.z <= cell.mAABBMaxWorldPoint.z
+		)
+		{
+			return cellIndex;
+		}
+	}
+
+	return EVERYCULLING_INVALID_CELL_INDEX;
+}
+
+bool culling::PortalCulling::WalkCell
+(
+	const size_t cameraIndex,
+	const std::uint32_t cellIndex,
+	const ScreenRect& screenRect,
+	const culling::Vec4* const viewFrustumPlanes,
+	const std::uint32_t portalDepth,
+	size_t& leftCellVisitCount
+)
+{
+	mCellVisibleBitsets[cameraIndex][cellIndex / 64] |= (std::uint64_t)1 << (cellIndex % 64);
+
+	if (portalDepth >= EVERYCULLING_PORTAL_CULLING_MAX_PORTAL_DEPTH)
+	{
+		return true;
+	}
+
+	// Cell was already walked with bigger frustum from shorter or same length path. Walking it again doesn't find new visible cell.
+	// This also stops walking back through cells on the path, as rect only shrinks along a path
+	CellWalkRecord& cellWalkRecord = mCellWalkRecords[cameraIndex][cellIndex];
+	if
+	(
+		cellWalkRecord.mPortalDepth <= portalDepth &&
+		screenRect.mMinX >= cellWalkRecord.mScreenRect.mMinX && screenRect.mMinY >= cellWalkRecord.mScreenRect.mMinY &&
+		screenRect.mMaxX <= cellWalkRecord.mScreenRect.mMaxX && screenRect.mMaxY <= cellWalkRecord.mScreenRect.mMaxY
+	)
+	{
+		return true;
+	}
+
+	if (leftCellVisitCount == 0)
+	{
+		return false;
+	}
+	leftCellVisitCount--;
+
+	cellWalkRecord.mScreenRect = screenRect;
+	cellWalkRecord.mPortalDepth = portalDepth;
+
+	const culling::Vec3& cameraWorldPosition = mCullingSystem->GetCameraWorldPosition(cameraIndex);
+	const float cameraNearClipPlaneDistance = mCullingSystem->GetCameraNearClipPlaneDistance(cameraIndex);
+	const culling::Mat4x4& worldToClipSpaceMatrix = mCullingSystem->GetCameraViewProjectionMatrix(cameraIndex);
+
+	for (std::uint32_t cellPortalIndex = mCellPortalOffsets[cellIndex]; cellPortalIndex < mCellPortalOffsets[cellIndex + 1]; cellPortalIndex++)
+	{
+		const std::uint32_t portalIndex = mCellPortalIndices[cellPortalIndex];
+		const culling::Portal& portal = mPortals[portalIndex];
+		const std::uint32_t nextCellIndex = (portal.mCellIndices[0] == cellIndex) ? portal.mCellIndices[1] : portal.mCellIndices[0];
+
+		// Camera standing in the portal sees next cell with same frustum
+		const culling::Vec4& portalPlane = mPortalPlanes[portalIndex];
+		const float cameraDistanceToPortal = portalPlane[0] * cameraWorldPosition.x + portalPlane[1] * cameraWorldPosition.y + portalPlane[2] * cameraWorldPosition.z + portalPlane[3];
+		if (std::abs(cameraDistanceToPortal) < cameraNearClipPlaneDistance)
+		{
+			if (WalkCell(cameraIndex, nextCellIndex, screenRect, viewFrustumPlanes, portalDepth + 1, leftCellVisitCount) == false)
+			{
+				return false;
+			}
+			continue;
+		}
+
+		// Clip portal polygon by view frustum, so every vertex is in front of camera
+		culling::Vec3 clippedVertices[2][EVERYCULLING_PORTAL_CULLING_MAX_CLIPPED_VERTEX_COUNT];
+		size_t clippedVertexCount = portal.mVertices.size();
+		bool isClipped = clippedVertexCount <= EVERYCULLING_PORTAL_CULLING_MAX_CLIPPED_VERTEX_COUNT;
+		size_t clippedBufferIndex = 0;
+		if (isClipped == true)
+		{
+			std::copy(portal.mVertices.begin(), portal.mVertices.end(), clippedVertices[0]);
+		}
+		for (size_t planeIndex = 0; planeIndex < 6 && isClipped == true && clippedVertexCount >= 3; planeIndex++)
+		{
+			isClipped = ClipPolygonByPlane(clippedVertices[clippedBufferIndex], clippedVertexCount, viewFrustumPlanes[planeIndex], clippedVertices[clippedBufferIndex ^ 1], EVERYCULLING_PORTAL_CULLING_MAX_CLIPPED_VERTEX_COUNT, clippedVertexCount);
+			clippedBufferIndex ^= 1;
+		}
+
+		// Portal is outside of view frustum
+		if (isClipped == true && clippedVertexCount < 3)
+		{
+			continue;
+		}
+
+		// Too many vertices or vertex near camera plane. Frustum isn't narrowed, so next cell is still visible conservatively
+		ScreenRect portalScreenRect = screenRect;
+		if (isClipped == true)
+		{
+			ScreenRect projectedPortalRect{ std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), -std::numeric_limits<float>::max(), -std::numeric_limits<float>::max() };
+			bool isProjected = true;
+			for (size_t vertexIndex = 0; vertexIndex < clippedVertexCount; vertexIndex++)
+			{
+				const culling::Vec4 clipSpaceVertex = worldToClipSpaceMatrix * clippedVertices[clippedBufferIndex][vertexIndex];
+				if (clipSpaceVertex[3] <= std::numeric_limits<float>::epsilon())
+				{
+					isProjected = false;
+					break;
+				}
+
+				const float ndcX = clipSpaceVertex[0] / clipSpaceVertex[3];
+				const float ndcY = clipSpaceVertex[1] / clipSpaceVertex[3];
+				projectedPortalRect.mMinX = EVERYCULLING_MIN(projectedPortalRect.mMinX, ndcX);
+				projectedPortalRect.mMinY = EVERYCULLING_MIN(projectedPortalRect.mMinY, ndcY);
+				projectedPortalRect.mMaxX = EVERYCULLING_MAX(projectedPortalRect.mMaxX, ndcX);
+				projectedPortalRect.mMaxY = EVERYCULLING_MAX(projectedPortalRect.mMaxY, ndcY);
+			}
+
+			if (isProjected == true)
+			{
+				portalScreenRect.mMinX = EVERYCULLING_MAX(screenRect.mMinX, projectedPortalRect.mMinX);
+				portalScreenRect.mMinY = EVERYCULLING_MAX(screenRect.mMinY, projectedPortalRect.mMinY);
+				portalScreenRect.mMaxX = EVERYCULLING_MIN(screenRect.mMaxX, projectedPortalRect.mMaxX);
+				portalScreenRect.mMaxY = EVERYCULLING_MIN(screenRect.mMaxY, projectedPortalRect.mMaxY);
+			}
+		}
+
+		// Portal is outside of frustum of the path
+		if (portalScreenRect.mMinX > portalScreenRect.mMaxX || portalScreenRect.mMinY > portalScreenRect.mMaxY)
+		{
+			continue;
+		}
+
+		if (WalkCell(cameraIndex, nextCellIndex, portalScreenRect, viewFrustumPlanes, portalDepth + 1, leftCellVisitCount) == false)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void culling::PortalCulling::UpdateCellVisibility(const size_t cameraIndex, const unsigned long long currentTickCount)
+{
+	// Camera data can be updated after PreCullJob, so cell graph is walked at start of cull job
+	if (mCellVisibilityUpdatedTickCount[cameraIndex].load(std::memory_order_acquire) != currentTickCount)
+	{
+		// Cameras walk cell graph in parallel. They only write their own bitset and records
+		std::lock_guard<std::mutex> lock{ mCellVisibilityUpdateMutexes[cameraIndex] };
+
+		if (mCellVisibilityUpdatedTickCount[cameraIndex].load(std::memory_order_relaxed) != currentTickCount)
+		{
+			mCellVisibleBitsets[cameraIndex].assign((mCells.size() + 63) / 64, 0);
+
+			// Light of shadow view sees other cells than player at its position
+			const std::uint32_t cameraCellIndex = (mCullingSystem->mShadowCasterCulling->IsShadowView(cameraIndex) == true) ? EVERYCULLING_INVALID_CELL_INDEX : FindCameraCell(cameraIndex);
+			mIsCameraInCell[cameraIndex] = (cameraCellIndex != EVERYCULLING_INVALID_CELL_INDEX);
+
+			if (cameraCellIndex != EVERYCULLING_INVALID_CELL_INDEX)
+			{
+				culling::Vec4 viewFrustumPlanes[6];
+				const culling::Vec4* const simdFrustumPlanes = mCullingSystem->mViewFrustumCulling->GetSIMDPlanes()[cameraIndex].mFrustumPlanes;
+				for (size_t planeIndex = 0; planeIndex < 6; planeIndex++)
+				{
+					viewFrustumPlanes[planeIndex] = culling::GetPlaneOfSIMDPlanes(simdFrustumPlanes, planeIndex);
+				}
+
+				const CellWalkRecord notWalkedCellRecord{ ScreenRect{ 0.0f, 0.0f, 0.0f, 0.0f }, EVERYCULLING_PORTAL_CULLING_MAX_PORTAL_DEPTH + 1 };
+				mCellWalkRecords[cameraIndex].assign(mCells.size(), notWalkedCellRecord);
+
+				// Walk starts with whole screen
+				size_t leftCellVisitCount = EVERYCULLING_PORTAL_CULLING_MAX_CELL_VISIT_COUNT;
+				if (WalkCell(cameraIndex, cameraCellIndex, ScreenRect{ -1.0f, -1.0f, 1.0f, 1.0f }, viewFrustumPlanes, 0, leftCellVisitCount) == false)
+				{
+					// Cells not walked yet can be visible, so don't cull entities of the camera
+					mIsCameraInCell[cameraIndex] = false;
+				}
+			}
+
+			mCellVisibilityUpdatedTickCount[cameraIndex].store(currentTickCount, std::memory_order_release);
+		}
+	}
+}
+
+void culling::PortalCulling::DoPortalCulling
+(
+	const size_t cameraIndex,
+	culling::EntityBlock* const entityBlock
+)
+{
+	assert(entityBlock->mCurrentEntityCount != 0);
+
+	// Result of this module depends on camera position, so it isn't stored to temporal visible bitflag
+	if (entityBlock->IsAllEntitiesCulled(cameraIndex) == true)
+	{
+		return;
+	}
+
+	const std::uint64_t* const cellVisibleBitset = mCellVisibleBitsets[cameraIndex].data();
+	const size_t cellCount = mCells.size();
+	for (size_t entityIndex = 0; entityIndex < entityBlock->mCurrentEntityCount; entityIndex++)
+	{
+		// Entities not in any cell aren't culled
+		const std::uint32_t cellIndex = entityBlock->GetCellIndex(entityIndex);
+		if (cellIndex < cellCount && (cellVisibleBitset[cellIndex / 64] & ((std::uint64_t)1 << (cellIndex % 64))) == 0)
+		{
+			entityBlock->SetCulled(entityIndex, cameraIndex);
+		}
+	}
+}
+
+void culling::PortalCulling::CullBlockEntityJob(const size_t cameraIndex, const unsigned long long currentTickCount)
+{
+	UpdateCellVisibility(cameraIndex, currentTickCount);
+
+	if (mIsCameraInCell[cameraIndex] == false)
+	{
+		return;
+	}
+
+	while (true)
+	{
+		culling::EntityBlock* const nextEntityBlock = GetNextEntityBlock(cameraIndex);
+
+		if (nextEntityBlock != nullptr)
+		{
+			DoPortalCulling(cameraIndex, nextEntityBlock);
+		}
+		else
+		{
+			break;
+		}
+	}
+}
+
+const char* culling::PortalCulling::GetCullingModuleName() const
+{
+	return "PortalCulling";
+}
+
+void culling::PortalCulling::OnSetCameraCount(const size_t cameraCount)
+{
+	CullingModule::OnSetCameraCount(cameraCount);
+
+	const size_t previousCameraCount = mCameraCellIndices.size();
+	mCameraCellIndices.Resize(cameraCount);
+	for (size_t cameraIndex = previousCameraCount; cameraIndex < cameraCount; cameraIndex++)
+	{
+		mCameraCellIndices[cameraIndex] = EVERYCULLING_INVALID_CELL_INDEX;
+	}
+
+	mCellVisibleBitsets.Resize(cameraCount);
+	mCellWalkRecords.Resize(cameraCount);
+	mIsCameraInCell.Resize(cameraCount);
+	mCellVisibilityUpdatedTickCount.Resize(cameraCount);
+	mCellVisibilityUpdateMutexes.Resize(cameraCount);
+}
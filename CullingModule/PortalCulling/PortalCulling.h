@@ -0,0 +1,159 @@
+#pragma once
+
+#include "../../EveryCullingCore.h"
+
+#include "../../DataType/Math/Vector.h"
+#include "../../DataType/PerCameraArray.h"
+
+#include "../CullingModule.h"
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace culling
+{
+	/// <summary>
+	/// Cell ( room ) of cell graph of PortalCulling
+	/// </summary>
+	struct PortalCell
+	{
+		/// <summary>
+		/// Camera inside of this aabb is in this cell. First cell containing camera is picked
+		/// </summary>
+		culling::Vec3 mAABBMinWorldPoint;
+		culling::Vec3 mAABBMaxWorldPoint;
+	};
+
+	/// <summary>
+	/// Opening between two cells. Visible from both sides
+	/// </summary>
+	struct Portal
+	{
+		std::uint32_t mCellIndices[2];
+		/// <summary>
+		/// Vertices of convex planar polygon in order ( any winding )
+		/// </summary>
+		std::vector<culling::Vec3> mVertices;
+	};
+
+	/// <summary>
+	/// Cull entities in cells which can't be seen through portals from cell of camera.
+	///
+	/// Cell graph is walked from cell of camera once per camera per tick.
+	/// Portal polygon is clipped by view frustum and projected to screen space,
+	/// and frustum of next cell is narrowed to screen space rect of the path intersected with bounding rect of projected portal.
+	/// Cell reached again with rect inside of rect it was already walked with isn't walked again,
+	/// so cycles and many paths to a cell don't make the walk exponential.
+	/// Cells reached by the walk are visible. Entities in other cells are culled ( EntityBlockViewer::SetCellIndex ).
+	/// Entities not in any cell and every entity when camera isn't in any cell aren't culled.
+	/// If a walk visits cells more than EVERYCULLING_PORTAL_CULLING_MAX_CELL_VISIT_COUNT times, entities of the camera aren't culled at the tick.
+	///
+	/// Visibility of cells depends on camera position, so this module runs after modules storing temporal visible bitflag,
+	/// and before MaskedSWOcclusionCulling so occluders and occludees in culled cells aren't rasterized or queried.
+	///
+	/// This module is disabled by default. ( use EveryCulling::SetEnabledCullingModule )
+	/// </summary>
+	class PortalCulling : public CullingModule
+	{
+	private:
+
+		/// <summary>
+		/// Rect in NDC space. Empty if min is greater than max
+		/// </summary>
+		struct ScreenRect
+		{
+			float mMinX;
+			float mMinY;
+			float mMaxX;
+			float mMaxY;
+		};
+
+		/// <summary>
+		/// Rect a cell was walked with at this tick, and count of portals on the path to it
+		/// </summary>
+		struct CellWalkRecord
+		{
+			ScreenRect mScreenRect;
+			std::uint32_t mPortalDepth;
+		};
+
+		std::vector<culling::PortalCell> mCells;
+		std::vector<culling::Portal> mPortals;
+		/// <summary>
+		/// Plane of each portal
+		/// </summary>
+		std::vector<culling::Vec4> mPortalPlanes;
+		/// <summary>
+		/// Portals of cell i are mCellPortalIndices[mCellPortalOffsets[i], mCellPortalOffsets[i + 1])
+		/// </summary>
+		std::vector<std::uint32_t> mCellPortalOffsets;
+		std::vector<std::uint32_t> mCellPortalIndices;
+
+		/// <summary>
+		/// Cell of camera set by user. EVERYCULLING_INVALID_CELL_INDEX : found from aabb of cells
+		/// </summary>
+		culling::PerCameraArray<std::uint32_t> mCameraCellIndices;
+		/// <summary>
+		/// Bit of the cell is set if the cell is visible from the camera at this tick
+		/// </summary>
+		culling::PerCameraArray<std::vector<std::uint64_t>> mCellVisibleBitsets;
+		/// <summary>
+		/// mPortalDepth is EVERYCULLING_PORTAL_CULLING_MAX_PORTAL_DEPTH + 1 if the cell isn't walked yet
+		/// </summary>
+		culling::PerCameraArray<std::vector<CellWalkRecord>> mCellWalkRecords;
+		/// <summary>
+		/// Whether camera is in a cell at this tick. If not, entities aren't culled
+		/// </summary>
+		culling::PerCameraArray<bool> mIsCameraInCell;
+		/// <summary>
+		/// Cell graph is walked once per tick for each camera. Other threads of the camera wait until it's done
+		/// </summary>
+		culling::PerCameraArray<std::atomic<unsigned long long>> mCellVisibilityUpdatedTickCount;
+		culling::PerCameraArray<std::mutex> mCellVisibilityUpdateMutexes;
+
+		std::uint32_t FindCameraCell(const size_t cameraIndex) const;
+		void UpdateCellVisibility(const size_t cameraIndex, const unsigned long long currentTickCount);
+		/// <summary>
+		/// Return false if count of visited cells exceeds leftCellVisitCount
+		/// </summary>
+		bool WalkCell
+		(
+			const size_t cameraIndex,
+			const std::uint32_t cellIndex,
+			const ScreenRect& screenRect,
+			const culling::Vec4* const viewFrustumPlanes,
+			const std::uint32_t portalDepth,
+			size_t& leftCellVisitCount
+		);
+		void DoPortalCulling(const size_t cameraIndex, culling::EntityBlock* const entityBlock);
+
+	public:
+
+		PortalCulling(EveryCulling* const everyCulling);
+
+		/// <summary>
+		/// Set cell graph. Portal connects two cells in cells.
+		/// Don't call this while cull job is running
+		/// </summary>
+		void SetCellGraph(std::vector<culling::PortalCell> cells, std::vector<culling::Portal> portals);
+		/// <summary>
+		/// Set cell of camera instead of finding it from aabb of cells ( ex. overlapped cells ).
+		/// EVERYCULLING_INVALID_CELL_INDEX : find it from aabb of cells ( default )
+		/// </summary>
+		void SetCameraCellIndex(const size_t cameraIndex, const std::uint32_t cellIndex);
+
+		EVERYCULLING_FORCE_INLINE size_t GetCellCount() const
+		{
+			return mCells.size();
+		}
+		/// <summary>
+		/// Whether the cell is visible from the camera. Valid after this module ran at this tick
+		/// </summary>
+		bool GetIsCellVisible(const size_t cameraIndex, const std::uint32_t cellIndex) const;
+
+		void OnSetCameraCount(const size_t cameraCount) override;
+		void CullBlockEntityJob(const size_t cameraIndex, const unsigned long long currentTickCount) override;
+		const char* GetCullingModuleName() const override;
+	};
+}
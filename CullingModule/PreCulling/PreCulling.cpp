@@ -1,116 +1,119 @@
 #include "PreCulling.h"
 
-#include "../MaskedSWOcclusionCulling/Utility/vertexTransformationHelper.h"
+#include "../MaskedSWOcclusionCulling/DepthBufferKernel/DepthBufferKernel.h"
 #include "../MaskedSWOcclusionCulling/MaskedSWOcclusionCulling.h"
+#include "../DistanceCulling/DistanceCulling.h"
+#include "../ViewFrustumCulling/ViewFrustumCulling.h"
+#include "../MultiViewCulling/MultiViewCulling.h"
 
 #define SCREEN_SPACE_MIN_VALUE (float)-50000.0f
 #define SCREEN_SPACE_MAX_VALUE (float)50000.0f
 
-EVERYCULLING_FORCE_INLINE void culling::PreCulling::ComputeScreenSpaceMinMaxAABBAndMinZ
+int culling::PreCulling::ProjectAABBToScreenSpace
 (
 	const size_t cameraIndex,
-	culling::EntityBlock* const entityBlock, 
-	const size_t entityIndex
+	const culling::Vec4& aabbMinWorldPoint,
+	const culling::Vec4& aabbMaxWorldPoint,
+	float& outMinScreenSpacePointX,
+	float& outMinScreenSpacePointY,
+	float& outMaxScreenSpacePointX,
+	float& outMaxScreenSpacePointY,
+	float& outMinNDCZ
 )
 {
-	const culling::Vec4& aabbMinWorldPoint = entityBlock->mAABBMinWorldPoint[entityIndex];
-	const culling::Vec4& aabbMaxWorldPoint = entityBlock->mAABBMaxWorldPoint[entityIndex];
-
 	const culling::Mat4x4& worldToClipSpaceMatrix = mCullingSystem->GetCameraViewProjectionMatrix(cameraIndex);
-	
-	culling::EVERYCULLING_M256F aabbVertexX = _mm256_setr_ps(aabbMinWorldPoint.values[0], aabbMinWorldPoint.values[0], aabbMinWorldPoint.values[0], aabbMinWorldPoint.values[0], aabbMaxWorldPoint.values[0], aabbMaxWorldPoint.values[0], aabbMaxWorldPoint.values[0], aabbMaxWorldPoint.values[0]);
-	culling::EVERYCULLING_M256F aabbVertexY = _mm256_setr_ps(aabbMinWorldPoint.values[1], aabbMinWorldPoint.values[1], aabbMaxWorldPoint.values[1], aabbMaxWorldPoint.values[1], aabbMinWorldPoint.values[1], aabbMinWorldPoint.values[1], aabbMaxWorldPoint.values[1], aabbMaxWorldPoint.values[1]);
-	culling::EVERYCULLING_M256F aabbVertexZ = _mm256_setr_ps(aabbMinWorldPoint.values[2], aabbMaxWorldPoint.values[2], aabbMinWorldPoint.values[2], aabbMaxWorldPoint.values[2], aabbMinWorldPoint.values[2], aabbMaxWorldPoint.values[2], aabbMinWorldPoint.values[2], aabbMaxWorldPoint.values[2]);
-	culling::EVERYCULLING_M256F aabbVertexW;
-	
-	// Convert world space to clip space
-	culling::vertexTransformationHelper::TransformVertexToClipSpace
-	(
-		aabbVertexX,
-		aabbVertexY,
-		aabbVertexZ,
-		aabbVertexW,
-		worldToClipSpaceMatrix.data()
-	);
-
-	const culling::EVERYCULLING_M256F isHomogeneousWNegative = _mm256_cmp_ps(aabbVertexW, _mm256_set1_ps(std::numeric_limits<float>::epsilon()), _CMP_LT_OQ);
+	const culling::SWDepthBuffer& depthBuffer = mCullingSystem->mMaskedSWOcclusionCulling->mDepthBuffer;
 
-	const culling::EVERYCULLING_M256F oneDividedByW = culling::EVERYCULLING_M256F_DIV(_mm256_set1_ps(1.0f), aabbVertexW);
-
-	// Convert clip space to ndc space
-	culling::vertexTransformationHelper::ConvertClipSpaceVertexToNDCSpace
-	(
-		aabbVertexX,
-		aabbVertexY,
-		aabbVertexZ,
-		oneDividedByW
-	);
+	switch (mCullingSystem->GetSIMDInstructionSet())
+	{
+	case culling::SIMDInstructionSet::SSE4_1:
+		return culling::depthBufferKernel::ProjectAABBToScreenSpace_SSE4_1(aabbMinWorldPoint.values, aabbMaxWorldPoint.values, worldToClipSpaceMatrix.data(), depthBuffer, outMinScreenSpacePointX, outMinScreenSpacePointY, outMaxScreenSpacePointX, outMaxScreenSpacePointY, outMinNDCZ);
+	case culling::SIMDInstructionSet::AVX2:
+	case culling::SIMDInstructionSet::AVX512:
+	default:
+		return culling::depthBufferKernel::ProjectAABBToScreenSpace_AVX2(aabbMinWorldPoint.values, aabbMaxWorldPoint.values, worldToClipSpaceMatrix.data(), depthBuffer, outMinScreenSpacePointX, outMinScreenSpacePointY, outMaxScreenSpacePointX, outMaxScreenSpacePointY, outMinNDCZ);
+	}
+}
 
-	culling::EVERYCULLING_M256F screenPixelPosX, screenPixelPosY;
-	culling::vertexTransformationHelper::ConvertNDCSpaceVertexToScreenPixelSpace
+void culling::PreCulling::ComputeScreenSpaceMinMaxAABBAndMinZ
+(
+	const size_t cameraIndex,
+	culling::EntityBlock* const entityBlock, 
+	const size_t entityIndex
+)
+{
+	const int isHomogeneousWNegativeMask = ProjectAABBToScreenSpace
 	(
-		aabbVertexX,
-		aabbVertexY,
-		screenPixelPosX, 
-		screenPixelPosY, 
-		mCullingSystem->mMaskedSWOcclusionCulling->mDepthBuffer
+		cameraIndex,
+		entityBlock->mColdData->mAABBMinWorldPoint[entityIndex],
+		entityBlock->mColdData->mAABBMaxWorldPoint[entityIndex],
+		entityBlock->mAABBMinScreenSpacePointX[entityIndex],
+		entityBlock->mAABBMinScreenSpacePointY[entityIndex],
+		entityBlock->mAABBMaxScreenSpacePointX[entityIndex],
+		entityBlock->mAABBMaxScreenSpacePointY[entityIndex],
+		entityBlock->mAABBMinNDCZ[entityIndex]
 	);
 
+	entityBlock->SetIsAllAABBClipPointWPositive(entityIndex, (isHomogeneousWNegativeMask == 0x00000000));
+	entityBlock->SetIsAllAABBClipPointWNegative(entityIndex, (isHomogeneousWNegativeMask == 0x000000FF));
 
+	// If All vertex's w of clip space aabb is negative, it should be culled!
+	entityBlock->UpdateIsCulled(entityIndex, cameraIndex, isHomogeneousWNegativeMask == 0x000000FF);
 
-
-	// Compute min, max sreen space X, Y
-
-	
-	// Do clamp min, max screen space
-	float minX = std::numeric_limits<float>::max();
-	float minY = std::numeric_limits<float>::max();
-	float maxX = -std::numeric_limits<float>::max();
-	float maxY = -std::numeric_limits<float>::max();
-
-	// set max value to invalid vertex index
-	// this is for branchless codes
-	
-	screenPixelPosX = _mm256_blendv_ps(screenPixelPosX, _mm256_set1_ps(std::numeric_limits<float>::max()), isHomogeneousWNegative);
-	screenPixelPosY = _mm256_blendv_ps(screenPixelPosY, _mm256_set1_ps(std::numeric_limits<float>::max()), isHomogeneousWNegative);
-	for(int i = 0 ; i < 8 ; i++)
-	{
-		minX = EVERYCULLING_MIN(minX, reinterpret_cast<const float*>(&screenPixelPosX)[i]);
-		minY = EVERYCULLING_MIN(minY, reinterpret_cast<const float*>(&screenPixelPosY)[i]);
-	}
-	
-	screenPixelPosX = _mm256_blendv_ps(screenPixelPosX, _mm256_set1_ps(-std::numeric_limits<float>::max()), isHomogeneousWNegative);
-	screenPixelPosY = _mm256_blendv_ps(screenPixelPosY, _mm256_set1_ps(-std::numeric_limits<float>::max()), isHomogeneousWNegative);
-	for (int i = 0; i < 8; i++)
+	// Renderer reads LOD selected here instead of projecting visible entities again
+	if (entityBlock->GetLODCount(entityIndex) > 1)
 	{
-		maxX = EVERYCULLING_MAX(maxX, reinterpret_cast<const float*>(&screenPixelPosX)[i]);
-		maxY = EVERYCULLING_MAX(maxY, reinterpret_cast<const float*>(&screenPixelPosY)[i]);
+		SelectLOD(cameraIndex, entityBlock, entityIndex);
 	}
+}
 
-	entityBlock->mAABBMinScreenSpacePointX[entityIndex] = minX;
-	entityBlock->mAABBMinScreenSpacePointY[entityIndex] = minY;
-
-	entityBlock->mAABBMaxScreenSpacePointX[entityIndex] = maxX;
-	entityBlock->mAABBMaxScreenSpacePointY[entityIndex] = maxY;
-	
+void culling::PreCulling::SelectLOD
+(
+	const size_t cameraIndex,
+	culling::EntityBlock* const entityBlock,
+	const size_t entityIndex
+) const
+{
+#if EVERYCULLING_MAX_LOD_COUNT > 1
+	std::uint8_t& lodIndex = entityBlock->mLODIndices[cameraIndex][entityIndex];
 
-	// Compute min depth value
+	// Camera is inside or very close to aabb, so finest LOD
+	if (entityBlock->GetIsAllAABBClipPointWPositive(entityIndex) == false)
+	{
+		lodIndex = 0;
+		return;
+	}
 
-	aabbVertexZ = _mm256_blendv_ps(aabbVertexZ, _mm256_set1_ps(std::numeric_limits<float>::max()), isHomogeneousWNegative);
-	float aabbMinDepthValue = std::numeric_limits<float>::max();
-	for (size_t i = 0; i < 8; i++)
+	const float screenSpaceArea =
+		(entityBlock->mAABBMaxScreenSpacePointX[entityIndex] - entityBlock->mAABBMinScreenSpacePointX[entityIndex]) *
+		(entityBlock->mAABBMaxScreenSpacePointY[entityIndex] - entityBlock->mAABBMinScreenSpacePointY[entityIndex]);
+	const float* const lodScreenSpaceAreas = entityBlock->mColdData->mLODScreenSpaceAreas[entityIndex];
+	const size_t lodCount = entityBlock->GetLODCount(entityIndex);
+
+	// Thresholds are descending, so LOD is count of thresholds larger than the area.
+	// Finer LOD needs area larger than threshold * ( 1 + hysteresis ), coarser LOD needs area smaller than threshold * ( 1 - hysteresis ).
+	// LOD of last tick is kept while it's between them
+	std::uint8_t finestLODIndex = 0;
+	std::uint8_t coarsestLODIndex = 0;
+	for (size_t thresholdIndex = 0; thresholdIndex + 1 < lodCount; thresholdIndex++)
 	{
-		aabbMinDepthValue = EVERYCULLING_MIN(aabbMinDepthValue, reinterpret_cast<const float*>(&aabbVertexZ)[i]);
+		finestLODIndex += (screenSpaceArea < lodScreenSpaceAreas[thresholdIndex] * (1.0f - mLODHysteresis)) ? 1 : 0;
+		coarsestLODIndex += (screenSpaceArea < lodScreenSpaceAreas[thresholdIndex] * (1.0f + mLODHysteresis)) ? 1 : 0;
 	}
 
-	entityBlock->mAABBMinNDCZ[entityIndex] = aabbMinDepthValue;
+	lodIndex = EVERYCULLING_MIN(EVERYCULLING_MAX(lodIndex, finestLODIndex), coarsestLODIndex);
+#endif
+}
 
-	const int isHomogeneousWNegativeMask = _mm256_movemask_ps(isHomogeneousWNegative);
-	entityBlock->SetIsAllAABBClipPointWPositive(entityIndex, (isHomogeneousWNegativeMask == 0x00000000));
-	entityBlock->SetIsAllAABBClipPointWNegative(entityIndex, (isHomogeneousWNegativeMask == 0x000000FF));
+void culling::PreCulling::SetLODHysteresis(const float lodHysteresis)
+{
+	assert(lodHysteresis >= 0.0f && lodHysteresis < 1.0f);
+	mLODHysteresis = lodHysteresis;
+}
 
-	// If All vertex's w of clip space aabb is negative, it should be culled!
-	entityBlock->UpdateIsCulled(entityIndex, cameraIndex, isHomogeneousWNegativeMask == 0x000000FF);
+float culling::PreCulling::GetLODHysteresis() const
+{
+	return mLODHysteresis;
 }
 
 void culling::PreCulling::DoPreCull
@@ -119,6 +122,19 @@ void culling::PreCulling::DoPreCull
 	culling::EntityBlock* const entityBlock
 )
 {
+	// MultiViewCulling already did every other work for all cameras. Screen space aabb is shared by cameras, so it's projected here
+	if (mCullingSystem->mMultiViewCulling->IsEnabled == true)
+	{
+		for (size_t entityIndex = 0; entityIndex < entityBlock->mCurrentEntityCount; entityIndex++)
+		{
+			if (entityBlock->GetIsCulled(entityIndex, cameraIndex) == false)
+			{
+				ComputeScreenSpaceMinMaxAABBAndMinZ(cameraIndex, entityBlock, entityIndex);
+			}
+		}
+		return;
+	}
+
 	for(size_t entityIndex = 0 ; entityIndex < entityBlock->mCurrentEntityCount ; entityIndex++)
 	{
 		if(entityBlock->GetIsObjectEnabled(entityIndex) == false)
@@ -127,6 +143,18 @@ void culling::PreCulling::DoPreCull
 		}	
 	}
 
+	// Unchanged entities culled at last tick are not projected
+	if (mCullingSystem->IsTemporalVisibilityReusable(cameraIndex) == true)
+	{
+		entityBlock->ApplyTemporalVisibleBitflag(cameraIndex);
+	}
+
+	// Whole block is already culled by HierarchyCulling or every entity is disabled
+	if (entityBlock->IsAllEntitiesCulled(cameraIndex) == true)
+	{
+		return;
+	}
+
 	for (size_t entityIndex = 0; entityIndex < entityBlock->mCurrentEntityCount; entityIndex++)
 	{
 		if (entityBlock->GetIsObjectEnabled(entityIndex) == true)
@@ -134,10 +162,23 @@ void culling::PreCulling::DoPreCull
 			entityBlock->UpdateBoundingSphereRadius(entityIndex);
 		}
 	}
+	entityBlock->UpdateAggregateBoundingVolume(mCullingSystem->GetTickCount());
 
+	// Test aggregate bounding volume before projecting aabb of each entity
+	if
+	(
+		(mCullingSystem->mDistanceCulling->IsEnabled == true && mCullingSystem->mDistanceCulling->CheckIsEntityBlockCulled(cameraIndex, entityBlock) == true) ||
+		(mCullingSystem->mViewFrustumCulling->IsEnabled == true && mCullingSystem->mViewFrustumCulling->CheckIsEntityBlockCulled(cameraIndex, entityBlock) == true)
+	)
+	{
+		entityBlock->SetAllEntitiesCulled(cameraIndex);
+		return;
+	}
+
+	// Disabled entities and entities culled by HierarchyCulling are skipped
 	for (size_t entityIndex = 0; entityIndex < entityBlock->mCurrentEntityCount; entityIndex++)
 	{
-		if (entityBlock->GetIsObjectEnabled(entityIndex) == true)
+		if (entityBlock->GetIsCulled(entityIndex, cameraIndex) == false)
 		{
 			ComputeScreenSpaceMinMaxAABBAndMinZ(cameraIndex, entityBlock, entityIndex);
 		}
@@ -145,7 +186,7 @@ void culling::PreCulling::DoPreCull
 }
 
 culling::PreCulling::PreCulling(EveryCulling* frotbiteCullingSystem)
-	: CullingModule(frotbiteCullingSystem)
+	: CullingModule(frotbiteCullingSystem), mLODHysteresis{ 0.0f }
 {
 }
 
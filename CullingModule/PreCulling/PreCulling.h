@@ -10,22 +10,68 @@ namespace culling
 	{
 	private:
 
-		EVERYCULLING_FORCE_INLINE void ComputeScreenSpaceMinMaxAABBAndMinZ
+		/// <summary>
+		/// Ratio of LOD screen space area threshold added / subtracted before LOD is switched
+		/// </summary>
+		float mLODHysteresis;
+
+		void DoPreCull
+		(
+			const size_t cameraIndex,
+			culling::EntityBlock* const entityBlock
+		);
+
+		/// <summary>
+		/// Select LOD of entity for the camera from its screen space aabb, LOD table and LOD of last tick
+		/// </summary>
+		void SelectLOD
 		(
 			const size_t cameraIndex,
 			culling::EntityBlock* const entityBlock,
 			const size_t entityIndex
+		) const;
+
+	public:
+
+		PreCulling(EveryCulling* frotbiteCullingSystem);
+
+		/// <summary>
+		/// Project world space aabb to screen space of the camera.
+		/// Return mask of aabb vertices whose clip space w is negative ( 8 bit ).
+		/// Screen space aabb, min ndc z is computed only from vertices with positive w
+		/// </summary>
+		int ProjectAABBToScreenSpace
+		(
+			const size_t cameraIndex,
+			const culling::Vec4& aabbMinWorldPoint,
+			const culling::Vec4& aabbMaxWorldPoint,
+			float& outMinScreenSpacePointX,
+			float& outMinScreenSpacePointY,
+			float& outMaxScreenSpacePointX,
+			float& outMaxScreenSpacePointY,
+			float& outMinNDCZ
 		);
 
-		void DoPreCull
+		/// <summary>
+		/// Compute screen space aabb, min ndc z of aabb and sign of clip space w
+		/// If all vertex's w of clip space aabb is negative, entity is culled.
+		/// LOD of entity with LOD table is selected from the screen space aabb ( EntityBlockViewer::SetLODScreenSpaceAreas )
+		/// </summary>
+		void ComputeScreenSpaceMinMaxAABBAndMinZ
 		(
 			const size_t cameraIndex,
-			culling::EntityBlock* const entityBlock
+			culling::EntityBlock* const entityBlock,
+			const size_t entityIndex
 		);
 
-	public:
+		/// <summary>
+		/// LOD i is selected when screen space area gets larger than threshold of LOD i * ( 1 + hysteresis ),
+		/// and it's kept until screen space area gets smaller than threshold * ( 1 - hysteresis ).
+		/// 0 : LOD is selected from threshold only ( default ). Don't call this while cull job is running
+		/// </summary>
+		void SetLODHysteresis(const float lodHysteresis);
+		float GetLODHysteresis() const;
 
-		PreCulling(EveryCulling* frotbiteCullingSystem);
 		void CullBlockEntityJob(const size_t cameraIndex, const unsigned long long currentTickCount) override;
 		const char* GetCullingModuleName() const override;
 	};
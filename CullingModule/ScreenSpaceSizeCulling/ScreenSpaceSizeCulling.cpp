@@ -0,0 +1,94 @@
+#include "ScreenSpaceSizeCulling.h"
+
+#include <cassert>
+
+#include "../../EveryCulling.h"
+
+culling::ScreenSpaceSizeCulling::ScreenSpaceSizeCulling(EveryCulling* const everyCulling)
+	: CullingModule(everyCulling)
+{
+	IsEnabled = false;
+}
+
+void culling::ScreenSpaceSizeCulling::SetMinScreenSpaceSize(const size_t cameraIndex, const float minScreenSpaceSize)
+{
+	assert(cameraIndex < mMinScreenSpaceSizes.size());
+	assert(minScreenSpaceSize >= 0.0f);
+
+	mMinScreenSpaceSizes[cameraIndex] = minScreenSpaceSize;
+}
+
+float culling::ScreenSpaceSizeCulling::GetMinScreenSpaceSize(const size_t cameraIndex) const
+{
+	assert(cameraIndex < mMinScreenSpaceSizes.size());
+
+	return mMinScreenSpaceSizes[cameraIndex];
+}
+
+void culling::ScreenSpaceSizeCulling::DoScreenSpaceSizeCulling
+(
+	const size_t cameraIndex,
+	culling::EntityBlock* const entityBlock
+)
+{
+	assert(entityBlock->mCurrentEntityCount != 0);
+
+	// Result of this module depends on camera projection, so it isn't stored to temporal visible bitflag
+	if (entityBlock->IsAllEntitiesCulled(cameraIndex) == true)
+	{
+		return;
+	}
+
+	const float cameraMinScreenSpaceSize = mMinScreenSpaceSizes[cameraIndex];
+	for (size_t entityIndex = 0; entityIndex < entityBlock->mCurrentEntityCount; entityIndex++)
+	{
+		// Screen space aabb is projected only for entities not culled before PreCulling finished
+		if (entityBlock->GetIsCulled(entityIndex, cameraIndex) == true || entityBlock->GetIsAllAABBClipPointWPositive(entityIndex) == false)
+		{
+			continue;
+		}
+
+		const float screenSpaceWidth = entityBlock->mAABBMaxScreenSpacePointX[entityIndex] - entityBlock->mAABBMinScreenSpacePointX[entityIndex];
+		const float screenSpaceHeight = entityBlock->mAABBMaxScreenSpacePointY[entityIndex] - entityBlock->mAABBMinScreenSpacePointY[entityIndex];
+		const float minScreenSpaceSize = EVERYCULLING_MAX(cameraMinScreenSpaceSize, entityBlock->mMinScreenSpaceSizes[entityIndex]);
+
+		if (EVERYCULLING_MAX(screenSpaceWidth, screenSpaceHeight) < minScreenSpaceSize)
+		{
+			entityBlock->SetCulled(entityIndex, cameraIndex);
+		}
+	}
+}
+
+void culling::ScreenSpaceSizeCulling::CullBlockEntityJob(const size_t cameraIndex, const unsigned long long currentTickCount)
+{
+	while (true)
+	{
+		culling::EntityBlock* const nextEntityBlock = GetNextEntityBlock(cameraIndex);
+
+		if (nextEntityBlock != nullptr)
+		{
+			DoScreenSpaceSizeCulling(cameraIndex, nextEntityBlock);
+		}
+		else
+		{
+			break;
+		}
+	}
+}
+
+const char* culling::ScreenSpaceSizeCulling::GetCullingModuleName() const
+{
+	return "ScreenSpaceSizeCulling";
+}
+
+void culling::ScreenSpaceSizeCulling::OnSetCameraCount(const size_t cameraCount)
+{
+	CullingModule::OnSetCameraCount(cameraCount);
+
+	const size_t previousCameraCount = mMinScreenSpaceSizes.size();
+	mMinScreenSpaceSizes.Resize(cameraCount);
+	for (size_t cameraIndex = previousCameraCount; cameraIndex < cameraCount; cameraIndex++)
+	{
+		mMinScreenSpaceSizes[cameraIndex] = EVERYCULLING_DEFAULT_MIN_SCREEN_SPACE_SIZE;
+	}
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "../../EveryCullingCore.h"
+
+#include "../../DataType/PerCameraArray.h"
+
+#include "../CullingModule.h"
+
+namespace culling
+{
+	/// <summary>
+	/// Contribution culling.
+	/// Cull entities whose screen space aabb projected by PreCulling is smaller than min screen space size.
+	/// Size of entity is larger one of width, height of screen space aabb in pixels of depth buffer.
+	/// Min screen space size of entity is larger one of min screen space size of the camera and of the entity ( EntityBlockViewer::SetMinScreenSpaceSize ),
+	/// so shadow views can drop small casters more aggressively than player cameras.
+	///
+	/// This module runs before MaskedSWOcclusionCulling, so tiny clutter isn't chosen as occluder or queried.
+	/// Entities crossing near plane of camera aren't culled, as their screen space aabb isn't valid.
+	/// Result depends on camera projection, so this module runs after modules storing temporal visible bitflag.
+	///
+	/// This module is disabled by default. ( use EveryCulling::SetEnabledCullingModule )
+	/// </summary>
+	class ScreenSpaceSizeCulling : public CullingModule
+	{
+	private:
+
+		/// <summary>
+		/// Pixels of depth buffer
+		/// </summary>
+		culling::PerCameraArray<float> mMinScreenSpaceSizes;
+
+		void DoScreenSpaceSizeCulling(const size_t cameraIndex, culling::EntityBlock* const entityBlock);
+
+	public:
+
+		ScreenSpaceSizeCulling(EveryCulling* const everyCulling);
+
+		/// <summary>
+		/// Set min screen space size of entities seen from the camera in pixels of depth buffer.
+		/// Default value is EVERYCULLING_DEFAULT_MIN_SCREEN_SPACE_SIZE
+		/// </summary>
+		void SetMinScreenSpaceSize(const size_t cameraIndex, const float minScreenSpaceSize);
+		float GetMinScreenSpaceSize(const size_t cameraIndex) const;
+
+		void OnSetCameraCount(const size_t cameraCount) override;
+		void CullBlockEntityJob(const size_t cameraIndex, const unsigned long long currentTickCount) override;
+		const char* GetCullingModuleName() const override;
+	};
+}
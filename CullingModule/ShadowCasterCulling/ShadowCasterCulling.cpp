@@ -0,0 +1,210 @@
+#include "ShadowCasterCulling.h"
+
+#include <cassert>
+#include <limits>
+
+#include "../../DataType/Math/Common.h"
+#include "../../EveryCulling.h"
+#include "../EntityCullingKernel/EntityCullingKernel.h"
+
+namespace
+{
+	// Plane index of planes extracted by ExtractSIMDPlanesFromViewProjectionMatrix
+	constexpr size_t NEAR_PLANE_INDEX = 4;
+
+	// Every point is in front of this plane, so SIMD plane test never culls with it
+	const culling::Vec4 NEVER_CULLING_PLANE{ 0.0f, 0.0f, 0.0f, std::numeric_limits<float>::max() };
+}
+
+void culling::ShadowCasterCulling::UpdateShadowViewPlanes(const size_t cameraIndex)
+{
+	assert(IsShadowView(cameraIndex) == true);
+
+	const ShadowView& shadowView = mShadowViews[cameraIndex];
+	assert(shadowView.mReceiverCameraIndex < mCullingSystem->GetCameraCount());
+	assert(IsShadowView(shadowView.mReceiverCameraIndex) == false);
+
+	culling::SIMDFrustumPlanes* const frustumPlanes = mCullingSystem->mViewFrustumCulling->GetSIMDPlanes();
+
+	// Casters between directional light and near plane of the cascade cast shadow into the cascade
+	if (shadowView.mLightType == culling::ShadowLightType::Directional)
+	{
+		culling::SetPlaneOfSIMDPlanes(frustumPlanes[cameraIndex].mFrustumPlanes, NEAR_PLANE_INDEX, NEVER_CULLING_PLANE);
+	}
+
+	const culling::Vec4* const receiverPlanes = frustumPlanes[shadowView.mReceiverCameraIndex].mFrustumPlanes;
+	for (size_t planeIndex = 0; planeIndex < 6; planeIndex++)
+	{
+		const culling::Vec4 receiverPlane = culling::GetPlaneOfSIMDPlanes(receiverPlanes, planeIndex);
+		const culling::Vec3 planeNormal{ receiverPlane[0], receiverPlane[1], receiverPlane[2] };
+
+		// Shadow volume of caster behind the plane can't enter receiver frustum only if the light is in front of the plane.
+		// Directional light is at infinity in opposite of light direction
+		const bool isLightInFrontOfPlane = (shadowView.mLightType == culling::ShadowLightType::Directional) ?
+			(culling::Dot(planeNormal, shadowView.mLightDirection) <= 0.0f) :
+			(culling::Dot(planeNormal, shadowView.mLightWorldPosition) + receiverPlane[3] >= 0.0f);
+
+		culling::SetPlaneOfSIMDPlanes(mShadowVolumePlanes[cameraIndex].mFrustumPlanes, planeIndex, (isLightInFrontOfPlane == true) ? receiverPlane : NEVER_CULLING_PLANE);
+	}
+}
+
+culling::ShadowCasterCulling::ShadowCasterCulling(EveryCulling* const everyCulling)
+	: CullingModule(everyCulling)
+{
+	IsEnabled = false;
+}
+
+void culling::ShadowCasterCulling::SetShadowView
+(
+	const size_t cameraIndex,
+	const culling::ShadowLightType lightType,
+	const culling::Vec3& lightDirectionOrWorldPosition,
+	const size_t receiverCameraIndex
+)
+{
+	assert(cameraIndex < mShadowViews.size());
+	assert(cameraIndex != receiverCameraIndex);
+
+	if (lightType == culling::ShadowLightType::None)
+	{
+		ClearShadowView(cameraIndex);
+		return;
+	}
+
+	// Near plane of the camera may be changed
+	ClearShadowView(cameraIndex);
+
+	ShadowView& shadowView = mShadowViews[cameraIndex];
+	shadowView.mLightType = lightType;
+	shadowView.mReceiverCameraIndex = receiverCameraIndex;
+	if (lightType == culling::ShadowLightType::Directional)
+	{
+		const float magnitude = lightDirectionOrWorldPosition.magnitude();
+		assert(magnitude > 0.0f);
+		shadowView.mLightDirection = culling::Vec3{ lightDirectionOrWorldPosition.x / magnitude, lightDirectionOrWorldPosition.y / magnitude, lightDirectionOrWorldPosition.z / magnitude };
+	}
+	else
+	{
+		shadowView.mLightWorldPosition = lightDirectionOrWorldPosition;
+	}
+
+	UpdateShadowViewPlanes(cameraIndex);
+}
+
+void culling::ShadowCasterCulling::ClearShadowView(const size_t cameraIndex)
+{
+	assert(cameraIndex < mShadowViews.size());
+
+	// Culling result of last tick is computed with other planes
+	mCullingSystem->InvalidateTemporalVisibility();
+
+	// Restore near plane ignored for directional light
+	if (mShadowViews[cameraIndex].mLightType == culling::ShadowLightType::Directional)
+	{
+		culling::ExtractSIMDPlanesFromViewProjectionMatrix(mCullingSystem->GetCameraViewProjectionMatrix(cameraIndex), mCullingSystem->mViewFrustumCulling->GetSIMDPlanes()[cameraIndex].mFrustumPlanes, true);
+	}
+
+	mShadowViews[cameraIndex].mLightType = culling::ShadowLightType::None;
+}
+
+bool culling::ShadowCasterCulling::CheckIsEntityBlockCulled
+(
+	const size_t cameraIndex,
+	const culling::EntityBlock* const entityBlock
+) const
+{
+	return
+		entityBlock->IsAggregateBoundingVolumeValid(mCullingSystem->GetTickCount()) == true &&
+		culling::CheckIsAABBOutsideOfFrustum(entityBlock->mAggregateAABBMinWorldPoint, entityBlock->mAggregateAABBMaxWorldPoint, mShadowVolumePlanes[cameraIndex].mFrustumPlanes, 2.0f * EVERYCULLING_BOUNDING_SPHRE_RADIUS_MARGIN);
+}
+
+void culling::ShadowCasterCulling::DoShadowCasterCulling
+(
+	const size_t cameraIndex,
+	culling::EntityBlock* const entityBlock
+)
+{
+	assert(entityBlock->mCurrentEntityCount != 0);
+
+	// Result of this module depends on receiver camera too, so it isn't stored to temporal visible bitflag
+	if (entityBlock->IsAllEntitiesCulled(cameraIndex) == true)
+	{
+		return;
+	}
+
+	// Whole entity block is culled when aggregate bounding volume of the block is outside of shadow volume planes
+	if (CheckIsEntityBlockCulled(cameraIndex, entityBlock) == true)
+	{
+		entityBlock->SetAllEntitiesCulled(cameraIndex);
+		return;
+	}
+
+	const float* const eightPlanes = reinterpret_cast<const float*>(mShadowVolumePlanes[cameraIndex].mFrustumPlanes);
+	const float* const positionAndRadius = reinterpret_cast<const float*>(entityBlock->mWorldPositionAndWorldBoundingSphereRadius);
+
+	char* const visibleBitflag = entityBlock->GetVisibleBitflag(cameraIndex);
+	const size_t cameraBitIndex = culling::EntityBlock::GetCameraBitIndex(cameraIndex);
+
+	switch (mCullingSystem->GetSIMDInstructionSet())
+	{
+	case culling::SIMDInstructionSet::SSE4_1:
+		culling::entityCullingKernel::ViewFrustumCulling_SSE4_1(eightPlanes, positionAndRadius, visibleBitflag, entityBlock->mCurrentEntityCount, cameraBitIndex);
+		break;
+	case culling::SIMDInstructionSet::AVX512:
+		culling::entityCullingKernel::ViewFrustumCulling_AVX512(eightPlanes, positionAndRadius, visibleBitflag, entityBlock->mCurrentEntityCount, cameraBitIndex);
+		break;
+	case culling::SIMDInstructionSet::AVX2:
+	default:
+		culling::entityCullingKernel::ViewFrustumCulling_AVX2(eightPlanes, positionAndRadius, visibleBitflag, entityBlock->mCurrentEntityCount, cameraBitIndex);
+		break;
+	}
+}
+
+void culling::ShadowCasterCulling::CullBlockEntityJob(const size_t cameraIndex, const unsigned long long currentTickCount)
+{
+	if (IsShadowView(cameraIndex) == false)
+	{
+		return;
+	}
+
+	while (true)
+	{
+		culling::EntityBlock* const nextEntityBlock = GetNextEntityBlock(cameraIndex);
+
+		if (nextEntityBlock != nullptr)
+		{
+			DoShadowCasterCulling(cameraIndex, nextEntityBlock);
+		}
+		else
+		{
+			break;
+		}
+	}
+}
+
+const char* culling::ShadowCasterCulling::GetCullingModuleName() const
+{
+	return "ShadowCasterCulling";
+}
+
+void culling::ShadowCasterCulling::OnSetCameraCount(const size_t cameraCount)
+{
+	CullingModule::OnSetCameraCount(cameraCount);
+
+	mShadowViews.Resize(cameraCount);
+	mShadowVolumePlanes.Resize(cameraCount);
+}
+
+void culling::ShadowCasterCulling::OnSetViewProjectionMatrix(const size_t cameraIndex, const culling::Mat4x4& cameraViewProjectionMatrix)
+{
+	culling::CullingModule::OnSetViewProjectionMatrix(cameraIndex, cameraViewProjectionMatrix);
+
+	// ViewFrustumCulling already extracted planes of the camera ( it's before this module in EveryCulling::mUpdatedCullingModules )
+	for (size_t shadowViewIndex = 0; shadowViewIndex < mShadowViews.size(); shadowViewIndex++)
+	{
+		if (IsShadowView(shadowViewIndex) == true && (shadowViewIndex == cameraIndex || mShadowViews[shadowViewIndex].mReceiverCameraIndex == cameraIndex))
+		{
+			UpdateShadowViewPlanes(shadowViewIndex);
+		}
+	}
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "../../EveryCullingCore.h"
+
+#include "../../DataType/Math/Vector.h"
+#include "../../DataType/PerCameraArray.h"
+#include "../ViewFrustumCulling/ViewFrustumCulling.h"
+
+#include "../CullingModule.h"
+
+namespace culling
+{
+	enum class ShadowLightType
+	{
+		/// <summary>
+		/// Not a shadow view. Camera is culled as player camera
+		/// </summary>
+		None,
+		/// <summary>
+		/// Orthographic cascade of directional light
+		/// </summary>
+		Directional,
+		/// <summary>
+		/// Perspective frustum of spot light
+		/// </summary>
+		Spot,
+		/// <summary>
+		/// Perspective frustum of a face of point light cube map
+		/// </summary>
+		Point
+	};
+
+	/// <summary>
+	/// Cull shadow casters of shadow views ( directional light cascade, spot light, point light cube face ).
+	///
+	/// Shadow view is a camera whose view projection matrix is light's view projection matrix ( SetShadowView ).
+	/// ViewFrustumCulling ( or FusedCulling, MultiViewCulling, HierarchyCulling ) culls casters outside of light frustum of the camera.
+	/// Near plane of directional light cascade is ignored, so casters between light and cascade still cast shadow into the cascade.
+	///
+	/// Then this module culls casters whose shadow volume misses frustum of receiver camera ( player camera ).
+	/// Shadow volume of a caster is the caster extruded along light direction ( away from light position ).
+	/// It touches receiver frustum only if the caster is inside of convex hull of the light and receiver frustum.
+	/// Planes of receiver frustum which the light is in front of bound the hull,
+	/// so casters are tested against them with the SIMD plane test of ViewFrustumCulling.
+	/// Off-screen casters whose shadow falls into receiver frustum are kept.
+	/// The hull without silhouette planes is bigger than exact hull, so culling is conservative.
+	///
+	/// DistanceCulling of shadow view uses world position of the shadow view camera.
+	/// Set it to world position of receiver camera to cull casters by desired max draw distance from the player.
+	///
+	/// This module is disabled by default. ( use EveryCulling::SetEnabledCullingModule )
+	/// </summary>
+	class ShadowCasterCulling : public CullingModule
+	{
+	private:
+
+		struct ShadowView
+		{
+			culling::ShadowLightType mLightType = culling::ShadowLightType::None;
+			/// <summary>
+			/// Normalized direction light travels. Used by directional light
+			/// </summary>
+			culling::Vec3 mLightDirection{ 0.0f, 0.0f, 1.0f };
+			/// <summary>
+			/// World position of light. Used by spot, point light
+			/// </summary>
+			culling::Vec3 mLightWorldPosition{ 0.0f, 0.0f, 0.0f };
+			size_t mReceiverCameraIndex = 0;
+		};
+
+		culling::PerCameraArray<ShadowView> mShadowViews;
+		/// <summary>
+		/// Planes of receiver frustum which bound convex hull of the light and receiver frustum.
+		/// Other planes never cull
+		/// </summary>
+		culling::PerCameraArray<SIMDFrustumPlanes> mShadowVolumePlanes;
+
+		/// <summary>
+		/// Update planes of the shadow view from frustum planes of ViewFrustumCulling
+		/// </summary>
+		void UpdateShadowViewPlanes(const size_t cameraIndex);
+		void DoShadowCasterCulling(const size_t cameraIndex, culling::EntityBlock* const entityBlock);
+
+	public:
+
+		ShadowCasterCulling(EveryCulling* const everyCulling);
+
+		/// <summary>
+		/// Make the camera a shadow view of the light.
+		/// lightDirectionOrWorldPosition is direction light travels for directional light, and world position of light for spot, point light.
+		/// Receiver camera should be a camera which isn't a shadow view.
+		/// Call this again when the light moves. Don't call this while cull job is running
+		/// </summary>
+		void SetShadowView(const size_t cameraIndex, const culling::ShadowLightType lightType, const culling::Vec3& lightDirectionOrWorldPosition, const size_t receiverCameraIndex);
+		/// <summary>
+		/// Make the camera a player camera again. Don't call this while cull job is running
+		/// </summary>
+		void ClearShadowView(const size_t cameraIndex);
+
+		EVERYCULLING_FORCE_INLINE bool IsShadowView(const size_t cameraIndex) const
+		{
+			return mShadowViews[cameraIndex].mLightType != culling::ShadowLightType::None;
+		}
+
+		/// <summary>
+		/// Check if aggregate bounding volume of the entity block is outside of shadow volume planes.
+		/// Return false if aggregate bounding volume isn't computed at this tick
+		/// </summary>
+		bool CheckIsEntityBlockCulled(const size_t cameraIndex, const culling::EntityBlock* const entityBlock) const;
+
+		void OnSetViewProjectionMatrix(const size_t cameraIndex, const culling::Mat4x4& cameraViewProjectionMatrix) override;
+		void OnSetCameraCount(const size_t cameraCount) override;
+
+		void CullBlockEntityJob(const size_t cameraIndex, const unsigned long long currentTickCount) override;
+		const char* GetCullingModuleName() const override;
+	};
+}
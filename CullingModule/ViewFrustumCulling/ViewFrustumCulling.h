@@ -24,13 +24,9 @@ namespace culling
 	{
 	private:
 
-		SIMDFrustumPlanes mSIMDFrustumPlanes[EVERYCULLING_MAX_CAMERA_COUNT];
+		culling::PerCameraArray<SIMDFrustumPlanes> mSIMDFrustumPlanes;
 
-		
-		//TODO : Add AVX2(__m256) version of this function
-		char CheckInFrustumSIMDWithTwoPoint(const Vec4* eightPlanes, const Position_BoundingSphereRadius* twoPoint);
-		
-		void DoViewFrustumCulling
+		void DoViewFrustumCullingOfEntities
 		(
 			const size_t cameraIndex,
 			culling::EntityBlock* const entityBlock
@@ -47,12 +43,28 @@ namespace culling
 		/// <param name="cameraIndex"></param>
 		/// <param name="viewProjectionMatix"></param>
 		virtual void OnSetViewProjectionMatrix(const size_t cameraIndex, const culling::Mat4x4& cameraViewProjectionMatrix) final;
+		void OnSetCameraCount(const size_t cameraCount) override;
 
 		EVERYCULLING_FORCE_INLINE culling::SIMDFrustumPlanes* GetSIMDPlanes()
 		{
-			return mSIMDFrustumPlanes;
+			return mSIMDFrustumPlanes.begin();
 		}
 
+		/// <summary>
+		/// Check if aggregate bounding volume of the entity block is outside of frustum.
+		/// Return false if aggregate bounding volume isn't computed at this tick
+		/// </summary>
+		bool CheckIsEntityBlockCulled(const size_t cameraIndex, const culling::EntityBlock* const entityBlock) const;
+
+		/// <summary>
+		/// Cull entities of the entity block with kernel of SIMD instruction set selected by EveryCulling
+		/// </summary>
+		void DoViewFrustumCulling
+		(
+			const size_t cameraIndex,
+			culling::EntityBlock* const entityBlock
+		);
+
 		virtual void CullBlockEntityJob(const size_t cameraIndex, const unsigned long long currentTickCount);
 		const char* GetCullingModuleName() const override;
 	};
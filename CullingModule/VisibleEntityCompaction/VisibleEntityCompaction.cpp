@@ -0,0 +1,191 @@
+#include "VisibleEntityCompaction.h"
+
+#include "../../EveryCulling.h"
+#include "../EntityCullingKernel/EntityCullingKernel.h"
+
+size_t culling::VisibleEntityCompaction::CompactVisibleEntities
+(
+	const size_t cameraIndex,
+	const culling::EntityBlock* const entityBlock,
+	std::uint64_t* const outUserDatas
+) const
+{
+	const std::uint64_t* const userDatas = entityBlock->mColdData->mUserDatas;
+
+	const char* const visibleBitflag = entityBlock->GetVisibleBitflag(cameraIndex);
+	const size_t cameraBitIndex = culling::EntityBlock::GetCameraBitIndex(cameraIndex);
+
+	switch (mCullingSystem->GetSIMDInstructionSet())
+	{
+	case culling::SIMDInstructionSet::SSE4_1:
+		return culling::entityCullingKernel::CompactVisibleEntities_SSE4_1(visibleBitflag, userDatas, entityBlock->mCurrentEntityCount, cameraBitIndex, outUserDatas);
+	case culling::SIMDInstructionSet::AVX512:
+		return culling::entityCullingKernel::CompactVisibleEntities_AVX512(visibleBitflag, userDatas, entityBlock->mCurrentEntityCount, cameraBitIndex, outUserDatas);
+	case culling::SIMDInstructionSet::AVX2:
+	default:
+		return culling::entityCullingKernel::CompactVisibleEntities_AVX2(visibleBitflag, userDatas, entityBlock->mCurrentEntityCount, cameraBitIndex, outUserDatas);
+	}
+}
+
+culling::VisibleEntityCompaction::VisibleEntityCompaction(EveryCulling* const everyCulling)
+	: CullingModule(everyCulling)
+{
+	IsEnabled = false;
+}
+
+void culling::VisibleEntityCompaction::ResetCullingModule(const unsigned long long currentTickCount)
+{
+	CullingModule::ResetCullingModule(currentTickCount);
+
+	if (IsEnabled == false)
+	{
+		return;
+	}
+
+	// A chunk is closed when it can't hold whole entity block, so each chunk holds at least ( capacity - entity count in block ) entities
+	// except last chunk of each thread
+	constexpr size_t minFilledEntityCount = EVERYCULLING_VISIBLE_ENTITY_CHUNK_CAPACITY - EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK + 1;
+	const size_t entityCount = mCullingSystem->GetActiveEntityBlockCount() * EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK;
+	const size_t chunkCount = (entityCount + minFilledEntityCount - 1) / minFilledEntityCount + EVERYCULLING_MAX_THREAD_COUNT;
+
+	for (VisibleEntityList& visibleEntityList : mVisibleEntityLists)
+	{
+		// Only grow. Entries of buffer are written before read
+		if (visibleEntityList.mChunkVisibleEntityCounts.size() < chunkCount)
+		{
+			visibleEntityList.mUserDatas.resize(chunkCount * EVERYCULLING_VISIBLE_ENTITY_CHUNK_CAPACITY);
+			visibleEntityList.mChunkVisibleEntityCounts.resize(chunkCount);
+		}
+
+		visibleEntityList.mUsedChunkCount.store(0, std::memory_order_relaxed);
+		visibleEntityList.mOverflowUserDatas.clear();
+	}
+}
+
+void culling::VisibleEntityCompaction::OnSetCameraCount(const size_t cameraCount)
+{
+	CullingModule::OnSetCameraCount(cameraCount);
+
+	mVisibleEntityLists.Resize(cameraCount);
+}
+
+void culling::VisibleEntityCompaction::CullBlockEntityJob(const size_t cameraIndex, const unsigned long long currentTickCount)
+{
+	VisibleEntityList& visibleEntityList = mVisibleEntityLists[cameraIndex];
+	const size_t chunkCount = visibleEntityList.mChunkVisibleEntityCounts.size();
+
+	std::uint32_t chunkIndex = 0;
+	std::uint64_t* chunkUserDatas = nullptr;
+	size_t chunkVisibleEntityCount = 0;
+	bool isOverflowed = false;
+
+	while (true)
+	{
+		const culling::EntityBlock* const nextEntityBlock = GetNextEntityBlock(cameraIndex);
+
+		if (nextEntityBlock == nullptr)
+		{
+			break;
+		}
+
+		if (nextEntityBlock->IsAllEntitiesCulled(cameraIndex) == true)
+		{
+			continue;
+		}
+
+		if (isOverflowed == false && (chunkUserDatas == nullptr || chunkVisibleEntityCount > EVERYCULLING_VISIBLE_ENTITY_CHUNK_CAPACITY - EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK))
+		{
+			if (chunkUserDatas != nullptr)
+			{
+				visibleEntityList.mChunkVisibleEntityCounts[chunkIndex] = static_cast<std::uint32_t>(chunkVisibleEntityCount);
+			}
+
+			chunkIndex = visibleEntityList.mUsedChunkCount.fetch_add(1, std::memory_order_relaxed);
+			if (chunkIndex < chunkCount)
+			{
+				chunkUserDatas = visibleEntityList.mUserDatas.data() + static_cast<size_t>(chunkIndex) * EVERYCULLING_VISIBLE_ENTITY_CHUNK_CAPACITY;
+				chunkVisibleEntityCount = 0;
+			}
+			else
+			{
+				chunkUserDatas = nullptr;
+				isOverflowed = true;
+			}
+		}
+
+		if (isOverflowed == false)
+		{
+			chunkVisibleEntityCount += CompactVisibleEntities(cameraIndex, nextEntityBlock, chunkUserDatas + chunkVisibleEntityCount);
+		}
+		else
+		{
+			std::uint64_t userDatas[EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK];
+			const size_t visibleEntityCount = CompactVisibleEntities(cameraIndex, nextEntityBlock, userDatas);
+
+			std::scoped_lock<std::mutex> lock{ visibleEntityList.mOverflowMutex };
+			visibleEntityList.mOverflowUserDatas.insert(visibleEntityList.mOverflowUserDatas.end(), userDatas, userDatas + visibleEntityCount);
+		}
+	}
+
+	if (chunkUserDatas != nullptr)
+	{
+		visibleEntityList.mChunkVisibleEntityCounts[chunkIndex] = static_cast<std::uint32_t>(chunkVisibleEntityCount);
+	}
+}
+
+const char* culling::VisibleEntityCompaction::GetCullingModuleName() const
+{
+	return "VisibleEntityCompaction";
+}
+
+size_t culling::VisibleEntityCompaction::GetVisibleEntityChunkCount(const size_t cameraIndex) const
+{
+	assert(cameraIndex < mVisibleEntityLists.size());
+
+	const VisibleEntityList& visibleEntityList = mVisibleEntityLists[cameraIndex];
+	const size_t chunkCount = EVERYCULLING_MIN(static_cast<size_t>(visibleEntityList.mUsedChunkCount.load(std::memory_order_acquire)), visibleEntityList.mChunkVisibleEntityCounts.size());
+
+	// Overflowed entities are returned as last chunk
+	return chunkCount + ((visibleEntityList.mOverflowUserDatas.empty() == false) ? 1 : 0);
+}
+
+culling::VisibleEntityChunk culling::VisibleEntityCompaction::GetVisibleEntityChunk(const size_t cameraIndex, const size_t chunkIndex) const
+{
+	assert(chunkIndex < GetVisibleEntityChunkCount(cameraIndex));
+
+	const VisibleEntityList& visibleEntityList = mVisibleEntityLists[cameraIndex];
+	const size_t chunkCount = EVERYCULLING_MIN(static_cast<size_t>(visibleEntityList.mUsedChunkCount.load(std::memory_order_acquire)), visibleEntityList.mChunkVisibleEntityCounts.size());
+
+	if (chunkIndex < chunkCount)
+	{
+		return VisibleEntityChunk{ visibleEntityList.mUserDatas.data() + chunkIndex * EVERYCULLING_VISIBLE_ENTITY_CHUNK_CAPACITY, visibleEntityList.mChunkVisibleEntityCounts[chunkIndex] };
+	}
+	else
+	{
+		return VisibleEntityChunk{ visibleEntityList.mOverflowUserDatas.data(), visibleEntityList.mOverflowUserDatas.size() };
+	}
+}
+
+size_t culling::VisibleEntityCompaction::GetVisibleEntityCount(const size_t cameraIndex) const
+{
+	size_t visibleEntityCount = 0;
+	const size_t chunkCount = GetVisibleEntityChunkCount(cameraIndex);
+	for (size_t chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++)
+	{
+		visibleEntityCount += GetVisibleEntityChunk(cameraIndex, chunkIndex).mVisibleEntityCount;
+	}
+	return visibleEntityCount;
+}
+
+void culling::VisibleEntityCompaction::CopyVisibleEntities(const size_t cameraIndex, std::vector<std::uint64_t>& outUserDatas) const
+{
+	outUserDatas.clear();
+	outUserDatas.reserve(GetVisibleEntityCount(cameraIndex));
+
+	const size_t chunkCount = GetVisibleEntityChunkCount(cameraIndex);
+	for (size_t chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++)
+	{
+		const VisibleEntityChunk visibleEntityChunk = GetVisibleEntityChunk(cameraIndex, chunkIndex);
+		outUserDatas.insert(outUserDatas.end(), visibleEntityChunk.mUserDatas, visibleEntityChunk.mUserDatas + visibleEntityChunk.mVisibleEntityCount);
+	}
+}
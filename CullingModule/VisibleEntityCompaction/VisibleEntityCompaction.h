@@ -0,0 +1,82 @@
+#pragma once
+
+#include "../../EveryCullingCore.h"
+
+#include "../CullingModule.h"
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace culling
+{
+	/// <summary>
+	/// Visible entities written by a cull job thread at once
+	/// </summary>
+	struct VisibleEntityChunk
+	{
+		/// <summary>
+		/// User data of visible entities ( EntityBlockViewer::SetUserData )
+		/// </summary>
+		const std::uint64_t* mUserDatas;
+		size_t mVisibleEntityCount;
+	};
+
+	/// <summary>
+	/// Write user data of entities visible from each camera to compact array at end of cull job,
+	/// so renderer walks only visible entities instead of testing visibility bit of every entity.
+	///
+	/// Each cull job thread claims chunk of EVERYCULLING_VISIBLE_ENTITY_CHUNK_CAPACITY entries and
+	/// compacts user data of visible entities of an entity block into it with SIMD ( stream compaction ).
+	/// Threads don't share chunks, so there is no synchronization per entity block.
+	/// Order of visible entities is different every frame because chunks are claimed by threads in any order.
+	///
+	/// This module is disabled by default. ( use EveryCulling::SetEnabledCullingModule )
+	/// Result is valid after cull job of the camera is finished until next PreCullJob
+	/// </summary>
+	class VisibleEntityCompaction : public CullingModule
+	{
+	private:
+
+		struct VisibleEntityList
+		{
+			/// <summary>
+			/// Chunk i is mUserDatas[i * EVERYCULLING_VISIBLE_ENTITY_CHUNK_CAPACITY, (i + 1) * EVERYCULLING_VISIBLE_ENTITY_CHUNK_CAPACITY)
+			/// </summary>
+			std::vector<std::uint64_t> mUserDatas;
+			std::vector<std::uint32_t> mChunkVisibleEntityCounts;
+			std::atomic<std::uint32_t> mUsedChunkCount;
+
+			/// <summary>
+			/// Used when every chunk is claimed ( ex. more threads than EVERYCULLING_MAX_THREAD_COUNT ran cull job )
+			/// </summary>
+			std::mutex mOverflowMutex;
+			std::vector<std::uint64_t> mOverflowUserDatas;
+		};
+
+		culling::PerCameraArray<VisibleEntityList> mVisibleEntityLists;
+
+		size_t CompactVisibleEntities(const size_t cameraIndex, const culling::EntityBlock* const entityBlock, std::uint64_t* const outUserDatas) const;
+
+	public:
+
+		VisibleEntityCompaction(EveryCulling* const everyCulling);
+
+		void ResetCullingModule(const unsigned long long currentTickCount) override;
+		void OnSetCameraCount(const size_t cameraCount) override;
+		void CullBlockEntityJob(const size_t cameraIndex, const unsigned long long currentTickCount) override;
+		const char* GetCullingModuleName() const override;
+
+		/// <summary>
+		/// Count of chunks of visible entities of the camera. Call after cull job of the camera is finished
+		/// </summary>
+		size_t GetVisibleEntityChunkCount(const size_t cameraIndex) const;
+		VisibleEntityChunk GetVisibleEntityChunk(const size_t cameraIndex, const size_t chunkIndex) const;
+		size_t GetVisibleEntityCount(const size_t cameraIndex) const;
+		/// <summary>
+		/// Copy user data of every visible entity of the camera to outUserDatas
+		/// </summary>
+		void CopyVisibleEntities(const size_t cameraIndex, std::vector<std::uint64_t>& outUserDatas) const;
+	};
+}
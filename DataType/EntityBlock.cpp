@@ -1,12 +1,147 @@
 #include "EntityBlock.h"
 
+#include <cfloat>
+#include <cstring>
+
 void culling::EntityBlock::ClearEntityBlock()
 {
 	mCurrentEntityCount = 0;
+	mAllocatedEntityCount.store(0, std::memory_order_relaxed);
+	mRemovedEntityMask.store(0, std::memory_order_relaxed);
+	bIsBoundingVolumeDirty = true;
+	// Entities allocated at this block aren't culled until next PreCullJob
+	std::memset(mIsVisibleBitflag, 0xFF, sizeof(mIsVisibleBitflag));
+	mChangedEntityMask.store(0xFFFF, std::memory_order_relaxed);
+	mChangedEntityMaskOfLastTick = 0xFFFF;
 	
 	for(size_t entityIndex = 0 ; entityIndex < EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK ; entityIndex++)
 	{
-		mDesiredMaxDrawDistance[entityIndex] = (float)EVERYCULLING_DEFAULT_DESIRED_MAX_DRAW_DISTANCE;
+		ClearEntityData(entityIndex);
 	}
+
+	mAggregateBoundingVolumeTickCount = (unsigned long long)-1;
 	
 }
+
+void culling::EntityBlock::ClearEntityData(const size_t entityIndex)
+{
+	assert(entityIndex < EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK);
+
+	mColdData->mVertexDatas[entityIndex].mVertices = nullptr;
+	mColdData->mVertexDatas[entityIndex].mVerticeCount = 0;
+	mColdData->mVertexDatas[entityIndex].mIndices = nullptr;
+	mColdData->mVertexDatas[entityIndex].mIndiceCount = 0;
+	mColdData->mVertexDatas[entityIndex].mCoarseMeshLODCount = 0;
+	mColdData->mVertexDatas[entityIndex].mCoarseMeshLODs = nullptr;
+	mDesiredMaxDrawDistance[entityIndex] = (float)EVERYCULLING_DEFAULT_DESIRED_MAX_DRAW_DISTANCE;
+	mColdData->mEntityBlockViewers[entityIndex] = nullptr;
+	mColdData->mUserDatas[entityIndex] = 0;
+	mCellIndices[entityIndex] = EVERYCULLING_INVALID_CELL_INDEX;
+	mPVSIndices[entityIndex] = EVERYCULLING_INVALID_PVS_INDEX;
+	mMinScreenSpaceSizes[entityIndex] = 0.0f;
+#if EVERYCULLING_MAX_LOD_COUNT > 1
+	mColdData->mLODCounts[entityIndex] = 1;
+	for (size_t cameraIndex = 0; cameraIndex < EVERYCULLING_MAX_CAMERA_COUNT; cameraIndex++)
+	{
+		mLODIndices[cameraIndex][entityIndex] = 0;
+	}
+#endif
+}
+
+void culling::EntityBlock::UpdateAggregateBoundingVolume(const unsigned long long currentTickCount)
+{
+	// Threads of other cameras can read aggregate bounding volume of this block now,
+	// so compute it at local variables and write final value only
+	culling::Vec3 aabbMinWorldPoint{ FLT_MAX, FLT_MAX, FLT_MAX };
+	culling::Vec3 aabbMaxWorldPoint{ -FLT_MAX, -FLT_MAX, -FLT_MAX };
+	float maxDesiredMaxDrawDistance = 0.0f;
+
+	for (size_t entityIndex = 0; entityIndex < mCurrentEntityCount; entityIndex++)
+	{
+		if (GetIsObjectEnabled(entityIndex) == true)
+		{
+			const culling::Vec3& position = mWorldPositionAndWorldBoundingSphereRadius[entityIndex].GetPosition();
+			const float radius = mWorldPositionAndWorldBoundingSphereRadius[entityIndex].GetBoundingSphereRadius();
+
+			// Sphere is used by DistanceCulling, ViewFrustumCulling and aabb is used by QueryOccludeeStage.
+			// Aabb isn't always inside of sphere when position isn't center of aabb
+			const culling::Vec4& entityAABBMinWorldPoint = mColdData->mAABBMinWorldPoint[entityIndex];
+			const culling::Vec4& entityAABBMaxWorldPoint = mColdData->mAABBMaxWorldPoint[entityIndex];
+
+			aabbMinWorldPoint.x = EVERYCULLING_MIN3(aabbMinWorldPoint.x, position.x - radius, entityAABBMinWorldPoint[0]);
+			aabbMinWorldPoint.y = EVERYCULLING_MIN3(aabbMinWorldPoint.y, position.y - radius, entityAABBMinWorldPoint[1]);
+			aabbMinWorldPoint.z = EVERYCULLING_MIN3(aabbMinWorldPoint.z, position.z - radius, entityAABBMinWorldPoint[2]);
+			aabbMaxWorldPoint.x = EVERYCULLING_MAX3(aabbMaxWorldPoint.x, position.x + radius, entityAABBMaxWorldPoint[0]);
+			aabbMaxWorldPoint.y = EVERYCULLING_MAX3(aabbMaxWorldPoint.y, position.y + radius, entityAABBMaxWorldPoint[1]);
+			aabbMaxWorldPoint.z = EVERYCULLING_MAX3(aabbMaxWorldPoint.z, position.z + radius, entityAABBMaxWorldPoint[2]);
+			maxDesiredMaxDrawDistance = EVERYCULLING_MAX(maxDesiredMaxDrawDistance, mDesiredMaxDrawDistance[entityIndex]);
+		}
+	}
+
+	mAggregateAABBMinWorldPoint = aabbMinWorldPoint;
+	mAggregateAABBMaxWorldPoint = aabbMaxWorldPoint;
+	mAggregateMaxDesiredMaxDrawDistance = maxDesiredMaxDrawDistance;
+	mAggregateBoundingVolumeTickCount = currentTickCount;
+}
+
+void culling::EntityBlock::CopyEntityData(const size_t entityIndex, const EntityBlock& srcEntityBlock, const size_t srcEntityIndex)
+{
+	assert(entityIndex < EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK);
+	assert(srcEntityIndex < EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK);
+
+	for (size_t cameraGroupIndex = 0; cameraGroupIndex < EVERYCULLING_CAMERA_GROUP_COUNT; cameraGroupIndex++)
+	{
+		mIsVisibleBitflag[cameraGroupIndex][entityIndex] = srcEntityBlock.mIsVisibleBitflag[cameraGroupIndex][srcEntityIndex];
+		mTemporalVisibleBitflag[cameraGroupIndex][entityIndex] = srcEntityBlock.mTemporalVisibleBitflag[cameraGroupIndex][srcEntityIndex];
+	}
+	mWorldPositionAndWorldBoundingSphereRadius[entityIndex] = srcEntityBlock.mWorldPositionAndWorldBoundingSphereRadius[srcEntityIndex];
+
+	// VertexData isn't copyable because of atomic variable
+	const culling::VertexData& srcVertexData = srcEntityBlock.mColdData->mVertexDatas[srcEntityIndex];
+	mColdData->mVertexDatas[entityIndex].mBinnedIndiceCount.store(srcVertexData.mBinnedIndiceCount.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	mColdData->mVertexDatas[entityIndex].mVertices = srcVertexData.mVertices;
+	mColdData->mVertexDatas[entityIndex].mVerticeCount = srcVertexData.mVerticeCount;
+	mColdData->mVertexDatas[entityIndex].mIndices = srcVertexData.mIndices;
+	mColdData->mVertexDatas[entityIndex].mIndiceCount = srcVertexData.mIndiceCount;
+	mColdData->mVertexDatas[entityIndex].mVertexStride = srcVertexData.mVertexStride;
+	mColdData->mVertexDatas[entityIndex].mCoarseMeshLODCount = srcVertexData.mCoarseMeshLODCount;
+	mColdData->mVertexDatas[entityIndex].mCoarseMeshLODs = srcVertexData.mCoarseMeshLODs;
+
+	mColdData->mAABBMinWorldPoint[entityIndex] = srcEntityBlock.mColdData->mAABBMinWorldPoint[srcEntityIndex];
+	mColdData->mAABBMaxWorldPoint[entityIndex] = srcEntityBlock.mColdData->mAABBMaxWorldPoint[srcEntityIndex];
+	mColdData->mModelMatrixes[entityIndex] = srcEntityBlock.mColdData->mModelMatrixes[srcEntityIndex];
+	mIsObjectEnabled[entityIndex] = srcEntityBlock.mIsObjectEnabled[srcEntityIndex];
+	mDesiredMaxDrawDistance[entityIndex] = srcEntityBlock.mDesiredMaxDrawDistance[srcEntityIndex];
+	mColdData->mEntityBlockViewers[entityIndex] = srcEntityBlock.mColdData->mEntityBlockViewers[srcEntityIndex];
+	mColdData->mUserDatas[entityIndex] = srcEntityBlock.mColdData->mUserDatas[srcEntityIndex];
+	mCellIndices[entityIndex] = srcEntityBlock.mCellIndices[srcEntityIndex];
+	mPVSIndices[entityIndex] = srcEntityBlock.mPVSIndices[srcEntityIndex];
+	mMinScreenSpaceSizes[entityIndex] = srcEntityBlock.mMinScreenSpaceSizes[srcEntityIndex];
+#if EVERYCULLING_MAX_LOD_COUNT > 1
+	std::memcpy(mColdData->mLODScreenSpaceAreas[entityIndex], srcEntityBlock.mColdData->mLODScreenSpaceAreas[srcEntityIndex], sizeof(mColdData->mLODScreenSpaceAreas[entityIndex]));
+	mColdData->mLODCounts[entityIndex] = srcEntityBlock.mColdData->mLODCounts[srcEntityIndex];
+	// LOD of last tick is kept for hysteresis
+	for (size_t cameraIndex = 0; cameraIndex < EVERYCULLING_MAX_CAMERA_COUNT; cameraIndex++)
+	{
+		mLODIndices[cameraIndex][entityIndex] = srcEntityBlock.mLODIndices[cameraIndex][srcEntityIndex];
+	}
+#endif
+
+	MarkEntityChanged(entityIndex);
+}
+
+void culling::EntityBlock::SetLODScreenSpaceAreas(const size_t entityIndex, const float* const lodScreenSpaceAreas, const size_t lodCount)
+{
+	assert(entityIndex < EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK);
+	assert(lodCount >= 1 && lodCount <= EVERYCULLING_MAX_LOD_COUNT);
+
+#if EVERYCULLING_MAX_LOD_COUNT > 1
+	const size_t clampedLODCount = EVERYCULLING_MIN(EVERYCULLING_MAX(lodCount, (size_t)1), (size_t)EVERYCULLING_MAX_LOD_COUNT);
+	for (size_t lodIndex = 0; lodIndex + 1 < clampedLODCount; lodIndex++)
+	{
+		assert(lodIndex == 0 || lodScreenSpaceAreas[lodIndex] <= lodScreenSpaceAreas[lodIndex - 1]);
+		mColdData->mLODScreenSpaceAreas[entityIndex][lodIndex] = lodScreenSpaceAreas[lodIndex];
+	}
+	mColdData->mLODCounts[entityIndex] = static_cast<std::uint8_t>(clampedLODCount);
+#endif
+}
@@ -14,6 +14,52 @@
 
 namespace culling
 {
+	class EntityBlockViewer;
+
+	/// <summary>
+	/// Entity data which isn't read by DistanceCulling, ViewFrustumCulling.
+	/// 
+	/// If EVERYCULLING_SPLIT_COLD_ENTITY_BLOCK_DATA is 1, this is allocated at separate array parallel to EntityBlock array,
+	/// so EntityBlocks hold only data read every frame and culling modules walk less memory
+	/// </summary>
+	struct alignas(EVERYCULLING_CACHE_LINE_SIZE) EntityBlockColdData
+	{
+		// Below variables is written(set) before start culling. -----------------------------------------------------------------------------
+
+		culling::Vec4 mAABBMinWorldPoint[EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK];
+		culling::Vec4 mAABBMaxWorldPoint[EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK];
+		culling::Mat4x4 mModelMatrixes[EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK];
+
+		/**
+		 * \brief Written in BinTriangleStage, Read in BinTriangleStage.
+		 */
+		VertexData mVertexDatas[EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK]; // 4 * 16 byte
+
+		/// <summary>
+		/// EntityBlockViewer given out for each entity.
+		/// When entity is moved to other block ( EveryCulling::RepackEntityBlocks ), the viewer is updated through this
+		/// </summary>
+		EntityBlockViewer* mEntityBlockViewers[EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK];
+
+		/// <summary>
+		/// Value set by user for each entity ( ex. entity id, pointer to renderer ).
+		/// Emitted for visible entities by VisibleEntityCompaction
+		/// </summary>
+		std::uint64_t mUserDatas[EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK];
+
+#if EVERYCULLING_MAX_LOD_COUNT > 1
+		/// <summary>
+		/// mLODScreenSpaceAreas[entityIndex][i] is min area of screen space aabb ( pixels of depth buffer ) to select LOD i.
+		/// Descending, only first mLODCounts[entityIndex] - 1 values are used. Read in PreCulling
+		/// </summary>
+		float mLODScreenSpaceAreas[EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK][EVERYCULLING_MAX_LOD_COUNT - 1];
+		/// <summary>
+		/// 1 : LOD isn't selected ( default )
+		/// </summary>
+		std::uint8_t mLODCounts[EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK];
+#endif
+	};
+
 	/// <summary>
 	/// EntityBlock size should be less 4KB(Page size) for Block data being allocated in a page
 	/// </summary>
@@ -21,9 +67,46 @@ namespace culling
 	{
 		/// <summary>
 		/// You don't need to worry about false sharing.
-		/// void* mRenderer[EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK] and mCurrentEntityCount isn't read during CullJob
+		/// void* mRenderer[EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK] isn't read during CullJob
+		///
+		/// mIsVisibleBitflag[cameraIndex / 8][entityIndex] holds visibility bits of 8 cameras ( camera group ) of the entity.
+		/// Bits of a camera of 16 entities are a 16 byte vector, so 64 cameras need only 8 vectors
 		/// </summary>
-		char mIsVisibleBitflag[EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK];
+		alignas(16) char mIsVisibleBitflag[EVERYCULLING_CAMERA_GROUP_COUNT][EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK];
+
+		/// <summary>
+		/// Visibility bit of each camera after DistanceCulling, ViewFrustumCulling of last tick.
+		/// Reused for unchanged entities when temporal coherence is enabled ( EveryCulling::SetTemporalCoherenceEnabled )
+		/// </summary>
+		alignas(16) char mTemporalVisibleBitflag[EVERYCULLING_CAMERA_GROUP_COUNT][EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK];
+
+		/// <summary>
+		/// Set when position, aabb, desired max draw distance of any entity in this block is changed.
+		/// HierarchyCulling refits bounding volume of this block and clears it.
+		/// Located at padding of first cache line
+		/// </summary>
+		bool bIsBoundingVolumeDirty;
+
+		/// <summary>
+		/// Bit of entity whose position, aabb, desired max draw distance or enabled state is changed.
+		/// Moved to mChangedEntityMaskOfLastTick at PreCullJob.
+		/// Both are tested because entity data can be updated before or after PreCullJob.
+		/// Atomic because entities of a block can be updated from multiple threads ( EveryCulling::UpdateEntityDatas )
+		/// </summary>
+		std::atomic<std::uint16_t> mChangedEntityMask;
+		std::uint16_t mChangedEntityMaskOfLastTick;
+
+		/// <summary>
+		/// Entities are always packed in [0, mCurrentEntityCount).
+		/// Removed entity is filled with last entity of the block ( EveryCulling::RemoveEntityFromBlock ).
+		/// Read by every culling module, so located at first cache line
+		/// </summary>
+		std::uint32_t mCurrentEntityCount;
+
+		/// <summary>
+		/// Whether renderer component is enabled.
+		/// </summary>
+		bool mIsObjectEnabled[EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK];
 
 		/// <summary>
 		/// x, y, z : components is position of entity
@@ -32,11 +115,53 @@ namespace culling
 		/// Writeen in Pre Culling, Read in ViewFrustum Culling, Distance Culling
 		/// </summary>
 		alignas(EVERYCULLING_CACHE_LINE_SIZE) culling::Position_BoundingSphereRadius mWorldPositionAndWorldBoundingSphereRadius[EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK]; // 4 * 16 byte
-		
-		/**
-		 * \brief Written in BinTriangleStage, Read in BinTriangleStage.
-		 */
-		VertexData mVertexDatas[EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK]; // 4 * 16 byte
+
+		/// <summary>
+		/// Read in Distance Culling. Next to bounding spheres
+		/// </summary>
+		float mDesiredMaxDrawDistance[EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK];
+
+		/// <summary>
+		/// Aabb enclosing bounding spheres and aabbs of enabled entities in this block.
+		/// Every camera writes same values, so it's computed once per frame in effect.
+		/// Read in PreCulling, DistanceCulling, ViewFrustumCulling, QueryOccludeeStage to cull whole block at once
+		/// </summary>
+		culling::Vec3 mAggregateAABBMinWorldPoint;
+		/// <summary>
+		/// Max of desired max draw distance of enabled entities in this block
+		/// </summary>
+		float mAggregateMaxDesiredMaxDrawDistance;
+		culling::Vec3 mAggregateAABBMaxWorldPoint;
+		/// <summary>
+		/// Tick count when aggregate bounding volume is written.
+		/// If PreCulling didn't run at this tick, aggregate bounding volume isn't used
+		/// </summary>
+		unsigned long long mAggregateBoundingVolumeTickCount;
+
+		/// <summary>
+		/// Index of cell of cell graph which entity is in ( EVERYCULLING_INVALID_CELL_INDEX : not in any cell ).
+		/// Read in PortalCulling
+		/// </summary>
+		std::uint32_t mCellIndices[EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK];
+		/// <summary>
+		/// Index of entity in bitset of PVS bake file ( EVERYCULLING_INVALID_PVS_INDEX : not baked ).
+		/// Read in PVSCulling
+		/// </summary>
+		std::uint32_t mPVSIndices[EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK];
+		/// <summary>
+		/// Entity is culled when its screen space aabb is smaller than this in pixels of depth buffer ( 0 : only threshold of camera ).
+		/// Read in ScreenSpaceSizeCulling
+		/// </summary>
+		float mMinScreenSpaceSizes[EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK];
+
+#if EVERYCULLING_MAX_LOD_COUNT > 1
+		/// <summary>
+		/// mLODIndices[cameraIndex][entityIndex] is LOD of entity selected for the camera.
+		/// Written in PreCulling when screen space aabb is projected, so it's valid for visible entities after cull job.
+		/// Kept while entity is culled, as LOD of last tick is needed for hysteresis
+		/// </summary>
+		alignas(16) std::uint8_t mLODIndices[EVERYCULLING_MAX_CAMERA_COUNT][EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK];
+#endif
 
 		// Written in PreCulling Stage ---------------------------------------------------------------------------------------------------
 
@@ -55,28 +180,50 @@ namespace culling
 		/// </summary>
 		bool mIsAllAABBClipPointWPositive[EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK];
 		bool mIsAllAABBClipPointWNegative[EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK];
-		
-		
-		
-		// Below variables is written(set) before start culling. -----------------------------------------------------------------------------
 
-		alignas(EVERYCULLING_CACHE_LINE_SIZE) culling::Vec4 mAABBMinWorldPoint[EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK];
-		culling::Vec4 mAABBMaxWorldPoint[EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK];
-		culling::Mat4x4 mModelMatrixes[EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK];
+		// ----------------------------------------------------------------------------------------------------------------------
+
 		/// <summary>
-		/// Whether renderer component is enabled.
+		/// Aabb, model matrix, mesh, viewer of entities.
+		/// Points to mColdDataStorage or element of cold data array at same index ( EntityBlockArena )
 		/// </summary>
-		bool mIsObjectEnabled[EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK];
-		float mDesiredMaxDrawDistance[EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK];
+		EntityBlockColdData* mColdData;
 
+#if EVERYCULLING_SPLIT_COLD_ENTITY_BLOCK_DATA == 0
+		EntityBlockColdData mColdDataStorage;
+#endif
+		
 		/// <summary>
-		/// this variable is only used to decide whether to free this EntityBlock
+		/// Index of this block in EveryCulling::mActiveEntityBlockList. Used to free block in O(1)
 		/// </summary>
-		std::uint32_t mCurrentEntityCount;
+		std::uint32_t mActiveEntityBlockListIndex;
+
+		/// <summary>
+		/// Count of entities allocated at this block before it's added to active entity block list at PreCullJob.
+		/// Can exceed EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK when threads race for last entity of the block
+		/// </summary>
+		std::atomic<std::uint32_t> mAllocatedEntityCount;
+		/// <summary>
+		/// Bit of entity removed with EveryCulling::RemoveEntityFromBlock. Entities are actually removed at PreCullJob.
+		/// Written while cull job is running, so not located at cache lines read by culling modules
+		/// </summary>
+		std::atomic<std::uint16_t> mRemovedEntityMask;
 		
 		std::uint64_t mEntityBlockUniqueID;
 		bool bIsValidEntityBlock;
 
+		EntityBlock()
+#if EVERYCULLING_SPLIT_COLD_ENTITY_BLOCK_DATA == 0
+			: mColdData{ &mColdDataStorage }
+#else
+			: mColdData{ nullptr }
+#endif
+			, mAllocatedEntityCount{ 0 }, mRemovedEntityMask{ 0 }
+		{
+		}
+		EntityBlock(const EntityBlock&) = delete;
+		EntityBlock& operator=(const EntityBlock&) = delete;
+
 		// ----------------------------------------------------------------------------------------------------------------------
 
 		EVERYCULLING_FORCE_INLINE bool GetIsAllAABBClipPointWNegative(const size_t entityIndex) const
@@ -120,9 +267,45 @@ namespace culling
 			mIsAllAABBClipPointWPositive[entityIndex] = isAllAABBClipPointWPositive;
 		}
 
+		/// <summary>
+		/// Bit index of the camera in visibility byte of its camera group
+		/// </summary>
+		static EVERYCULLING_FORCE_INLINE size_t GetCameraBitIndex(const size_t cameraIndex)
+		{
+			return cameraIndex % EVERYCULLING_CAMERA_GROUP_SIZE;
+		}
+
+		/// <summary>
+		/// Visibility bytes of 16 entities holding bit of the camera. Passed to entity culling kernels with GetCameraBitIndex
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE char* GetVisibleBitflag(const size_t cameraIndex)
+		{
+			assert(cameraIndex < EVERYCULLING_MAX_CAMERA_COUNT);
+			return mIsVisibleBitflag[cameraIndex / EVERYCULLING_CAMERA_GROUP_SIZE];
+		}
+		EVERYCULLING_FORCE_INLINE const char* GetVisibleBitflag(const size_t cameraIndex) const
+		{
+			assert(cameraIndex < EVERYCULLING_MAX_CAMERA_COUNT);
+			return mIsVisibleBitflag[cameraIndex / EVERYCULLING_CAMERA_GROUP_SIZE];
+		}
+
 		EVERYCULLING_FORCE_INLINE bool GetIsCulled(const size_t entityIndex, const size_t cameraIndex) const
 		{
-			return ( mIsVisibleBitflag[entityIndex] & (1 << cameraIndex) ) == 0;
+			return ( GetVisibleBitflag(cameraIndex)[entityIndex] & (1 << GetCameraBitIndex(cameraIndex)) ) == 0;
+		}
+
+		/// <summary>
+		/// Bit i is set if entity isn't culled from camera i.
+		/// Bits of cameras whose cull job didn't run at this tick are set
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE std::uint64_t GetVisibleCameraMask(const size_t entityIndex) const
+		{
+			std::uint64_t visibleCameraMask = 0;
+			for (size_t cameraGroupIndex = 0; cameraGroupIndex < EVERYCULLING_CAMERA_GROUP_COUNT; cameraGroupIndex++)
+			{
+				visibleCameraMask |= static_cast<std::uint64_t>(static_cast<unsigned char>(mIsVisibleBitflag[cameraGroupIndex][entityIndex])) << (cameraGroupIndex * EVERYCULLING_CAMERA_GROUP_SIZE);
+			}
+			return visibleCameraMask;
 		}
 
 		/// <summary>
@@ -140,24 +323,153 @@ namespace culling
 			// Setting value to invalid index is acceptable
 			assert(entityIndex < EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK);
 
-			const char cullMask = ~((char)isCullded << cameraIndex);
+			const char cullMask = ~((char)isCullded << GetCameraBitIndex(cameraIndex));
 
-			mIsVisibleBitflag[entityIndex] &= cullMask;
+			GetVisibleBitflag(cameraIndex)[entityIndex] &= cullMask;
 		}
 
 		EVERYCULLING_FORCE_INLINE void SetCulled(const size_t entityIndex, const size_t cameraIndex)
 		{
-			mIsVisibleBitflag[entityIndex] &= ~(1 << cameraIndex);
+			GetVisibleBitflag(cameraIndex)[entityIndex] &= ~(1 << GetCameraBitIndex(cameraIndex));
+		}
+
+		/// <summary>
+		/// SetCulled for cameras of the camera group whose bit of cameraBits is set
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE void SetCulledOfCameraGroup(const size_t entityIndex, const size_t cameraGroupIndex, const char cameraBits)
+		{
+			mIsVisibleBitflag[cameraGroupIndex][entityIndex] &= ~cameraBits;
 		}
 
 		EVERYCULLING_FORCE_INLINE void SetNotCulled(const size_t entityIndex, const size_t cameraIndex)
 		{
-			mIsVisibleBitflag[entityIndex] |= (1 << cameraIndex);
+			GetVisibleBitflag(cameraIndex)[entityIndex] |= (1 << GetCameraBitIndex(cameraIndex));
+		}
+
+		EVERYCULLING_FORCE_INLINE void MarkEntityChanged(const size_t entityIndex)
+		{
+			MarkEntitiesChanged(static_cast<std::uint16_t>(1 << entityIndex));
+		}
+
+		EVERYCULLING_FORCE_INLINE void MarkEntitiesChanged(const std::uint16_t entityMask)
+		{
+			if (entityMask != 0)
+			{
+				bIsBoundingVolumeDirty = true;
+				mChangedEntityMask.fetch_or(entityMask, std::memory_order_relaxed);
+			}
+		}
+
+		EVERYCULLING_FORCE_INLINE std::uint32_t GetChangedEntityMask() const
+		{
+			return mChangedEntityMask.load(std::memory_order_relaxed) | mChangedEntityMaskOfLastTick;
+		}
+
+		/// <summary>
+		/// Clear visibility bit of the camera of unchanged entities culled at last tick
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE void ApplyTemporalVisibleBitflag(const size_t cameraIndex)
+		{
+			ApplyTemporalVisibleBitflagOfCameraGroup(cameraIndex / EVERYCULLING_CAMERA_GROUP_SIZE, static_cast<char>(1 << GetCameraBitIndex(cameraIndex)));
+		}
+
+		/// <summary>
+		/// ApplyTemporalVisibleBitflag for cameras of the camera group whose bit of cameraBits is set
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE void ApplyTemporalVisibleBitflagOfCameraGroup(const size_t cameraGroupIndex, const char cameraBits)
+		{
+			static_assert(EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK == 16, "mIsVisibleBitflag should be a 16 byte vector");
+
+			// 0xFF at byte of changed entity
+			const __m128i entityBit = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+			const __m128i changedEntityMask = _mm_shuffle_epi8(_mm_cvtsi32_si128(static_cast<int>(GetChangedEntityMask())), _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1));
+			const __m128i isChangedEntity = _mm_cmpeq_epi8(_mm_and_si128(changedEntityMask, entityBit), entityBit);
+
+			const __m128i keptBits = _mm_or_si128
+			(
+				_mm_or_si128(_mm_load_si128(reinterpret_cast<const __m128i*>(mTemporalVisibleBitflag[cameraGroupIndex])), isChangedEntity),
+				_mm_set1_epi8(static_cast<char>(~cameraBits))
+			);
+			__m128i* const visibleBitflag = reinterpret_cast<__m128i*>(mIsVisibleBitflag[cameraGroupIndex]);
+			_mm_store_si128(visibleBitflag, _mm_and_si128(_mm_load_si128(visibleBitflag), keptBits));
+		}
+
+		/// <summary>
+		/// Copy visibility bit of the camera to mTemporalVisibleBitflag
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE void StoreTemporalVisibleBitflag(const size_t cameraIndex)
+		{
+			StoreTemporalVisibleBitflagOfCameraGroup(cameraIndex / EVERYCULLING_CAMERA_GROUP_SIZE, static_cast<char>(1 << GetCameraBitIndex(cameraIndex)));
+		}
+
+		/// <summary>
+		/// StoreTemporalVisibleBitflag for cameras of the camera group whose bit of cameraBits is set
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE void StoreTemporalVisibleBitflagOfCameraGroup(const size_t cameraGroupIndex, const char cameraBits)
+		{
+			const __m128i cameraBit = _mm_set1_epi8(cameraBits);
+			__m128i* const temporalVisibleBitflag = reinterpret_cast<__m128i*>(mTemporalVisibleBitflag[cameraGroupIndex]);
+			_mm_store_si128
+			(
+				temporalVisibleBitflag,
+				_mm_or_si128(_mm_andnot_si128(cameraBit, _mm_load_si128(temporalVisibleBitflag)), _mm_and_si128(cameraBit, _mm_load_si128(reinterpret_cast<const __m128i*>(mIsVisibleBitflag[cameraGroupIndex]))))
+			);
+		}
+
+		/// <summary>
+		/// Clear visibility bit of the camera of all entities with one store
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE void SetAllEntitiesCulled(const size_t cameraIndex)
+		{
+			static_assert(EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK == 16, "mIsVisibleBitflag should be a 16 byte vector");
+
+			__m128i* const visibleBitflag = reinterpret_cast<__m128i*>(GetVisibleBitflag(cameraIndex));
+			_mm_store_si128(visibleBitflag, _mm_and_si128(_mm_load_si128(visibleBitflag), _mm_set1_epi8(static_cast<char>(~(1 << GetCameraBitIndex(cameraIndex))))));
+		}
+
+		/// <summary>
+		/// Check if every entity in [0, mCurrentEntityCount) is culled from the camera
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE bool IsAllEntitiesCulled(const size_t cameraIndex) const
+		{
+			return GetVisibleEntityMask(cameraIndex) == 0;
+		}
+
+		/// <summary>
+		/// Bit i is set if entity i in [0, mCurrentEntityCount) isn't culled from the camera
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE std::uint32_t GetVisibleEntityMask(const size_t cameraIndex) const
+		{
+			const __m128i cameraBit = _mm_set1_epi8(static_cast<char>(1 << GetCameraBitIndex(cameraIndex)));
+			const __m128i visibleBit = _mm_and_si128(_mm_load_si128(reinterpret_cast<const __m128i*>(GetVisibleBitflag(cameraIndex))), cameraBit);
+			const std::uint32_t visibleEntityMask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(visibleBit, cameraBit)));
+			return visibleEntityMask & ((1u << mCurrentEntityCount) - 1);
+		}
+
+		/// <summary>
+		/// Count of entities in [0, mCurrentEntityCount) which aren't culled from the camera.
+		/// Library isn't compiled with popcnt instruction
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE std::uint32_t GetVisibleEntityCount(const size_t cameraIndex) const
+		{
+			std::uint32_t mask = GetVisibleEntityMask(cameraIndex);
+			mask = mask - ((mask >> 1) & 0x55555555);
+			mask = (mask & 0x33333333) + ((mask >> 2) & 0x33333333);
+			return (((mask + (mask >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24;
+		}
+
+		EVERYCULLING_FORCE_INLINE bool IsAggregateBoundingVolumeValid(const unsigned long long currentTickCount) const
+		{
+			return mAggregateBoundingVolumeTickCount == currentTickCount;
 		}
 
 		EVERYCULLING_FORCE_INLINE void SetIsObjectEnabled(const size_t entityIndex, const bool isEnabled)
 		{
-			mIsObjectEnabled[entityIndex] = isEnabled;
+			if (mIsObjectEnabled[entityIndex] != isEnabled)
+			{
+				mIsObjectEnabled[entityIndex] = isEnabled;
+				mChangedEntityMask.fetch_or(static_cast<std::uint16_t>(1 << entityIndex), std::memory_order_relaxed);
+			}
 		}
 		EVERYCULLING_FORCE_INLINE bool GetIsObjectEnabled(const size_t entityIndex) const
 		{
@@ -166,18 +478,65 @@ namespace culling
 		
 		EVERYCULLING_FORCE_INLINE void SetModelMatrix(const size_t entityIndex, const float* const modelToClipspaceMatrix)
 		{
-			std::memcpy(mModelMatrixes + entityIndex, modelToClipspaceMatrix, sizeof(culling::Mat4x4));
+			std::memcpy(mColdData->mModelMatrixes + entityIndex, modelToClipspaceMatrix, sizeof(culling::Mat4x4));
+		}
+
+		/// <summary>
+		/// Write model matrix with non-temporal store. A model matrix fills a cache line, so it's not read before written.
+		/// Caller should call _mm_sfence after all stores before cull job reads it
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE void StreamModelMatrix(const size_t entityIndex, const float* const modelToClipspaceMatrix)
+		{
+			static_assert(sizeof(culling::Mat4x4) == EVERYCULLING_CACHE_LINE_SIZE, "Model matrix should fill a cache line");
+
+			float* const dst = reinterpret_cast<float*>(mColdData->mModelMatrixes + entityIndex);
+			EVERYCULLING_ALIGNMENT_ASSERT(reinterpret_cast<std::uintptr_t>(dst), 16);
+
+			_mm_stream_ps(dst, _mm_loadu_ps(modelToClipspaceMatrix));
+			_mm_stream_ps(dst + 4, _mm_loadu_ps(modelToClipspaceMatrix + 4));
+			_mm_stream_ps(dst + 8, _mm_loadu_ps(modelToClipspaceMatrix + 8));
+			_mm_stream_ps(dst + 12, _mm_loadu_ps(modelToClipspaceMatrix + 12));
 		}
 		EVERYCULLING_FORCE_INLINE const culling::Mat4x4& GetModelMatrix(const size_t entityIndex) const
 		{
-			return mModelMatrixes[entityIndex];
+			return mColdData->mModelMatrixes[entityIndex];
 		}
 
 		EVERYCULLING_FORCE_INLINE void UpdateBoundingSphereRadius(const size_t entityIndex)
 		{
-			culling::Vec4 vec = mAABBMaxWorldPoint[entityIndex] - mAABBMinWorldPoint[entityIndex];
+			mWorldPositionAndWorldBoundingSphereRadius[entityIndex].SetBoundingSphereRadius(ComputeBoundingSphereRadius(entityIndex));
+		}
+
+		EVERYCULLING_FORCE_INLINE void SetEntityWorldPosition(const size_t entityIndex, const float* const worldPos)
+		{
+			if (StoreEntityWorldPosition(entityIndex, worldPos) == true)
+			{
+				MarkEntityChanged(entityIndex);
+			}
+		}
+
+		/// <summary>
+		/// Write position only if it's changed without marking entity changed.
+		/// Return whether position is changed
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE bool StoreEntityWorldPosition(const size_t entityIndex, const float* const worldPos)
+		{
+			if (std::memcmp(mWorldPositionAndWorldBoundingSphereRadius[entityIndex].Position.data(), worldPos, sizeof(culling::Vec3)) != 0)
+			{
+				mWorldPositionAndWorldBoundingSphereRadius[entityIndex].SetPosition(worldPos);
+				return true;
+			}
+			return false;
+		}
+
+		/// <summary>
+		/// Same value with bounding sphere radius written by UpdateBoundingSphereRadius
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE float ComputeBoundingSphereRadius(const size_t entityIndex) const
+		{
+			culling::Vec4 vec = mColdData->mAABBMaxWorldPoint[entityIndex] - mColdData->mAABBMinWorldPoint[entityIndex];
 			vec[3] = 1.0f;
-			mWorldPositionAndWorldBoundingSphereRadius[entityIndex].SetBoundingSphereRadius(vec.magnitude() * 0.5f);
+			return vec.magnitude() * 0.5f;
 		}
 
 		EVERYCULLING_FORCE_INLINE const culling::Position_BoundingSphereRadius& GetEntityWorldPositionAndBoudingSphereRadius(const size_t entityIndex) const
@@ -187,17 +546,36 @@ namespace culling
 
 		EVERYCULLING_FORCE_INLINE void SetAABBWorldPosition(const size_t entityIndex, const float* const minWorldPos, const float* const maxWorldPos)
 		{
-			std::memcpy(mAABBMinWorldPoint + entityIndex, minWorldPos, sizeof(culling::Vec4));
-			std::memcpy(mAABBMaxWorldPoint + entityIndex, maxWorldPos, sizeof(culling::Vec4));
+			if (StoreAABBWorldPosition(entityIndex, minWorldPos, maxWorldPos) == true)
+			{
+				MarkEntityChanged(entityIndex);
+			}
+		}
+
+		/// <summary>
+		/// Write aabb only if it's changed without marking entity changed.
+		/// Return whether aabb is changed
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE bool StoreAABBWorldPosition(const size_t entityIndex, const float* const minWorldPos, const float* const maxWorldPos)
+		{
+			// Entities which don't move are usually updated every frame too
+			if (std::memcmp(mColdData->mAABBMinWorldPoint + entityIndex, minWorldPos, sizeof(culling::Vec4)) != 0 || std::memcmp(mColdData->mAABBMaxWorldPoint + entityIndex, maxWorldPos, sizeof(culling::Vec4)) != 0)
+			{
+				std::memcpy(mColdData->mAABBMinWorldPoint + entityIndex, minWorldPos, sizeof(culling::Vec4));
+				std::memcpy(mColdData->mAABBMaxWorldPoint + entityIndex, maxWorldPos, sizeof(culling::Vec4));
+				return true;
+			}
+			return false;
 		}
 		
 		EVERYCULLING_FORCE_INLINE void ResetEntityBlock(const unsigned long long currentTickCount)
 		{
 			for(size_t entityIndex = 0 ; entityIndex < EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK ; entityIndex++)
 			{
-				mVertexDatas[entityIndex].Reset(currentTickCount);
+				mColdData->mVertexDatas[entityIndex].Reset(currentTickCount);
 			}
-			std::memset(mIsVisibleBitflag, 0xFF, sizeof(char) * EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK);
+			std::memset(mIsVisibleBitflag, 0xFF, sizeof(mIsVisibleBitflag));
+			mChangedEntityMaskOfLastTick = mChangedEntityMask.exchange(0, std::memory_order_relaxed);
 			std::memset(mIsAllAABBClipPointWPositive, 0xFF, sizeof(char) * EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK);
 		}
 
@@ -205,10 +583,14 @@ namespace culling
 		{
 			assert(desiredMaxDrawDistance >= 0.0f);
 
-			mDesiredMaxDrawDistance[entityIndex] = desiredMaxDrawDistance;
+			if (mDesiredMaxDrawDistance[entityIndex] != desiredMaxDrawDistance)
+			{
+				mDesiredMaxDrawDistance[entityIndex] = desiredMaxDrawDistance;
+				MarkEntityChanged(entityIndex);
+			}
 		}
 
-		EVERYCULLING_FORCE_INLINE float GetDesiredMaxDrawDistance(const size_t entityIndex)
+		EVERYCULLING_FORCE_INLINE float GetDesiredMaxDrawDistance(const size_t entityIndex) const
 		{
 			assert(mDesiredMaxDrawDistance[entityIndex] >= 0.0f);
 
@@ -217,10 +599,85 @@ namespace culling
 		
 		EVERYCULLING_FORCE_INLINE const culling::VertexData& GetVertexData(const size_t entityIndex) const
 		{
-			return mVertexDatas[entityIndex];
+			return mColdData->mVertexDatas[entityIndex];
+		}
+
+		EVERYCULLING_FORCE_INLINE void SetUserData(const size_t entityIndex, const std::uint64_t userData)
+		{
+			mColdData->mUserDatas[entityIndex] = userData;
+		}
+		EVERYCULLING_FORCE_INLINE std::uint64_t GetUserData(const size_t entityIndex) const
+		{
+			return mColdData->mUserDatas[entityIndex];
+		}
+
+		EVERYCULLING_FORCE_INLINE void SetCellIndex(const size_t entityIndex, const std::uint32_t cellIndex)
+		{
+			mCellIndices[entityIndex] = cellIndex;
+		}
+		EVERYCULLING_FORCE_INLINE std::uint32_t GetCellIndex(const size_t entityIndex) const
+		{
+			return mCellIndices[entityIndex];
+		}
+
+		EVERYCULLING_FORCE_INLINE void SetPVSIndex(const size_t entityIndex, const std::uint32_t pvsIndex)
+		{
+			mPVSIndices[entityIndex] = pvsIndex;
+		}
+		EVERYCULLING_FORCE_INLINE std::uint32_t GetPVSIndex(const size_t entityIndex) const
+		{
+			return mPVSIndices[entityIndex];
+		}
+
+		EVERYCULLING_FORCE_INLINE void SetMinScreenSpaceSize(const size_t entityIndex, const float minScreenSpaceSize)
+		{
+			assert(minScreenSpaceSize >= 0.0f);
+			mMinScreenSpaceSizes[entityIndex] = minScreenSpaceSize;
+		}
+		EVERYCULLING_FORCE_INLINE float GetMinScreenSpaceSize(const size_t entityIndex) const
+		{
+			return mMinScreenSpaceSizes[entityIndex];
+		}
+
+		/// <summary>
+		/// lodScreenSpaceAreas : lodCount - 1 descending min areas of screen space aabb to select LOD 0, 1, ...
+		/// </summary>
+		void SetLODScreenSpaceAreas(const size_t entityIndex, const float* const lodScreenSpaceAreas, const size_t lodCount);
+		EVERYCULLING_FORCE_INLINE size_t GetLODCount(const size_t entityIndex) const
+		{
+#if EVERYCULLING_MAX_LOD_COUNT > 1
+			return mColdData->mLODCounts[entityIndex];
+#else
+			return 1;
+#endif
+		}
+		EVERYCULLING_FORCE_INLINE size_t GetLODIndex(const size_t entityIndex, const size_t cameraIndex) const
+		{
+			assert(cameraIndex < EVERYCULLING_MAX_CAMERA_COUNT);
+#if EVERYCULLING_MAX_LOD_COUNT > 1
+			return mLODIndices[cameraIndex][entityIndex];
+#else
+			return 0;
+#endif
 		}
 
 		void ClearEntityBlock();
+		/// <summary>
+		/// Reset data of removed entity, so entity allocated at the index later doesn't inherit mesh, draw distance of it
+		/// </summary>
+		void ClearEntityData(const size_t entityIndex);
+
+		/// <summary>
+		/// Compute aggregate bounding volume from bounding sphere and aabb of enabled entities.
+		/// Should be called after UpdateBoundingSphereRadius of enabled entities
+		/// </summary>
+		void UpdateAggregateBoundingVolume(const unsigned long long currentTickCount);
+
+		/// <summary>
+		/// Copy data of entity set before cull job and visibility of last cull job from other entity block.
+		/// Viewer of the entity isn't updated here
+		/// </summary>
+		void CopyEntityData(const size_t entityIndex, const EntityBlock& srcEntityBlock, const size_t srcEntityIndex);
 	};
 
 
@@ -0,0 +1,277 @@
+#include "EntityBlockArena.h"
+
+#include <new>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+#endif
+
+namespace
+{
+	EVERYCULLING_FORCE_INLINE size_t RoundUp(const size_t value, const size_t alignment)
+	{
+		return (value + alignment - 1) / alignment * alignment;
+	}
+}
+
+culling::VirtualMemoryRange::VirtualMemoryRange()
+	: mReservedAddress{ nullptr }, mReservedSize{ 0 }, mCommittedSize{ 0 }, bmIsHugePageAdvised{ false }
+{
+}
+
+culling::VirtualMemoryRange::~VirtualMemoryRange()
+{
+	if (mReservedAddress == nullptr)
+	{
+		return;
+	}
+
+#if defined(_WIN32)
+	VirtualFree(mReservedAddress, 0, MEM_RELEASE);
+#else
+	munmap(mReservedAddress, mReservedSize);
+#endif
+}
+
+bool culling::VirtualMemoryRange::Reserve(const size_t size)
+{
+	assert(mReservedAddress == nullptr);
+
+	const size_t reservedSize = RoundUp(size, EVERYCULLING_HUGE_PAGE_SIZE);
+
+#if defined(_WIN32)
+	// Reserved address is aligned to allocation granularity ( 64KB ). Large pages need SeLockMemoryPrivilege, so they aren't used
+	void* const reservedAddress = VirtualAlloc(nullptr, reservedSize, MEM_RESERVE, PAGE_NOACCESS);
+	if (reservedAddress == nullptr)
+	{
+		return false;
+	}
+	mReservedAddress = static_cast<char*>(reservedAddress);
+#else
+	// Reserve one more huge page to align address to huge page
+	const size_t paddedReservedSize = reservedSize + EVERYCULLING_HUGE_PAGE_SIZE;
+	void* const paddedReservedAddress = mmap(nullptr, paddedReservedSize, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+	if (paddedReservedAddress == MAP_FAILED)
+	{
+		return false;
+	}
+
+	char* const reservedAddress = reinterpret_cast<char*>(RoundUp(reinterpret_cast<std::uintptr_t>(paddedReservedAddress), EVERYCULLING_HUGE_PAGE_SIZE));
+	const size_t frontPaddingSize = static_cast<size_t>(reservedAddress - static_cast<char*>(paddedReservedAddress));
+	if (frontPaddingSize != 0)
+	{
+		munmap(paddedReservedAddress, frontPaddingSize);
+	}
+	if (EVERYCULLING_HUGE_PAGE_SIZE - frontPaddingSize != 0)
+	{
+		munmap(reservedAddress + reservedSize, EVERYCULLING_HUGE_PAGE_SIZE - frontPaddingSize);
+	}
+	mReservedAddress = reservedAddress;
+#endif
+
+	mReservedSize = reservedSize;
+	mCommittedSize = 0;
+	return true;
+}
+
+bool culling::VirtualMemoryRange::Commit(const size_t size)
+{
+	const size_t committedSize = RoundUp(size, EVERYCULLING_HUGE_PAGE_SIZE);
+	if (committedSize <= mCommittedSize)
+	{
+		return true;
+	}
+	if (committedSize > mReservedSize)
+	{
+		return false;
+	}
+
+	char* const committedAddress = mReservedAddress + mCommittedSize;
+	const size_t newlyCommittedSize = committedSize - mCommittedSize;
+
+#if defined(_WIN32)
+	if (VirtualAlloc(committedAddress, newlyCommittedSize, MEM_COMMIT, PAGE_READWRITE) == nullptr)
+	{
+		return false;
+	}
+#else
+	if (mprotect(committedAddress, newlyCommittedSize, PROT_READ | PROT_WRITE) != 0)
+	{
+		return false;
+	}
+#if defined(MADV_HUGEPAGE)
+	// Pages aren't touched yet, so kernel can back the range with 2MB pages at first touch
+	if (madvise(committedAddress, newlyCommittedSize, MADV_HUGEPAGE) == 0)
+	{
+		bmIsHugePageAdvised = true;
+	}
+#endif
+#endif
+
+	mCommittedSize = committedSize;
+	return true;
+}
+
+bool culling::VirtualMemoryRange::ApplyNumaPolicy
+(
+	const EntityBlockArenaNumaPolicy numaPolicy,
+	const std::uint32_t numaNode,
+	const size_t offset,
+	const size_t size
+) const
+{
+	if (size == 0)
+	{
+		return true;
+	}
+
+#if defined(__linux__) && defined(SYS_mbind)
+	// Values of linux/mempolicy.h
+	constexpr int MPOL_DEFAULT_VALUE = 0;
+	constexpr int MPOL_BIND_VALUE = 2;
+	constexpr int MPOL_INTERLEAVE_VALUE = 3;
+	constexpr unsigned int MPOL_MF_MOVE_VALUE = 1 << 1;
+
+	unsigned long nodeMask = 0;
+	int mode = MPOL_DEFAULT_VALUE;
+	switch (numaPolicy)
+	{
+	case EntityBlockArenaNumaPolicy::FirstTouch:
+		mode = MPOL_DEFAULT_VALUE;
+		break;
+	case EntityBlockArenaNumaPolicy::Interleave:
+		// Nodes which don't exist are ignored
+		mode = MPOL_INTERLEAVE_VALUE;
+		nodeMask = ~0ul;
+		break;
+	case EntityBlockArenaNumaPolicy::Bind:
+		if (numaNode >= sizeof(unsigned long) * 8)
+		{
+			return false;
+		}
+		mode = MPOL_BIND_VALUE;
+		nodeMask = 1ul << numaNode;
+		break;
+	}
+
+	const unsigned long maxNode = (mode == MPOL_DEFAULT_VALUE) ? 0 : sizeof(unsigned long) * 8;
+	return syscall(SYS_mbind, mReservedAddress + offset, size, mode, (mode == MPOL_DEFAULT_VALUE) ? nullptr : &nodeMask, maxNode, MPOL_MF_MOVE_VALUE) == 0;
+#else
+	return numaPolicy == EntityBlockArenaNumaPolicy::FirstTouch;
+#endif
+}
+
+culling::EntityBlockArena::EntityBlockArena()
+	: mEntityBlockCount{ 0 }, mMaxEntityBlockCount{ EVERYCULLING_ENTITY_BLOCK_ARENA_MAX_ENTITY_BLOCK_COUNT },
+	mNumaPolicy{ EntityBlockArenaNumaPolicy::FirstTouch }, mNumaNode{ 0 }
+{
+	bool isSuccess = mEntityBlockRange.Reserve(sizeof(EntityBlock) * mMaxEntityBlockCount);
+#if EVERYCULLING_SPLIT_COLD_ENTITY_BLOCK_DATA == 1
+	isSuccess = isSuccess && mEntityBlockColdDataRange.Reserve(sizeof(EntityBlockColdData) * mMaxEntityBlockCount);
+#endif
+
+	if (isSuccess == false)
+	{
+		throw std::bad_alloc{};
+	}
+}
+
+culling::EntityBlockArena::~EntityBlockArena()
+{
+	for (size_t entityBlockIndex = 0; entityBlockIndex < mEntityBlockCount; entityBlockIndex++)
+	{
+		EntityBlock* const entityBlock = GetEntityBlock(entityBlockIndex);
+#if EVERYCULLING_SPLIT_COLD_ENTITY_BLOCK_DATA == 1
+		entityBlock->mColdData->~EntityBlockColdData();
+#endif
+		entityBlock->~EntityBlock();
+	}
+}
+
+size_t culling::EntityBlockArena::Grow(const size_t minEntityBlockCount)
+{
+	const size_t previousCommittedSize = mEntityBlockRange.GetCommittedSize();
+	const size_t requiredEntityBlockCount = mEntityBlockCount + minEntityBlockCount;
+	if (requiredEntityBlockCount > mMaxEntityBlockCount || mEntityBlockRange.Commit(sizeof(EntityBlock) * requiredEntityBlockCount) == false)
+	{
+		throw std::bad_alloc{};
+	}
+
+	// Use every entity block fitting in committed pages
+	const size_t entityBlockCount = EVERYCULLING_MIN(mEntityBlockRange.GetCommittedSize() / sizeof(EntityBlock), mMaxEntityBlockCount);
+	assert(entityBlockCount >= requiredEntityBlockCount);
+
+#if EVERYCULLING_SPLIT_COLD_ENTITY_BLOCK_DATA == 1
+	const size_t previousColdDataCommittedSize = mEntityBlockColdDataRange.GetCommittedSize();
+	if (mEntityBlockColdDataRange.Commit(sizeof(EntityBlockColdData) * entityBlockCount) == false)
+	{
+		throw std::bad_alloc{};
+	}
+#endif
+
+	// Newly committed pages aren't touched yet. Set policy before constructing blocks touches them
+	if (mNumaPolicy != EntityBlockArenaNumaPolicy::FirstTouch)
+	{
+		mEntityBlockRange.ApplyNumaPolicy(mNumaPolicy, mNumaNode, previousCommittedSize, mEntityBlockRange.GetCommittedSize() - previousCommittedSize);
+#if EVERYCULLING_SPLIT_COLD_ENTITY_BLOCK_DATA == 1
+		mEntityBlockColdDataRange.ApplyNumaPolicy(mNumaPolicy, mNumaNode, previousColdDataCommittedSize, mEntityBlockColdDataRange.GetCommittedSize() - previousColdDataCommittedSize);
+#endif
+	}
+
+	for (size_t entityBlockIndex = mEntityBlockCount; entityBlockIndex < entityBlockCount; entityBlockIndex++)
+	{
+		EntityBlock* const entityBlock = new (reinterpret_cast<EntityBlock*>(mEntityBlockRange.GetAddress()) + entityBlockIndex) EntityBlock();
+#if EVERYCULLING_SPLIT_COLD_ENTITY_BLOCK_DATA == 1
+		entityBlock->mColdData = new (reinterpret_cast<EntityBlockColdData*>(mEntityBlockColdDataRange.GetAddress()) + entityBlockIndex) EntityBlockColdData();
+#else
+		(void)entityBlock;
+#endif
+	}
+
+	const size_t grownEntityBlockCount = entityBlockCount - mEntityBlockCount;
+	mEntityBlockCount = entityBlockCount;
+	return grownEntityBlockCount;
+}
+
+bool culling::EntityBlockArena::SetNumaPolicy(const EntityBlockArenaNumaPolicy numaPolicy, const std::uint32_t numaNode)
+{
+	mNumaPolicy = numaPolicy;
+	mNumaNode = numaNode;
+
+	// Move already committed pages
+	bool isSuccess = mEntityBlockRange.ApplyNumaPolicy(numaPolicy, numaNode, 0, mEntityBlockRange.GetCommittedSize());
+#if EVERYCULLING_SPLIT_COLD_ENTITY_BLOCK_DATA == 1
+	isSuccess = mEntityBlockColdDataRange.ApplyNumaPolicy(numaPolicy, numaNode, 0, mEntityBlockColdDataRange.GetCommittedSize()) && isSuccess;
+#endif
+
+	if (isSuccess == false)
+	{
+		// ex) numa node doesn't exist
+		mNumaPolicy = EntityBlockArenaNumaPolicy::FirstTouch;
+		mNumaNode = 0;
+	}
+	return isSuccess;
+}
+
+size_t culling::EntityBlockArena::GetCommittedSize() const
+{
+	size_t committedSize = mEntityBlockRange.GetCommittedSize();
+#if EVERYCULLING_SPLIT_COLD_ENTITY_BLOCK_DATA == 1
+	committedSize += mEntityBlockColdDataRange.GetCommittedSize();
+#endif
+	return committedSize;
+}
+
+bool culling::EntityBlockArena::IsHugePageAdvised() const
+{
+	return mEntityBlockRange.IsHugePageAdvised();
+}
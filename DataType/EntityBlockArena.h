@@ -0,0 +1,154 @@
+#pragma once
+
+#include "../EveryCullingCore.h"
+
+#include <cstddef>
+
+#include "EntityBlock.h"
+
+namespace culling
+{
+	/// <summary>
+	/// Where physical pages of entity block arena are placed on NUMA system
+	/// </summary>
+	enum class EntityBlockArenaNumaPolicy : std::uint32_t
+	{
+		/// <summary>
+		/// Pages are placed at NUMA node of thread which allocates entity ( OS default )
+		/// </summary>
+		FirstTouch,
+		/// <summary>
+		/// Pages are spread over all NUMA nodes.
+		/// Cull job threads pick any entity block, so this balances remote memory accesses of threads on every socket
+		/// </summary>
+		Interleave,
+		/// <summary>
+		/// Pages are placed at a NUMA node. Use when every cull job thread runs on the node
+		/// </summary>
+		Bind
+	};
+
+	/// <summary>
+	/// Range of virtual address space reserved once and committed from front.
+	/// Committed pages never move, so pointers to it stay valid while it grows
+	/// </summary>
+	class VirtualMemoryRange
+	{
+	private:
+
+		char* mReservedAddress;
+		size_t mReservedSize;
+		size_t mCommittedSize;
+		bool bmIsHugePageAdvised;
+
+	public:
+
+		VirtualMemoryRange();
+		VirtualMemoryRange(const VirtualMemoryRange&) = delete;
+		VirtualMemoryRange& operator=(const VirtualMemoryRange&) = delete;
+		~VirtualMemoryRange();
+
+		/// <summary>
+		/// Reserve address space without physical memory. Reserved address is aligned to EVERYCULLING_HUGE_PAGE_SIZE
+		/// </summary>
+		bool Reserve(const size_t size);
+		/// <summary>
+		/// Commit pages in [0, size). size is rounded up to EVERYCULLING_HUGE_PAGE_SIZE
+		/// </summary>
+		bool Commit(const size_t size);
+		/// <summary>
+		/// Apply NUMA policy to committed range and ranges committed later.
+		/// Return false if OS doesn't support it
+		/// </summary>
+		bool ApplyNumaPolicy(const EntityBlockArenaNumaPolicy numaPolicy, const std::uint32_t numaNode, const size_t offset, const size_t size) const;
+
+		EVERYCULLING_FORCE_INLINE char* GetAddress() const
+		{
+			return mReservedAddress;
+		}
+		EVERYCULLING_FORCE_INLINE size_t GetReservedSize() const
+		{
+			return mReservedSize;
+		}
+		EVERYCULLING_FORCE_INLINE size_t GetCommittedSize() const
+		{
+			return mCommittedSize;
+		}
+		EVERYCULLING_FORCE_INLINE bool IsHugePageAdvised() const
+		{
+			return bmIsHugePageAdvised;
+		}
+	};
+
+	/// <summary>
+	/// Contiguous storage of every entity block ( and EntityBlockColdData ) of a EveryCulling.
+	///
+	/// Maximum entity block count is reserved at once and pages are committed when it grows,
+	/// so entity blocks are addressable by index and neighbor blocks are neighbor in memory.
+	/// Pages are backed with transparent huge pages when OS supports it to reduce TLB misses
+	/// </summary>
+	class EntityBlockArena
+	{
+	private:
+
+		VirtualMemoryRange mEntityBlockRange;
+#if EVERYCULLING_SPLIT_COLD_ENTITY_BLOCK_DATA == 1
+		VirtualMemoryRange mEntityBlockColdDataRange;
+#endif
+
+		size_t mEntityBlockCount;
+		size_t mMaxEntityBlockCount;
+
+		EntityBlockArenaNumaPolicy mNumaPolicy;
+		std::uint32_t mNumaNode;
+
+	public:
+
+		EntityBlockArena();
+		EntityBlockArena(const EntityBlockArena&) = delete;
+		EntityBlockArena& operator=(const EntityBlockArena&) = delete;
+		~EntityBlockArena();
+
+		/// <summary>
+		/// Construct at least minEntityBlockCount new entity blocks at end of arena.
+		/// Every entity block fitting in committed pages is constructed.
+		/// Return count of constructed entity blocks. Indices of them start at GetEntityBlockCount() before call
+		/// </summary>
+		size_t Grow(const size_t minEntityBlockCount);
+
+		/// <summary>
+		/// Set NUMA policy of pages of arena. Already committed pages are moved if possible.
+		/// Return false and keep first touch policy if OS doesn't support it
+		/// </summary>
+		bool SetNumaPolicy(const EntityBlockArenaNumaPolicy numaPolicy, const std::uint32_t numaNode);
+
+		EVERYCULLING_FORCE_INLINE EntityBlock* GetEntityBlock(const size_t entityBlockIndex) const
+		{
+			assert(entityBlockIndex < mEntityBlockCount);
+			return reinterpret_cast<EntityBlock*>(mEntityBlockRange.GetAddress()) + entityBlockIndex;
+		}
+
+		EVERYCULLING_FORCE_INLINE size_t GetEntityBlockIndex(const EntityBlock* const entityBlock) const
+		{
+			const size_t entityBlockIndex = static_cast<size_t>(entityBlock - reinterpret_cast<const EntityBlock*>(mEntityBlockRange.GetAddress()));
+			assert(entityBlockIndex < mEntityBlockCount);
+			return entityBlockIndex;
+		}
+
+		EVERYCULLING_FORCE_INLINE size_t GetEntityBlockCount() const
+		{
+			return mEntityBlockCount;
+		}
+
+		EVERYCULLING_FORCE_INLINE size_t GetMaxEntityBlockCount() const
+		{
+			return mMaxEntityBlockCount;
+		}
+
+		/// <summary>
+		/// Size of committed memory in bytes
+		/// </summary>
+		size_t GetCommittedSize() const;
+		bool IsHugePageAdvised() const;
+	};
+}
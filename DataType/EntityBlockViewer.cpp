@@ -14,6 +14,23 @@ void culling::EntityBlockViewer::ResetEntityData()
 	SetIsObjectEnabled(true);
 }
 
+void culling::EntityBlockViewer::DetachFromEntityBlock()
+{
+	if (IsValid() == true && mTargetEntityBlock->mColdData->mEntityBlockViewers[mEntityIndexInBlock] == this)
+	{
+		mTargetEntityBlock->mColdData->mEntityBlockViewers[mEntityIndexInBlock] = nullptr;
+	}
+}
+
+void culling::EntityBlockViewer::Relocate(EntityBlock* const entityBlock, const size_t entityIndexInBlock)
+{
+	mTargetEntityBlock = entityBlock;
+	mEntityIndexInBlock = entityIndexInBlock;
+
+	assert(IsValid() == true);
+	mTargetEntityBlock->mColdData->mEntityBlockViewers[mEntityIndexInBlock] = this;
+}
+
 culling::EntityBlockViewer::EntityBlockViewer()
 {
 	DeInitializeEntityBlockViewer();
@@ -27,11 +44,41 @@ culling::EntityBlockViewer::EntityBlockViewer
 	: mTargetEntityBlock{ entityBlock }, mEntityIndexInBlock{ entityIndexInBlock }
 {
 	assert(IsValid() == true);
+	mTargetEntityBlock->mColdData->mEntityBlockViewers[mEntityIndexInBlock] = this;
 	ResetEntityData();
 }
 
-culling::EntityBlockViewer::EntityBlockViewer(EntityBlockViewer&&) noexcept = default;
-culling::EntityBlockViewer& culling::EntityBlockViewer::operator=(EntityBlockViewer&&) noexcept = default;
+culling::EntityBlockViewer::EntityBlockViewer(EntityBlockViewer&& entityBlockViewer) noexcept
+	: mTargetEntityBlock{ entityBlockViewer.mTargetEntityBlock }, mEntityIndexInBlock{ entityBlockViewer.mEntityIndexInBlock }
+{
+	if (IsValid() == true)
+	{
+		mTargetEntityBlock->mColdData->mEntityBlockViewers[mEntityIndexInBlock] = this;
+	}
+	entityBlockViewer.DeInitializeEntityBlockViewer();
+}
+
+culling::EntityBlockViewer& culling::EntityBlockViewer::operator=(EntityBlockViewer&& entityBlockViewer) noexcept
+{
+	if (this != &entityBlockViewer)
+	{
+		DetachFromEntityBlock();
+
+		mTargetEntityBlock = entityBlockViewer.mTargetEntityBlock;
+		mEntityIndexInBlock = entityBlockViewer.mEntityIndexInBlock;
+		if (IsValid() == true)
+		{
+			mTargetEntityBlock->mColdData->mEntityBlockViewers[mEntityIndexInBlock] = this;
+		}
+		entityBlockViewer.DeInitializeEntityBlockViewer();
+	}
+	return *this;
+}
+
+culling::EntityBlockViewer::~EntityBlockViewer()
+{
+	DetachFromEntityBlock();
+}
 
 void culling::EntityBlockViewer::SetMeshVertexData
 (
@@ -43,13 +90,29 @@ void culling::EntityBlockViewer::SetMeshVertexData
 )
 {
 	assert(IsValid() == true);
+	assert(verticeCount <= UINT32_MAX && indiceCount <= UINT32_MAX && verticeStride <= UINT32_MAX);
+	if (IsValid() == true)
+	{
+		mTargetEntityBlock->mColdData->mVertexDatas[mEntityIndexInBlock].mVertices = vertices;
+		mTargetEntityBlock->mColdData->mVertexDatas[mEntityIndexInBlock].mVerticeCount = static_cast<std::uint32_t>(verticeCount);
+		mTargetEntityBlock->mColdData->mVertexDatas[mEntityIndexInBlock].mIndices = indices;
+		mTargetEntityBlock->mColdData->mVertexDatas[mEntityIndexInBlock].mIndiceCount = static_cast<std::uint32_t>(indiceCount);
+		mTargetEntityBlock->mColdData->mVertexDatas[mEntityIndexInBlock].mVertexStride = static_cast<std::uint32_t>(verticeStride);
+	}
+}
+
+void culling::EntityBlockViewer::SetOccluderMeshLODs
+(
+	const culling::OccluderMeshLOD* const coarseMeshLODs,
+	const std::uint32_t coarseMeshLODCount
+)
+{
+	assert(IsValid() == true);
+	assert(coarseMeshLODCount == 0 || coarseMeshLODs != nullptr);
 	if (IsValid() == true)
 	{
-		mTargetEntityBlock->mVertexDatas[mEntityIndexInBlock].mVertices = vertices;
-		mTargetEntityBlock->mVertexDatas[mEntityIndexInBlock].mVerticeCount = verticeCount;
-		mTargetEntityBlock->mVertexDatas[mEntityIndexInBlock].mIndices = indices;
-		mTargetEntityBlock->mVertexDatas[mEntityIndexInBlock].mIndiceCount = indiceCount;
-		mTargetEntityBlock->mVertexDatas[mEntityIndexInBlock].mVertexStride = verticeStride;
+		mTargetEntityBlock->mColdData->mVertexDatas[mEntityIndexInBlock].mCoarseMeshLODs = coarseMeshLODs;
+		mTargetEntityBlock->mColdData->mVertexDatas[mEntityIndexInBlock].mCoarseMeshLODCount = (coarseMeshLODs != nullptr) ? coarseMeshLODCount : 0;
 	}
 }
 
@@ -10,6 +10,10 @@ namespace culling
 
 	/// <summary>
 	/// Used for storing specific EntityBlock pointer
+	///
+	/// EntityBlock keeps pointer to viewer of each entity ( EntityBlockColdData::mEntityBlockViewers ),
+	/// so EveryCulling can update the viewer when entity is moved to other entity block.
+	/// Moving viewer updates the pointer
 	/// </summary>
 	class EntityBlockViewer
 	{
@@ -25,6 +29,11 @@ namespace culling
 
 		void DeInitializeEntityBlockViewer();
 		void ResetEntityData();
+		/// <summary>
+		/// Clear pointer to this viewer stored in entity block
+		/// </summary>
+		void DetachFromEntityBlock();
+		void Relocate(EntityBlock* const entityBlock, const size_t entityIndexInBlock);
 
 	public:
 
@@ -34,6 +43,7 @@ namespace culling
 		EntityBlockViewer& operator=(const EntityBlockViewer&) = delete;
 		EntityBlockViewer(EntityBlockViewer&&) noexcept;
 		EntityBlockViewer& operator=(EntityBlockViewer&&)noexcept ;
+		~EntityBlockViewer();
 
 		EVERYCULLING_FORCE_INLINE bool IsValid() const
 		{
@@ -70,6 +80,15 @@ namespace culling
 			return mTargetEntityBlock->GetIsCulled(mEntityIndexInBlock, cameraIndex);
 		}
 
+		/// <summary>
+		/// Bit i is set if entity isn't culled from camera i
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE std::uint64_t GetVisibleCameraMask() const
+		{
+			assert(IsValid() == true);
+			return mTargetEntityBlock->GetVisibleCameraMask(mEntityIndexInBlock);
+		}
+
 		EVERYCULLING_FORCE_INLINE void SetModelMatrix(const float* const modelMatrix)
 		{
 			assert(IsValid() == true);
@@ -95,11 +114,119 @@ namespace culling
 			const std::uint64_t indiceCount,
 			const std::uint64_t verticeStride
 		);
+
+		/// <summary>
+		/// Set coarse LODs of occluder mesh ( LOD 1, 2, ... ) from finer to coarser. LOD 0 is mesh set with SetMeshVertexData.
+		/// SolveMeshRoleStage selects LOD of occluder from its screen space area and distance to camera,
+		/// and BinTrianglesStage bins only indices of the LOD. Array is owned by user like vertices, indices
+		/// </summary>
+		void SetOccluderMeshLODs
+		(
+			const culling::OccluderMeshLOD* const coarseMeshLODs,
+			const std::uint32_t coarseMeshLODCount
+		);
 		
 		EVERYCULLING_FORCE_INLINE const culling::VertexData& GetVertexData() const
 		{
 			assert(IsValid() == true);
-			return mTargetEntityBlock->mVertexDatas[mEntityIndexInBlock];
+			return mTargetEntityBlock->mColdData->mVertexDatas[mEntityIndexInBlock];
+		}
+
+		/// <summary>
+		/// Set value emitted for this entity when it's visible ( VisibleEntityCompaction )
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE void SetUserData(const std::uint64_t userData)
+		{
+			assert(IsValid() == true);
+			if (IsValid() == true)
+			{
+				mTargetEntityBlock->SetUserData(mEntityIndexInBlock, userData);
+			}
+		}
+
+		EVERYCULLING_FORCE_INLINE std::uint64_t GetUserData() const
+		{
+			assert(IsValid() == true);
+			return mTargetEntityBlock->GetUserData(mEntityIndexInBlock);
+		}
+
+		/// <summary>
+		/// Set cell of cell graph of PortalCulling which entity is in. EVERYCULLING_INVALID_CELL_INDEX : not in any cell ( default )
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE void SetCellIndex(const std::uint32_t cellIndex)
+		{
+			assert(IsValid() == true);
+			if (IsValid() == true)
+			{
+				mTargetEntityBlock->SetCellIndex(mEntityIndexInBlock, cellIndex);
+			}
+		}
+
+		EVERYCULLING_FORCE_INLINE std::uint32_t GetCellIndex() const
+		{
+			assert(IsValid() == true);
+			return mTargetEntityBlock->GetCellIndex(mEntityIndexInBlock);
+		}
+
+		/// <summary>
+		/// Set index of entity in bitset of PVS bake file ( PVSBaker, PVSCulling ).
+		/// Only static entities should have PVS index. EVERYCULLING_INVALID_PVS_INDEX : not baked ( default )
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE void SetPVSIndex(const std::uint32_t pvsIndex)
+		{
+			assert(IsValid() == true);
+			if (IsValid() == true)
+			{
+				mTargetEntityBlock->SetPVSIndex(mEntityIndexInBlock, pvsIndex);
+			}
+		}
+
+		EVERYCULLING_FORCE_INLINE std::uint32_t GetPVSIndex() const
+		{
+			assert(IsValid() == true);
+			return mTargetEntityBlock->GetPVSIndex(mEntityIndexInBlock);
+		}
+
+		/// <summary>
+		/// Entity is culled by ScreenSpaceSizeCulling when its screen space aabb is smaller than this in pixels of depth buffer.
+		/// Min screen space size of camera is used together ( larger one wins )
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE void SetMinScreenSpaceSize(const float minScreenSpaceSize)
+		{
+			assert(IsValid() == true);
+			if (IsValid() == true)
+			{
+				mTargetEntityBlock->SetMinScreenSpaceSize(mEntityIndexInBlock, minScreenSpaceSize);
+			}
+		}
+
+		EVERYCULLING_FORCE_INLINE float GetMinScreenSpaceSize() const
+		{
+			assert(IsValid() == true);
+			return mTargetEntityBlock->GetMinScreenSpaceSize(mEntityIndexInBlock);
+		}
+
+		/// <summary>
+		/// Set LOD table of entity. LOD i is selected when area of screen space aabb ( pixels of depth buffer ) is at least lodScreenSpaceAreas[i].
+		/// lodScreenSpaceAreas has lodCount - 1 descending values. Last LOD is selected when area is smaller than every value.
+		/// lodCount 1 : LOD isn't selected ( default ). lodCount should be at most EVERYCULLING_MAX_LOD_COUNT
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE void SetLODScreenSpaceAreas(const float* const lodScreenSpaceAreas, const size_t lodCount)
+		{
+			assert(IsValid() == true);
+			if (IsValid() == true)
+			{
+				mTargetEntityBlock->SetLODScreenSpaceAreas(mEntityIndexInBlock, lodScreenSpaceAreas, lodCount);
+			}
+		}
+
+		/// <summary>
+		/// LOD selected for the camera at last cull job. Valid only if entity isn't culled from the camera
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE size_t GetLODIndex(const std::uint32_t cameraIndex) const
+		{
+			assert(IsValid() == true);
+			return mTargetEntityBlock->GetLODIndex(mEntityIndexInBlock, cameraIndex);
 		}
 
 		EVERYCULLING_FORCE_INLINE void SetIsObjectEnabled(const bool isEnabled)
@@ -125,7 +252,7 @@ namespace culling
 			assert(IsValid() == true);
 			if (IsValid() == true)
 			{
-				mTargetEntityBlock->mWorldPositionAndWorldBoundingSphereRadius[mEntityIndexInBlock].SetPosition(worldPos);
+				mTargetEntityBlock->SetEntityWorldPosition(mEntityIndexInBlock, worldPos);
 			}
 		}
 
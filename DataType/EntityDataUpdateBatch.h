@@ -0,0 +1,55 @@
+#pragma once
+
+#include "../EveryCullingCore.h"
+
+#include <cstddef>
+
+namespace culling
+{
+	class EntityBlockViewer;
+
+	/// <summary>
+	/// Array whose i th element is located at ( reinterpret_cast<const char*>(mData) + mStride * i ).
+	/// SoA array has stride of sizeof(element), member of AoS array has stride of sizeof(struct)
+	/// </summary>
+	template <typename T>
+	struct StridedArrayView
+	{
+		const T* mData = nullptr;
+		size_t mStride = sizeof(T);
+
+		EVERYCULLING_FORCE_INLINE const T& operator[](const size_t index) const
+		{
+			return *reinterpret_cast<const T*>(reinterpret_cast<const char*>(mData) + mStride * index);
+		}
+
+		EVERYCULLING_FORCE_INLINE bool IsNull() const
+		{
+			return mData == nullptr;
+		}
+	};
+
+	/// <summary>
+	/// Entity datas updated at once with EveryCulling::UpdateEntityDatas.
+	/// i th entity is updated with i th element of every array
+	/// </summary>
+	struct EntityDataUpdateBatch
+	{
+		StridedArrayView<EntityBlockViewer> mEntityBlockViewers;
+		/// <summary>
+		/// 3 floats ( x, y, z )
+		/// </summary>
+		StridedArrayView<float> mWorldPositions;
+		/// <summary>
+		/// 4 floats ( x, y, z, w ) like EntityBlockViewer::SetAABBWorldPosition
+		/// </summary>
+		StridedArrayView<float> mAABBMinWorldPoints;
+		StridedArrayView<float> mAABBMaxWorldPoints;
+		/// <summary>
+		/// 16 floats. Model matrix isn't updated if this is null
+		/// </summary>
+		StridedArrayView<float> mModelMatrixes;
+
+		size_t mEntityCount = 0;
+	};
+}
@@ -109,3 +109,92 @@ void culling::ExtractSIMDPlanesFromViewProjectionMatrix(const Mat4x4& viewProjec
 	eightPlanes[7][3] = sixPlane[5][3];
 
 }
+
+bool culling::CheckIsAABBOutsideOfFrustum(const Vec3& aabbMinPoint, const Vec3& aabbMaxPoint, const Vec4* const eightPlanes, const float margin) noexcept
+{
+	for (size_t planeIndex = 0; planeIndex < 6; planeIndex++)
+	{
+		// component of plane 0 ~ 3 is stored at eightPlanes[0 ~ 3][planeIndex], plane 4, 5 is stored at eightPlanes[4 ~ 7][planeIndex - 4]
+		const size_t componentOffset = (planeIndex < 4) ? 0 : 4;
+		const size_t componentIndex = (planeIndex < 4) ? planeIndex : (planeIndex - 4);
+		const float normalX = eightPlanes[componentOffset + 0][componentIndex];
+		const float normalY = eightPlanes[componentOffset + 1][componentIndex];
+		const float normalZ = eightPlanes[componentOffset + 2][componentIndex];
+		const float distance = eightPlanes[componentOffset + 3][componentIndex];
+
+		// corner of aabb farthest along plane normal
+		const float x = (normalX > 0.0f) ? aabbMaxPoint.x : aabbMinPoint.x;
+		const float y = (normalY > 0.0f) ? aabbMaxPoint.y : aabbMinPoint.y;
+		const float z = (normalZ > 0.0f) ? aabbMaxPoint.z : aabbMinPoint.z;
+
+		if (normalX * x + normalY * y + normalZ * z + distance < -margin)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+culling::Vec4 culling::GetPlaneOfSIMDPlanes(const Vec4* const eightPlanes, const size_t planeIndex) noexcept
+{
+	assert(planeIndex < 6);
+
+	const size_t componentOffset = (planeIndex < 4) ? 0 : 4;
+	const size_t componentIndex = (planeIndex < 4) ? planeIndex : (planeIndex - 4);
+
+	Vec4 plane;
+	for (size_t component = 0; component < 4; component++)
+	{
+		plane[component] = eightPlanes[componentOffset + component][componentIndex];
+	}
+	return plane;
+}
+
+void culling::SetPlaneOfSIMDPlanes(Vec4* const eightPlanes, const size_t planeIndex, const Vec4& plane) noexcept
+{
+	assert(planeIndex < 6);
+
+	for (size_t component = 0; component < 4; component++)
+	{
+		if (planeIndex < 4)
+		{
+			eightPlanes[component][planeIndex] = plane[component];
+		}
+		else
+		{
+			// plane 4, 5 is stored twice to fill 4 lanes
+			eightPlanes[4 + component][planeIndex - 4] = plane[component];
+			eightPlanes[4 + component][planeIndex - 2] = plane[component];
+		}
+	}
+}
+
+bool culling::CheckIsAABBFartherThan(const Vec3& aabbMinPoint, const Vec3& aabbMaxPoint, const Vec3& point, const float distance) noexcept
+{
+	// closest point of aabb to the point
+	const float dx = point.x - EVERYCULLING_MIN(EVERYCULLING_MAX(point.x, aabbMinPoint.x), aabbMaxPoint.x);
+	const float dy = point.y - EVERYCULLING_MIN(EVERYCULLING_MAX(point.y, aabbMinPoint.y), aabbMaxPoint.y);
+	const float dz = point.z - EVERYCULLING_MIN(EVERYCULLING_MAX(point.z, aabbMinPoint.z), aabbMaxPoint.z);
+
+	return std::sqrt(dx * dx + dy * dy + dz * dz) > distance;
+}
+
+namespace
+{
+	// Insert two zero bits between each of lower 10 bits
+	std::uint32_t SpreadBitsForMortonCode(std::uint32_t value) noexcept
+	{
+		value &= 0x000003FF;
+		value = (value | (value << 16)) & 0x030000FF;
+		value = (value | (value << 8)) & 0x0300F00F;
+		value = (value | (value << 4)) & 0x030C30C3;
+		value = (value | (value << 2)) & 0x09249249;
+		return value;
+	}
+}
+
+std::uint32_t culling::ComputeMortonCode(const std::uint32_t x, const std::uint32_t y, const std::uint32_t z) noexcept
+{
+	return SpreadBitsForMortonCode(x) | (SpreadBitsForMortonCode(y) << 1) | (SpreadBitsForMortonCode(z) << 2);
+}
@@ -31,6 +31,31 @@ namespace culling
 
 	void ExtractSIMDPlanesFromViewProjectionMatrix(const Mat4x4& viewProjectionMatrix, Vec4* eightPlanes, bool normalize) noexcept;
 
+	/// <summary>
+	/// Check if aabb is outside of one of six planes extracted by ExtractSIMDPlanesFromViewProjectionMatrix.
+	/// Aabb is culled only when it's farther than margin from the plane
+	/// </summary>
+	bool CheckIsAABBOutsideOfFrustum(const Vec3& aabbMinPoint, const Vec3& aabbMaxPoint, const Vec4* const eightPlanes, const float margin) noexcept;
+
+	/// <summary>
+	/// Get plane of planeIndex ( 0 : left, 1 : right, 2 : top, 3 : bottom, 4 : near, 5 : far ) from planes extracted by ExtractSIMDPlanesFromViewProjectionMatrix
+	/// </summary>
+	Vec4 GetPlaneOfSIMDPlanes(const Vec4* const eightPlanes, const size_t planeIndex) noexcept;
+	/// <summary>
+	/// Replace plane of planeIndex of planes extracted by ExtractSIMDPlanesFromViewProjectionMatrix
+	/// </summary>
+	void SetPlaneOfSIMDPlanes(Vec4* const eightPlanes, const size_t planeIndex, const Vec4& plane) noexcept;
+
+	/// <summary>
+	/// Check if closest point of aabb to the point is farther than distance
+	/// </summary>
+	bool CheckIsAABBFartherThan(const Vec3& aabbMinPoint, const Vec3& aabbMaxPoint, const Vec3& point, const float distance) noexcept;
+
+	/// <summary>
+	/// Interleave bits of 10 bit x, y, z coordinates. Close points have close codes
+	/// </summary>
+	std::uint32_t ComputeMortonCode(const std::uint32_t x, const std::uint32_t y, const std::uint32_t z) noexcept;
+
 	EVERYCULLING_FORCE_INLINE Vec4 operator*(const culling::Mat4x4& mat4, const culling::Vec3& vec3) noexcept
 	{
 		return Vec4
@@ -61,7 +86,7 @@ namespace culling
 
 	EVERYCULLING_FORCE_INLINE culling::Mat4x4 operator*(const culling::Mat4x4& mat4_A, const culling::Mat4x4& mat4_B) noexcept
 	{
-		culling::EVERYCULLING_M256F _REULST_MAT4[2];
+		culling::EVERYCULLING_M128F _REULST_MAT4[4];
 		culling::EVERYCULLING_M128F TEMP_M128F;
 
 		const culling::EVERYCULLING_M128F* const A = reinterpret_cast<const culling::EVERYCULLING_M128F*>(mat4_A.data());
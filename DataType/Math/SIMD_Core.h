@@ -1,7 +1,14 @@
 #pragma once
 #include "../../EveryCullingCore.h"
 
-#if defined(__AVX2__)
+#include <cstdint>
+
+// Every translation unit requires SSE4.1.
+// 8 wide vectors ( EVERYCULLING_M256F, EVERYCULLING_M256I ) are 256bit register in translation unit compiled with AVX2,
+// and two 128bit halves ( lane 0 ~ 3, lane 4 ~ 7 ) otherwise. Operation working in 128bit lane ( ex) shuffle ) works in each half.
+// 8 wide vectors are declared in inline namespace of the instruction set,
+// so inline functions taking them are never shared between translation units compiled with different instruction set
+#if defined(__SSE4_1__) || defined(_MSC_VER)
 
 #include <immintrin.h>
 
@@ -62,70 +69,12 @@ namespace culling
 
 	using EVERYCULLING_M128I = EVERYCULLING_UNION_M128I;
 
-	union EVERYCULLING_UNION_M256F {
-		__m256 raw;    // SSE 4 x float vector
-		float m128_f32[8];  // scalar array of 4 floats
-
-		EVERYCULLING_FORCE_INLINE operator __m256() { return raw; }
-		EVERYCULLING_FORCE_INLINE operator __m256() const { return raw; }
-		EVERYCULLING_FORCE_INLINE operator __m256* () { return &raw; }
-		EVERYCULLING_FORCE_INLINE operator const __m256* () const { return &raw; }
-		EVERYCULLING_FORCE_INLINE __m256* operator& () { return &raw; }
-		EVERYCULLING_FORCE_INLINE const __m256* operator& () const { return &raw; }
-
-		EVERYCULLING_FORCE_INLINE EVERYCULLING_UNION_M256F() {}
-		EVERYCULLING_FORCE_INLINE EVERYCULLING_UNION_M256F(const __m256& _raw) : raw(_raw) {}
-	};
-
-	using EVERYCULLING_M256F = EVERYCULLING_UNION_M256F;
-
-	union EVERYCULLING_UNION_M256D {
-		__m256d raw;    // SSE 4 x float vector
-		double m128_d32[4];  // scalar array of 4 floats
-
-		EVERYCULLING_FORCE_INLINE operator __m256d() { return raw; }
-		EVERYCULLING_FORCE_INLINE operator __m256d() const { return raw; }
-		EVERYCULLING_FORCE_INLINE operator __m256d* () { return &raw; }
-		EVERYCULLING_FORCE_INLINE operator const __m256d* () const { return &raw; }
-		EVERYCULLING_FORCE_INLINE __m256d* operator& () { return &raw; }
-		EVERYCULLING_FORCE_INLINE const __m256d* operator& () const { return &raw; }
-
-		EVERYCULLING_FORCE_INLINE EVERYCULLING_UNION_M256D() {}
-		EVERYCULLING_FORCE_INLINE EVERYCULLING_UNION_M256D(const __m256d& _raw) : raw(_raw) {}
-	};
-
-	using EVERYCULLING_M256D = EVERYCULLING_UNION_M256D;
-
-	union EVERYCULLING_UNION_M256I {
-		__m256i raw;    // SSE 4 x float vector
-		int m128_i32[8];  // scalar array of 4 floats
-
-		EVERYCULLING_FORCE_INLINE operator __m256i() { return raw; }
-		EVERYCULLING_FORCE_INLINE operator __m256i() const { return raw; }
-		EVERYCULLING_FORCE_INLINE operator __m256i* () { return &raw; }
-		EVERYCULLING_FORCE_INLINE operator const __m256i* () const { return &raw; }
-		EVERYCULLING_FORCE_INLINE __m256i* operator& () { return &raw; }
-		EVERYCULLING_FORCE_INLINE const __m256i* operator& () const { return &raw; }
-
-		EVERYCULLING_FORCE_INLINE EVERYCULLING_UNION_M256I() {}
-		EVERYCULLING_FORCE_INLINE EVERYCULLING_UNION_M256I(const __m256i& _raw) : raw(_raw) {}
-	};
-
-	using EVERYCULLING_M256I = EVERYCULLING_UNION_M256I;
-
-
 #elif defined(_MSC_VER)
 
 	using EVERYCULLING_M128F = __m128;
 	using EVERYCULLING_M128D = __m128d;
 	using EVERYCULLING_M128I = __m128i;
 
-
-
-	using EVERYCULLING_M256F = __m256;
-	using EVERYCULLING_M256D = __m256d;
-	using EVERYCULLING_M256I = __m256i;
-
 #endif
 
 
@@ -151,19 +100,11 @@ namespace culling
 #endif
 
 #ifndef EVERYCULLING_M128F_REPLICATE
-#define EVERYCULLING_M128F_REPLICATE(_M128F, ElementIndex) _mm_permute_ps(_M128F, EVERYCULLING_SHUFFLEMASK(ElementIndex, ElementIndex, ElementIndex, ElementIndex)) 
+#define EVERYCULLING_M128F_REPLICATE(_M128F, ElementIndex) _mm_shuffle_ps(_M128F, _M128F, EVERYCULLING_SHUFFLEMASK(ElementIndex, ElementIndex, ElementIndex, ElementIndex)) 
 #endif
 
 #ifndef EVERYCULLING_M128F_SWIZZLE
-#define EVERYCULLING_M128F_SWIZZLE(_M128F, X, Y, Z, W) _mm_permute_ps(_M128F, EVERYCULLING_SHUFFLEMASK(X, Y, Z, W)) 
-#endif
-
-#ifndef EVERYCULLING_M256F_REPLICATE
-#define EVERYCULLING_M256F_REPLICATE(_M256F, ElementIndex) _mm256_permute_ps(_M256F, EVERYCULLING_SHUFFLEMASK(ElementIndex, ElementIndex, ElementIndex, ElementIndex)) 
-#endif
-
-#ifndef EVERYCULLING_M256F_SWIZZLE
-#define EVERYCULLING_M256F_SWIZZLE(_M256F, X, Y, Z, W) _mm256_permute_ps(_M256F, EVERYCULLING_SHUFFLEMASK(X, Y, Z, W)) 
+#define EVERYCULLING_M128F_SWIZZLE(_M128F, X, Y, Z, W) _mm_shuffle_ps(_M128F, _M128F, EVERYCULLING_SHUFFLEMASK(X, Y, Z, W)) 
 #endif
 
 	extern const culling::EVERYCULLING_M128F M128F_Zero;
@@ -175,51 +116,26 @@ namespace culling
 		return _mm_add_ps(M128_A, M128_B);
 	}
 
-	EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_ADD(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B)
-	{
-		return _mm256_add_ps(M256_A, M256_B);
-	}
-
 	EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M128F EVERYCULLING_M128F_SUB(const culling::EVERYCULLING_M128F& M128_A, const culling::EVERYCULLING_M128F& M128_B)
 	{
 		return _mm_sub_ps(M128_A, M128_B);
 	}
 
-	EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_SUB(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B)
-	{
-		return _mm256_sub_ps(M256_A, M256_B);
-	}
-
 	EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M128F EVERYCULLING_M128F_MUL(const culling::EVERYCULLING_M128F& M128_A, const culling::EVERYCULLING_M128F& M128_B)
 	{
 		return _mm_mul_ps(M128_A, M128_B);
 	}
 
-	EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_MUL(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B)
-	{
-		return _mm256_mul_ps(M256_A, M256_B);
-	}
-
 	EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M128F EVERYCULLING_M128F_DIV(const culling::EVERYCULLING_M128F& M128_A, const culling::EVERYCULLING_M128F& M128_B)
 	{
 		return _mm_div_ps(M128_A, M128_B);
 	}
 
-	EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_DIV(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B)
-	{
-		return _mm256_div_ps(M256_A, M256_B);
-	}
-
 	EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M128F EVERYCULLING_M128F_MUL_AND_ADD(const culling::EVERYCULLING_M128F& M128_A, const culling::EVERYCULLING_M128F& M128_B, const culling::EVERYCULLING_M128F& M128_C)
 	{
 		return culling::EVERYCULLING_M128F_ADD(culling::EVERYCULLING_M128F_MUL(M128_A, M128_B), M128_C);
 	}
 
-	EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_MUL_AND_ADD(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B, const culling::EVERYCULLING_M256F& M256_C)
-	{
-		return _mm256_fmadd_ps(M256_A, M256_B, M256_C);
-	}
-
 	/*EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M128F EVERYCULLING_M128F_CROSS(const culling::EVERYCULLING_M128F& M128_A, const culling::EVERYCULLING_M128F& M128_B)
 	{
 		culling::EVERYCULLING_M128F A_YZXW = _mm_shuffle_ps(M128_A.raw, M128_A.raw, EVERYCULLING_SHUFFLEMASK(1, 2, 0, 3));
@@ -227,49 +143,662 @@ namespace culling
 		culling::EVERYCULLING_M128F A_ZXYW = _mm_shuffle_ps(M128_A, M128_A, EVERYCULLING_SHUFFLEMASK(2, 0, 1, 3));
 		culling::EVERYCULLING_M128F B_YZXW = _mm_shuffle_ps(M128_B, M128_B, EVERYCULLING_SHUFFLEMASK(1, 2, 0, 3));
 		return EVERYCULLING_M128F_SUB(EVERYCULLING_M128F_MUL(A_YZXW, B_ZXYW), EVERYCULLING_M128F_MUL(A_ZXYW, B_YZXW));
-	}
-
-	EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_CROSS(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B)
-	{
-		culling::EVERYCULLING_M256F A_YZXW = _mm256_shuffle_ps(M256_A, M256_A, EVERYCULLING_SHUFFLEMASK(1, 2, 0, 3));
-		culling::EVERYCULLING_M256F B_ZXYW = _mm256_shuffle_ps(M256_B, M256_B, EVERYCULLING_SHUFFLEMASK(2, 0, 1, 3));
-		culling::EVERYCULLING_M256F A_ZXYW = _mm256_shuffle_ps(M256_A, M256_A, EVERYCULLING_SHUFFLEMASK(2, 0, 1, 3));
-		culling::EVERYCULLING_M256F B_YZXW = _mm256_shuffle_ps(M256_B, M256_B, EVERYCULLING_SHUFFLEMASK(1, 2, 0, 3));
-		return EVERYCULLING_M256F_SUB(EVERYCULLING_M256F_MUL(A_YZXW, B_ZXYW), EVERYCULLING_M256F_MUL(A_ZXYW, B_YZXW));
 	}*/
+}
 
+#if defined(__AVX2__)
+#define EVERYCULLING_M256_INSTRUCTION_SET avx2
+#else
+#define EVERYCULLING_M256_INSTRUCTION_SET sse4_1
+#endif
 
-	EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_SELECT(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B, const culling::EVERYCULLING_M256F& MASK)
+namespace culling
+{
+	inline namespace EVERYCULLING_M256_INSTRUCTION_SET
 	{
-		return _mm256_blendv_ps(M256_A, M256_B, MASK);
-	}
 
-	EVERYCULLING_FORCE_INLINE void EVERYCULLING_M256F_SWAP(culling::EVERYCULLING_M256F& M256_A, culling::EVERYCULLING_M256F& M256_B, const culling::EVERYCULLING_M256F& MASK)
-	{
-		const culling::EVERYCULLING_M256F TEMP_A = M256_A;
-		const culling::EVERYCULLING_M256F TEMP_B = M256_B;
-		M256_A = culling::EVERYCULLING_M256F_SELECT(TEMP_A, TEMP_B, MASK);
-		M256_B = culling::EVERYCULLING_M256F_SELECT(TEMP_B, TEMP_A, MASK);
-	}
+#if defined(__AVX2__)
 
-	/*
-	EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_MIN(culling::EVERYCULLING_M256F& M256_A, culling::EVERYCULLING_M256F& M256_B)
-	{
-		return _mm256_min_ps(M256_A, M256_B);
-	}
+#if defined(__GNUC__)  || defined( __clang__)
 
-	EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_MAX(culling::EVERYCULLING_M256F& M256_A, culling::EVERYCULLING_M256F& M256_B)
-	{
-		return _mm256_max_ps(M256_A, M256_B);
-	}
-	*/
-	
-}
+		union EVERYCULLING_UNION_M256F {
+			__m256 raw;    // SSE 4 x float vector
+			float m128_f32[8];  // scalar array of 4 floats
+
+			EVERYCULLING_FORCE_INLINE operator __m256() { return raw; }
+			EVERYCULLING_FORCE_INLINE operator __m256() const { return raw; }
+			EVERYCULLING_FORCE_INLINE operator __m256* () { return &raw; }
+			EVERYCULLING_FORCE_INLINE operator const __m256* () const { return &raw; }
+			EVERYCULLING_FORCE_INLINE __m256* operator& () { return &raw; }
+			EVERYCULLING_FORCE_INLINE const __m256* operator& () const { return &raw; }
+
+			EVERYCULLING_FORCE_INLINE EVERYCULLING_UNION_M256F() {}
+			EVERYCULLING_FORCE_INLINE EVERYCULLING_UNION_M256F(const __m256& _raw) : raw(_raw) {}
+		};
+
+		using EVERYCULLING_M256F = EVERYCULLING_UNION_M256F;
+
+		union EVERYCULLING_UNION_M256D {
+			__m256d raw;    // SSE 4 x float vector
+			double m128_d32[4];  // scalar array of 4 floats
+
+			EVERYCULLING_FORCE_INLINE operator __m256d() { return raw; }
+			EVERYCULLING_FORCE_INLINE operator __m256d() const { return raw; }
+			EVERYCULLING_FORCE_INLINE operator __m256d* () { return &raw; }
+			EVERYCULLING_FORCE_INLINE operator const __m256d* () const { return &raw; }
+			EVERYCULLING_FORCE_INLINE __m256d* operator& () { return &raw; }
+			EVERYCULLING_FORCE_INLINE const __m256d* operator& () const { return &raw; }
+
+			EVERYCULLING_FORCE_INLINE EVERYCULLING_UNION_M256D() {}
+			EVERYCULLING_FORCE_INLINE EVERYCULLING_UNION_M256D(const __m256d& _raw) : raw(_raw) {}
+		};
+
+		using EVERYCULLING_M256D = EVERYCULLING_UNION_M256D;
+
+		union EVERYCULLING_UNION_M256I {
+			__m256i raw;    // SSE 4 x float vector
+			int m128_i32[8];  // scalar array of 4 floats
+
+			EVERYCULLING_FORCE_INLINE operator __m256i() { return raw; }
+			EVERYCULLING_FORCE_INLINE operator __m256i() const { return raw; }
+			EVERYCULLING_FORCE_INLINE operator __m256i* () { return &raw; }
+			EVERYCULLING_FORCE_INLINE operator const __m256i* () const { return &raw; }
+			EVERYCULLING_FORCE_INLINE __m256i* operator& () { return &raw; }
+			EVERYCULLING_FORCE_INLINE const __m256i* operator& () const { return &raw; }
+
+			EVERYCULLING_FORCE_INLINE EVERYCULLING_UNION_M256I() {}
+			EVERYCULLING_FORCE_INLINE EVERYCULLING_UNION_M256I(const __m256i& _raw) : raw(_raw) {}
+		};
+
+		using EVERYCULLING_M256I = EVERYCULLING_UNION_M256I;
+
+#elif defined(_MSC_VER)
+
+		using EVERYCULLING_M256F = __m256;
+		using EVERYCULLING_M256D = __m256d;
+		using EVERYCULLING_M256I = __m256i;
+
+#endif
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_SET1(const float value)
+		{
+			return _mm256_set1_ps(value);
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_SETR(const float e0, const float e1, const float e2, const float e3, const float e4, const float e5, const float e6, const float e7)
+		{
+			return _mm256_setr_ps(e0, e1, e2, e3, e4, e5, e6, e7);
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_SETZERO()
+		{
+			return _mm256_setzero_ps();
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_ADD(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B)
+		{
+			return _mm256_add_ps(M256_A, M256_B);
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_SUB(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B)
+		{
+			return _mm256_sub_ps(M256_A, M256_B);
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_MUL(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B)
+		{
+			return _mm256_mul_ps(M256_A, M256_B);
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_DIV(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B)
+		{
+			return _mm256_div_ps(M256_A, M256_B);
+		}
+
+		/// <summary>
+		/// A * B + C. Multiply and add aren't fused, so every instruction set returns same result
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_MUL_AND_ADD(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B, const culling::EVERYCULLING_M256F& M256_C)
+		{
+			return culling::EVERYCULLING_M256F_ADD(culling::EVERYCULLING_M256F_MUL(M256_A, M256_B), M256_C);
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_MIN(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B)
+		{
+			return _mm256_min_ps(M256_A, M256_B);
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_MAX(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B)
+		{
+			return _mm256_max_ps(M256_A, M256_B);
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_FLOOR(const culling::EVERYCULLING_M256F& M256_A)
+		{
+			return _mm256_floor_ps(M256_A);
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_CEIL(const culling::EVERYCULLING_M256F& M256_A)
+		{
+			return _mm256_ceil_ps(M256_A);
+		}
+
+		/// <summary>
+		/// Round to nearest integer
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_ROUND(const culling::EVERYCULLING_M256F& M256_A)
+		{
+			return _mm256_round_ps(M256_A, (_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_CMP_LT(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B)
+		{
+			return _mm256_cmp_ps(M256_A, M256_B, _CMP_LT_OQ);
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_CMP_LE(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B)
+		{
+			return _mm256_cmp_ps(M256_A, M256_B, _CMP_LE_OQ);
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_CMP_GT(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B)
+		{
+			return _mm256_cmp_ps(M256_A, M256_B, _CMP_GT_OQ);
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_CMP_GE(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B)
+		{
+			return _mm256_cmp_ps(M256_A, M256_B, _CMP_GE_OQ);
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_AND(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B)
+		{
+			return _mm256_and_ps(M256_A, M256_B);
+		}
+
+		/// <summary>
+		/// ( ~A ) & B
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_ANDNOT(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B)
+		{
+			return _mm256_andnot_ps(M256_A, M256_B);
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_XOR(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B)
+		{
+			return _mm256_xor_ps(M256_A, M256_B);
+		}
+
+		EVERYCULLING_FORCE_INLINE int EVERYCULLING_M256F_MOVEMASK(const culling::EVERYCULLING_M256F& M256_A)
+		{
+			return _mm256_movemask_ps(M256_A);
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_SELECT(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B, const culling::EVERYCULLING_M256F& MASK)
+		{
+			return _mm256_blendv_ps(M256_A, M256_B, MASK);
+		}
+
+		/// <summary>
+		/// Convert to integer with current rounding mode ( round to nearest )
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256F_TO_M256I(const culling::EVERYCULLING_M256F& M256_A)
+		{
+			return _mm256_cvtps_epi32(M256_A);
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256F_TRUNCATE_TO_M256I(const culling::EVERYCULLING_M256F& M256_A)
+		{
+			return _mm256_cvttps_epi32(M256_A);
+		}
+
+		/// <summary>
+		/// Load float at base + byte offset of each lane
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_GATHER(const float* const base, const culling::EVERYCULLING_M256I& M256I_BYTE_OFFSET)
+		{
+			return _mm256_i32gather_ps(base, M256I_BYTE_OFFSET, 1);
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_SET1(const int value)
+		{
+			return _mm256_set1_epi32(value);
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_SETR(const int e0, const int e1, const int e2, const int e3, const int e4, const int e5, const int e6, const int e7)
+		{
+			return _mm256_setr_epi32(e0, e1, e2, e3, e4, e5, e6, e7);
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_SETR_EPI8(const char e0, const char e1, const char e2, const char e3, const char e4, const char e5, const char e6, const char e7, const char e8, const char e9, const char e10, const char e11, const char e12, const char e13, const char e14, const char e15, const char e16, const char e17, const char e18, const char e19, const char e20, const char e21, const char e22, const char e23, const char e24, const char e25, const char e26, const char e27, const char e28, const char e29, const char e30, const char e31)
+		{
+			return _mm256_setr_epi8(e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31);
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_SETZERO()
+		{
+			return _mm256_setzero_si256();
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_SUB(const culling::EVERYCULLING_M256I& M256I_A, const culling::EVERYCULLING_M256I& M256I_B)
+		{
+			return _mm256_sub_epi32(M256I_A, M256I_B);
+		}
+
+		/// <summary>
+		/// Low 32 bit of A * B
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_MULLO(const culling::EVERYCULLING_M256I& M256I_A, const culling::EVERYCULLING_M256I& M256I_B)
+		{
+			return _mm256_mullo_epi32(M256I_A, M256I_B);
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_MIN(const culling::EVERYCULLING_M256I& M256I_A, const culling::EVERYCULLING_M256I& M256I_B)
+		{
+			return _mm256_min_epi32(M256I_A, M256I_B);
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_MAX(const culling::EVERYCULLING_M256I& M256I_A, const culling::EVERYCULLING_M256I& M256I_B)
+		{
+			return _mm256_max_epi32(M256I_A, M256I_B);
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_CMP_EQ(const culling::EVERYCULLING_M256I& M256I_A, const culling::EVERYCULLING_M256I& M256I_B)
+		{
+			return _mm256_cmpeq_epi32(M256I_A, M256I_B);
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_CMP_GT(const culling::EVERYCULLING_M256I& M256I_A, const culling::EVERYCULLING_M256I& M256I_B)
+		{
+			return _mm256_cmpgt_epi32(M256I_A, M256I_B);
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_CMP_EQ_EPI8(const culling::EVERYCULLING_M256I& M256I_A, const culling::EVERYCULLING_M256I& M256I_B)
+		{
+			return _mm256_cmpeq_epi8(M256I_A, M256I_B);
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_AND(const culling::EVERYCULLING_M256I& M256I_A, const culling::EVERYCULLING_M256I& M256I_B)
+		{
+			return _mm256_and_si256(M256I_A, M256I_B);
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_OR(const culling::EVERYCULLING_M256I& M256I_A, const culling::EVERYCULLING_M256I& M256I_B)
+		{
+			return _mm256_or_si256(M256I_A, M256I_B);
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_XOR(const culling::EVERYCULLING_M256I& M256I_A, const culling::EVERYCULLING_M256I& M256I_B)
+		{
+			return _mm256_xor_si256(M256I_A, M256I_B);
+		}
+
+		/// <summary>
+		/// Shift each lane by count of the lane ( logical left ). Lane is zero if count is greater than 31
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_SHIFT_LEFT(const culling::EVERYCULLING_M256I& M256I_A, const culling::EVERYCULLING_M256I& M256I_COUNT)
+		{
+			return _mm256_sllv_epi32(M256I_A, M256I_COUNT);
+		}
+
+		/// <summary>
+		/// Shift each lane by count of the lane ( logical right ). Lane is zero if count is greater than 31
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_SHIFT_RIGHT(const culling::EVERYCULLING_M256I& M256I_A, const culling::EVERYCULLING_M256I& M256I_COUNT)
+		{
+			return _mm256_srlv_epi32(M256I_A, M256I_COUNT);
+		}
+
+		/// <summary>
+		/// Shuffle bytes in each 128 bit half
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_SHUFFLE_EPI8(const culling::EVERYCULLING_M256I& M256I_A, const culling::EVERYCULLING_M256I& M256I_B)
+		{
+			return _mm256_shuffle_epi8(M256I_A, M256I_B);
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256I_TO_M256F(const culling::EVERYCULLING_M256I& M256I_A)
+		{
+			return _mm256_cvtepi32_ps(M256I_A);
+		}
+
+		EVERYCULLING_FORCE_INLINE int EVERYCULLING_M256I_TEST_ALL_ONES(const culling::EVERYCULLING_M256I& M256I_A)
+		{
+			return _mm256_testc_si256(M256I_A, _mm256_set1_epi32(-1));
+		}
+
+		/// <summary>
+		/// Load int at base[ index ] of each lane
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_GATHER(const int* const base, const culling::EVERYCULLING_M256I& M256I_INDEX)
+		{
+			return _mm256_i32gather_epi32(base, M256I_INDEX, 4);
+		}
 
 #else
 
-#error "Please enable AVX2"
+		union alignas(32) EVERYCULLING_UNION_M256F {
+			struct
+			{
+				__m128 low; // lane 0 ~ 3
+				__m128 high; // lane 4 ~ 7
+			};
+			float m128_f32[8];  // scalar array of 8 floats
+
+			EVERYCULLING_FORCE_INLINE EVERYCULLING_UNION_M256F() {}
+			EVERYCULLING_FORCE_INLINE EVERYCULLING_UNION_M256F(const __m128& _low, const __m128& _high) { low = _low; high = _high; }
+		};
+
+		using EVERYCULLING_M256F = EVERYCULLING_UNION_M256F;
+
+		union alignas(32) EVERYCULLING_UNION_M256I {
+			struct
+			{
+				__m128i low; // lane 0 ~ 3
+				__m128i high; // lane 4 ~ 7
+			};
+			int m128_i32[8];  // scalar array of 8 ints
+
+			EVERYCULLING_FORCE_INLINE EVERYCULLING_UNION_M256I() {}
+			EVERYCULLING_FORCE_INLINE EVERYCULLING_UNION_M256I(const __m128i& _low, const __m128i& _high) { low = _low; high = _high; }
+		};
+
+		using EVERYCULLING_M256I = EVERYCULLING_UNION_M256I;
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_SET1(const float value)
+		{
+			return culling::EVERYCULLING_M256F{ _mm_set1_ps(value), _mm_set1_ps(value) };
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_SETR(const float e0, const float e1, const float e2, const float e3, const float e4, const float e5, const float e6, const float e7)
+		{
+			return culling::EVERYCULLING_M256F{ _mm_setr_ps(e0, e1, e2, e3), _mm_setr_ps(e4, e5, e6, e7) };
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_SETZERO()
+		{
+			return culling::EVERYCULLING_M256F{ _mm_setzero_ps(), _mm_setzero_ps() };
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_ADD(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B)
+		{
+			return culling::EVERYCULLING_M256F{ _mm_add_ps(M256_A.low, M256_B.low), _mm_add_ps(M256_A.high, M256_B.high) };
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_SUB(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B)
+		{
+			return culling::EVERYCULLING_M256F{ _mm_sub_ps(M256_A.low, M256_B.low), _mm_sub_ps(M256_A.high, M256_B.high) };
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_MUL(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B)
+		{
+			return culling::EVERYCULLING_M256F{ _mm_mul_ps(M256_A.low, M256_B.low), _mm_mul_ps(M256_A.high, M256_B.high) };
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_DIV(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B)
+		{
+			return culling::EVERYCULLING_M256F{ _mm_div_ps(M256_A.low, M256_B.low), _mm_div_ps(M256_A.high, M256_B.high) };
+		}
+
+		/// <summary>
+		/// A * B + C. Multiply and add aren't fused, so every instruction set returns same result
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_MUL_AND_ADD(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B, const culling::EVERYCULLING_M256F& M256_C)
+		{
+			return culling::EVERYCULLING_M256F_ADD(culling::EVERYCULLING_M256F_MUL(M256_A, M256_B), M256_C);
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_MIN(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B)
+		{
+			return culling::EVERYCULLING_M256F{ _mm_min_ps(M256_A.low, M256_B.low), _mm_min_ps(M256_A.high, M256_B.high) };
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_MAX(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B)
+		{
+			return culling::EVERYCULLING_M256F{ _mm_max_ps(M256_A.low, M256_B.low), _mm_max_ps(M256_A.high, M256_B.high) };
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_FLOOR(const culling::EVERYCULLING_M256F& M256_A)
+		{
+			return culling::EVERYCULLING_M256F{ _mm_floor_ps(M256_A.low), _mm_floor_ps(M256_A.high) };
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_CEIL(const culling::EVERYCULLING_M256F& M256_A)
+		{
+			return culling::EVERYCULLING_M256F{ _mm_ceil_ps(M256_A.low), _mm_ceil_ps(M256_A.high) };
+		}
+
+		/// <summary>
+		/// Round to nearest integer
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_ROUND(const culling::EVERYCULLING_M256F& M256_A)
+		{
+			return culling::EVERYCULLING_M256F{ _mm_round_ps(M256_A.low, (_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)), _mm_round_ps(M256_A.high, (_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)) };
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_CMP_LT(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B)
+		{
+			return culling::EVERYCULLING_M256F{ _mm_cmplt_ps(M256_A.low, M256_B.low), _mm_cmplt_ps(M256_A.high, M256_B.high) };
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_CMP_LE(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B)
+		{
+			return culling::EVERYCULLING_M256F{ _mm_cmple_ps(M256_A.low, M256_B.low), _mm_cmple_ps(M256_A.high, M256_B.high) };
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_CMP_GT(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B)
+		{
+			return culling::EVERYCULLING_M256F{ _mm_cmpgt_ps(M256_A.low, M256_B.low), _mm_cmpgt_ps(M256_A.high, M256_B.high) };
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_CMP_GE(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B)
+		{
+			return culling::EVERYCULLING_M256F{ _mm_cmpge_ps(M256_A.low, M256_B.low), _mm_cmpge_ps(M256_A.high, M256_B.high) };
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_AND(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B)
+		{
+			return culling::EVERYCULLING_M256F{ _mm_and_ps(M256_A.low, M256_B.low), _mm_and_ps(M256_A.high, M256_B.high) };
+		}
+
+		/// <summary>
+		/// ( ~A ) & B
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_ANDNOT(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B)
+		{
+			return culling::EVERYCULLING_M256F{ _mm_andnot_ps(M256_A.low, M256_B.low), _mm_andnot_ps(M256_A.high, M256_B.high) };
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_XOR(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B)
+		{
+			return culling::EVERYCULLING_M256F{ _mm_xor_ps(M256_A.low, M256_B.low), _mm_xor_ps(M256_A.high, M256_B.high) };
+		}
+
+		EVERYCULLING_FORCE_INLINE int EVERYCULLING_M256F_MOVEMASK(const culling::EVERYCULLING_M256F& M256_A)
+		{
+			return _mm_movemask_ps(M256_A.low) | (_mm_movemask_ps(M256_A.high) << 4);
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_SELECT(const culling::EVERYCULLING_M256F& M256_A, const culling::EVERYCULLING_M256F& M256_B, const culling::EVERYCULLING_M256F& MASK)
+		{
+			return culling::EVERYCULLING_M256F{ _mm_blendv_ps(M256_A.low, M256_B.low, MASK.low), _mm_blendv_ps(M256_A.high, M256_B.high, MASK.high) };
+		}
+
+		/// <summary>
+		/// Convert to integer with current rounding mode ( round to nearest )
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256F_TO_M256I(const culling::EVERYCULLING_M256F& M256_A)
+		{
+			return culling::EVERYCULLING_M256I{ _mm_cvtps_epi32(M256_A.low), _mm_cvtps_epi32(M256_A.high) };
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256F_TRUNCATE_TO_M256I(const culling::EVERYCULLING_M256F& M256_A)
+		{
+			return culling::EVERYCULLING_M256I{ _mm_cvttps_epi32(M256_A.low), _mm_cvttps_epi32(M256_A.high) };
+		}
+
+		/// <summary>
+		/// Load float at base + byte offset of each lane
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256F_GATHER(const float* const base, const culling::EVERYCULLING_M256I& M256I_BYTE_OFFSET)
+		{
+			culling::EVERYCULLING_M256F gathered;
+			for (size_t i = 0; i < 8; i++)
+			{
+				gathered.m128_f32[i] = *reinterpret_cast<const float*>(reinterpret_cast<const char*>(base) + M256I_BYTE_OFFSET.m128_i32[i]);
+			}
+			return gathered;
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_SET1(const int value)
+		{
+			return culling::EVERYCULLING_M256I{ _mm_set1_epi32(value), _mm_set1_epi32(value) };
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_SETR(const int e0, const int e1, const int e2, const int e3, const int e4, const int e5, const int e6, const int e7)
+		{
+			return culling::EVERYCULLING_M256I{ _mm_setr_epi32(e0, e1, e2, e3), _mm_setr_epi32(e4, e5, e6, e7) };
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_SETR_EPI8(const char e0, const char e1, const char e2, const char e3, const char e4, const char e5, const char e6, const char e7, const char e8, const char e9, const char e10, const char e11, const char e12, const char e13, const char e14, const char e15, const char e16, const char e17, const char e18, const char e19, const char e20, const char e21, const char e22, const char e23, const char e24, const char e25, const char e26, const char e27, const char e28, const char e29, const char e30, const char e31)
+		{
+			return culling::EVERYCULLING_M256I{ _mm_setr_epi8(e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15), _mm_setr_epi8(e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31) };
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_SETZERO()
+		{
+			return culling::EVERYCULLING_M256I{ _mm_setzero_si128(), _mm_setzero_si128() };
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_SUB(const culling::EVERYCULLING_M256I& M256I_A, const culling::EVERYCULLING_M256I& M256I_B)
+		{
+			return culling::EVERYCULLING_M256I{ _mm_sub_epi32(M256I_A.low, M256I_B.low), _mm_sub_epi32(M256I_A.high, M256I_B.high) };
+		}
+
+		/// <summary>
+		/// Low 32 bit of A * B
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_MULLO(const culling::EVERYCULLING_M256I& M256I_A, const culling::EVERYCULLING_M256I& M256I_B)
+		{
+			return culling::EVERYCULLING_M256I{ _mm_mullo_epi32(M256I_A.low, M256I_B.low), _mm_mullo_epi32(M256I_A.high, M256I_B.high) };
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_MIN(const culling::EVERYCULLING_M256I& M256I_A, const culling::EVERYCULLING_M256I& M256I_B)
+		{
+			return culling::EVERYCULLING_M256I{ _mm_min_epi32(M256I_A.low, M256I_B.low), _mm_min_epi32(M256I_A.high, M256I_B.high) };
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_MAX(const culling::EVERYCULLING_M256I& M256I_A, const culling::EVERYCULLING_M256I& M256I_B)
+		{
+			return culling::EVERYCULLING_M256I{ _mm_max_epi32(M256I_A.low, M256I_B.low), _mm_max_epi32(M256I_A.high, M256I_B.high) };
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_CMP_EQ(const culling::EVERYCULLING_M256I& M256I_A, const culling::EVERYCULLING_M256I& M256I_B)
+		{
+			return culling::EVERYCULLING_M256I{ _mm_cmpeq_epi32(M256I_A.low, M256I_B.low), _mm_cmpeq_epi32(M256I_A.high, M256I_B.high) };
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_CMP_GT(const culling::EVERYCULLING_M256I& M256I_A, const culling::EVERYCULLING_M256I& M256I_B)
+		{
+			return culling::EVERYCULLING_M256I{ _mm_cmpgt_epi32(M256I_A.low, M256I_B.low), _mm_cmpgt_epi32(M256I_A.high, M256I_B.high) };
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_CMP_EQ_EPI8(const culling::EVERYCULLING_M256I& M256I_A, const culling::EVERYCULLING_M256I& M256I_B)
+		{
+			return culling::EVERYCULLING_M256I{ _mm_cmpeq_epi8(M256I_A.low, M256I_B.low), _mm_cmpeq_epi8(M256I_A.high, M256I_B.high) };
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_AND(const culling::EVERYCULLING_M256I& M256I_A, const culling::EVERYCULLING_M256I& M256I_B)
+		{
+			return culling::EVERYCULLING_M256I{ _mm_and_si128(M256I_A.low, M256I_B.low), _mm_and_si128(M256I_A.high, M256I_B.high) };
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_OR(const culling::EVERYCULLING_M256I& M256I_A, const culling::EVERYCULLING_M256I& M256I_B)
+		{
+			return culling::EVERYCULLING_M256I{ _mm_or_si128(M256I_A.low, M256I_B.low), _mm_or_si128(M256I_A.high, M256I_B.high) };
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_XOR(const culling::EVERYCULLING_M256I& M256I_A, const culling::EVERYCULLING_M256I& M256I_B)
+		{
+			return culling::EVERYCULLING_M256I{ _mm_xor_si128(M256I_A.low, M256I_B.low), _mm_xor_si128(M256I_A.high, M256I_B.high) };
+		}
+
+		/// <summary>
+		/// Shift each lane by count of the lane ( logical left ). Lane is zero if count is greater than 31
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_SHIFT_LEFT(const culling::EVERYCULLING_M256I& M256I_A, const culling::EVERYCULLING_M256I& M256I_COUNT)
+		{
+			culling::EVERYCULLING_M256I shifted;
+			for (size_t i = 0; i < 8; i++)
+			{
+				const std::uint32_t count = static_cast<std::uint32_t>(M256I_COUNT.m128_i32[i]);
+				shifted.m128_i32[i] = (count < 32) ? static_cast<int>(static_cast<std::uint32_t>(M256I_A.m128_i32[i]) << count) : 0;
+			}
+			return shifted;
+		}
+
+		/// <summary>
+		/// Shift each lane by count of the lane ( logical right ). Lane is zero if count is greater than 31
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_SHIFT_RIGHT(const culling::EVERYCULLING_M256I& M256I_A, const culling::EVERYCULLING_M256I& M256I_COUNT)
+		{
+			culling::EVERYCULLING_M256I shifted;
+			for (size_t i = 0; i < 8; i++)
+			{
+				const std::uint32_t count = static_cast<std::uint32_t>(M256I_COUNT.m128_i32[i]);
+				shifted.m128_i32[i] = (count < 32) ? static_cast<int>(static_cast<std::uint32_t>(M256I_A.m128_i32[i]) >> count) : 0;
+			}
+			return shifted;
+		}
+
+		/// <summary>
+		/// Shuffle bytes in each 128 bit half
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_SHUFFLE_EPI8(const culling::EVERYCULLING_M256I& M256I_A, const culling::EVERYCULLING_M256I& M256I_B)
+		{
+			return culling::EVERYCULLING_M256I{ _mm_shuffle_epi8(M256I_A.low, M256I_B.low), _mm_shuffle_epi8(M256I_A.high, M256I_B.high) };
+		}
+
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256F EVERYCULLING_M256I_TO_M256F(const culling::EVERYCULLING_M256I& M256I_A)
+		{
+			return culling::EVERYCULLING_M256F{ _mm_cvtepi32_ps(M256I_A.low), _mm_cvtepi32_ps(M256I_A.high) };
+		}
+
+		EVERYCULLING_FORCE_INLINE int EVERYCULLING_M256I_TEST_ALL_ONES(const culling::EVERYCULLING_M256I& M256I_A)
+		{
+			return _mm_test_all_ones(M256I_A.low) & _mm_test_all_ones(M256I_A.high);
+		}
+
+		/// <summary>
+		/// Load int at base[ index ] of each lane
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE culling::EVERYCULLING_M256I EVERYCULLING_M256I_GATHER(const int* const base, const culling::EVERYCULLING_M256I& M256I_INDEX)
+		{
+			culling::EVERYCULLING_M256I gathered;
+			for (size_t i = 0; i < 8; i++)
+			{
+				gathered.m128_i32[i] = base[M256I_INDEX.m128_i32[i]];
+			}
+			return gathered;
+		}
 
 #endif
 
+		EVERYCULLING_FORCE_INLINE void EVERYCULLING_M256F_SWAP(culling::EVERYCULLING_M256F& M256_A, culling::EVERYCULLING_M256F& M256_B, const culling::EVERYCULLING_M256F& MASK)
+		{
+			const culling::EVERYCULLING_M256F TEMP_A = M256_A;
+			const culling::EVERYCULLING_M256F TEMP_B = M256_B;
+			M256_A = culling::EVERYCULLING_M256F_SELECT(TEMP_A, TEMP_B, MASK);
+			M256_B = culling::EVERYCULLING_M256F_SELECT(TEMP_B, TEMP_A, MASK);
+		}
+
+		static_assert(sizeof(culling::EVERYCULLING_M256F) == 32 && alignof(culling::EVERYCULLING_M256F) == 32);
+		static_assert(sizeof(culling::EVERYCULLING_M256I) == 32 && alignof(culling::EVERYCULLING_M256I) == 32);
+	}
+}
+
+#else
 
+#error "Please enable SSE4.1"
+
+#endif
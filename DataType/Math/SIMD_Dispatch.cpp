@@ -0,0 +1,119 @@
+#include "SIMD_Dispatch.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+namespace
+{
+	struct CPUFeatures
+	{
+		bool mIsSSE4_1Supported;
+		bool mIsAVX2Supported;
+		bool mIsAVX512Supported;
+
+		CPUFeatures()
+			: mIsSSE4_1Supported(false), mIsAVX2Supported(false), mIsAVX512Supported(false)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+
+			// __builtin_cpu_supports also checks if os saves ymm, zmm registers
+			__builtin_cpu_init();
+			mIsSSE4_1Supported = __builtin_cpu_supports("sse4.1");
+			mIsAVX2Supported = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+			mIsAVX512Supported = __builtin_cpu_supports("avx512f");
+
+#elif defined(_MSC_VER)
+
+			int cpuInfo[4];
+			__cpuid(cpuInfo, 0);
+			const int maxLeaf = cpuInfo[0];
+
+			__cpuid(cpuInfo, 1);
+			mIsSSE4_1Supported = (cpuInfo[2] & (1 << 19)) != 0;
+			const bool isFMASupported = (cpuInfo[2] & (1 << 12)) != 0;
+			const bool isOSXSaveSupported = (cpuInfo[2] & (1 << 27)) != 0;
+
+			if (isOSXSaveSupported == true && maxLeaf >= 7)
+			{
+				const unsigned long long xcr0 = _xgetbv(0);
+				const bool isYMMSaved = (xcr0 & 0x6) == 0x6;
+				const bool isZMMSaved = (xcr0 & 0xE6) == 0xE6;
+
+				__cpuidex(cpuInfo, 7, 0);
+				mIsAVX2Supported = isYMMSaved && isFMASupported && ((cpuInfo[1] & (1 << 5)) != 0);
+				mIsAVX512Supported = isZMMSaved && ((cpuInfo[1] & (1 << 16)) != 0);
+			}
+
+#endif
+		}
+	};
+
+	const CPUFeatures& GetCPUFeatures()
+	{
+		static const CPUFeatures cpuFeatures{};
+		return cpuFeatures;
+	}
+}
+
+bool culling::IsSIMDInstructionSetSupported(const SIMDInstructionSet instructionSet)
+{
+	const CPUFeatures& cpuFeatures = GetCPUFeatures();
+
+	bool isSupported = false;
+	switch (instructionSet)
+	{
+	case SIMDInstructionSet::SSE4_1:
+		isSupported = cpuFeatures.mIsSSE4_1Supported;
+		break;
+
+	case SIMDInstructionSet::AVX2:
+		isSupported = cpuFeatures.mIsAVX2Supported;
+		break;
+
+	case SIMDInstructionSet::AVX512:
+		// AVX512 kernels are compiled only when compiler supports it
+		isSupported = (EVERYCULLING_AVX512_KERNEL == 1) && cpuFeatures.mIsAVX512Supported;
+		break;
+	}
+
+	return isSupported;
+}
+
+culling::SIMDInstructionSet culling::GetBestSupportedSIMDInstructionSet()
+{
+	if (IsSIMDInstructionSetSupported(SIMDInstructionSet::AVX512) == true)
+	{
+		return SIMDInstructionSet::AVX512;
+	}
+	else if (IsSIMDInstructionSetSupported(SIMDInstructionSet::AVX2) == true)
+	{
+		return SIMDInstructionSet::AVX2;
+	}
+	else
+	{
+		return SIMDInstructionSet::SSE4_1;
+	}
+}
+
+const char* culling::GetSIMDInstructionSetName(const SIMDInstructionSet instructionSet)
+{
+	const char* name = "";
+	switch (instructionSet)
+	{
+	case SIMDInstructionSet::SSE4_1:
+		name = "SSE4.1";
+		break;
+
+	case SIMDInstructionSet::AVX2:
+		name = "AVX2";
+		break;
+
+	case SIMDInstructionSet::AVX512:
+		name = "AVX512";
+		break;
+	}
+
+	return name;
+}
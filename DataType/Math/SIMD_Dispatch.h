@@ -0,0 +1,30 @@
+#pragma once
+
+#include "../../EveryCullingCore.h"
+
+namespace culling
+{
+	/// <summary>
+	/// Instruction set of entity culling kernels ( view frustum culling, distance culling )
+	/// and depth buffer kernels ( screen space aabb projection, binning and rasterizing occluders )
+	/// Kernel variant is picked at runtime with cpuid.
+	///
+	/// Depth buffer of masked sw occlusion culling is built on 256bit tile ( 32 x 8 ) coverage mask.
+	/// SSE4_1 variant of depth buffer kernels handles it as two 128bit halves, AVX512 uses AVX2 variant of them
+	/// </summary>
+	enum class SIMDInstructionSet : std::uint32_t
+	{
+		SSE4_1,
+		AVX2,
+		AVX512
+	};
+
+	bool IsSIMDInstructionSetSupported(const SIMDInstructionSet instructionSet);
+
+	/// <summary>
+	/// Get widest instruction set supported by both of cpu and this build
+	/// </summary>
+	SIMDInstructionSet GetBestSupportedSIMDInstructionSet();
+
+	const char* GetSIMDInstructionSetName(const SIMDInstructionSet instructionSet);
+}
@@ -107,12 +107,12 @@ namespace culling
 		const culling::EVERYCULLING_M256F triArea = culling::EVERYCULLING_M256F_SUB(triArea1, triArea2);
 		
 		//_CMP_GT_OQ vs _CMP_GT_OQ : https://stackoverflow.com/questions/16988199/how-to-choose-avx-compare-predicate-variants
-		const culling::EVERYCULLING_M256F ccwMask = _mm256_cmp_ps(triArea, _mm256_set1_ps(0.0f), _CMP_GT_OQ);
+		const culling::EVERYCULLING_M256F ccwMask = culling::EVERYCULLING_M256F_CMP_GT(triArea, culling::EVERYCULLING_M256F_SET1(0.0f));
 
 		//Set each bit of mask dst based on the most significant bit of the corresponding packed single-precision (32-bit) floating-point element in a.
 		//https://software.intel.com/sites/landingpage/IntrinsicsGuide/#techs=SSE,SSE2,SSE3,SSSE3,SSE4_1,SSE4_2,AVX&expand=2156,4979,4979,1731,4929,951,4979,3869&text=movemask
 		//if second triangle is front facing, low second bit of triangleCullMask is 1
-		return static_cast<std::uint32_t>(_mm256_movemask_ps(ccwMask));
+		return static_cast<std::uint32_t>(culling::EVERYCULLING_M256F_MOVEMASK(ccwMask));
 	}
 
 	
@@ -135,15 +135,15 @@ namespace culling
 	{
 		culling::EVERYCULLING_M256F MASK;
 
-		MASK = _mm256_cmp_ps(TriPointY[0], TriPointY[1], _CMP_LT_OQ);
+		MASK = culling::EVERYCULLING_M256F_CMP_LT(TriPointY[0], TriPointY[1]);
 		culling::EVERYCULLING_M256F_SWAP(TriPointX[0], TriPointX[1], MASK);
 		culling::EVERYCULLING_M256F_SWAP(TriPointY[0], TriPointY[1], MASK);
 
-		MASK = _mm256_cmp_ps(TriPointY[0], TriPointY[2], _CMP_LT_OQ);
+		MASK = culling::EVERYCULLING_M256F_CMP_LT(TriPointY[0], TriPointY[2]);
 		culling::EVERYCULLING_M256F_SWAP(TriPointX[0], TriPointX[2], MASK);
 		culling::EVERYCULLING_M256F_SWAP(TriPointY[0], TriPointY[2], MASK);
 
-		MASK = _mm256_cmp_ps(TriPointY[1], TriPointY[2], _CMP_LT_OQ);
+		MASK = culling::EVERYCULLING_M256F_CMP_LT(TriPointY[1], TriPointY[2]);
 		culling::EVERYCULLING_M256F_SWAP(TriPointX[1], TriPointX[2], MASK);
 		culling::EVERYCULLING_M256F_SWAP(TriPointY[1], TriPointY[2], MASK);
 	}
@@ -167,17 +167,17 @@ namespace culling
 	{
 		culling::EVERYCULLING_M256F MASK;
 
-		MASK = _mm256_cmp_ps(TriPointY[0], TriPointY[1], _CMP_LT_OQ);
+		MASK = culling::EVERYCULLING_M256F_CMP_LT(TriPointY[0], TriPointY[1]);
 		culling::EVERYCULLING_M256F_SWAP(TriPointX[0], TriPointX[1], MASK);
 		culling::EVERYCULLING_M256F_SWAP(TriPointY[0], TriPointY[1], MASK);
 		culling::EVERYCULLING_M256F_SWAP(TriPointZ[0], TriPointZ[1], MASK);
 
-		MASK = _mm256_cmp_ps(TriPointY[0], TriPointY[2], _CMP_LT_OQ);
+		MASK = culling::EVERYCULLING_M256F_CMP_LT(TriPointY[0], TriPointY[2]);
 		culling::EVERYCULLING_M256F_SWAP(TriPointX[0], TriPointX[2], MASK);
 		culling::EVERYCULLING_M256F_SWAP(TriPointY[0], TriPointY[2], MASK);
 		culling::EVERYCULLING_M256F_SWAP(TriPointZ[0], TriPointZ[2], MASK);
 
-		MASK = _mm256_cmp_ps(TriPointY[1], TriPointY[2], _CMP_LT_OQ);
+		MASK = culling::EVERYCULLING_M256F_CMP_LT(TriPointY[1], TriPointY[2]);
 		culling::EVERYCULLING_M256F_SWAP(TriPointX[1], TriPointX[2], MASK);
 		culling::EVERYCULLING_M256F_SWAP(TriPointY[1], TriPointY[2], MASK);
 		culling::EVERYCULLING_M256F_SWAP(TriPointZ[1], TriPointZ[2], MASK);
@@ -197,15 +197,15 @@ namespace culling
 	{
 		culling::EVERYCULLING_M256F MASK;
 		
-		MASK = _mm256_cmp_ps(TriPointA_Y, TriPointB_Y, _CMP_LT_OQ);
+		MASK = culling::EVERYCULLING_M256F_CMP_LT(TriPointA_Y, TriPointB_Y);
 		culling::EVERYCULLING_M256F_SWAP(TriPointA_X, TriPointB_X, MASK);
 		culling::EVERYCULLING_M256F_SWAP(TriPointA_Y, TriPointB_Y, MASK);
 
-		MASK = _mm256_cmp_ps(TriPointA_Y, TriPointC_Y, _CMP_LT_OQ);
+		MASK = culling::EVERYCULLING_M256F_CMP_LT(TriPointA_Y, TriPointC_Y);
 		culling::EVERYCULLING_M256F_SWAP(TriPointA_X, TriPointC_X, MASK);
 		culling::EVERYCULLING_M256F_SWAP(TriPointA_Y, TriPointC_Y, MASK);
 
-		MASK = _mm256_cmp_ps(TriPointB_Y, TriPointC_Y, _CMP_LT_OQ);
+		MASK = culling::EVERYCULLING_M256F_CMP_LT(TriPointB_Y, TriPointC_Y);
 		culling::EVERYCULLING_M256F_SWAP(TriPointB_X, TriPointC_X, MASK);
 		culling::EVERYCULLING_M256F_SWAP(TriPointB_Y, TriPointC_Y, MASK);
 	}
@@ -227,17 +227,17 @@ namespace culling
 	{
 		culling::EVERYCULLING_M256F MASK;
 
-		MASK = _mm256_cmp_ps(TriPointA_Y, TriPointB_Y, _CMP_LT_OQ);
+		MASK = culling::EVERYCULLING_M256F_CMP_LT(TriPointA_Y, TriPointB_Y);
 		culling::EVERYCULLING_M256F_SWAP(TriPointA_X, TriPointB_X, MASK);
 		culling::EVERYCULLING_M256F_SWAP(TriPointA_Y, TriPointB_Y, MASK);
 		culling::EVERYCULLING_M256F_SWAP(TriPointA_Z, TriPointB_Z, MASK);
 
-		MASK = _mm256_cmp_ps(TriPointA_Y, TriPointC_Y, _CMP_LT_OQ);
+		MASK = culling::EVERYCULLING_M256F_CMP_LT(TriPointA_Y, TriPointC_Y);
 		culling::EVERYCULLING_M256F_SWAP(TriPointA_X, TriPointC_X, MASK);
 		culling::EVERYCULLING_M256F_SWAP(TriPointA_Y, TriPointC_Y, MASK);
 		culling::EVERYCULLING_M256F_SWAP(TriPointA_Z, TriPointC_Z, MASK);
 
-		MASK = _mm256_cmp_ps(TriPointB_Y, TriPointC_Y, _CMP_LT_OQ);
+		MASK = culling::EVERYCULLING_M256F_CMP_LT(TriPointB_Y, TriPointC_Y);
 		culling::EVERYCULLING_M256F_SWAP(TriPointB_X, TriPointC_X, MASK);
 		culling::EVERYCULLING_M256F_SWAP(TriPointB_Y, TriPointC_Y, MASK);
 		culling::EVERYCULLING_M256F_SWAP(TriPointB_Z, TriPointC_Z, MASK);
@@ -262,17 +262,17 @@ namespace culling
 	{
 		culling::EVERYCULLING_M256F MASK;
 
-		MASK = _mm256_cmp_ps(TriPointA_Y, TriPointB_Y, _CMP_LT_OQ);
+		MASK = culling::EVERYCULLING_M256F_CMP_LT(TriPointA_Y, TriPointB_Y);
 		culling::EVERYCULLING_M256F_SWAP(TriPointA_X, TriPointB_X, MASK);
 		culling::EVERYCULLING_M256F_SWAP(TriPointA_Y, TriPointB_Y, MASK);
 		culling::EVERYCULLING_M256F_SWAP(TriPointA_Z, TriPointB_Z, MASK);
 		
-		MASK = _mm256_cmp_ps(TriPointA_Y, TriPointC_Y, _CMP_LT_OQ);
+		MASK = culling::EVERYCULLING_M256F_CMP_LT(TriPointA_Y, TriPointC_Y);
 		culling::EVERYCULLING_M256F_SWAP(TriPointA_X, TriPointC_X, MASK);
 		culling::EVERYCULLING_M256F_SWAP(TriPointA_Y, TriPointC_Y, MASK);
 		culling::EVERYCULLING_M256F_SWAP(TriPointA_Z, TriPointC_Z, MASK);
 
-		MASK = _mm256_cmp_ps(TriPointB_Y, TriPointC_Y, _CMP_LT_OQ);
+		MASK = culling::EVERYCULLING_M256F_CMP_LT(TriPointB_Y, TriPointC_Y);
 		culling::EVERYCULLING_M256F_SWAP(TriPointB_X, TriPointC_X, MASK);
 		culling::EVERYCULLING_M256F_SWAP(TriPointB_Y, TriPointC_Y, MASK);
 		culling::EVERYCULLING_M256F_SWAP(TriPointB_Z, TriPointC_Z, MASK);
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "../EveryCullingCore.h"
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace culling
+{
+	/// <summary>
+	/// Array holding state of each camera, sized to camera count instead of EVERYCULLING_MAX_CAMERA_COUNT.
+	/// Resized at EveryCulling::SetCameraCount. Storage only grows, so shrinking and growing again doesn't allocate.
+	///
+	/// Elements are kept on growth if T is move assignable.
+	/// Other elements ( atomic counters, barriers ) are value initialized again, so don't resize while cull job is running
+	/// </summary>
+	template <typename T>
+	class PerCameraArray
+	{
+	private:
+
+		std::unique_ptr<T[]> mElements;
+		size_t mSize;
+		size_t mCapacity;
+
+	public:
+
+		PerCameraArray()
+			: mElements{}, mSize{ 0 }, mCapacity{ 0 }
+		{
+		}
+		PerCameraArray(const PerCameraArray&) = delete;
+		PerCameraArray& operator=(const PerCameraArray&) = delete;
+
+		void Resize(const size_t size)
+		{
+			assert(size <= EVERYCULLING_MAX_CAMERA_COUNT);
+
+			if (size > mCapacity)
+			{
+				std::unique_ptr<T[]> elements{ new T[size]() };
+				if constexpr (std::is_move_assignable<T>::value == true)
+				{
+					for (size_t index = 0; index < mCapacity; index++)
+					{
+						elements[index] = std::move(mElements[index]);
+					}
+				}
+				mElements = std::move(elements);
+				mCapacity = size;
+			}
+			mSize = size;
+		}
+
+		EVERYCULLING_FORCE_INLINE T& operator[](const size_t index)
+		{
+			assert(index < mSize);
+			return mElements[index];
+		}
+		EVERYCULLING_FORCE_INLINE const T& operator[](const size_t index) const
+		{
+			assert(index < mSize);
+			return mElements[index];
+		}
+
+		EVERYCULLING_FORCE_INLINE size_t size() const
+		{
+			return mSize;
+		}
+
+		EVERYCULLING_FORCE_INLINE T* begin()
+		{
+			return mElements.get();
+		}
+		EVERYCULLING_FORCE_INLINE T* end()
+		{
+			return mElements.get() + mSize;
+		}
+		EVERYCULLING_FORCE_INLINE const T* begin() const
+		{
+			return mElements.get();
+		}
+		EVERYCULLING_FORCE_INLINE const T* end() const
+		{
+			return mElements.get() + mSize;
+		}
+	};
+}
@@ -6,22 +6,53 @@
 
 namespace culling
 {
+	/// <summary>
+	/// Coarse LOD of occluder mesh. Vertices have same stride with LOD 0 ( VertexData::mVertexStride ).
+	/// LOD is selected in SolveMeshRoleStage when either condition is met, and coarsest selected LOD is binned
+	/// </summary>
+	struct OccluderMeshLOD
+	{
+		const culling::Vec3* mVertices;
+		const std::uint32_t* mIndices;
+		std::uint32_t mVerticeCount;
+		std::uint32_t mIndiceCount;
+
+		/// <summary>
+		/// Selected when area of screen space aabb of occluder ( pixels of depth buffer ) is smaller than this
+		/// </summary>
+		float mMaxScreenSpaceArea;
+		/// <summary>
+		/// Selected when distance from camera to bounding sphere of occluder is larger than this
+		/// </summary>
+		float mMinDistanceToCamera;
+	};
+
 	struct VertexData
 	{
 		std::atomic<std::uint64_t> mBinnedIndiceCount; //  8byte + ??
 
 		const culling::Vec3* mVertices; // 8byte or 4byte
-		std::uint64_t mVerticeCount; // 8byte
-
 		const std::uint32_t* mIndices; // 8byte or 4byte
-		std::uint64_t mIndiceCount; // 8byte
+
+		// Indices are 32 bit, so counts and stride are 32 bit to keep cold data of entity block small
+		std::uint32_t mVerticeCount; // 4byte
+		std::uint32_t mIndiceCount; // 4byte
 
 		/// <summary>
 		/// Vertex Stride ( offset between vertices )
 		///	ex) Vertex1.X Vertex1.Y Vertex1.Z Vertex1.UV_X(4byte) Vertex1.UV_Y(4byte) Vertex2.X Vertex2.Y Vertex2.Z
 		///		-> Stride is 8byte!
 		/// </summary>
-		std::uint64_t mVertexStride; // 8byte
+		std::uint32_t mVertexStride; // 4byte
+
+		/// <summary>
+		/// Count of mCoarseMeshLODs. 0 : only LOD 0 ( mVertices, mIndices ) is rasterized
+		/// </summary>
+		std::uint32_t mCoarseMeshLODCount; // 4byte
+		/// <summary>
+		/// LOD 1, 2, ... of occluder mesh from finer to coarser. Owned by user like vertices and indices
+		/// </summary>
+		const culling::OccluderMeshLOD* mCoarseMeshLODs; // 8byte or 4byte
 		
 		EVERYCULLING_FORCE_INLINE void Reset(const unsigned long long currentTickCount)
 		{
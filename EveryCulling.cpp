@@ -1,44 +1,63 @@
 #include "EveryCulling.h"
 
+#include <algorithm>
+#include <cfloat>
+#include <cstring>
 #include <thread>
 
 #include "DataType/EntityBlock.h"
+#include "DataType/Math/Common.h"
 #include "CullingModule/ViewFrustumCulling/ViewFrustumCulling.h"
 #include "CullingModule/PreCulling/PreCulling.h"
 #include "CullingModule/DistanceCulling/DistanceCulling.h"
+#include "CullingModule/FusedCulling/FusedCulling.h"
+#include "CullingModule/MultiViewCulling/MultiViewCulling.h"
+#include "CullingModule/ShadowCasterCulling/ShadowCasterCulling.h"
+#include "CullingModule/PortalCulling/PortalCulling.h"
+#include "CullingModule/PVSCulling/PVSCulling.h"
+#include "CullingModule/ScreenSpaceSizeCulling/ScreenSpaceSizeCulling.h"
+#include "CullingModule/HierarchyCulling/HierarchyCulling.h"
 #include "CullingModule/MaskedSWOcclusionCulling/MaskedSWOcclusionCulling.h"
+#include "CullingModule/VisibleEntityCompaction/VisibleEntityCompaction.h"
 
+namespace
+{
+	/// <summary>
+	/// Threads get slot in order of their first allocation, so up to EVERYCULLING_ENTITY_ALLOCATION_SLOT_COUNT threads don't share a slot
+	/// </summary>
+	std::uint32_t GetEntityAllocationSlotIndex()
+	{
+		static std::atomic<std::uint32_t> allocatingThreadCounter{ 0 };
+		thread_local const std::uint32_t entityAllocationSlotIndex = allocatingThreadCounter.fetch_add(1, std::memory_order_relaxed) % EVERYCULLING_ENTITY_ALLOCATION_SLOT_COUNT;
+		return entityAllocationSlotIndex;
+	}
+}
 
 void culling::EveryCulling::FreeEntityBlock(EntityBlock* freedEntityBlock)
 {
 	assert(freedEntityBlock != nullptr);
 
-	size_t freedEntityBlockIndex;
-	const size_t entityBlockCount = mActiveEntityBlockList.size();
-	bool IsSuccessToFind = false;
-	for (size_t i = 0; i < entityBlockCount; i++)
-	{
-		//Freeing entity block happen barely
-		//So this looping is acceptable
-		if (mActiveEntityBlockList[i] == freedEntityBlock)
-		{
-			freedEntityBlockIndex = i;
-			IsSuccessToFind = true;
-			break;
-		}
-	}
+	const std::uint32_t freedEntityBlockIndex = freedEntityBlock->mActiveEntityBlockListIndex;
+	assert(freedEntityBlockIndex < mActiveEntityBlockList.size());
+	assert(mActiveEntityBlockList[freedEntityBlockIndex] == freedEntityBlock);
 
-	assert(IsSuccessToFind == true);
+	EntityBlock* const lastEntityBlock = mActiveEntityBlockList.back();
+	mActiveEntityBlockList[freedEntityBlockIndex] = lastEntityBlock;
+	lastEntityBlock->mActiveEntityBlockListIndex = freedEntityBlockIndex;
+	mActiveEntityBlockList.pop_back();
+	mActiveEntityBlockListVersion++;
 
-	freedEntityBlock->bIsValidEntityBlock = false;
-	freedEntityBlock->mEntityBlockUniqueID = EVERYCULLING_INVALID_ENTITY_UNIQUE_ID_MAGIC_NUMBER;
-	mFreeEntityBlockList.push_back(freedEntityBlock);
+	ReleaseEntityBlockToPool(freedEntityBlock);
+}
 
-	if(IsSuccessToFind == true)
-	{
-		mActiveEntityBlockList.erase(mActiveEntityBlockList.begin() + freedEntityBlockIndex);
-	}
-	
+void culling::EveryCulling::ReleaseEntityBlockToPool(EntityBlock* const releasedEntityBlock)
+{
+	releasedEntityBlock->bIsValidEntityBlock = false;
+	releasedEntityBlock->mEntityBlockUniqueID = EVERYCULLING_INVALID_ENTITY_UNIQUE_ID_MAGIC_NUMBER;
+
+	// Other threads can take entity block from pool at AllocateNewEntity meanwhile
+	std::lock_guard<std::mutex> lock{ mEntityBlockListMutex };
+	mFreeEntityBlockList.push_back(releasedEntityBlock);
 }
 
 
@@ -82,15 +101,18 @@ void culling::EveryCulling::ResetEntityBlocks()
 
 void culling::EveryCulling::AllocateEntityBlockPool()
 {
-	EntityBlock* newEntityBlockChunk = new EntityBlock[EVERYCULLING_INITIAL_ENTITY_BLOCK_COUNT];
-	for (std::uint32_t i = 0; i < EVERYCULLING_INITIAL_ENTITY_BLOCK_COUNT; i++)
+	const size_t firstNewEntityBlockIndex = mEntityBlockArena.GetEntityBlockCount();
+	const size_t newEntityBlockCount = mEntityBlockArena.Grow(EVERYCULLING_INITIAL_ENTITY_BLOCK_COUNT);
+
+	// Pool is popped from back, so push in reverse order to hand out entity blocks in address order
+	for (size_t entityBlockIndex = firstNewEntityBlockIndex + newEntityBlockCount; entityBlockIndex-- > firstNewEntityBlockIndex;)
 	{
-		newEntityBlockChunk[i].bIsValidEntityBlock = false;
-		newEntityBlockChunk[i].mEntityBlockUniqueID = EVERYCULLING_INVALID_ENTITY_UNIQUE_ID_MAGIC_NUMBER;
+		EntityBlock* const newEntityBlock = mEntityBlockArena.GetEntityBlock(entityBlockIndex);
+		newEntityBlock->bIsValidEntityBlock = false;
+		newEntityBlock->mEntityBlockUniqueID = EVERYCULLING_INVALID_ENTITY_UNIQUE_ID_MAGIC_NUMBER;
 
-		mFreeEntityBlockList.push_back(newEntityBlockChunk + i);
+		mFreeEntityBlockList.push_back(newEntityBlock);
 	}
-	mAllocatedEntityBlockChunkList.push_back(newEntityBlockChunk);
 }
 
 
@@ -104,7 +126,19 @@ void culling::EveryCulling::RemoveEntityFromBlock(EntityBlock* ownerEntityBlock,
 		cullingModule->ClearEntityData(ownerEntityBlock, entityIndexInBlock);
 	}
 	
+	ownerEntityBlock->mColdData->mEntityBlockViewers[entityIndexInBlock] = nullptr;
+
 	assert(ownerEntityBlock->mCurrentEntityCount != 0);
+	assert(entityIndexInBlock < ownerEntityBlock->mCurrentEntityCount);
+
+	// Culling modules only look at [0, mCurrentEntityCount), so fill the hole with last entity
+	const std::uint32_t lastEntityIndexInBlock = ownerEntityBlock->mCurrentEntityCount - 1;
+	if (entityIndexInBlock != lastEntityIndexInBlock)
+	{
+		MoveEntity(ownerEntityBlock, entityIndexInBlock, ownerEntityBlock, lastEntityIndexInBlock);
+	}
+	ownerEntityBlock->ClearEntityData(lastEntityIndexInBlock);
+
 	ownerEntityBlock->mCurrentEntityCount--;
 	if (ownerEntityBlock->mCurrentEntityCount == 0)
 	{
@@ -113,51 +147,134 @@ void culling::EveryCulling::RemoveEntityFromBlock(EntityBlock* ownerEntityBlock,
 	
 }
 
+void culling::EveryCulling::MoveEntity
+(
+	EntityBlock* const dstEntityBlock, 
+	const std::uint32_t dstEntityIndexInBlock, 
+	EntityBlock* const srcEntityBlock, 
+	const std::uint32_t srcEntityIndexInBlock
+)
+{
+	dstEntityBlock->CopyEntityData(dstEntityIndexInBlock, *srcEntityBlock, srcEntityIndexInBlock);
+
+	EntityBlockViewer* const entityBlockViewer = dstEntityBlock->mColdData->mEntityBlockViewers[dstEntityIndexInBlock];
+	if (entityBlockViewer != nullptr)
+	{
+		entityBlockViewer->Relocate(dstEntityBlock, dstEntityIndexInBlock);
+	}
+}
+
 void culling::EveryCulling::ThreadCullJob(const size_t cameraIndex, const unsigned long long tickCount)
 {
+	assert(cameraIndex < mCameraCount);
+	// Cull job of camera 0 does MultiViewCulling for other cameras. Use ThreadMultiViewCullJob
+	assert(mMultiViewCulling->IsEnabled == false);
 
 	const std::uint32_t entityBlockCount = static_cast<std::uint32_t>(GetActiveEntityBlockCount());
 	const unsigned long long currentTickCount = mCurrentTickCount;
 
 	if (entityBlockCount > 0 && currentTickCount == tickCount)
 	{
-		mRunningThreadCount++;
+		// Thread keeps this index for all culling modules of this camera,
+		// so it works on same entity blocks in consecutive culling modules
+		const std::uint32_t threadIndex = mRunningThreadCount[cameraIndex]++;
 
 		for (size_t moduleIndex = 0; moduleIndex < mUpdatedCullingModules.size(); moduleIndex++)
 		{
-			culling::CullingModule* cullingModule = mUpdatedCullingModules[moduleIndex];
-			assert(cullingModule != nullptr);
+			RunCullingModule(cameraIndex, threadIndex, currentTickCount, mUpdatedCullingModules[moduleIndex]);
+		}
+	}
+}
 
-			if (cullingModule->IsEnabled == true)
-			{
-				OnStartCullingModule(cullingModule);
+void culling::EveryCulling::ThreadMultiViewCullJob(const unsigned long long tickCount)
+{
+	assert(mMultiViewCulling->IsEnabled == true);
 
-				cullingModule->ThreadCullJob(cameraIndex, currentTickCount);
+	const std::uint32_t entityBlockCount = static_cast<std::uint32_t>(GetActiveEntityBlockCount());
+	const unsigned long long currentTickCount = mCurrentTickCount;
 
-				std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (entityBlockCount > 0 && currentTickCount == tickCount)
+	{
+		// Thread joins cull job of every camera before running any culling module,
+		// so threads waiting at barrier of any camera count this thread
+		std::array<std::uint32_t, EVERYCULLING_MAX_CAMERA_COUNT> threadIndices;
+		for (size_t cameraIndex = 0; cameraIndex < mCameraCount; cameraIndex++)
+		{
+			threadIndices[cameraIndex] = mRunningThreadCount[cameraIndex]++;
+		}
 
-				while (cullingModule->GetFinishedThreadCount(cameraIndex) < mRunningThreadCount)
-				{
-					
-				}
+		const size_t multiViewCullingModuleIndex = static_cast<size_t>(std::find(mUpdatedCullingModules.begin(), mUpdatedCullingModules.end(), mMultiViewCulling.get()) - mUpdatedCullingModules.begin());
+		assert(multiViewCullingModuleIndex < mUpdatedCullingModules.size());
 
-				OnEndCullingModule(cullingModule);
+		// Culling modules until MultiViewCulling finish for every camera before next culling module
+		for (size_t moduleIndex = 0; moduleIndex <= multiViewCullingModuleIndex; moduleIndex++)
+		{
+			for (size_t cameraIndex = 0; cameraIndex < mCameraCount; cameraIndex++)
+			{
+				RunCullingModule(cameraIndex, threadIndices[cameraIndex], currentTickCount, mUpdatedCullingModules[moduleIndex]);
+			}
+		}
+
+		for (size_t cameraIndex = 0; cameraIndex < mCameraCount; cameraIndex++)
+		{
+			for (size_t moduleIndex = multiViewCullingModuleIndex + 1; moduleIndex < mUpdatedCullingModules.size(); moduleIndex++)
+			{
+				RunCullingModule(cameraIndex, threadIndices[cameraIndex], currentTickCount, mUpdatedCullingModules[moduleIndex]);
 			}
 		}
 	}
 }
 
+void culling::EveryCulling::RunCullingModule
+(
+	const size_t cameraIndex, 
+	const std::uint32_t threadIndex, 
+	const unsigned long long currentTickCount, 
+	culling::CullingModule* const cullingModule
+)
+{
+	assert(cullingModule != nullptr);
+
+	if (IsCullingModuleRunning(cullingModule) == true)
+	{
+		OnStartCullingModule(cullingModule);
+
+		cullingModule->ThreadCullJob(cameraIndex, threadIndex, currentTickCount);
+		mPhaseBarriers[cameraIndex].Notify();
+
+#ifdef EVERYCULLING_PROFILING_CULLING
+		const std::chrono::steady_clock::time_point waitStartTime = std::chrono::steady_clock::now();
+#endif
+
+		WaitToFinishCullingModule(cameraIndex, cullingModule);
+
+#ifdef EVERYCULLING_PROFILING_CULLING
+		cullingModule->AddWaitedTime(threadIndex, std::chrono::steady_clock::now() - waitStartTime);
+#endif
+
+		OnEndCullingModule(cullingModule);
+	}
+}
+
 
 void culling::EveryCulling::WaitToFinishCullJob(const std::uint32_t cameraIndex) const
 {
 	const CullingModule* lastEnabledCullingModule = GetLastEnabledCullingModule();
 	if(lastEnabledCullingModule != nullptr)
 	{
-		while (lastEnabledCullingModule->GetFinishedThreadCount(cameraIndex) < mRunningThreadCount)
-		{
+		WaitToFinishCullingModule(cameraIndex, lastEnabledCullingModule);
+	}
+}
 
+void culling::EveryCulling::WaitToFinishCullingModule(const size_t cameraIndex, const culling::CullingModule* const cullingModule) const
+{
+	mPhaseBarriers[cameraIndex].Wait
+	(
+		[this, cameraIndex, cullingModule]()
+		{
+			return cullingModule->GetFinishedThreadCount(cameraIndex) >= mRunningThreadCount[cameraIndex].load(std::memory_order_seq_cst);
 		}
-	}
+	);
 }
 
 void culling::EveryCulling::WaitToFinishCullJobOfAllCameras() const
@@ -171,21 +288,63 @@ void culling::EveryCulling::WaitToFinishCullJobOfAllCameras() const
 void culling::EveryCulling::PreCullJob()
 {
 	mCurrentTickCount++;
-	mRunningThreadCount = 0;
+
+	ApplyDeferredEntityChanges();
+
+	if (mEntityBlockRepackInterval != 0 && mCurrentTickCount % mEntityBlockRepackInterval == 0)
+	{
+		RepackEntityBlocks();
+	}
+	else if (mEntityBlockDefragmentInterval != 0 && mCurrentTickCount % mEntityBlockDefragmentInterval == 0)
+	{
+		// Repacked entity blocks are already full
+		DefragmentEntityBlocks();
+	}
 
 	ResetEntityBlocks();
+	// Culling modules read running thread count of last cull job, so reset it after this
 	ResetCullingModules();
 
+	for (std::atomic<std::uint32_t>& runningThreadCount : mRunningThreadCount)
+	{
+		runningThreadCount.store(0, std::memory_order_relaxed);
+	}
+
 	//release!
 	std::atomic_thread_fence(std::memory_order_seq_cst);
 }
 
+bool culling::EveryCulling::IsCullingModuleRunning(const culling::CullingModule* const cullingModule) const
+{
+	assert(cullingModule != nullptr);
+
+	// MultiViewCulling takes precedence over FusedCulling while both are enabled
+	const bool isMultiViewCullingRunning = mMultiViewCulling->IsEnabled;
+	const bool isFusedCullingRunning = (mFusedCulling->IsEnabled == true) && (isMultiViewCullingRunning == false);
+
+	if (cullingModule == mFusedCulling.get())
+	{
+		return isFusedCullingRunning;
+	}
+	else if (cullingModule == mPreCulling.get())
+	{
+		// MultiViewCulling needs PreCulling to project aabb of entities to screen space of each camera
+		return (isMultiViewCullingRunning == true) || (cullingModule->IsEnabled == true && isFusedCullingRunning == false);
+	}
+	else if (cullingModule == mDistanceCulling.get() || cullingModule == mViewFrustumCulling.get())
+	{
+		return (cullingModule->IsEnabled == true) && (isMultiViewCullingRunning == false) && (isFusedCullingRunning == false);
+	}
+
+	return cullingModule->IsEnabled;
+}
+
 const culling::CullingModule* culling::EveryCulling::GetLastEnabledCullingModule() const
 {
 	culling::CullingModule* lastEnabledCullingModule = nullptr;
 	for(int cullingModuleIndex = static_cast<int>(mUpdatedCullingModules.size()) - 1 ; cullingModuleIndex >= 0 ; cullingModuleIndex--)
 	{
-		if(mUpdatedCullingModules[cullingModuleIndex]->IsEnabled == true)
+		if(IsCullingModuleRunning(mUpdatedCullingModules[cullingModuleIndex]) == true)
 		{
 			lastEnabledCullingModule = mUpdatedCullingModules[cullingModuleIndex];
 			break;
@@ -196,6 +355,9 @@ const culling::CullingModule* culling::EveryCulling::GetLastEnabledCullingModule
 
 void culling::EveryCulling::SetEnabledCullingModule(const CullingModuleType cullingModuleType, const bool isEnabled)
 {
+	// Culling result of last tick is computed with other culling modules
+	InvalidateTemporalVisibility();
+
 	switch (cullingModuleType)
 	{
 
@@ -219,21 +381,77 @@ void culling::EveryCulling::SetEnabledCullingModule(const CullingModuleType cull
 
 		mDistanceCulling->IsEnabled = isEnabled;
 		break;
+
+	case CullingModuleType::FusedCulling:
+
+		// PreCulling, DistanceCulling, ViewFrustumCulling are skipped by scheduler while it runs. ( IsCullingModuleRunning )
+		mFusedCulling->IsEnabled = isEnabled;
+		break;
+
+	case CullingModuleType::MultiViewCulling:
+
+		// DistanceCulling, ViewFrustumCulling, FusedCulling are skipped by scheduler while it runs. ( IsCullingModuleRunning )
+		mMultiViewCulling->IsEnabled = isEnabled;
+		break;
+
+	case CullingModuleType::ShadowCasterCulling:
+
+		mShadowCasterCulling->IsEnabled = isEnabled;
+		break;
+
+	case CullingModuleType::PortalCulling:
+
+		mPortalCulling->IsEnabled = isEnabled;
+		break;
+
+	case CullingModuleType::PVSCulling:
+
+		mPVSCulling->IsEnabled = isEnabled;
+		break;
+
+	case CullingModuleType::ScreenSpaceSizeCulling:
+
+		mScreenSpaceSizeCulling->IsEnabled = isEnabled;
+		break;
+
+	case CullingModuleType::HierarchyCulling:
+
+		mHierarchyCulling->IsEnabled = isEnabled;
+		break;
+
+	case CullingModuleType::VisibleEntityCompaction:
+
+		mVisibleEntityCompaction->IsEnabled = isEnabled;
+		break;
 		
 	}
 }
 
-std::uint32_t culling::EveryCulling::GetRunningThreadCount() const
+std::uint32_t culling::EveryCulling::GetRunningThreadCount(const size_t cameraIndex) const
+{
+	assert(cameraIndex >= 0 && cameraIndex < mCameraCount);
+	return mRunningThreadCount[cameraIndex];
+}
+
+bool culling::EveryCulling::SetSIMDInstructionSet(const culling::SIMDInstructionSet instructionSet)
 {
-	return mRunningThreadCount;
+	if (culling::IsSIMDInstructionSetSupported(instructionSet) == false)
+	{
+		return false;
+	}
+
+	mSIMDInstructionSet = instructionSet;
+	return true;
 }
 
 culling::EntityBlock* culling::EveryCulling::AllocateNewEntityBlockFromPool()
 {
+	std::lock_guard<std::mutex> lock{ mEntityBlockListMutex };
+
 	EntityBlock* const newEntityBlock = GetNewEntityBlockFromPool();
 	newEntityBlock->ClearEntityBlock();
 
-	mActiveEntityBlockList.push_back(newEntityBlock);
+	mPendingEntityBlockList.push_back(newEntityBlock);
 
 	return newEntityBlock;
 }
@@ -242,77 +460,474 @@ culling::EntityBlock* culling::EveryCulling::AllocateNewEntityBlockFromPool()
 
 
 
-culling::EntityBlockViewer culling::EveryCulling::AllocateNewEntity()
+culling::EveryCulling::EntityChangeLock culling::EveryCulling::LockEntityChanges()
 {
-	culling::EntityBlock* targetEntityBlock;
-	if (mActiveEntityBlockList.size() == 0)
+	return EntityChangeLock{ mEntityMovingMutex };
+}
+
+culling::EntityBlockViewer culling::EveryCulling::AllocateNewEntity(const EntityChangeLock& entityChangeLock)
+{
+	assert(entityChangeLock.owns_lock() == true && entityChangeLock.mutex() == &mEntityMovingMutex);
+
+	EntityAllocationSlot& entityAllocationSlot = mEntityAllocationSlots[GetEntityAllocationSlotIndex()];
+	culling::EntityBlock* targetEntityBlock = entityAllocationSlot.mEntityBlock.load(std::memory_order_acquire);
+
+	while (true)
 	{
-		// if Any entityBlock isn't allocated yet
-		targetEntityBlock = AllocateNewEntityBlockFromPool();
+		if (targetEntityBlock != nullptr)
+		{
+			// Pending entity block isn't read by cull job, so entity data can be written without lock.
+			// Entities of it are counted into mCurrentEntityCount at PreCullJob
+			// Entity block applied at PreCullJob is sealed with full count, so late allocation on it takes new block
+			const std::uint32_t entityIndexInBlock = targetEntityBlock->mAllocatedEntityCount.fetch_add(1, std::memory_order_acq_rel);
+			if (entityIndexInBlock < EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK)
+			{
+				// Every entity of new entity block is already marked changed at EntityBlock::ClearEntityBlock
+				return EntityBlockViewer(targetEntityBlock, entityIndexInBlock);
+			}
+		}
+
+		//if entity block of the slot is full of entities
+		//alocate new entity block
+		culling::EntityBlock* const newEntityBlock = AllocateNewEntityBlockFromPool();
+		if (entityAllocationSlot.mEntityBlock.compare_exchange_strong(targetEntityBlock, newEntityBlock, std::memory_order_acq_rel, std::memory_order_acquire) == true)
+		{
+			targetEntityBlock = newEntityBlock;
+		}
+		// Otherwise other thread of the slot replaced the block first and targetEntityBlock is updated to it.
+		// newEntityBlock stays empty and is returned to pool at PreCullJob
 	}
-	else
-	{//When Allocated entity block count is at least one
+}
+
+void culling::EveryCulling::RemoveEntityFromBlock(EntityBlockViewer& entityBlockViewer, const EntityChangeLock& entityChangeLock)
+{
+	assert(entityChangeLock.owns_lock() == true && entityChangeLock.mutex() == &mEntityMovingMutex);
+
+	if(entityBlockViewer.IsValid() == true)
+	{
+		EntityBlock* const ownerEntityBlock = entityBlockViewer.mTargetEntityBlock;
+		const std::uint32_t entityIndexInBlock = static_cast<std::uint32_t>(entityBlockViewer.mEntityIndexInBlock);
+		const std::uint16_t removedEntityBit = static_cast<std::uint16_t>(1 << entityIndexInBlock);
 
-		//Get last entityblock in active entities
-		targetEntityBlock = { mActiveEntityBlockList.back() };
+		ownerEntityBlock->mColdData->mEntityBlockViewers[entityIndexInBlock] = nullptr;
+		entityBlockViewer.DeInitializeEntityBlockViewer();
 
-		if (targetEntityBlock->mCurrentEntityCount == EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK)
+		// Entities aren't moved until PreCullJob, so index of removed entity stays valid
+		const std::uint16_t lastRemovedEntityMask = ownerEntityBlock->mRemovedEntityMask.fetch_or(removedEntityBit, std::memory_order_relaxed);
+		assert((lastRemovedEntityMask & removedEntityBit) == 0);
+		if (lastRemovedEntityMask == 0)
 		{
-			//if last entityblock in active entities is full of entities
-			//alocate new entity block
-			targetEntityBlock = AllocateNewEntityBlockFromPool();
+			std::lock_guard<std::mutex> lock{ mEntityBlockListMutex };
+			mRemovedEntityBlockList.push_back(ownerEntityBlock);
 		}
 	}
 
-	assert(targetEntityBlock->mCurrentEntityCount <= EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK); // something is weird........
-	
-	targetEntityBlock->mCurrentEntityCount++;
-	
-	return EntityBlockViewer(targetEntityBlock, targetEntityBlock->mCurrentEntityCount - 1);
 }
 
-void culling::EveryCulling::RemoveEntityFromBlock(EntityBlockViewer& entityBlockViewer)
+void culling::EveryCulling::ApplyDeferredEntityChanges()
 {
-	if(entityBlockViewer.IsValid() == true)
+	std::unique_lock<std::shared_mutex> entityMovingLock{ mEntityMovingMutex };
+	DoApplyDeferredEntityChanges();
+}
+
+void culling::EveryCulling::DoApplyDeferredEntityChanges()
+{
+	// Pending entity blocks become active below, so next allocation of every slot takes new block
+	for (EntityAllocationSlot& entityAllocationSlot : mEntityAllocationSlots)
 	{
-		RemoveEntityFromBlock(entityBlockViewer.mTargetEntityBlock, entityBlockViewer.mEntityIndexInBlock);
-		entityBlockViewer.DeInitializeEntityBlockViewer();
+		entityAllocationSlot.mEntityBlock.store(nullptr, std::memory_order_release);
+	}
+
+	{
+		std::lock_guard<std::mutex> lock{ mEntityBlockListMutex };
+		mAppliedPendingEntityBlockList.swap(mPendingEntityBlockList);
+		mAppliedRemovedEntityBlockList.swap(mRemovedEntityBlockList);
+	}
+
+	// Partially filled entity block receiving entities of partially filled pending entity blocks,
+	// so entity blocks don't stay sparse when a few entities are allocated every tick
+	EntityBlock* targetEntityBlock = (mActiveEntityBlockList.empty() == false) ? mActiveEntityBlockList.back() : nullptr;
+
+	for (EntityBlock* const pendingEntityBlock : mAppliedPendingEntityBlockList)
+	{
+		// Seal entity block. Thread which loaded it from allocation slot before slot was cleared gets index out of the block and takes new block.
+		// Entities allocated before sealing are counted here
+		const std::uint32_t allocatedEntityCount = pendingEntityBlock->mAllocatedEntityCount.exchange(EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK, std::memory_order_acq_rel);
+		pendingEntityBlock->mCurrentEntityCount = EVERYCULLING_MIN(allocatedEntityCount, (std::uint32_t)EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK);
+		if (pendingEntityBlock->mCurrentEntityCount == 0)
+		{
+			ReleaseEntityBlockToPool(pendingEntityBlock);
+			continue;
+		}
+
+		pendingEntityBlock->mActiveEntityBlockListIndex = static_cast<std::uint32_t>(mActiveEntityBlockList.size());
+		mActiveEntityBlockList.push_back(pendingEntityBlock);
+		mActiveEntityBlockListVersion++;
 	}
 
-	//Don't decrement mEntityGridCell.AllocatedEntityCountInBlocks
-	//Entities Indexs in EntityBlock should not be swapped because already allocated EntityBlockViewer can't see it
+	for (EntityBlock* const removedEntityBlock : mAppliedRemovedEntityBlockList)
+	{
+		const std::uint32_t removedEntityMask = removedEntityBlock->mRemovedEntityMask.exchange(0, std::memory_order_relaxed);
+
+		// Remove from last entity, so last entity filling the hole is never removed one
+		for (std::uint32_t entityIndexInBlock = EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK; entityIndexInBlock-- > 0;)
+		{
+			if ((removedEntityMask & (1u << entityIndexInBlock)) != 0)
+			{
+				RemoveEntityFromBlock(removedEntityBlock, entityIndexInBlock);
+			}
+		}
+	}
+	mAppliedRemovedEntityBlockList.clear();
+
+	for (EntityBlock* const pendingEntityBlock : mAppliedPendingEntityBlockList)
+	{
+		// Released above or all entities were removed
+		if (pendingEntityBlock->bIsValidEntityBlock == false || pendingEntityBlock->mCurrentEntityCount == EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK)
+		{
+			continue;
+		}
+
+		if (targetEntityBlock != nullptr && targetEntityBlock->bIsValidEntityBlock == true && targetEntityBlock != pendingEntityBlock)
+		{
+			while (pendingEntityBlock->mCurrentEntityCount > 0 && targetEntityBlock->mCurrentEntityCount < EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK)
+			{
+				const std::uint32_t lastEntityIndexInBlock = pendingEntityBlock->mCurrentEntityCount - 1;
+				MoveEntity(targetEntityBlock, targetEntityBlock->mCurrentEntityCount, pendingEntityBlock, lastEntityIndexInBlock);
+				pendingEntityBlock->ClearEntityData(lastEntityIndexInBlock);
+
+				targetEntityBlock->mCurrentEntityCount++;
+				pendingEntityBlock->mCurrentEntityCount--;
+			}
+
+			if (pendingEntityBlock->mCurrentEntityCount == 0)
+			{
+				FreeEntityBlock(pendingEntityBlock);
+				continue;
+			}
+		}
+
+		if (targetEntityBlock == nullptr || targetEntityBlock->bIsValidEntityBlock == false || targetEntityBlock->mCurrentEntityCount == EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK)
+		{
+			targetEntityBlock = pendingEntityBlock;
+		}
+	}
+	mAppliedPendingEntityBlockList.clear();
+}
+
+void culling::EveryCulling::UpdateEntityDatas(const EntityDataUpdateBatch& batch, const size_t beginEntityIndex, const size_t endEntityIndex)
+{
+	assert(beginEntityIndex <= endEntityIndex && endEntityIndex <= batch.mEntityCount);
+
+	const bool isModelMatrixUpdated = (batch.mModelMatrixes.IsNull() == false);
+
+	// Entities in a batch are usually sorted by entity block ( ex. allocation order ),
+	// so changed entities of a entity block are marked once with a atomic operation
+	EntityBlock* lastEntityBlock = nullptr;
+	std::uint16_t changedEntityMaskOfLastEntityBlock = 0;
+
+	for (size_t batchIndex = beginEntityIndex; batchIndex < endEntityIndex; batchIndex++)
+	{
+		const EntityBlockViewer& entityBlockViewer = batch.mEntityBlockViewers[batchIndex];
+		if (entityBlockViewer.IsValid() == false)
+		{
+			continue;
+		}
+
+		EntityBlock* const entityBlock = entityBlockViewer.mTargetEntityBlock;
+		const size_t entityIndexInBlock = entityBlockViewer.mEntityIndexInBlock;
+
+		if (entityBlock != lastEntityBlock)
+		{
+			if (lastEntityBlock != nullptr)
+			{
+				lastEntityBlock->MarkEntitiesChanged(changedEntityMaskOfLastEntityBlock);
+			}
+			lastEntityBlock = entityBlock;
+			changedEntityMaskOfLastEntityBlock = 0;
+		}
+
+		bool isChanged = false;
+		if (batch.mWorldPositions.IsNull() == false)
+		{
+			isChanged |= entityBlock->StoreEntityWorldPosition(entityIndexInBlock, &(batch.mWorldPositions[batchIndex]));
+		}
+		if (batch.mAABBMinWorldPoints.IsNull() == false && batch.mAABBMaxWorldPoints.IsNull() == false)
+		{
+			isChanged |= entityBlock->StoreAABBWorldPosition(entityIndexInBlock, &(batch.mAABBMinWorldPoints[batchIndex]), &(batch.mAABBMaxWorldPoints[batchIndex]));
+		}
+		if (isModelMatrixUpdated == true)
+		{
+			entityBlock->StreamModelMatrix(entityIndexInBlock, &(batch.mModelMatrixes[batchIndex]));
+		}
+
+		changedEntityMaskOfLastEntityBlock |= static_cast<std::uint16_t>((std::uint32_t)isChanged << entityIndexInBlock);
+	}
+
+	if (lastEntityBlock != nullptr)
+	{
+		lastEntityBlock->MarkEntitiesChanged(changedEntityMaskOfLastEntityBlock);
+	}
+
+	if (isModelMatrixUpdated == true)
+	{
+		// Non-temporal stores should be visible to cull job threads
+		_mm_sfence();
+	}
+}
+
+void culling::EveryCulling::UpdateEntityDatas(const EntityDataUpdateBatch& batch)
+{
+	UpdateEntityDatas(batch, 0, batch.mEntityCount);
+}
+
+void culling::EveryCulling::RepackEntityBlocks()
+{
+	std::unique_lock<std::shared_mutex> entityMovingLock{ mEntityMovingMutex };
+	DoApplyDeferredEntityChanges();
+
+	struct RepackedEntity
+	{
+		std::uint32_t mMortonCode;
+		EntityBlock* mEntityBlock;
+		std::uint32_t mEntityIndexInBlock;
+	};
+
+	std::vector<RepackedEntity> repackedEntities;
+	culling::Vec3 sceneMinWorldPoint{ FLT_MAX, FLT_MAX, FLT_MAX };
+	culling::Vec3 sceneMaxWorldPoint{ -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+	for (EntityBlock* const entityBlock : mActiveEntityBlockList)
+	{
+		for (std::uint32_t entityIndex = 0; entityIndex < entityBlock->mCurrentEntityCount; entityIndex++)
+		{
+			const culling::Vec3& position = entityBlock->GetEntityWorldPositionAndBoudingSphereRadius(entityIndex).GetPosition();
+			sceneMinWorldPoint.x = EVERYCULLING_MIN(sceneMinWorldPoint.x, position.x);
+			sceneMinWorldPoint.y = EVERYCULLING_MIN(sceneMinWorldPoint.y, position.y);
+			sceneMinWorldPoint.z = EVERYCULLING_MIN(sceneMinWorldPoint.z, position.z);
+			sceneMaxWorldPoint.x = EVERYCULLING_MAX(sceneMaxWorldPoint.x, position.x);
+			sceneMaxWorldPoint.y = EVERYCULLING_MAX(sceneMaxWorldPoint.y, position.y);
+			sceneMaxWorldPoint.z = EVERYCULLING_MAX(sceneMaxWorldPoint.z, position.z);
+
+			repackedEntities.push_back(RepackedEntity{ 0, entityBlock, entityIndex });
+		}
+	}
+
+	if (repackedEntities.empty() == true)
+	{
+		return;
+	}
+
+	// Quantize position in scene bound to 10 bit per axis
+	const float quantizeScaleX = 1023.0f / EVERYCULLING_MAX(sceneMaxWorldPoint.x - sceneMinWorldPoint.x, FLT_MIN);
+	const float quantizeScaleY = 1023.0f / EVERYCULLING_MAX(sceneMaxWorldPoint.y - sceneMinWorldPoint.y, FLT_MIN);
+	const float quantizeScaleZ = 1023.0f / EVERYCULLING_MAX(sceneMaxWorldPoint.z - sceneMinWorldPoint.z, FLT_MIN);
+	for (RepackedEntity& repackedEntity : repackedEntities)
+	{
+		const culling::Vec3& position = repackedEntity.mEntityBlock->GetEntityWorldPositionAndBoudingSphereRadius(repackedEntity.mEntityIndexInBlock).GetPosition();
+		repackedEntity.mMortonCode = culling::ComputeMortonCode
+		(
+			static_cast<std::uint32_t>(culling::CLAMP((position.x - sceneMinWorldPoint.x) * quantizeScaleX, 0.0f, 1023.0f)),
+			static_cast<std::uint32_t>(culling::CLAMP((position.y - sceneMinWorldPoint.y) * quantizeScaleY, 0.0f, 1023.0f)),
+			static_cast<std::uint32_t>(culling::CLAMP((position.z - sceneMinWorldPoint.z) * quantizeScaleZ, 0.0f, 1023.0f))
+		);
+	}
+
+	std::stable_sort
+	(
+		repackedEntities.begin(), repackedEntities.end(),
+		[](const RepackedEntity& a, const RepackedEntity& b)
+		{
+			return a.mMortonCode < b.mMortonCode;
+		}
+	);
+
+	// Entities are moved between active entity blocks, so copy them to temporary blocks first
+	const size_t entityCount = repackedEntities.size();
+	const size_t repackedEntityBlockCount = (entityCount + EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK - 1) / EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK;
+	assert(repackedEntityBlockCount <= mActiveEntityBlockList.size());
+
+	std::unique_ptr<EntityBlock[]> temporaryEntityBlocks{ new EntityBlock[repackedEntityBlockCount] };
+#if EVERYCULLING_SPLIT_COLD_ENTITY_BLOCK_DATA == 1
+	std::unique_ptr<EntityBlockColdData[]> temporaryEntityBlockColdDatas{ new EntityBlockColdData[repackedEntityBlockCount] };
+	for (size_t entityBlockIndex = 0; entityBlockIndex < repackedEntityBlockCount; entityBlockIndex++)
+	{
+		temporaryEntityBlocks[entityBlockIndex].mColdData = temporaryEntityBlockColdDatas.get() + entityBlockIndex;
+	}
+#endif
+	for (size_t entityIndex = 0; entityIndex < entityCount; entityIndex++)
+	{
+		temporaryEntityBlocks[entityIndex / EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK].CopyEntityData
+		(
+			entityIndex % EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK,
+			*(repackedEntities[entityIndex].mEntityBlock),
+			repackedEntities[entityIndex].mEntityIndexInBlock
+		);
+	}
+
+	for (size_t entityBlockIndex = 0; entityBlockIndex < repackedEntityBlockCount; entityBlockIndex++)
+	{
+		EntityBlock* const entityBlock = mActiveEntityBlockList[entityBlockIndex];
+		const EntityBlock& temporaryEntityBlock = temporaryEntityBlocks[entityBlockIndex];
+
+		entityBlock->mCurrentEntityCount = static_cast<std::uint32_t>(EVERYCULLING_MIN(entityCount - entityBlockIndex * EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK, (size_t)EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK));
+		for (std::uint32_t entityIndex = 0; entityIndex < EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK; entityIndex++)
+		{
+			if (entityIndex < entityBlock->mCurrentEntityCount)
+			{
+				entityBlock->CopyEntityData(entityIndex, temporaryEntityBlock, entityIndex);
+
+				EntityBlockViewer* const entityBlockViewer = entityBlock->mColdData->mEntityBlockViewers[entityIndex];
+				if (entityBlockViewer != nullptr)
+				{
+					entityBlockViewer->Relocate(entityBlock, entityIndex);
+				}
+			}
+			else
+			{
+				entityBlock->mColdData->mEntityBlockViewers[entityIndex] = nullptr;
+			}
+		}
+	}
+
+	while (mActiveEntityBlockList.size() > repackedEntityBlockCount)
+	{
+		ReleaseEntityBlockToPool(mActiveEntityBlockList.back());
+		mActiveEntityBlockList.pop_back();
+	}
+
+	// Every entity block has other entities now. Hierarchy should be rebuilt
+	mActiveEntityBlockListVersion++;
+}
+
+void culling::EveryCulling::SetEntityBlockRepackInterval(const std::uint32_t tickInterval)
+{
+	mEntityBlockRepackInterval = tickInterval;
+}
+
+void culling::EveryCulling::DefragmentEntityBlocks()
+{
+	std::unique_lock<std::shared_mutex> entityMovingLock{ mEntityMovingMutex };
+	DoApplyDeferredEntityChanges();
+
+	// Block receiving entities of following half-empty blocks
+	EntityBlock* targetEntityBlock = nullptr;
+	size_t activeEntityBlockCount = 0;
+
+	for (size_t entityBlockIndex = 0; entityBlockIndex < mActiveEntityBlockList.size(); entityBlockIndex++)
+	{
+		EntityBlock* const entityBlock = mActiveEntityBlockList[entityBlockIndex];
+
+		if (entityBlock->mCurrentEntityCount <= EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK / 2)
+		{
+			if (targetEntityBlock != nullptr)
+			{
+				// Move last entities, so remaining entities of the block stay packed
+				while (entityBlock->mCurrentEntityCount > 0 && targetEntityBlock->mCurrentEntityCount < EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK)
+				{
+					const std::uint32_t lastEntityIndexInBlock = entityBlock->mCurrentEntityCount - 1;
+					MoveEntity(targetEntityBlock, targetEntityBlock->mCurrentEntityCount, entityBlock, lastEntityIndexInBlock);
+					entityBlock->ClearEntityData(lastEntityIndexInBlock);
+
+					targetEntityBlock->mCurrentEntityCount++;
+					entityBlock->mCurrentEntityCount--;
+				}
+
+				if (entityBlock->mCurrentEntityCount == 0)
+				{
+					ReleaseEntityBlockToPool(entityBlock);
+					continue;
+				}
+
+				entityBlock->bIsBoundingVolumeDirty = true;
+			}
+
+			if (targetEntityBlock == nullptr || targetEntityBlock->mCurrentEntityCount == EVERYCULLING_ENTITY_COUNT_IN_ENTITY_BLOCK)
+			{
+				targetEntityBlock = entityBlock;
+			}
+		}
+
+		entityBlock->mActiveEntityBlockListIndex = static_cast<std::uint32_t>(activeEntityBlockCount);
+		mActiveEntityBlockList[activeEntityBlockCount] = entityBlock;
+		activeEntityBlockCount++;
+	}
+
+	if (activeEntityBlockCount != mActiveEntityBlockList.size())
+	{
+		mActiveEntityBlockList.resize(activeEntityBlockCount);
+		mActiveEntityBlockListVersion++;
+	}
+}
+
+void culling::EveryCulling::SetEntityBlockDefragmentInterval(const std::uint32_t tickInterval)
+{
+	mEntityBlockDefragmentInterval = tickInterval;
+}
+
+bool culling::EveryCulling::SetEntityBlockArenaNumaPolicy(const EntityBlockArenaNumaPolicy numaPolicy, const std::uint32_t numaNode)
+{
+	return mEntityBlockArena.SetNumaPolicy(numaPolicy, numaNode);
+}
+
+const culling::EntityBlockArena& culling::EveryCulling::GetEntityBlockArena() const
+{
+	return mEntityBlockArena;
 }
 
 culling::EveryCulling::EveryCulling(const std::uint32_t resolutionWidth, const std::uint32_t resolutionHeight)
 	:
+	mCameraCount(0),
+	mHierarchyCulling{ std::make_unique<HierarchyCulling>(this) },
 	mPreCulling{ std::make_unique<PreCulling>(this) },
 	mDistanceCulling{ std::make_unique<DistanceCulling>(this) },
-	mViewFrustumCulling{ std::make_unique<ViewFrustumCulling>(this) }
-#ifdef ENABLE_SCREEN_SAPCE_AABB_CULLING
-	, mScreenSpaceBoudingSphereCulling{ std::make_unique<ScreenSpaceBoundingSphereCulling>(this) }
-#endif
+	mViewFrustumCulling{ std::make_unique<ViewFrustumCulling>(this) },
+	mFusedCulling{ std::make_unique<FusedCulling>(this) },
+	mMultiViewCulling{ std::make_unique<MultiViewCulling>(this) },
+	mShadowCasterCulling{ std::make_unique<ShadowCasterCulling>(this) },
+	mPortalCulling{ std::make_unique<PortalCulling>(this) },
+	mPVSCulling{ std::make_unique<PVSCulling>(this) },
+	mScreenSpaceSizeCulling{ std::make_unique<ScreenSpaceSizeCulling>(this) }
 	, mMaskedSWOcclusionCulling{ std::make_unique<MaskedSWOcclusionCulling>(this, resolutionWidth, resolutionHeight) }
+	, mVisibleEntityCompaction{ std::make_unique<VisibleEntityCompaction>(this) }
 	, mUpdatedCullingModules
 		{
+			mHierarchyCulling.get(),
+			mMultiViewCulling.get(),
+			mFusedCulling.get(),
 			mPreCulling.get(),
 			mDistanceCulling.get(),
 			mViewFrustumCulling.get(),
+			mShadowCasterCulling.get(), // After ViewFrustumCulling, it reads frustum planes extracted by ViewFrustumCulling
+			mPortalCulling.get(), // Before occlusion culling, so entities in culled cells aren't rasterized or queried
+			mPVSCulling.get(), // Before occlusion culling, so static entities not in PVS aren't rasterized or queried
+			mScreenSpaceSizeCulling.get(), // After PreCulling projected screen space aabb, before occlusion culling so tiny entities aren't rasterized or queried
 			mMaskedSWOcclusionCulling.get(), // Choose Role Stage
 			&(mMaskedSWOcclusionCulling->mSolveMeshRoleStage), // Choose Role Stage
 			&(mMaskedSWOcclusionCulling->mBinTrianglesStage), // BinTriangles
 			&(mMaskedSWOcclusionCulling->mRasterizeTrianglesStage), // DrawOccluderStage
-			&(mMaskedSWOcclusionCulling->mQueryOccludeeStage) // QueryOccludeeStage
+			&(mMaskedSWOcclusionCulling->mQueryOccludeeStage), // QueryOccludeeStage
+			mVisibleEntityCompaction.get()
 		}
 #ifdef EVERYCULLING_PROFILING_CULLING
 	, mEveryCullingProfiler{}
 #endif
 	, mCurrentTickCount()
 	, bmIsEntityBlockPoolInitialized(false)
+	, mSIMDInstructionSet{ culling::GetBestSupportedSIMDInstructionSet() }
 	, mEntityBlockUniqueIDCounter{0}
+	, mActiveEntityBlockListVersion{0}
+	, mEntityBlockRepackInterval{0}
+	, mEntityBlockDefragmentInterval{0}
+	, bmIsTemporalCoherenceEnabled{false}
 {
+	SetCameraCount(1);
+
 	//to protect 
 	mFreeEntityBlockList.reserve(EVERYCULLING_INITIAL_ENTITY_BLOCK_RESERVED_SIZE);
 	mActiveEntityBlockList.reserve(EVERYCULLING_INITIAL_ENTITY_BLOCK_RESERVED_SIZE);
+	mPendingEntityBlockList.reserve(EVERYCULLING_ENTITY_ALLOCATION_SLOT_COUNT);
+	mAppliedPendingEntityBlockList.reserve(EVERYCULLING_ENTITY_ALLOCATION_SLOT_COUNT);
 
 	AllocateEntityBlockPool();
 
@@ -322,16 +937,29 @@ culling::EveryCulling::EveryCulling(const std::uint32_t resolutionWidth, const s
 
 culling::EveryCulling::~EveryCulling()
 {
-	for (culling::EntityBlock* allocatedEntityBlockChunk : mAllocatedEntityBlockChunkList)
-	{
-		delete[] allocatedEntityBlockChunk;
-	}
 }
 
 void culling::EveryCulling::SetCameraCount(const size_t cameraCount)
 {
+	assert(cameraCount > 0 && cameraCount <= EVERYCULLING_MAX_CAMERA_COUNT);
+
 	mCameraCount = cameraCount;
 
+	mRunningThreadCount.Resize(cameraCount);
+	mPhaseBarriers.Resize(cameraCount);
+	mCameraModelMatrixes.Resize(cameraCount);
+	mCameraViewProjectionMatrixes.Resize(cameraCount);
+	mCameraWorldPositions.Resize(cameraCount);
+	mCameraRotations.Resize(cameraCount);
+	mCameraFieldOfView.Resize(cameraCount);
+	mFarClipPlaneDistance.Resize(cameraCount);
+	mNearClipPlaneDistance.Resize(cameraCount);
+	mTemporalReferenceCameraDatas.Resize(cameraCount);
+	mIsTemporalReferenceCameraDataValid.Resize(cameraCount);
+	mIsTemporalVisibilityReusable.Resize(cameraCount);
+
+	InvalidateTemporalVisibility();
+
 	for (auto updatedCullingModule : mUpdatedCullingModules)
 	{
 		updatedCullingModule->OnSetCameraCount(cameraCount);
@@ -359,14 +987,14 @@ void culling::EveryCulling::OnEndCullingModule(const culling::CullingModule* con
 
 void culling::EveryCulling::SetViewProjectionMatrix(const size_t cameraIndex, const culling::Mat4x4& viewProjectionMatrix)
 {
-	assert(cameraIndex >= 0 && cameraIndex < EVERYCULLING_MAX_CAMERA_COUNT);
+	assert(cameraIndex >= 0 && cameraIndex < mCameraCount);
 
 	EVERYCULLING_ALIGNMENT_ASSERT(reinterpret_cast<size_t>(&viewProjectionMatrix), 32);
 
-	mCameraViewProjectionMatrixes[cameraIndex] = viewProjectionMatrix;
-	
-	if (cameraIndex >= 0 && cameraIndex < EVERYCULLING_MAX_CAMERA_COUNT)
+	if (cameraIndex >= 0 && cameraIndex < mCameraCount)
 	{
+		mCameraViewProjectionMatrixes[cameraIndex] = viewProjectionMatrix;
+
 		for (auto updatedCullingModule : mUpdatedCullingModules)
 		{
 			updatedCullingModule->OnSetViewProjectionMatrix(cameraIndex, viewProjectionMatrix);
@@ -376,13 +1004,13 @@ void culling::EveryCulling::SetViewProjectionMatrix(const size_t cameraIndex, co
 
 void culling::EveryCulling::SetFieldOfViewInDegree(const size_t cameraIndex, const float fov)
 {
-	assert(cameraIndex >= 0 && cameraIndex < EVERYCULLING_MAX_CAMERA_COUNT);
+	assert(cameraIndex >= 0 && cameraIndex < mCameraCount);
 	assert(fov > 0.0f);
 
-	mCameraFieldOfView[cameraIndex] = fov;
-
-	if (cameraIndex >= 0 && cameraIndex < EVERYCULLING_MAX_CAMERA_COUNT)
+	if (cameraIndex >= 0 && cameraIndex < mCameraCount)
 	{
+		mCameraFieldOfView[cameraIndex] = fov;
+
 		for (auto updatedCullingModule : mUpdatedCullingModules)
 		{
 			updatedCullingModule->OnSetCameraFieldOfView(cameraIndex, fov);
@@ -397,17 +1025,15 @@ void culling::EveryCulling::SetCameraNearFarClipPlaneDistance
 	const float farPlaneDistance
 )
 {
-	assert(cameraIndex >= 0 && cameraIndex < EVERYCULLING_MAX_CAMERA_COUNT);
+	assert(cameraIndex >= 0 && cameraIndex < mCameraCount);
 	assert(nearPlaneDistance > 0.0f);
 	assert(farPlaneDistance > 0.0f);
-	assert(cameraIndex >= 0 && cameraIndex < EVERYCULLING_MAX_CAMERA_COUNT);
-
 
-	mNearClipPlaneDistance[cameraIndex] = nearPlaneDistance;
-	mFarClipPlaneDistance[cameraIndex] = farPlaneDistance;
-
-	if (cameraIndex >= 0 && cameraIndex < EVERYCULLING_MAX_CAMERA_COUNT)
+	if (cameraIndex >= 0 && cameraIndex < mCameraCount)
 	{
+		mNearClipPlaneDistance[cameraIndex] = nearPlaneDistance;
+		mFarClipPlaneDistance[cameraIndex] = farPlaneDistance;
+
 		for (auto updatedCullingModule : mUpdatedCullingModules)
 		{
 			updatedCullingModule->OnSetCameraNearClipPlaneDistance(cameraIndex, nearPlaneDistance);
@@ -418,12 +1044,12 @@ void culling::EveryCulling::SetCameraNearFarClipPlaneDistance
 
 void culling::EveryCulling::SetCameraWorldPosition(const size_t cameraIndex, const culling::Vec3& cameraWorldPos)
 {
-	assert(cameraIndex >= 0 && cameraIndex < EVERYCULLING_MAX_CAMERA_COUNT);
-
-	mCameraWorldPositions[cameraIndex] = cameraWorldPos;
+	assert(cameraIndex >= 0 && cameraIndex < mCameraCount);
 
-	if (cameraIndex >= 0 && cameraIndex < EVERYCULLING_MAX_CAMERA_COUNT)
+	if (cameraIndex >= 0 && cameraIndex < mCameraCount)
 	{
+		mCameraWorldPositions[cameraIndex] = cameraWorldPos;
+
 		for (auto updatedCullingModule : mUpdatedCullingModules)
 		{
 			updatedCullingModule->OnSetCameraWorldPosition(cameraIndex, cameraWorldPos);
@@ -433,12 +1059,12 @@ void culling::EveryCulling::SetCameraWorldPosition(const size_t cameraIndex, con
 
 void culling::EveryCulling::SetCameraRotation(const size_t cameraIndex, const culling::Vec4& cameraRotation)
 {
-	assert(cameraIndex >= 0 && cameraIndex < EVERYCULLING_MAX_CAMERA_COUNT);
-
-	mCameraRotations[cameraIndex] = cameraRotation;
+	assert(cameraIndex >= 0 && cameraIndex < mCameraCount);
 
-	if (cameraIndex >= 0 && cameraIndex < EVERYCULLING_MAX_CAMERA_COUNT)
+	if (cameraIndex >= 0 && cameraIndex < mCameraCount)
 	{
+		mCameraRotations[cameraIndex] = cameraRotation;
+
 		for (auto updatedCullingModule : mUpdatedCullingModules)
 		{
 			updatedCullingModule->OnSetCameraRotation(cameraIndex, cameraRotation);
@@ -446,8 +1072,51 @@ void culling::EveryCulling::SetCameraRotation(const size_t cameraIndex, const cu
 	}
 }
 
+void culling::EveryCulling::UpdateIsTemporalVisibilityReusable(const size_t cameraIndex, const GlobalDataForCullJob& cameraData)
+{
+	assert(cameraIndex >= 0 && cameraIndex < mCameraCount);
+
+	const GlobalDataForCullJob& referenceCameraData = mTemporalReferenceCameraDatas[cameraIndex];
+
+	// Translation of camera only changes last column of view projection matrix.
+	// Then distance to every frustum plane and camera is changed by the translation distance at most
+	const culling::Vec3 cameraMove = cameraData.mCameraWorldPosition - referenceCameraData.mCameraWorldPosition;
+	const bool isReusable =
+		mIsTemporalReferenceCameraDataValid[cameraIndex] == true &&
+		std::memcmp(cameraData.mViewProjectionMatrix.data(), referenceCameraData.mViewProjectionMatrix.data(), sizeof(float) * 12) == 0 &&
+		cameraData.mFieldOfViewInDegree == referenceCameraData.mFieldOfViewInDegree &&
+		cameraData.mCameraNearPlaneDistance == referenceCameraData.mCameraNearPlaneDistance &&
+		cameraData.mCameraFarPlaneDistance == referenceCameraData.mCameraFarPlaneDistance &&
+		cameraMove.magnitude() <= EVERYCULLING_TEMPORAL_COHERENCE_CAMERA_MOVE_THRESHOLD;
+
+	mIsTemporalVisibilityReusable[cameraIndex] = isReusable;
+	if (isReusable == false)
+	{
+		// Culling result of this tick is computed from scratch with this camera data
+		mTemporalReferenceCameraDatas[cameraIndex] = cameraData;
+		mIsTemporalReferenceCameraDataValid[cameraIndex] = true;
+	}
+}
+
+void culling::EveryCulling::InvalidateTemporalVisibility()
+{
+	for (size_t cameraIndex = 0; cameraIndex < mIsTemporalReferenceCameraDataValid.size(); cameraIndex++)
+	{
+		mIsTemporalReferenceCameraDataValid[cameraIndex] = false;
+		mIsTemporalVisibilityReusable[cameraIndex] = false;
+	}
+}
+
+void culling::EveryCulling::SetTemporalCoherenceEnabled(const bool isEnabled)
+{
+	bmIsTemporalCoherenceEnabled = isEnabled;
+	InvalidateTemporalVisibility();
+}
+
 void culling::EveryCulling::UpdateGlobalDataForCullJob(const size_t cameraIndex, const GlobalDataForCullJob& settingParameters)
 {
+	UpdateIsTemporalVisibilityReusable(cameraIndex, settingParameters);
+
 	SetViewProjectionMatrix(cameraIndex, settingParameters.mViewProjectionMatrix);
 	SetFieldOfViewInDegree(cameraIndex, settingParameters.mFieldOfViewInDegree);
 	SetCameraNearFarClipPlaneDistance(cameraIndex, settingParameters.mCameraNearPlaneDistance, settingParameters.mCameraFarPlaneDistance);
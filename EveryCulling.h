@@ -4,9 +4,14 @@
 
 #include "DataType/EntityGridCell.h"
 #include "DataType/EntityBlockViewer.h"
+#include "DataType/EntityDataUpdateBatch.h"
+#include "DataType/EntityBlockArena.h"
+#include "DataType/PerCameraArray.h"
 #include "DataType/Math/Vector.h"
 #include "DataType/Math/Matrix.h"
+#include "DataType/Math/SIMD_Dispatch.h"
 
+#include "EveryCullingPhaseBarrier.h"
 
 #ifdef EVERYCULLING_PROFILING_CULLING
 #include "EveryCullingProfiler.h"
@@ -15,58 +20,149 @@
 #include <array>
 #include <vector>
 #include <memory>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
 
 namespace culling
 {
 	class CullingModule;
 	class ViewFrustumCulling;
-	class ScreenSpaceBoundingSphereCulling;
 	class MaskedSWOcclusionCulling;
 	class QueryOcclusionCulling;
 	class PreCulling;
 	class DistanceCulling;
+	class FusedCulling;
+	class MultiViewCulling;
+	class ShadowCasterCulling;
+	class PortalCulling;
+	class PVSCulling;
+	class ScreenSpaceSizeCulling;
+	class HierarchyCulling;
+	class VisibleEntityCompaction;
 	struct EntityBlock;
 
 	class EveryCulling
 	{
 	private:
 
-		std::atomic<std::uint32_t> mRunningThreadCount;
+		/// <summary>
+		/// Count of threads which entered ThreadCullJob of each camera.
+		/// Cull job of each camera is waited separately, so this should be counted per camera
+		/// </summary>
+		culling::PerCameraArray<std::atomic<std::uint32_t>> mRunningThreadCount;
+		/// <summary>
+		/// Threads of a camera wait other threads at end of each culling module with this barrier
+		/// </summary>
+		mutable culling::PerCameraArray<EveryCullingPhaseBarrier> mPhaseBarriers;
 		
 		size_t mCameraCount;
-		std::array<culling::Mat4x4, EVERYCULLING_MAX_CAMERA_COUNT> mCameraModelMatrixes;
-		std::array<culling::Mat4x4, EVERYCULLING_MAX_CAMERA_COUNT> mCameraViewProjectionMatrixes;
-		std::array<culling::Vec3, EVERYCULLING_MAX_CAMERA_COUNT> mCameraWorldPositions;
-		std::array<culling::Vec4, EVERYCULLING_MAX_CAMERA_COUNT> mCameraRotations;
-		std::array<float, EVERYCULLING_MAX_CAMERA_COUNT> mCameraFieldOfView;
-		std::array<float, EVERYCULLING_MAX_CAMERA_COUNT> mFarClipPlaneDistance;
-		std::array<float, EVERYCULLING_MAX_CAMERA_COUNT> mNearClipPlaneDistance;
+		culling::PerCameraArray<culling::Mat4x4> mCameraModelMatrixes;
+		culling::PerCameraArray<culling::Mat4x4> mCameraViewProjectionMatrixes;
+		culling::PerCameraArray<culling::Vec3> mCameraWorldPositions;
+		culling::PerCameraArray<culling::Vec4> mCameraRotations;
+		culling::PerCameraArray<float> mCameraFieldOfView;
+		culling::PerCameraArray<float> mFarClipPlaneDistance;
+		culling::PerCameraArray<float> mNearClipPlaneDistance;
 
 		bool bmIsEntityBlockPoolInitialized;
 
+		/// <summary>
+		/// Instruction set of entity culling kernels. Widest supported instruction set is picked at constructor
+		/// </summary>
+		culling::SIMDInstructionSet mSIMDInstructionSet;
+
 		/// <summary>
 		/// List of EntityBlock with no entity ( maybe entity was destroyed)
 		/// </summary>
 		std::vector<EntityBlock*> mFreeEntityBlockList;
 		/// <summary>
-		/// List of EntityBlock containing Entities
+		/// List of EntityBlock containing Entities.
+		/// Changed only at PreCullJob, RepackEntityBlocks, DefragmentEntityBlocks, so cull job threads can read it without lock
 		/// </summary>
 		std::vector<EntityBlock*> mActiveEntityBlockList;
 		/// <summary>
-		/// Allocated EntityBlock Arrays
+		/// EntityBlock taken from pool by AllocateNewEntity. Added to mActiveEntityBlockList at PreCullJob
+		/// </summary>
+		std::vector<EntityBlock*> mPendingEntityBlockList;
+		/// <summary>
+		/// EntityBlock with entities removed by RemoveEntityFromBlock ( EntityBlock::mRemovedEntityMask ). Entities are removed at PreCullJob
+		/// </summary>
+		std::vector<EntityBlock*> mRemovedEntityBlockList;
+		/// <summary>
+		/// Protect mFreeEntityBlockList, mPendingEntityBlockList, mRemovedEntityBlockList and growth of mEntityBlockArena.
+		/// Locked once per entity block, not per entity
+		/// </summary>
+		std::mutex mEntityBlockListMutex;
+		/// <summary>
+		/// mPendingEntityBlockList, mRemovedEntityBlockList are swapped with these under lock at ApplyDeferredEntityChanges,
+		/// so entity blocks allocated or removed meanwhile go to lists of next PreCullJob. Capacity is kept between ticks
+		/// </summary>
+		std::vector<EntityBlock*> mAppliedPendingEntityBlockList;
+		std::vector<EntityBlock*> mAppliedRemovedEntityBlockList;
+		/// <summary>
+		/// Locked shared by threads allocating, removing entities ( LockEntityChanges ),
+		/// and locked exclusively while entities are moved ( ApplyDeferredEntityChanges, RepackEntityBlocks, DefragmentEntityBlocks ),
+		/// so EntityBlockViewer isn't relocated while other thread writes or moves it
+		/// </summary>
+		std::shared_mutex mEntityMovingMutex;
+
+		/// <summary>
+		/// Entity block which AllocateNewEntity allocates entities at
+		/// </summary>
+		struct alignas(EVERYCULLING_CACHE_LINE_SIZE) EntityAllocationSlot
+		{
+			std::atomic<EntityBlock*> mEntityBlock{ nullptr };
+		};
+		/// <summary>
+		/// Each thread allocates entities at a slot, so threads allocating at same time rarely touch same entity block
+		/// </summary>
+		std::array<EntityAllocationSlot, EVERYCULLING_ENTITY_ALLOCATION_SLOT_COUNT> mEntityAllocationSlots;
+		/// <summary>
+		/// Every EntityBlock is allocated from here.
 		/// This objects will be released at destructor
 		/// </summary>
-		std::vector<EntityBlock*> mAllocatedEntityBlockChunkList;
+		EntityBlockArena mEntityBlockArena;
 
 		std::uint64_t mEntityBlockUniqueIDCounter;
+		/// <summary>
+		/// Incremented when entity block is added to or removed from mActiveEntityBlockList
+		/// </summary>
+		std::uint64_t mActiveEntityBlockListVersion;
+		/// <summary>
+		/// RepackEntityBlocks is called at PreCullJob every this count of ticks. 0 : disabled
+		/// </summary>
+		std::uint32_t mEntityBlockRepackInterval;
+		/// <summary>
+		/// DefragmentEntityBlocks is called at PreCullJob every this count of ticks. 0 : disabled
+		/// </summary>
+		std::uint32_t mEntityBlockDefragmentInterval;
 		
 		void AllocateEntityBlockPool();
+		/// <summary>
+		/// Get cleared entity block from pool and add it to mPendingEntityBlockList. Thread safe
+		/// </summary>
 		culling::EntityBlock* AllocateNewEntityBlockFromPool();
+		/// <summary>
+		/// Body of ApplyDeferredEntityChanges. mEntityMovingMutex should be locked exclusively
+		/// </summary>
+		void DoApplyDeferredEntityChanges();
+		/// <summary>
+		/// Fill removed entity with last entity of the block, so entities of the block stay packed
+		/// </summary>
 		void RemoveEntityFromBlock(EntityBlock* ownerEntityBlock, std::uint32_t entityIndexInBlock);
 		/// <summary>
+		/// Copy entity to other index ( or other block ) and relocate EntityBlockViewer of it
+		/// </summary>
+		void MoveEntity(EntityBlock* const dstEntityBlock, const std::uint32_t dstEntityIndexInBlock, EntityBlock* const srcEntityBlock, const std::uint32_t srcEntityIndexInBlock);
+		/// <summary>
 		/// Block Swap removedblock with last block, and return swapped lastblock to pool
 		/// </summary>
 		void FreeEntityBlock(EntityBlock* freedEntityBlock);
+		/// <summary>
+		/// Return block already removed from mActiveEntityBlockList to pool. Thread safe
+		/// </summary>
+		void ReleaseEntityBlockToPool(EntityBlock* const releasedEntityBlock);
 		EntityBlock* GetNewEntityBlockFromPool();
 
 		void ResetCullingModules();
@@ -77,10 +173,42 @@ namespace culling
 
 	public:
 
+		/// <summary>
+		/// Reject subtree of bounding volume hierarchy over entity blocks before DistanceCulling, ViewFrustumCulling. Disabled by default
+		/// </summary>
+		std::unique_ptr<HierarchyCulling> mHierarchyCulling;
 		std::unique_ptr<PreCulling> mPreCulling;
 		std::unique_ptr<DistanceCulling> mDistanceCulling;
 		std::unique_ptr<ViewFrustumCulling> mViewFrustumCulling;
+		/// <summary>
+		/// Do PreCulling, DistanceCulling, ViewFrustumCulling in one pass. Disabled by default
+		/// </summary>
+		std::unique_ptr<FusedCulling> mFusedCulling;
+		/// <summary>
+		/// Do PreCulling, DistanceCulling, ViewFrustumCulling of every camera in one pass. Disabled by default
+		/// </summary>
+		std::unique_ptr<MultiViewCulling> mMultiViewCulling;
+		/// <summary>
+		/// Cull shadow casters of shadow views with frustum of their receiver camera. Disabled by default
+		/// </summary>
+		std::unique_ptr<ShadowCasterCulling> mShadowCasterCulling;
+		/// <summary>
+		/// Cull entities in cells which can't be seen through portals from cell of camera. Disabled by default
+		/// </summary>
+		std::unique_ptr<PortalCulling> mPortalCulling;
+		/// <summary>
+		/// Cull static entities not in potentially visible set of cell of camera baked by PVSBaker. Disabled by default
+		/// </summary>
+		std::unique_ptr<PVSCulling> mPVSCulling;
+		/// <summary>
+		/// Cull entities whose screen space aabb is smaller than min screen space size of camera or entity. Disabled by default
+		/// </summary>
+		std::unique_ptr<ScreenSpaceSizeCulling> mScreenSpaceSizeCulling;
 		std::unique_ptr<MaskedSWOcclusionCulling> mMaskedSWOcclusionCulling;
+		/// <summary>
+		/// Write user data of visible entities of each camera to compact array after every other culling module. Disabled by default
+		/// </summary>
+		std::unique_ptr<VisibleEntityCompaction> mVisibleEntityCompaction;
 
 #ifdef EVERYCULLING_PROFILING_CULLING
 		EveryCullingProfiler mEveryCullingProfiler;
@@ -96,6 +224,14 @@ namespace culling
 		void OnStartCullingModule(const culling::CullingModule* const cullingModule);
 		// this function is called by multiple threads
 		void OnEndCullingModule(const culling::CullingModule* const cullingModule);
+		/// <summary>
+		/// Caller thread will stall until all running threads of the camera finish the culling module
+		/// </summary>
+		void WaitToFinishCullingModule(const size_t cameraIndex, const culling::CullingModule* const cullingModule) const;
+		/// <summary>
+		/// Run the culling module of the camera if it's enabled, and wait until all running threads of the camera finish it
+		/// </summary>
+		void RunCullingModule(const size_t cameraIndex, const std::uint32_t threadIndex, const unsigned long long currentTickCount, culling::CullingModule* const cullingModule);
 		
 		void SetViewProjectionMatrix(const size_t cameraIndex, const culling::Mat4x4& viewProjectionMatrix);
 		void SetFieldOfViewInDegree(const size_t cameraIndex, const float fov);
@@ -110,7 +246,42 @@ namespace culling
 			PreCulling,
 			ViewFrustumCulling,
 			MaskedSWOcclusionCulling,
-			DistanceCulling
+			DistanceCulling,
+			/// <summary>
+			/// While FusedCulling is enabled, PreCulling, DistanceCulling, ViewFrustumCulling don't run.
+			/// Their enabled state isn't changed, so they run again as set when FusedCulling is disabled
+			/// </summary>
+			FusedCulling,
+			/// <summary>
+			/// While MultiViewCulling is enabled, DistanceCulling, ViewFrustumCulling, FusedCulling don't run
+			/// and PreCulling always runs to project aabb of entities. Their enabled state isn't changed.
+			/// Cull job should be run with ThreadMultiViewCullJob while it's enabled
+			/// </summary>
+			MultiViewCulling,
+			/// <summary>
+			/// Shadow views are set with mShadowCasterCulling
+			/// </summary>
+			ShadowCasterCulling,
+			/// <summary>
+			/// Cell graph and cell of entities are set with mPortalCulling, EntityBlockViewer::SetCellIndex
+			/// </summary>
+			PortalCulling,
+			/// <summary>
+			/// Bake file and PVS index of entities are set with mPVSCulling, EntityBlockViewer::SetPVSIndex
+			/// </summary>
+			PVSCulling,
+			/// <summary>
+			/// Min screen space size of cameras and entities are set with mScreenSpaceSizeCulling, EntityBlockViewer::SetMinScreenSpaceSize
+			/// </summary>
+			ScreenSpaceSizeCulling,
+			/// <summary>
+			/// When HierarchyCulling is disabled, every entity block is tested one by one
+			/// </summary>
+			HierarchyCulling,
+			/// <summary>
+			/// Result is read with mVisibleEntityCompaction after cull job is finished
+			/// </summary>
+			VisibleEntityCompaction
 		};
 
 		EveryCulling() = delete;
@@ -120,6 +291,10 @@ namespace culling
 
 		~EveryCulling();
 
+		/// <summary>
+		/// Per camera state is sized to camera count ( 1 by default ), up to EVERYCULLING_MAX_CAMERA_COUNT.
+		/// Call before camera data is set with UpdateGlobalDataForCullJob and while cull job isn't running
+		/// </summary>
 		void SetCameraCount(const size_t cameraCount);
 
 		unsigned long long GetTickCount() const;
@@ -134,6 +309,25 @@ namespace culling
 			culling::Vec4 mCameraRotation;
 		};
 
+	private:
+
+		bool bmIsTemporalCoherenceEnabled;
+		/// <summary>
+		/// Camera data when distance, view frustum culling result of mTemporalVisibleBitflag started to be reused
+		/// </summary>
+		culling::PerCameraArray<GlobalDataForCullJob> mTemporalReferenceCameraDatas;
+		culling::PerCameraArray<bool> mIsTemporalReferenceCameraDataValid;
+		culling::PerCameraArray<bool> mIsTemporalVisibilityReusable;
+
+		void UpdateIsTemporalVisibilityReusable(const size_t cameraIndex, const GlobalDataForCullJob& cameraData);
+
+	public:
+
+		/// <summary>
+		/// Culling result of last tick isn't reused at next tick. Called when culling modules or their settings are changed
+		/// </summary>
+		void InvalidateTemporalVisibility();
+
 		/**
 		 * \brief Update global data for cull job. Should be called every frame.
 		 * \param cameraIndex 
@@ -147,32 +341,32 @@ namespace culling
 		}
 		EVERYCULLING_FORCE_INLINE const culling::Vec3& GetCameraWorldPosition(const size_t cameraIndex) const
 		{
-			assert(cameraIndex >= 0 && cameraIndex < EVERYCULLING_MAX_CAMERA_COUNT);
+			assert(cameraIndex >= 0 && cameraIndex < mCameraCount);
 			return mCameraWorldPositions[cameraIndex];
 		}
 		EVERYCULLING_FORCE_INLINE const culling::Mat4x4& GetCameraModelMatrix(const size_t cameraIndex) const
 		{
-			assert(cameraIndex >= 0 && cameraIndex < EVERYCULLING_MAX_CAMERA_COUNT);
+			assert(cameraIndex >= 0 && cameraIndex < mCameraCount);
 			return mCameraModelMatrixes[cameraIndex];
 		}
 		EVERYCULLING_FORCE_INLINE const culling::Mat4x4& GetCameraViewProjectionMatrix(const size_t cameraIndex) const
 		{
-			assert(cameraIndex >= 0 && cameraIndex < EVERYCULLING_MAX_CAMERA_COUNT);
+			assert(cameraIndex >= 0 && cameraIndex < mCameraCount);
 			return mCameraViewProjectionMatrixes[cameraIndex];
 		}
 		EVERYCULLING_FORCE_INLINE float GetCameraFieldOfView(const size_t cameraIndex) const
 		{
-			assert(cameraIndex >= 0 && cameraIndex < EVERYCULLING_MAX_CAMERA_COUNT);
+			assert(cameraIndex >= 0 && cameraIndex < mCameraCount);
 			return mCameraFieldOfView[cameraIndex];
 		}
 		EVERYCULLING_FORCE_INLINE float GetCameraFarClipPlaneDistance(const size_t cameraIndex) const
 		{
-			assert(cameraIndex >= 0 && cameraIndex < EVERYCULLING_MAX_CAMERA_COUNT);
+			assert(cameraIndex >= 0 && cameraIndex < mCameraCount);
 			return mFarClipPlaneDistance[cameraIndex];
 		}
 		EVERYCULLING_FORCE_INLINE float GetCameraNearClipPlaneDistance(const size_t cameraIndex) const
 		{
-			assert(cameraIndex >= 0 && cameraIndex < EVERYCULLING_MAX_CAMERA_COUNT);
+			assert(cameraIndex >= 0 && cameraIndex < mCameraCount);
 			return mNearClipPlaneDistance[cameraIndex];
 		}
 		
@@ -182,29 +376,117 @@ namespace culling
 		/// <returns></returns>
 		const std::vector<EntityBlock*>& GetActiveEntityBlockList() const;
 		size_t GetActiveEntityBlockCount() const;
+		EVERYCULLING_FORCE_INLINE std::uint64_t GetActiveEntityBlockListVersion() const
+		{
+			return mActiveEntityBlockListVersion;
+		}
+
+		using EntityChangeLock = std::shared_lock<std::shared_mutex>;
+
+		/// <summary>
+		/// Lock shared to allocate, remove entities.
+		/// Entities are moved and their EntityBlockViewer is relocated at PreCullJob ( or ApplyDeferredEntityChanges, RepackEntityBlocks, DefragmentEntityBlocks ),
+		/// so they wait until every returned lock is released, and this waits until they finish.
+		/// Keep the lock while setting data of allocated entity and moving its EntityBlockViewer.
+		/// Don't call this on thread calling PreCullJob while holding the lock
+		/// </summary>
+		EntityChangeLock LockEntityChanges();
 
 		/// <summary>
 		/// You should call this function on your Transform Component or In your game engine
 		///
-		/// increment EntityCountInBlock of TargetBlock.
-		/// If All blocks is full, Get new block from Block Pool
+		/// Entity is allocated at entity block of allocation slot of caller thread.
+		/// If the block is full, Get new block from Block Pool
 		/// 
-		/// Allocating New Entity isn't thread safe
+		/// Thread safe. Can be called from multiple threads while cull job is running.
+		/// Entity block of allocated entity is added to active entity block list at next PreCullJob, so the entity is culled from next tick.
 		/// </summary>
-		EntityBlockViewer AllocateNewEntity();
+		/// <param name="entityChangeLock">Lock returned by LockEntityChanges</param>
+		EntityBlockViewer AllocateNewEntity(const EntityChangeLock& entityChangeLock);
 
 		/// <summary>
 		/// You should call this function on your Transform Component or In your game engine
 		/// 
-		/// Remove Entity is nothing, Just decrement AllocatedEntityCountInBlocks
-		/// And if AllocatedEntityCountInBlocks Of Block become zero, Remove the block using RemoveBlock function
+		/// Entity is removed at next PreCullJob.
+		/// Last entity of the block is moved to index of removed entity and its EntityBlockViewer is updated.
+		/// And if entity count of block become zero, the block is returned to pool
+		/// 
+		/// Thread safe. Can be called from multiple threads while cull job is running.
+		/// </summary>
+		/// <param name="entityChangeLock">Lock returned by LockEntityChanges</param>
+		void RemoveEntityFromBlock(EntityBlockViewer& entityBlockViewer, const EntityChangeLock& entityChangeLock);
+
+		/// <summary>
+		/// Apply entity allocations and removals deferred to next PreCullJob now ( ex. after loading scene ).
+		/// Wait until every lock of LockEntityChanges is released. Don't call this while cull job is running
+		/// </summary>
+		void ApplyDeferredEntityChanges();
+
+		/// <summary>
+		/// Update position, aabb, model matrix of entities in [beginEntityIndex, endEntityIndex) of the batch.
+		/// Same result with calling EntityBlockViewer's setters for each entity, but change of entities in a entity block is marked at once
+		/// and model matrixes are written with non-temporal stores.
+		/// 
+		/// Can be called from multiple threads with disjoint ranges of a batch ( or different batches of different entities ).
+		/// Don't call this while cull job is running, and don't remove entities of the batch at same time
+		/// </summary>
+		void UpdateEntityDatas(const EntityDataUpdateBatch& batch, const size_t beginEntityIndex, const size_t endEntityIndex);
+		void UpdateEntityDatas(const EntityDataUpdateBatch& batch);
+
+		/// <summary>
+		/// Move entities to entity blocks in morton order of their world position,
+		/// so entities in a entity block are close to each other and the block can be culled at once.
+		/// Unneeded entity blocks are returned to pool.
+		/// EntityBlockViewer of moved entities is updated.
+		/// 
+		/// Call this when cull job isn't running ( ex. after loading scene ). Wait until every lock of LockEntityChanges is released
+		/// </summary>
+		void RepackEntityBlocks();
+
+		/// <summary>
+		/// Call RepackEntityBlocks at PreCullJob every tickInterval ticks.
+		/// Entities allocated later are appended to last entity block until next repack.
+		/// 0 disables repacking ( default )
+		/// </summary>
+		void SetEntityBlockRepackInterval(const std::uint32_t tickInterval);
+
+		/// <summary>
+		/// Merge entities of half-empty entity blocks to preceding half-empty block in active entity block list,
+		/// so culling modules don't walk mostly empty blocks after many entities are removed.
+		/// Near blocks in the list have close entities after RepackEntityBlocks, so locality is mostly preserved.
+		/// EntityBlockViewer of moved entities is updated.
 		/// 
-		/// Removing Entity isn't thread safe
+		/// Call this when cull job isn't running. Wait until every lock of LockEntityChanges is released
+		/// </summary>
+		void DefragmentEntityBlocks();
+
+		/// <summary>
+		/// Call DefragmentEntityBlocks at PreCullJob every tickInterval ticks.
+		/// 0 disables defragmentation ( default )
+		/// </summary>
+		void SetEntityBlockDefragmentInterval(const std::uint32_t tickInterval);
+
+		/// <summary>
+		/// Set where memory of entity blocks is placed on NUMA system ( EntityBlockArenaNumaPolicy ).
+		/// Already allocated entity blocks are moved if possible.
+		/// Return false if OS doesn't support the policy
+		/// </summary>
+		bool SetEntityBlockArenaNumaPolicy(const EntityBlockArenaNumaPolicy numaPolicy, const std::uint32_t numaNode = 0);
+		/// <summary>
+		/// Entity blocks are addressable by index with EntityBlockArena::GetEntityBlock
 		/// </summary>
-		void RemoveEntityFromBlock(EntityBlockViewer& entityBlockViewer);
+		const EntityBlockArena& GetEntityBlockArena() const;
 		
 		void ThreadCullJob(const size_t cameraIndex, const unsigned long long tickCount);
 		//void ThreadCullJob(const std::uint32_t threadIndex, const std::uint32_t threadCount);
+		/// <summary>
+		/// Cull job of every camera. Use this instead of ThreadCullJob when MultiViewCulling is enabled.
+		/// Call this from every thread working on cull job, then WaitToFinishCullJobOfAllCameras works same.
+		///
+		/// HierarchyCulling and MultiViewCulling run for every camera first, so each entity block is tested for all cameras at once.
+		/// Screen space aabb of entities is shared by cameras, so PreCulling and later culling modules run camera by camera
+		/// </summary>
+		void ThreadMultiViewCullJob(const unsigned long long tickCount);
 
 		/// <summary>
 		/// Caller thread will stall until cull job of all entity block is finished
@@ -226,9 +508,43 @@ namespace culling
 			};
 		}
 
+		/// <summary>
+		/// Whether the culling module runs at cull job.
+		/// Enabled culling module doesn't run while FusedCulling or MultiViewCulling does its work
+		/// </summary>
+		bool IsCullingModuleRunning(const culling::CullingModule* const cullingModule) const;
 		const culling::CullingModule* GetLastEnabledCullingModule() const;
 		void SetEnabledCullingModule(const CullingModuleType cullingModuleType, const bool isEnabled);
-		std::uint32_t GetRunningThreadCount() const;
+		std::uint32_t GetRunningThreadCount(const size_t cameraIndex) const;
+
+		EVERYCULLING_FORCE_INLINE culling::SIMDInstructionSet GetSIMDInstructionSet() const
+		{
+			return mSIMDInstructionSet;
+		}
+		/// <summary>
+		/// Reuse distance, view frustum culling result of last tick for entities whose data isn't changed
+		/// while camera moved less than EVERYCULLING_TEMPORAL_COHERENCE_CAMERA_MOVE_THRESHOLD without rotation, projection change.
+		/// Cull job should run every tick while it's enabled. Disabled by default
+		/// </summary>
+		void SetTemporalCoherenceEnabled(const bool isEnabled);
+		EVERYCULLING_FORCE_INLINE bool IsTemporalCoherenceEnabled() const
+		{
+			return bmIsTemporalCoherenceEnabled;
+		}
+		/// <summary>
+		/// Whether mTemporalVisibleBitflag of entity blocks can be reused for the camera at this tick
+		/// </summary>
+		EVERYCULLING_FORCE_INLINE bool IsTemporalVisibilityReusable(const size_t cameraIndex) const
+		{
+			assert(cameraIndex >= 0 && cameraIndex < mCameraCount);
+			return bmIsTemporalCoherenceEnabled == true && mIsTemporalVisibilityReusable[cameraIndex] == true;
+		}
+
+		/// <summary>
+		/// Pin instruction set of entity culling kernels. Return false if cpu or this build doesn't support it
+		/// Don't call this function while cull job is running
+		/// </summary>
+		bool SetSIMDInstructionSet(const culling::SIMDInstructionSet instructionSet);
 
 	};
 }
@@ -25,7 +25,7 @@
 #endif
 
 #ifndef EVERYCULLING_MIN3
-#define EVERYCULLING_MIN3(A, B) EVERYCULLING_MIN(A, EVERYCULLING_MIN(B, C))
+#define EVERYCULLING_MIN3(A, B, C) EVERYCULLING_MIN(A, EVERYCULLING_MIN(B, C))
 #endif
 
 #ifndef EVERYCULLING_ABS
@@ -76,20 +76,150 @@
 #define EVERYCULLING_INITIAL_ENTITY_BLOCK_RESERVED_SIZE 512
 #endif
 
+// 1 : aabb, model matrix, mesh of entities are allocated at array parallel to entity block array ( EntityBlockColdData ),
+// so entity blocks walked by culling modules every frame are compact
+#ifndef EVERYCULLING_SPLIT_COLD_ENTITY_BLOCK_DATA
+#define EVERYCULLING_SPLIT_COLD_ENTITY_BLOCK_DATA 1
+#endif
+
+// Maximum entity block count of EntityBlockArena. Address space for it is reserved at once, and physical memory is committed on demand
+#ifndef EVERYCULLING_ENTITY_BLOCK_ARENA_MAX_ENTITY_BLOCK_COUNT
+#define EVERYCULLING_ENTITY_BLOCK_ARENA_MAX_ENTITY_BLOCK_COUNT ((size_t)1 << 18)
+#endif
+
+// EntityBlockArena commits memory in this unit and advises OS to back it with huge pages
+#ifndef EVERYCULLING_HUGE_PAGE_SIZE
+#define EVERYCULLING_HUGE_PAGE_SIZE ((size_t)2 * 1024 * 1024)
+#endif
+
+// Threads allocating entities are spread over this count of slots. Each slot fills its own entity block
+#ifndef EVERYCULLING_ENTITY_ALLOCATION_SLOT_COUNT
+#define EVERYCULLING_ENTITY_ALLOCATION_SLOT_COUNT 16
+#endif
+
+// Visibility of each camera is a bit of entity. Per camera state is sized to camera count set at runtime ( EveryCulling::SetCameraCount )
 #ifndef EVERYCULLING_MAX_CAMERA_COUNT
-#define EVERYCULLING_MAX_CAMERA_COUNT 5
+#define EVERYCULLING_MAX_CAMERA_COUNT 8
 #endif
 
+#if EVERYCULLING_MAX_CAMERA_COUNT < 1 || EVERYCULLING_MAX_CAMERA_COUNT > 64
+#error EVERYCULLING_MAX_CAMERA_COUNT should be in [1, 64]
+#endif
+
+// Visibility bits of 8 cameras ( camera group ) are stored at a byte of entity, so entity culling kernels handle 16 entities with a 16 byte vector
+#define EVERYCULLING_CAMERA_GROUP_SIZE 8
+#define EVERYCULLING_CAMERA_GROUP_COUNT ((EVERYCULLING_MAX_CAMERA_COUNT + EVERYCULLING_CAMERA_GROUP_SIZE - 1) / EVERYCULLING_CAMERA_GROUP_SIZE)
+
 #ifndef EVERYCULLING_MAX_THREAD_COUNT
 #define EVERYCULLING_MAX_THREAD_COUNT 10
 #endif
 
+///////////////////////////////////////////////////////////////////////////////////////
+//Cull Job
+
+// Set to 1 by build system when AVX512 kernels are compiled ( EntityCullingKernel_AVX512.cpp )
+#ifndef EVERYCULLING_AVX512_KERNEL
+#define EVERYCULLING_AVX512_KERNEL 0
+#endif
+
+// Count of _mm_pause before waiting thread start to yield
+#ifndef EVERYCULLING_PHASE_BARRIER_SPIN_COUNT
+#define EVERYCULLING_PHASE_BARRIER_SPIN_COUNT 1024
+#endif
+
+// Count of std::this_thread::yield before waiting thread is parked
+#ifndef EVERYCULLING_PHASE_BARRIER_YIELD_COUNT
+#define EVERYCULLING_PHASE_BARRIER_YIELD_COUNT 64
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////
+//Hierarchy Culling
+
+// Hierarchy is split into about this count of subtrees. Threads of a camera pop subtree one by one
+#ifndef EVERYCULLING_HIERARCHY_CULLING_SUBTREE_COUNT
+#define EVERYCULLING_HIERARCHY_CULLING_SUBTREE_COUNT 64
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////
+//Visible Entity Compaction
+
+// Count of user datas in a chunk of visible entities claimed by a cull job thread
+#ifndef EVERYCULLING_VISIBLE_ENTITY_CHUNK_CAPACITY
+#define EVERYCULLING_VISIBLE_ENTITY_CHUNK_CAPACITY 1024
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////////////
 //ViewFrustum Culling
 #ifndef EVERYCULLING_BOUNDING_SPHRE_RADIUS_MARGIN
 #define EVERYCULLING_BOUNDING_SPHRE_RADIUS_MARGIN 0.1f
 #endif
 
+///////////////////////////////////////////////////////////////////////////////////////
+//Temporal Coherence
+
+// Distance, view frustum culling result of last tick is reused while camera moved less than this distance without rotation.
+// Reused result is different from result of this tick by this distance at most
+#ifndef EVERYCULLING_TEMPORAL_COHERENCE_CAMERA_MOVE_THRESHOLD
+#define EVERYCULLING_TEMPORAL_COHERENCE_CAMERA_MOVE_THRESHOLD EVERYCULLING_BOUNDING_SPHRE_RADIUS_MARGIN
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////
+//Portal Culling
+
+// Cell index of entities which aren't in any cell of cell graph. PortalCulling doesn't cull them
+#ifndef EVERYCULLING_INVALID_CELL_INDEX
+#define EVERYCULLING_INVALID_CELL_INDEX (std::uint32_t)0xFFFFFFFF
+#endif
+
+// Max count of portals on a path from cell of camera. Cell graph with cycles is walked until this depth
+#ifndef EVERYCULLING_PORTAL_CULLING_MAX_PORTAL_DEPTH
+#define EVERYCULLING_PORTAL_CULLING_MAX_PORTAL_DEPTH 32
+#endif
+
+// Max vertex count of portal polygon clipped by view frustum. Frustum isn't narrowed through portal exceeding it
+#ifndef EVERYCULLING_PORTAL_CULLING_MAX_CLIPPED_VERTEX_COUNT
+#define EVERYCULLING_PORTAL_CULLING_MAX_CLIPPED_VERTEX_COUNT 32
+#endif
+
+// Max count of cells visited by walk of cell graph of a camera at a tick. If walk exceeds it, entities of the camera aren't culled at the tick
+#ifndef EVERYCULLING_PORTAL_CULLING_MAX_CELL_VISIT_COUNT
+#define EVERYCULLING_PORTAL_CULLING_MAX_CELL_VISIT_COUNT 4096
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////
+//PVS Culling
+
+// PVS index of entities which aren't baked to PVS ( dynamic entities ). PVSCulling doesn't cull them
+#ifndef EVERYCULLING_INVALID_PVS_INDEX
+#define EVERYCULLING_INVALID_PVS_INDEX (std::uint32_t)0xFFFFFFFF
+#endif
+
+// Identifies PVS bake file ( "EVPV" ). Version is increased when layout of bake file is changed
+#define EVERYCULLING_PVS_BAKE_FILE_MAGIC (std::uint32_t)0x56505645
+#define EVERYCULLING_PVS_BAKE_FILE_VERSION (std::uint32_t)1
+
+///////////////////////////////////////////////////////////////////////////////////////
+//Screen Space Size Culling
+
+// Min screen space size of entities seen from camera in pixels of depth buffer, until it's set with ScreenSpaceSizeCulling::SetMinScreenSpaceSize
+#ifndef EVERYCULLING_DEFAULT_MIN_SCREEN_SPACE_SIZE
+#define EVERYCULLING_DEFAULT_MIN_SCREEN_SPACE_SIZE 1.0f
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////
+//LOD Selection
+
+// Max LOD count of entity. LOD index of each camera is selected in PreCulling from area of screen space aabb.
+// 1 compiles out LOD selection and LOD index array of EntityBlock ( EVERYCULLING_MAX_CAMERA_COUNT * 16 bytes ),
+// ex. when cold data isn't split and EntityBlock with many cameras doesn't fit in a page
+#ifndef EVERYCULLING_MAX_LOD_COUNT
+#define EVERYCULLING_MAX_LOD_COUNT 4
+#endif
+
+#if EVERYCULLING_MAX_LOD_COUNT < 1 || EVERYCULLING_MAX_LOD_COUNT > 255
+#error EVERYCULLING_MAX_LOD_COUNT should be in [1, 255]
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////////////
 //Masked SW Occlusion Culling
 
@@ -166,6 +296,32 @@
 
 #endif
 
+// Occlusion cost model ( OcclusionCostModel, disabled by default )
+// Occlusion culling is skipped for camera when fewer entities than this survive culling modules before it
+#ifndef EVERYCULLING_DEFAULT_OCCLUSION_CULLING_MIN_SURVIVED_ENTITY_COUNT
+#define EVERYCULLING_DEFAULT_OCCLUSION_CULLING_MIN_SURVIVED_ENTITY_COUNT 64
+#endif
+
+// Render time saved by an occluded entity in nanoseconds, until it's set with OcclusionCostModel::SetOccludedEntitySavedTime
+#ifndef EVERYCULLING_DEFAULT_OCCLUDED_ENTITY_SAVED_TIME
+#define EVERYCULLING_DEFAULT_OCCLUDED_ENTITY_SAVED_TIME 1000.0f
+#endif
+
+// Occlusion culling skipped for this many consecutive bin cycles runs once to measure its benefit again
+#ifndef EVERYCULLING_DEFAULT_OCCLUSION_COST_MODEL_PROBE_INTERVAL
+#define EVERYCULLING_DEFAULT_OCCLUSION_COST_MODEL_PROBE_INTERVAL 16
+#endif
+
+// Binned indice budget smaller than this skips occlusion culling, as few triangles rarely occlude anything
+#ifndef EVERYCULLING_OCCLUSION_COST_MODEL_MIN_BINNED_INDICE_COUNT
+#define EVERYCULLING_OCCLUSION_COST_MODEL_MIN_BINNED_INDICE_COUNT (std::uint64_t)360
+#endif
+
+// Weight of newest measurement in running averages of cost model
+#ifndef EVERYCULLING_OCCLUSION_COST_MODEL_SMOOTHING
+#define EVERYCULLING_OCCLUSION_COST_MODEL_SMOOTHING 0.125f
+#endif
+
 // Distance Culling
 #ifndef EVERYCULLING_DEFAULT_DESIRED_MAX_DRAW_DISTANCE
 #define EVERYCULLING_DEFAULT_DESIRED_MAX_DRAW_DISTANCE 10000.0f
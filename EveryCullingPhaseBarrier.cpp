@@ -0,0 +1,16 @@
+#include "EveryCullingPhaseBarrier.h"
+
+culling::EveryCullingPhaseBarrier::EveryCullingPhaseBarrier()
+	: mMutex{}, mConditionVariable{}, mParkedThreadCount{ 0 }
+{
+
+}
+
+void culling::EveryCullingPhaseBarrier::Notify()
+{
+	if (mParkedThreadCount.load(std::memory_order_seq_cst) != 0)
+	{
+		std::lock_guard<std::mutex> lock{ mMutex };
+		mConditionVariable.notify_all();
+	}
+}
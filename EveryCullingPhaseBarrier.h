@@ -0,0 +1,76 @@
+#pragma once
+
+#include "EveryCullingCore.h"
+
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <immintrin.h>
+
+namespace culling
+{
+	/// <summary>
+	/// Barrier between culling modules of a camera.
+	///
+	/// Waiting thread spins for a while, then yields, then parks on condition variable.
+	/// So waiting threads don't burn cores of job system when other threads take long time.
+	/// Thread which changes the phase condition should call Notify to wake up parked threads
+	/// </summary>
+	class EveryCullingPhaseBarrier
+	{
+	private:
+
+		std::mutex mMutex;
+		std::condition_variable mConditionVariable;
+		std::atomic<std::uint32_t> mParkedThreadCount;
+
+	public:
+
+		EveryCullingPhaseBarrier();
+		EveryCullingPhaseBarrier(const EveryCullingPhaseBarrier&) = delete;
+		EveryCullingPhaseBarrier& operator=(const EveryCullingPhaseBarrier&) = delete;
+
+		/// <summary>
+		/// Caller thread will stall until isPhaseFinished returns true
+		/// isPhaseFinished should read atomic variables with sequentially consistent ordering
+		/// </summary>
+		template <typename PREDICATE>
+		void Wait(const PREDICATE& isPhaseFinished)
+		{
+			for (std::uint32_t spinCount = 0; spinCount < EVERYCULLING_PHASE_BARRIER_SPIN_COUNT; spinCount++)
+			{
+				if (isPhaseFinished() == true)
+				{
+					return;
+				}
+				_mm_pause();
+			}
+
+			for (std::uint32_t yieldCount = 0; yieldCount < EVERYCULLING_PHASE_BARRIER_YIELD_COUNT; yieldCount++)
+			{
+				if (isPhaseFinished() == true)
+				{
+					return;
+				}
+				std::this_thread::yield();
+			}
+
+			std::unique_lock<std::mutex> lock{ mMutex };
+			// Parked thread count is increased before checking condition.
+			// So notifier which changed condition after this always see parked thread
+			mParkedThreadCount.fetch_add(1, std::memory_order_seq_cst);
+			while (isPhaseFinished() == false)
+			{
+				mConditionVariable.wait(lock);
+			}
+			mParkedThreadCount.fetch_sub(1, std::memory_order_relaxed);
+		}
+
+		/// <summary>
+		/// Wake up parked threads.
+		/// Should be called after changing phase condition with sequentially consistent ordering
+		/// </summary>
+		void Notify();
+	};
+}
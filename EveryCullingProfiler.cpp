@@ -10,7 +10,7 @@ void culling::EveryCullingProfiler::SetStartTime(const char* const cullingModule
 	{
 		IsLocalThreadRecordProfilingData = true;
 
-		mProfilingDatas[std::string_view{ cullingModuleName }].mStartTime = std::chrono::high_resolution_clock::now();
+		mProfilingDatas[std::string_view{ cullingModuleName }].mStartTime = std::chrono::steady_clock::now();
 	}
 	
 }
@@ -21,7 +21,7 @@ void culling::EveryCullingProfiler::SetEndTime(const char* const cullingModuleNa
 	{
 		ProfilingData& profilingData = mProfilingDatas[std::string_view{ cullingModuleName }];
 
-		profilingData.mEndTime = std::chrono::high_resolution_clock::now();
+		profilingData.mEndTime = std::chrono::steady_clock::now();
 		profilingData.mElapsedTime = std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(profilingData.mEndTime - profilingData.mStartTime).count();
 
 		IsLocalThreadRecordProfilingData = false;